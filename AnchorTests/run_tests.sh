@@ -0,0 +1,45 @@
+#!/bin/sh
+#
+# Tests of the anchor ids given to headings and table captions.
+#
+# usage: ./run_tests.sh ../multimarkdown
+#
+# Ids made from repeated text get the first free suffix of "-1", "-2",
+# ..., skipping ids that are already taken, in document order.  Ids
+# given in the document ("# Summary [intro]") are kept as they are, and
+# generated ids never take them.
+
+MMD=${1:-../multimarkdown}
+failures=0
+
+fail() {
+	echo "FAILED: $1"
+	failures=`expr $failures + 1`
+}
+
+# ids FORMAT FILE - the anchor ids in FILE converted to FORMAT, on a line
+ids() {
+	case $1 in
+	html)	"$MMD" "$2" | grep -o 'id="[^"]*"' | sed 's/id="\(.*\)"/\1/' ;;
+	latex)	"$MMD" -t latex "$2" | grep -o 'label{[^}]*}' | sed 's/label{\(.*\)}/\1/' ;;
+	odf)	"$MMD" -t odf "$2" | grep -o '<text:bookmark text:name="[^"]*"' | sed 's/.*name="\(.*\)"/\1/' ;;
+	esac | tr '\n' ' ' | sed 's/ $//'
+}
+
+# expect FILE IDS - check the ids of FILE in every format that prints them
+expect() {
+	for format in html latex odf; do
+		got=`ids $format $1`
+		[ "$got" = "$2" ] || fail "$1 in $format: got \"$got\", wanted \"$2\""
+	done
+}
+
+expect repeated.text "intro-1 intro intro-2 intro-3 intro-4 results results-1"
+expect explicit.text "intro-1 intro intro-2 intro-3 intro"
+
+if [ $failures -eq 0 ]; then
+	echo "All anchor id tests passed."
+	exit 0
+fi
+echo "$failures anchor id tests failed."
+exit 1
@@ -14,6 +14,9 @@
 #include <string.h>
 #include <stdarg.h>
 
+/* Not declared by <stdio.h> under -ansi */
+extern int vsnprintf(char *str, size_t size, const char *format, va_list ap);
+
 /*
  * The following section came from:
  *
@@ -75,6 +78,25 @@ GString* g_string_new(char *startingString)
 	return newString;
 }
 
+/* Like g_string_new(""), but with room for startingBufferSize characters
+   before the buffer has to grow */
+GString* g_string_sized_new(size_t startingBufferSize)
+{
+	GString* newString = malloc(sizeof(GString));
+
+	if (startingBufferSize < kStringBufferStartingSize)
+	{
+		startingBufferSize = kStringBufferStartingSize;
+	}
+
+	newString->str = malloc(startingBufferSize + 1);
+	newString->currentStringBufferSize = startingBufferSize + 1;
+	newString->str[0] = '\0';
+	newString->currentStringLength = 0;
+
+	return newString;
+}
+
 char* g_string_free(GString* ripString, bool freeCharacterData)
 {	
 	char* returnedString = ripString->str;
@@ -111,14 +133,23 @@ static void ensureStringBufferCanHold(GString* baseString, size_t newStringSize)
 
 void g_string_append(GString* baseString, char* appendedString)
 {
-	if ((appendedString != NULL) && (strlen(appendedString) > 0))
+	if (appendedString != NULL)
+	{
+		g_string_append_len(baseString, appendedString, strlen(appendedString));
+	}
+}
+
+/* Append the first appendedStringLength characters of appendedString,
+   which need not be NUL-terminated */
+void g_string_append_len(GString* baseString, char* appendedString, size_t appendedStringLength)
+{
+	if (appendedStringLength > 0)
 	{
-		size_t appendedStringLength = strlen(appendedString);
 		size_t newStringLength = baseString->currentStringLength + appendedStringLength;
 		ensureStringBufferCanHold(baseString, newStringLength);
 
-		/* We already know where the current string ends, so pass that as the starting address for strncat */
-		strncat(baseString->str + baseString->currentStringLength, appendedString, appendedStringLength);
+		memcpy(baseString->str + baseString->currentStringLength, appendedString, appendedStringLength);
+		baseString->str[newStringLength] = '\0';
 		baseString->currentStringLength = newStringLength;
 	}
 }
@@ -133,19 +164,51 @@ void g_string_append_c(GString* baseString, char appendedCharacter)
 	baseString->str[baseString->currentStringLength] = '\0';
 }
 
+/* Append appendedNumber in decimal, without going through printf */
+void g_string_append_int(GString* baseString, int appendedNumber)
+{
+	char digits[16];
+	char* start = digits + sizeof(digits);
+	unsigned int magnitude = (appendedNumber < 0) ? 0u - (unsigned int) appendedNumber : (unsigned int) appendedNumber;
+
+	do
+	{
+		*--start = '0' + magnitude % 10;
+		magnitude /= 10;
+	} while (magnitude != 0);
+	if (appendedNumber < 0)
+	{
+		*--start = '-';
+	}
+	g_string_append_len(baseString, start, digits + sizeof(digits) - start);
+}
+
+/* Format straight into the end of the buffer; only output that does not
+   fit in the space left is formatted a second time, once the buffer has
+   grown to hold it */
 void g_string_append_printf(GString* baseString, char* format, ...)
 {
 	va_list args;
+	size_t available = baseString->currentStringBufferSize - baseString->currentStringLength;
+	int formattedLength;
+
 	va_start(args, format);
-	
-	char* formattedString = NULL;
-	vasprintf(&formattedString, format, args);
-	if (formattedString != NULL)
+	formattedLength = vsnprintf(baseString->str + baseString->currentStringLength, available, format, args);
+	va_end(args);
+	if (formattedLength < 0)
 	{
-		g_string_append(baseString, formattedString);
-		free(formattedString);
+		baseString->str[baseString->currentStringLength] = '\0';
+		return;
 	}
-} 
+	if ((size_t) formattedLength >= available)
+	{
+		ensureStringBufferCanHold(baseString, baseString->currentStringLength + formattedLength);
+		va_start(args, format);
+		vsnprintf(baseString->str + baseString->currentStringLength, formattedLength + 1, format, args);
+		va_end(args);
+	}
+	baseString->currentStringLength += formattedLength;
+}
 
 void g_string_prepend(GString* baseString, char* prependedString)
 {
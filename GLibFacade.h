@@ -43,10 +43,18 @@ typedef struct
 } GString;
 
 GString* g_string_new(char *startingString);
+GString* g_string_sized_new(size_t startingBufferSize);
 char* g_string_free(GString* ripString, bool freeCharacterData);
 
 void g_string_append_c(GString* baseString, char appendedCharacter);
 void g_string_append(GString* baseString, char *appendedString);
+void g_string_append_len(GString* baseString, char *appendedString, size_t appendedStringLength);
+void g_string_append_int(GString* baseString, int appendedNumber);
+
+/* Append a string literal, whose length is known at compile time.  The
+   empty strings make anything but a literal fail to compile. */
+#define g_string_append_literal(baseString, literal) \
+	g_string_append_len((baseString), "" literal "", sizeof("" literal "") - 1)
 
 void g_string_prepend(GString* baseString, char* prependedString);
 
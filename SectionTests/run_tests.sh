@@ -0,0 +1,117 @@
+#!/bin/sh
+#
+# Tests of parsing a document a section at a time on several threads.
+# Each document is converted with -j 1 and with -j 4 in every format,
+# and the two must be the same.
+#
+# usage: ./run_tests.sh ../multimarkdown
+#
+# Only documents of 128 KB or more are split.  Sections are at least
+# 64 KB long and start at an ATX heading that follows a blank line (see
+# find_sections() in markdown_lib.c), so the documents are built from
+# 1 KB blocks of filler with the cases below placed around 64 KB, 128 KB
+# and so on.
+
+MMD=${1:-../multimarkdown}
+DIR=${TMPDIR:-/tmp}/mmd-section-test.$$
+FORMATS="html latex memoir beamer odf opml"
+failures=0
+
+mkdir "$DIR" || exit 1
+trap 'rm -rf "$DIR"' 0
+
+fail() {
+	echo "FAILED: $1"
+	failures=`expr $failures + 1`
+}
+
+# filler NAME COUNT - COUNT headed paragraphs of about 1 KB
+filler() {
+	awk -v name="$1" -v count=$2 'BEGIN {
+		for (i = 1; i <= count; i++) {
+			printf "## %s %d\n\n", name, i
+			for (j = 0; j < 12; j++)
+				printf "Some *filler* text about %s, paragraph %d, with a [link](http://example.com/%d).\n", name, i, i
+			printf "\n"
+		}
+	}'
+}
+
+# loose_list COUNT - a list of COUNT items, each with a second paragraph
+# and a code block
+loose_list() {
+	awk -v count=$1 'BEGIN {
+		for (i = 1; i <= count; i++) {
+			printf "%d. Item %d of a long list.\n\n", i, i
+			printf "    A second paragraph of item %d, which is indented.\n\n", i
+			printf "        code in item %d\n\n", i
+		}
+	}'
+}
+
+# code_block COUNT - a code block of COUNT lines, with blank lines
+code_block() {
+	awk -v count=$1 'BEGIN {
+		for (i = 1; i <= count; i++) {
+			printf "    # comment %d in a code block\n    x = %d;\n", i, i
+			if (i % 10 == 0)
+				printf "\n"
+		}
+		printf "\n"
+	}'
+}
+
+# html_block COUNT - a div holding COUNT lines that would be ATX headings
+# outside of it, each after a blank line
+html_block() {
+	awk -v count=$1 'BEGIN {
+		printf "<div>\n\n"
+		for (i = 1; i <= count; i++)
+			printf "# Not a heading %d\n\nRaw text %d inside the div, which is not parsed as markdown.\n\n", i, i
+		printf "</div>\n\n"
+	}'
+}
+
+# A list and a code block across the first two split points, and a div
+# across the third.  The section that starts inside the div is parsed
+# again from the end of the div.
+{
+	filler "Opening" 50
+	loose_list 250
+	filler "Middle" 30
+	code_block 1000
+	filler "Later" 55
+	html_block 150
+	filler "Closing" 60
+} >"$DIR/blocks.text"
+
+# Metadata, whose footer must end up after the last section.
+{
+	printf "Title:  Sections\nAuthor: A. Writer\nCSS:    style.css\n\n"
+	filler "Chapter" 260
+} >"$DIR/metadata.text"
+
+# A div longer than a section, so a whole section lies inside it and
+# the one after it is parsed again from the end of the div.
+{
+	filler "Before" 60
+	html_block 1600
+	filler "After" 100
+} >"$DIR/swallowed.text"
+
+for doc in blocks metadata swallowed; do
+	size=`wc -c <"$DIR/$doc.text"`
+	[ $size -ge 131072 ] || fail "$doc.text is only $size bytes"
+	for format in $FORMATS; do
+		"$MMD" -j 1 -t $format "$DIR/$doc.text" >"$DIR/want" || fail "$doc.text to $format with -j 1"
+		"$MMD" -j 4 -t $format "$DIR/$doc.text" >"$DIR/got" || fail "$doc.text to $format with -j 4"
+		cmp -s "$DIR/want" "$DIR/got" || fail "$doc.text in $format differs with -j 4"
+	done
+done
+
+if [ $failures -eq 0 ]; then
+	echo "All section tests passed."
+	exit 0
+fi
+echo "$failures section tests failed."
+exit 1
@@ -0,0 +1,53 @@
+#!/bin/sh
+#
+# Tests of the files written by --save-tree and read by --from-tree.
+#
+# usage: ./run_tests.sh ../multimarkdown
+#
+# The cyclic files are made by hand from a saved one, by pointing a
+# record back at the first element of the document.  Offsets are those
+# of tree_file.c: a 44-byte header, then 20-byte element records whose
+# last two fields are 'children' and 'next'.  Index 0 is written as four
+# zero bytes in either byte order.
+
+MMD=${1:-../multimarkdown}
+TREE=${TMPDIR:-/tmp}/mmd-tree-test.$$
+failures=0
+
+trap 'rm -f "$TREE" "$TREE.bad" "$TREE.want" "$TREE.got"' 0
+
+fail() {
+	echo "FAILED: $1"
+	failures=`expr $failures + 1`
+}
+
+# point_at_first - copy the saved tree, with the 4 bytes at offset $1
+# set to index 0
+point_at_first() {
+	cp "$TREE" "$TREE.bad"
+	printf '\000\000\000\000' | dd of="$TREE.bad" bs=1 seek=$1 conv=notrunc 2>/dev/null
+}
+
+"$MMD" --save-tree="$TREE" notes.text || fail "saving notes.text"
+
+for format in html latex odf; do
+	"$MMD" -t $format notes.text >"$TREE.want"
+	"$MMD" --from-tree -t $format "$TREE" >"$TREE.got"
+	cmp -s "$TREE.want" "$TREE.got" || fail "$format from the saved tree differs"
+done
+
+point_at_first 60
+"$MMD" --from-tree "$TREE.bad" >/dev/null 2>&1 && fail "first element as its own next was read"
+
+point_at_first 56
+"$MMD" --from-tree "$TREE.bad" >/dev/null 2>&1 && fail "first element as its own child was read"
+
+point_at_first 120
+"$MMD" --from-tree "$TREE.bad" >/dev/null 2>&1 && fail "cycle through the fourth element was read"
+
+if [ $failures -eq 0 ]; then
+	echo "All tree file tests passed."
+	exit 0
+fi
+echo "$failures tree file tests failed."
+exit 1
@@ -23,10 +23,19 @@
 #include <string.h>
 #include <assert.h>
 #include <getopt.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <pthread.h>
+#endif
 #include "glib.h"
 #include "markdown_peg.h"
+#include "output_cache.h"
 
 static int extensions;
+static output_cache *cache;     /* Cache of earlier conversions, if any. */
 
 /**********************************************************************
 
@@ -43,6 +52,23 @@ static int extensions;
                   "original Copyright (c) 2008-2009 John MacFarlane.  License GPLv2+ or MIT.\n" \
                   "This is free software: you are free to change and redistribute it.\n" \
                   "There is NO WARRANTY, to the extent permitted by law."
+#define MAX_FORMATS 4           /* One for each extension an output file can have. */
+
+/* Format of the output kept in the cache.  Bump it with every change to
+   the parser or the writers that changes the output for some input, so
+   that conversions cached by an older program are not reused. */
+#define OUTPUT_CACHE_FORMAT 1
+
+#define STRINGIFY(x) STRINGIFY_VALUE(x)
+#define STRINGIFY_VALUE(x) #x
+
+/* Hashed into every cache key. */
+#define CACHE_SALT VERSION " format " STRINGIFY(OUTPUT_CACHE_FORMAT)
+
+/* Values getopt_long returns for options that have no short form */
+#define OPT_CACHE 1
+#define OPT_CACHE_SIZE 2
+#define OPT_SAVE_TREE 3
 
 /* print version and copyright information */
 void version(const char *progname)
@@ -67,13 +93,24 @@ Help Options:\n\
 Application Options:\n\
   -v, --version           print version and exit\n\
   -o, --output=FILE       send output to FILE (default is stdout)\n\
-  -t, --to=FORMAT         convert to FORMAT (default is html)\n\
+  -t, --to=FORMAT         convert to FORMAT (default is html); a comma\n\
+                          separated list converts to each of them\n\
   -x, --extensions        use all syntax extensions\n\
   --filter-html           filter out raw HTML (except styles)\n\
   --filter-styles         filter out HTML styles\n\
   -c, --compatibility     markdown compatibility mode\n\
   -b, --batch             process multiple files automatically\n\
   -e, --extract           extract and display specified metadata\n\
+  -j, --jobs=N            use up to N threads (in batch mode, convert up to\n\
+                          N files at a time)\n\
+  --cache=DIR             reuse conversions of unchanged input cached in DIR\n\
+  --cache-size=N          keep at most N megabytes in the cache (default 256,\n\
+                          0 for no limit)\n\
+  --cache-stats           report cache hits and misses on stderr\n\
+  --save-tree=FILE        parse the input and save the document to FILE,\n\
+                          instead of converting it\n\
+  --from-tree             convert a document saved with --save-tree, without\n\
+                          parsing it again\n\
 \n\
 Syntax extensions\n\
   --smart --nosmart       toggle smart typography extension\n\
@@ -84,22 +121,477 @@ Converts text in specified files (or stdin) from markdown to FORMAT.\n\
 Available FORMATs:  html, latex, memoir, beamer, odf, opml\n");
 }
 
+/* input_text - the NUL-terminated contents of an input */
+typedef struct {
+    char *text;
+    size_t mapped;          /* Length of the mapping holding 'text', or 0
+                               if 'text' was read into malloc'd memory. */
+} input_text;
+
+/* read_input - load everything that can be read from 'fd' into 'in'.
+ * A regular file is mapped instead of copied when its length is not a
+ * multiple of the page size, since the rest of the last page then reads
+ * as zeros and terminates the text.  Anything else is read in as few
+ * read() calls as possible, into a buffer sized by fstat() (which only
+ * has to grow for pipes and terminals).  Returns false, with errno set,
+ * on failure. */
+static bool read_input(int fd, input_text *in) {
+    struct stat info;
+    size_t size;
+    size_t len = 0;
+    ssize_t count;
+    char *buf;
+
+    in->text = NULL;
+    in->mapped = 0;
+    if (fstat(fd, &info) != 0)
+        return false;
+#ifndef _WIN32
+    if (S_ISREG(info.st_mode) && info.st_size > 0
+        && info.st_size % sysconf(_SC_PAGESIZE) != 0) {
+        buf = mmap(NULL, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (buf != MAP_FAILED) {
+            in->text = buf;
+            in->mapped = info.st_size;
+            return true;
+        }
+    }
+#endif
+    size = (S_ISREG(info.st_mode) && info.st_size > 0) ? info.st_size + 1 : 65536;
+    buf = malloc(size);
+    for (;;) {
+        if (len + 1 == size) {
+            size *= 2;
+            buf = realloc(buf, size);
+        }
+        count = read(fd, buf + len, size - len - 1);
+        if (count < 0) {
+            if (errno == EINTR)
+                continue;
+            free(buf);
+            return false;
+        }
+        if (count == 0)
+            break;
+        len += count;
+    }
+    buf[len] = '\0';
+    in->text = buf;
+    return true;
+}
+
+/* open_input - read the file at 'path' into 'in', reporting any error */
+static bool open_input(char *path, input_text *in) {
+    int fd;
+    bool ok;
+
+    if ((fd = open(path, O_RDONLY)) < 0) {
+        perror(path);
+        return false;
+    }
+    ok = read_input(fd, in);
+    if (!ok)
+        perror(path);
+    close(fd);
+    return ok;
+}
+
+/* free_input - release the contents of an input */
+static void free_input(input_text *in) {
+#ifndef _WIN32
+    if (in->mapped != 0) {
+        munmap(in->text, in->mapped);
+        return;
+    }
+#endif
+    free(in->text);
+}
+
+/* batch_file - one file of a batch conversion */
+typedef struct batch_file {
+    char *path;
+    char **outputs;         /* Names of the files the conversions to each
+                               format are written to. */
+    int index;              /* Position on the command line. */
+    off_t size;             /* Size of this file and of every file after it
+                               in the 'same_output' chain. */
+    struct batch_file *same_output;  /* Next file on the command line that
+                                        writes to the same output file. */
+} batch_file;
+
+/* batch_queue - the files of a batch, shared by all of its workers */
+typedef struct {
+    batch_file **files;     /* First file of each output, largest first. */
+    int count;
+    int next;               /* Index in 'files' of the next file to hand out. */
+    int failures;
+    int *formats;
+    int format_count;
+#ifndef _WIN32
+    pthread_mutex_t lock;
+#endif
+} batch_queue;
+
+/* format_extension - file name extension for output in 'output_format' */
+static char *format_extension(int output_format) {
+    if (output_format == HTML_FORMAT) {
+        return ".html";
+    } else if (output_format == OPML_FORMAT) {
+        return ".opml";
+    } else if (output_format == ODF_FORMAT) {
+        return ".fodt";
+    } else {
+        return ".tex";
+    }
+}
+
+/* batch_output_name - name of the file that batch mode writes the
+ * conversion of 'path' to: 'path' without its extension, plus one that
+ * fits 'output_format'. */
+static char *batch_output_name(char *path, int output_format) {
+    GString *file;
+    char *dot = strrchr(path, '.');
+    size_t len = (dot != NULL && dot != path) ? (size_t)(dot - path) : strlen(path);
+
+    file = g_string_sized_new(len + 6);
+    g_string_append_len(file, path, len);
+    g_string_append(file, format_extension(output_format));
+    return g_string_free(file, false);
+}
+
+/* write_output - write the conversion 'out' to the file 'path', reporting
+ * any error.  Returns false if it could not be written. */
+static bool write_output(char *path, char *out) {
+    FILE *output;
+
+    if (!(output = fopen(path, "w"))) {
+        perror(path);
+        return false;
+    }
+    fprintf(output, "%s\n", out);
+    if (ferror(output) | (fclose(output) != 0)) {
+        perror(path);
+        return false;
+    }
+    return true;
+}
+
+/* write_to_file - mmd_write_fn that writes to the FILE 'data' */
+static void write_to_file(const char *text, size_t len, void *data) {
+    fwrite(text, 1, len, (FILE *)data);
+}
+
+/* stream_text - convert 'text' to 'format' and write it to the file 'path'
+ * (stdout if it is NULL or "-") as it is printed, using up to 'jobs'
+ * threads to parse it.  Only used without a cache, which needs the whole
+ * output.  Returns false, after reporting the error, if the output could
+ * not be written. */
+static bool stream_text(char *text, int format, int jobs, char *path) {
+    mmd_parser_t *parser;
+    FILE *output;
+    bool to_stdout = (path == NULL || strcmp(path, "-") == 0);
+
+    if (to_stdout) {
+        output = stdout;
+        path = "stdout";
+    } else if (!(output = fopen(path, "w"))) {
+        perror(path);
+        return false;
+    }
+    parser = mmd_parser_new();
+    mmd_parser_set_jobs(parser, jobs);
+    mmd_parser_write(parser, text, extensions, format, write_to_file, output);
+    mmd_parser_free(parser);
+    fputc('\n', output);
+    if (ferror(output) | (fclose(output) != 0)) {
+        perror(path);
+        return false;
+    }
+    return true;
+}
+
+/* convert_text - convert 'text' to each of the 'count' formats in
+ * 'formats'.  Conversions found in the cache are taken from it; for the
+ * rest the text is parsed once, using up to 'jobs' threads, and their
+ * output is added to the cache.  Returns an array of 'count' strings;
+ * free each of them and the array after use. */
+static char **convert_text(char *text, int *formats, int count, int jobs) {
+    char **outs = malloc(count * sizeof(char *));
+    char key_space[MAX_FORMATS][OUTPUT_CACHE_KEY_SIZE];
+    char *keys[MAX_FORMATS];
+    int missing[MAX_FORMATS];   /* formats not found in the cache */
+    int missing_count = 0;
+    GString **converted;
+    mmd_parser_t *parser;
+    int i, j;
+
+    if (cache != NULL) {
+        for (i = 0; i < count; i++)
+            keys[i] = key_space[i];
+        output_cache_keys(cache, keys, text, strlen(text), extensions, formats, count);
+    }
+    for (i = 0; i < count; i++) {
+        outs[i] = (cache != NULL) ? output_cache_get(cache, keys[i]) : NULL;
+        if (outs[i] == NULL)
+            missing[missing_count++] = formats[i];
+    }
+    if (missing_count == 0)
+        return outs;
+
+    parser = mmd_parser_new();
+    mmd_parser_set_jobs(parser, jobs);
+    converted = mmd_parser_to_g_strings(parser, text, extensions, missing, missing_count);
+    mmd_parser_free(parser);
+    for (i = 0, j = 0; i < count; i++) {
+        if (outs[i] != NULL)
+            continue;
+        if (cache != NULL)
+            output_cache_put(cache, keys[i], converted[j]->str, converted[j]->currentStringLength);
+        outs[i] = g_string_free(converted[j++], false);
+    }
+    free(converted);
+    return outs;
+}
+
+/* convert_tree_file - convert the document saved in the tree file at
+ * 'path' to each of the 'count' formats in 'formats', without parsing it.
+ * Returns an array of 'count' strings, as convert_text does, or NULL
+ * after reporting an error. */
+static char **convert_tree_file(char *path, int *formats, int count) {
+    mmd_document_t *doc;
+    char **outs;
+    int i;
+
+    if ((doc = mmd_document_load(path)) == NULL) {
+        perror(path);
+        return NULL;
+    }
+    outs = malloc(count * sizeof(char *));
+    for (i = 0; i < count; i++)
+        outs[i] = g_string_free(mmd_document_to_g_string(doc, formats[i], 0), false);
+    mmd_document_free(doc);
+    return outs;
+}
+
+/* write_outputs - write each of the 'count' conversions in 'outs', to the
+ * corresponding formats in 'formats', to the file 'output_path' (stdout
+ * if it is NULL or "-").  Several conversions go to files named after
+ * 'output_path', with the extension of each format.  Frees the
+ * conversions.  Returns false if any could not be written. */
+static bool write_outputs(char **outs, int *formats, int count, char *output_path) {
+    FILE *output;
+    char *path;
+    bool ok = true;
+    int i;
+
+    if (count == 1 && (output_path == NULL || strcmp(output_path, "-") == 0)) {
+        fprintf(stdout, "%s\n", outs[0]);
+        fclose(stdout);
+    } else if (count == 1) {
+        if (!(output = fopen(output_path, "w"))) {
+            perror(output_path);
+            ok = false;
+        } else {
+            fprintf(output, "%s\n", outs[0]);
+            fclose(output);
+        }
+    } else {
+        for (i = 0; i < count; i++) {
+            path = batch_output_name(output_path, formats[i]);
+            if (!write_output(path, outs[i]))
+                ok = false;
+            free(path);
+        }
+    }
+    for (i = 0; i < count; i++)
+        free(outs[i]);
+    free(outs);
+    return ok;
+}
+
+/* convert_batch_file - convert one file of a batch to each of the
+ * 'format_count' formats in 'formats', parsing it at most once and
+ * reporting any error.  Returns false if the file could not be
+ * converted. */
+static bool convert_batch_file(batch_file *f, int *formats, int format_count) {
+    input_text input;
+    char **outs;
+    bool ok = true;
+    int i;
+
+    if (!open_input(f->path, &input))
+        return false;
+
+    if (cache == NULL && format_count == 1) {
+        ok = stream_text(input.text, formats[0], 1, f->outputs[0]);
+        free_input(&input);
+        return ok;
+    }
+
+    outs = convert_text(input.text, formats, format_count, 1);
+    for (i = 0; i < format_count; i++) {
+        if (!write_output(f->outputs[i], outs[i]))
+            ok = false;
+        free(outs[i]);
+    }
+    free(outs);
+    free_input(&input);
+    return ok;
+}
+
+/* batch_worker - convert files from 'arg', a batch_queue, until none are
+ * left.  Each worker takes the next file as soon as it is done with the
+ * previous one, so a few large files do not hold up the small ones. */
+static void *batch_worker(void *arg) {
+    batch_queue *queue = arg;
+    batch_file *f;
+    int failures = 0;
+
+    for (;;) {
+#ifndef _WIN32
+        pthread_mutex_lock(&queue->lock);
+#endif
+        f = (queue->next < queue->count) ? queue->files[queue->next++] : NULL;
+#ifndef _WIN32
+        pthread_mutex_unlock(&queue->lock);
+#endif
+        if (f == NULL)
+            break;
+        /* Files writing the same output are converted in command line
+           order, so the last one wins as it does in serial mode. */
+        for (; f != NULL; f = f->same_output)
+            if (!convert_batch_file(f, queue->formats, queue->format_count))
+                failures++;
+    }
+
+#ifndef _WIN32
+    pthread_mutex_lock(&queue->lock);
+#endif
+    queue->failures += failures;
+#ifndef _WIN32
+    pthread_mutex_unlock(&queue->lock);
+#endif
+    return NULL;
+}
+
+static int compare_batch_output(const void *a, const void *b) {
+    const batch_file *x = *(batch_file * const *)a;
+    const batch_file *y = *(batch_file * const *)b;
+    int c = strcmp(x->outputs[0], y->outputs[0]);
+    return (c != 0) ? c : x->index - y->index;
+}
+
+static int compare_batch_size(const void *a, const void *b) {
+    const batch_file *x = *(batch_file * const *)a;
+    const batch_file *y = *(batch_file * const *)b;
+    if (x->size != y->size)
+        return (x->size > y->size) ? -1 : 1;
+    return x->index - y->index;
+}
+
+/* convert_batch - convert each of the 'count' files in 'paths' to an
+ * output file of its own for each of the 'format_count' formats in
+ * 'formats', using up to 'jobs' threads.  With a single job the files are
+ * converted in command line order.  Returns the number of files that
+ * could not be converted. */
+static int convert_batch(char **paths, int count, int jobs, int *formats, int format_count) {
+    batch_file *files = malloc(count * sizeof(batch_file));
+    batch_queue queue;
+    struct stat info;
+    int i, j, heads;
+
+    queue.files = malloc(count * sizeof(batch_file *));
+    queue.next = 0;
+    queue.failures = 0;
+    queue.formats = formats;
+    queue.format_count = format_count;
+
+    for (i = 0; i < count; i++) {
+        files[i].path = paths[i];
+        files[i].outputs = malloc(format_count * sizeof(char *));
+        for (j = 0; j < format_count; j++)
+            files[i].outputs[j] = batch_output_name(paths[i], formats[j]);
+        files[i].index = i;
+        files[i].size = (stat(paths[i], &info) == 0) ? info.st_size : 0;
+        files[i].same_output = NULL;
+        queue.files[i] = &files[i];
+    }
+
+    queue.count = count;
+    if (jobs > 1) {
+        /* Chain the files that share an output file, and queue only the
+           first of each chain, so that one worker converts all of them in
+           order.  Then hand out the largest files first, so that the small
+           ones fill in the gaps at the end. */
+        qsort(queue.files, count, sizeof(batch_file *), compare_batch_output);
+        heads = 0;
+        for (i = 0; i < count; i++) {
+            if (heads > 0 && strcmp(queue.files[heads - 1]->outputs[0], queue.files[i]->outputs[0]) == 0) {
+                batch_file *last = queue.files[heads - 1];
+                while (last->same_output != NULL)
+                    last = last->same_output;
+                last->same_output = queue.files[i];
+                queue.files[heads - 1]->size += queue.files[i]->size;
+            } else {
+                queue.files[heads++] = queue.files[i];
+            }
+        }
+        queue.count = heads;
+        qsort(queue.files, heads, sizeof(batch_file *), compare_batch_size);
+        if (jobs > heads)
+            jobs = heads;
+    }
+
+#ifndef _WIN32
+    pthread_mutex_init(&queue.lock, NULL);
+    if (jobs > 1) {
+        pthread_t *workers = malloc(jobs * sizeof(pthread_t));
+        int started;
+
+        for (started = 0; started < jobs; started++)
+            if (pthread_create(&workers[started], NULL, batch_worker, &queue) != 0)
+                break;
+        if (started == 0)
+            batch_worker(&queue);
+        for (i = 0; i < started; i++)
+            pthread_join(workers[i], NULL);
+        free(workers);
+    } else
+        batch_worker(&queue);
+    pthread_mutex_destroy(&queue.lock);
+#else
+    batch_worker(&queue);
+#endif
+
+    for (i = 0; i < count; i++) {
+        for (j = 0; j < format_count; j++)
+            free(files[i].outputs[j]);
+        free(files[i].outputs);
+    }
+    free(files);
+    free(queue.files);
+    return queue.failures;
+}
+
 int main(int argc, char * argv[]) {
 	
     int numargs;            /* number of filename arguments */
     int i;
 
     GString *inputbuf;
+    input_text input;       /* text to be converted */
+    input_text part;
     char *out;              /* string containing processed output */
+    char **outs;
+    mmd_document_t *doc;
 
-    GString *file;
-    char *fake;
-    FILE *input;
-    FILE *output;
-    char curchar;
     char *progname = argv[0];
+    char *name;
+    int status = EXIT_SUCCESS;
 
-    int output_format = HTML_FORMAT;
+    int formats[MAX_FORMATS];  /* formats to convert to, in order */
+    int format_count;
+    int jobs = 1;           /* number of threads to use */
 
     /* Code for command-line option parsing. */
 
@@ -118,6 +610,12 @@ int main(int argc, char * argv[]) {
     static gboolean opt_batchmode = FALSE;
     static gchar *opt_extract_meta = FALSE;
     static gboolean opt_no_labels = FALSE;
+    static gchar *opt_jobs = 0;
+    static gchar *opt_cache = 0;
+    static gchar *opt_cache_size = 0;
+    static gboolean opt_cache_stats = FALSE;
+    static gchar *opt_save_tree = 0;
+    static gboolean opt_from_tree = FALSE;
 
 	static struct option entries[] =
 	{
@@ -131,6 +629,12 @@ int main(int argc, char * argv[]) {
       MD_ARGUMENT_FLAG( "compatibility", 'c', 1, &opt_compatibility, "markdown compatibility mode", NULL ),
       MD_ARGUMENT_FLAG( "batch", 'b', 1, &opt_batchmode, "process multiple files automatically", NULL ),
       MD_ARGUMENT_STRING( "extract", 'e', &opt_extract_meta, "extract and display specified metadata", NULL ),
+      MD_ARGUMENT_STRING( "jobs", 'j', &opt_jobs, "use up to N threads", "N" ),
+      MD_ARGUMENT_STRING( "cache", OPT_CACHE, &opt_cache, "reuse conversions cached in DIR", "DIR" ),
+      MD_ARGUMENT_STRING( "cache-size", OPT_CACHE_SIZE, &opt_cache_size, "keep at most N megabytes in the cache", "N" ),
+      MD_ARGUMENT_FLAG( "cache-stats", 0, 1, &opt_cache_stats, "report cache hits and misses", NULL ),
+      MD_ARGUMENT_STRING( "save-tree", OPT_SAVE_TREE, &opt_save_tree, "parse and save the document to FILE", "FILE" ),
+      MD_ARGUMENT_FLAG( "from-tree", 0, 1, &opt_from_tree, "convert a document saved with --save-tree", NULL ),
       MD_ARGUMENT_FLAG( "smart", 0, 1, &opt_smart, "use smart typography extension (on by default)", NULL ),
       MD_ARGUMENT_FLAG( "nosmart", 0, 1, &opt_no_smart, "do not use smart typography extension", NULL ),
       MD_ARGUMENT_FLAG( "notes", 0, 1, &opt_notes, "use notes extension (on by default)", NULL ),
@@ -140,7 +644,7 @@ int main(int argc, char * argv[]) {
     };
 
 	char ch;
-	while ((ch = getopt_long(argc, argv, "hvo:t:xcbe:", entries, NULL)) != -1) {
+	while ((ch = getopt_long(argc, argv, "hvo:t:xcbe:j:", entries, NULL)) != -1) {
 		 switch (ch) {
 			case 'h':
 				printUsage();
@@ -170,6 +674,22 @@ int main(int argc, char * argv[]) {
 				opt_extract_meta = malloc(strlen(optarg) + 1);
 				strcpy(opt_extract_meta, optarg);
 				break;
+			case 'j':
+				opt_jobs = malloc(strlen(optarg) + 1);
+				strcpy(opt_jobs, optarg);
+				break;
+			case OPT_CACHE:
+				opt_cache = malloc(strlen(optarg) + 1);
+				strcpy(opt_cache, optarg);
+				break;
+			case OPT_CACHE_SIZE:
+				opt_cache_size = malloc(strlen(optarg) + 1);
+				strcpy(opt_cache_size, optarg);
+				break;
+			case OPT_SAVE_TREE:
+				opt_save_tree = malloc(strlen(optarg) + 1);
+				strcpy(opt_save_tree, optarg);
+				break;
 		 }
 	}
 
@@ -215,128 +735,158 @@ int main(int argc, char * argv[]) {
         extensions = extensions | EXT_NO_LABELS;
     }
 
+    /* -t takes a comma separated list of formats; the document is parsed
+       once and converted to each of them. */
+    format_count = 0;
     if (opt_to == NULL)
-        output_format = HTML_FORMAT;
-    else if (strcmp(opt_to, "html") == 0)
-        output_format = HTML_FORMAT;
-    else if (strcmp(opt_to, "latex") == 0)
-        output_format = LATEX_FORMAT;
-    else if (strcmp(opt_to, "memoir") == 0)
-        output_format = MEMOIR_FORMAT;
-    else if (strcmp(opt_to, "beamer") == 0)
-        output_format = BEAMER_FORMAT;
-    else if (strcmp(opt_to, "opml") == 0)
-        output_format = OPML_FORMAT;
-    else if (strcmp(opt_to, "odf") == 0)
-        output_format = ODF_FORMAT;
-    else {
+        formats[format_count++] = HTML_FORMAT;
+    else for (name = strtok(opt_to, ","); name != NULL; name = strtok(NULL, ",")) {
+        if (strcmp(name, "html") == 0)
+            formats[format_count] = HTML_FORMAT;
+        else if (strcmp(name, "latex") == 0)
+            formats[format_count] = LATEX_FORMAT;
+        else if (strcmp(name, "memoir") == 0)
+            formats[format_count] = MEMOIR_FORMAT;
+        else if (strcmp(name, "beamer") == 0)
+            formats[format_count] = BEAMER_FORMAT;
+        else if (strcmp(name, "opml") == 0)
+            formats[format_count] = OPML_FORMAT;
+        else if (strcmp(name, "odf") == 0)
+            formats[format_count] = ODF_FORMAT;
+        else {
+            fprintf(stderr, "%s: Unknown output format '%s'\n", progname, name);
+            exit(EXIT_FAILURE);
+        }
+        /* Each format is written to a file with its own extension. */
+        for (i = 0; i < format_count; i++)
+            if (strcmp(format_extension(formats[i]), format_extension(formats[format_count])) == 0) {
+                fprintf(stderr, "%s: Output format '%s' would overwrite the %s output of an earlier one\n",
+                    progname, name, format_extension(formats[i]));
+                exit(EXIT_FAILURE);
+            }
+        format_count++;
+    }
+    if (format_count == 0) {
         fprintf(stderr, "%s: Unknown output format '%s'\n", progname, opt_to);
         exit(EXIT_FAILURE);
     }
 
+    if (opt_jobs != NULL) {
+        char *end;
+        long n = strtol(opt_jobs, &end, 10);
+        if (end == opt_jobs || *end != '\0' || n < 1 || n > 1024) {
+            fprintf(stderr, "%s: Invalid number of jobs '%s'\n", progname, opt_jobs);
+            exit(EXIT_FAILURE);
+        }
+        jobs = n;
+    }
+
+    if (opt_cache != NULL) {
+        long long size = 256;   /* megabytes */
+        if (opt_cache_size != NULL) {
+            char *end;
+            size = strtol(opt_cache_size, &end, 10);
+            if (end == opt_cache_size || *end != '\0' || size < 0) {
+                fprintf(stderr, "%s: Invalid cache size '%s'\n", progname, opt_cache_size);
+                exit(EXIT_FAILURE);
+            }
+        }
+        if ((cache = output_cache_open(opt_cache, size * 1024 * 1024, CACHE_SALT)) == NULL)
+            exit(EXIT_FAILURE);
+    }
+
     numargs = argc - 1;
 
-    if (opt_batchmode && numargs != 0) {
+    /* A saved document is a single file, read from or written to as a
+       whole. */
+    if ((opt_save_tree != NULL || opt_from_tree) && (opt_batchmode || numargs > 1
+            || (opt_from_tree && numargs == 0))) {
+        fprintf(stderr, "%s: --save-tree and --from-tree take a single input file\n", progname);
+        exit(EXIT_FAILURE);
+    }
+
+    /* Several formats go to files named after the output file, with
+       the extension of each format. */
+    if (format_count > 1 && !(opt_batchmode && numargs != 0) && opt_save_tree == NULL
+        && (opt_output == NULL || strcmp(opt_output, "-") == 0)) {
+        fprintf(stderr, "%s: Converting to several formats needs -o FILE or -b\n", progname);
+        exit(EXIT_FAILURE);
+    }
+
+    if (opt_from_tree) {
+        if ((outs = convert_tree_file(argv[1], formats, format_count)) == NULL)
+            exit(EXIT_FAILURE);
+        if (!write_outputs(outs, formats, format_count, opt_output))
+            status = EXIT_FAILURE;
+
+    } else if (opt_batchmode && numargs != 0) {
         /* handle each file individually, and set output to filename with
             appropriate extension */
         
-           for (i = 0; i < numargs; i++) {
-                inputbuf = g_string_new("");   /* string for concatenated input */
-                /* Read file */
-                if ((input = fopen(argv[i+1], "r")) == NULL) {
-                    perror(argv[i+1]);
-                    exit(EXIT_FAILURE);
-                }
-                while ((curchar = fgetc(input)) != EOF)
-                    g_string_append_c(inputbuf, curchar);
-                fclose(input);
-
-                /* Display metadata on request */
-                if (opt_extract_meta) {
-                    out = extract_metadata_value(inputbuf->str, extensions, opt_extract_meta);
-                    if (out != NULL) fprintf(stdout, "%s\n", out);
-                    return(EXIT_SUCCESS);
-                }
-                
-                /* remove file extension, if present */
-                fake = argv[i+1];
-                if (strrchr(fake, '.') != NULL) {
-                    int count = strrchr(fake,'.') - fake;
-                    if (count != 0) {
-                        fake[count] = '\0';
-                    }
-                }
-
-                file = g_string_new(fake);
-                if (output_format == HTML_FORMAT) {
-                    g_string_append(file,".html");
-                } else if (output_format == OPML_FORMAT) {
-                    g_string_append(file,".opml");
-                } else if (output_format == ODF_FORMAT) {
-                    g_string_append(file,".fodt");
-                } else {
-                    g_string_append(file,".tex");
-                }
-
-                /* open output file */
-                if (!(output = fopen(file->str, "w"))) {
-                    perror(opt_output);
-                    return 1;
-                }
-               
-                out = markdown_to_string(inputbuf->str, extensions, output_format);
-
-                fprintf(output, "%s\n", out);
-                fclose(output);
-                g_string_free(file,true);
-                free(out);
-                g_string_free(inputbuf, true);
-           }
+        /* Display metadata on request */
+        if (opt_extract_meta) {
+            if (!open_input(argv[1], &input))
+                exit(EXIT_FAILURE);
+            out = extract_metadata_value(input.text, extensions, opt_extract_meta);
+            if (out != NULL) fprintf(stdout, "%s\n", out);
+            return(EXIT_SUCCESS);
+        }
+
+        if (convert_batch(argv + 1, numargs, jobs, formats, format_count) != 0)
+            status = EXIT_FAILURE;
         
     } else {
-        /* Read input from stdin or input files into inputbuf */
-
-        inputbuf = g_string_new("");   /* string for concatenated input */
+        /* Read input from stdin or input files */
 
         if (numargs == 0) {        /* use stdin if no files specified */
-            while ((curchar = fgetc(stdin)) != EOF)
-                g_string_append_c(inputbuf, curchar);
+            if (!read_input(STDIN_FILENO, &input)) {
+                perror("stdin");
+                exit(EXIT_FAILURE);
+            }
             fclose(stdin);
         }
-        else {                  /* open all the files on command line */
+        else if (numargs == 1) {
+            if (!open_input(argv[1], &input))
+                exit(EXIT_FAILURE);
+        }
+        else {                  /* concatenate all the files on command line */
+           inputbuf = g_string_new("");
            for (i = 0; i < numargs; i++) {
-                if ((input = fopen(argv[i+1], "r")) == NULL) {
-                    perror(argv[i+1]);
+                if (!open_input(argv[i+1], &part))
                     exit(EXIT_FAILURE);
-                }
-                while ((curchar = fgetc(input)) != EOF)
-                    g_string_append_c(inputbuf, curchar);
-                fclose(input);
+                g_string_append(inputbuf, part.text);
+                free_input(&part);
            }
+           input.text = g_string_free(inputbuf, false);
+           input.mapped = 0;
         }
 
         /* Display metadata on request */
         if (opt_extract_meta) {
-            out = extract_metadata_value(inputbuf->str, extensions, opt_extract_meta);
+            out = extract_metadata_value(input.text, extensions, opt_extract_meta);
             if (out != NULL) fprintf(stdout, "%s\n", out);
             return(EXIT_SUCCESS);
         }
         
-       /* we allow "-" as a synonym for stdout here */
-        if (opt_output == NULL || strcmp(opt_output, "-") == 0)
-            output = stdout;
-        else if (!(output = fopen(opt_output, "w"))) {
-            perror(opt_output);
-            return 1;
+        if (opt_save_tree != NULL) {
+            doc = mmd_document_new(input.text, extensions, jobs);
+            if (!mmd_document_save(doc, opt_save_tree)) {
+                perror(opt_save_tree);
+                status = EXIT_FAILURE;
+            }
+            mmd_document_free(doc);
+        } else if (cache == NULL && format_count == 1) {
+            if (!stream_text(input.text, formats[0], jobs, opt_output))
+                status = EXIT_FAILURE;
+        } else {
+            outs = convert_text(input.text, formats, format_count, jobs);
+            if (!write_outputs(outs, formats, format_count, opt_output))
+                status = EXIT_FAILURE;
         }
-
-        out = markdown_to_string(inputbuf->str, extensions, output_format);
-        fprintf(output, "%s\n", out);
-        free(out);
-        fclose(output);
-        g_string_free(inputbuf, true);
+        free_input(&input);
         
     }
 
-    return(EXIT_SUCCESS);
+    output_cache_close(cache, opt_cache_stats);
+    return(status);
 }
@@ -19,36 +19,123 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <pthread.h>
+#endif
 #include "markdown_peg.h"
+#include "tree_file.c"
 
 #define TABSTOP 4
+#define SECTION_MIN_SIZE 65536      /* Smallest section worth a thread. */
+#define SECTIONS_PER_JOB 4
+
+extern char *strtok_r(char *str, const char *delim, char **saveptr);
+
+/* plain_run_length - number of characters at the start of 'text' (of
+ * length 'len') that preformat_text can copy unchanged, i.e. up to the
+ * first tab, carriage return or newline.  Scans a vector at a time when
+ * built for SSE2 or AVX2. */
+static size_t plain_run_length(const char *text, size_t len) {
+    size_t i = 0;
+    char c;
+#if defined(__AVX2__) && defined(__GNUC__)
+    {
+        const __m256i tab32 = _mm256_set1_epi8('\t');
+        const __m256i cr32 = _mm256_set1_epi8('\r');
+        const __m256i lf32 = _mm256_set1_epi8('\n');
+        __m256i chunk32;
+        unsigned int mask32;
+
+        for (; i + 32 <= len; i += 32) {
+            chunk32 = _mm256_loadu_si256((const __m256i *) (text + i));
+            mask32 = (unsigned int) _mm256_movemask_epi8(_mm256_or_si256(
+                _mm256_cmpeq_epi8(chunk32, tab32),
+                _mm256_or_si256(_mm256_cmpeq_epi8(chunk32, cr32),
+                                _mm256_cmpeq_epi8(chunk32, lf32))));
+            if (mask32 != 0)
+                return i + __builtin_ctz(mask32);
+        }
+    }
+#endif
+#if defined(__SSE2__) && defined(__GNUC__)
+    {
+        const __m128i tab16 = _mm_set1_epi8('\t');
+        const __m128i cr16 = _mm_set1_epi8('\r');
+        const __m128i lf16 = _mm_set1_epi8('\n');
+        __m128i chunk16;
+        unsigned int mask16;
+
+        for (; i + 16 <= len; i += 16) {
+            chunk16 = _mm_loadu_si128((const __m128i *) (text + i));
+            mask16 = (unsigned int) _mm_movemask_epi8(_mm_or_si128(
+                _mm_cmpeq_epi8(chunk16, tab16),
+                _mm_or_si128(_mm_cmpeq_epi8(chunk16, cr16),
+                             _mm_cmpeq_epi8(chunk16, lf16))));
+            if (mask16 != 0)
+                return i + __builtin_ctz(mask16);
+        }
+    }
+#endif
+    for (; i < len; i++) {
+        c = text[i];
+        if (c == '\t' || c == '\r' || c == '\n')
+            break;
+    }
+    return i;
+}
 
 /* preformat_text - allocate and copy text buffer while
- * performing tab expansion. */
+ * performing tab expansion.  CRLF and lone CR line endings become LF,
+ * and a leading UTF-8 byte order mark is dropped. */
 static GString *preformat_text(char *text) {
     GString *buf;
-    char next_char;
-    int charstotab;
+    size_t len;
+    size_t run;
+    char *end;
+    int column = 0;         /* Characters since the last tab stop. */
 
-    int len = 0;
+    len = strlen(text);
+    if (len >= 3 && memcmp(text, "\357\273\277", 3) == 0) {
+        text += 3;
+        len -= 3;
+    }
+    end = text + len;
 
-    buf = g_string_new("");
+    buf = g_string_sized_new(len + len / 32 + 2);
 
-    charstotab = TABSTOP;
-    while ((next_char = *text++) != '\0') {
-        switch (next_char) {
+    while (text < end) {
+        run = plain_run_length(text, end - text);
+        g_string_append_len(buf, text, run);
+        column = (column + run) % TABSTOP;
+        text += run;
+        if (text == end)
+            break;
+        switch (*text++) {
         case '\t':
-            while (charstotab > 0)
-                g_string_append_c(buf, ' '), len++, charstotab--;
+            while (column++ < TABSTOP)
+                g_string_append_c(buf, ' ');
+            column = 0;
+            break;
+        case '\r':
+            if (text < end && *text == '\n')
+                text++;
+            g_string_append_c(buf, '\n');
+            column = 0;
             break;
         case '\n':
-            g_string_append_c(buf, '\n'), len++, charstotab = TABSTOP;
+            g_string_append_c(buf, '\n');
+            column = 0;
             break;
-        default:
-            g_string_append_c(buf, next_char), len++, charstotab--;
         }
-        if (charstotab == 0)
-            charstotab = TABSTOP;
     }
     g_string_append(buf, "\n\n");
     return(buf);
@@ -112,10 +199,11 @@ static void print_tree(element * elt, int indent) {
 /* process_raw_blocks - traverses an element list, replacing any RAW elements with
  * the result of parsing them as markdown text, and recursing into the children
  * of parent elements.  The result should be a tree of elements without any RAWs. */
-static element * process_raw_blocks(element *input, int extensions, element *references, element *notes, element *labels) {
+static element * process_raw_blocks(mmd_parser_t *parser, element *input, int extensions, element *references, element *notes, element *labels) {
     element *current = NULL;
     element *last_child = NULL;
     char *contents;
+    char *saveptr;
     current = input;
 
     while (current != NULL) {
@@ -123,59 +211,655 @@ static element * process_raw_blocks(element *input, int extensions, element *ref
             /* \001 is used to indicate boundaries between nested lists when there
              * is no blank line.  We split the string by \001 and parse
              * each chunk separately. */
-            contents = strtok(current->contents.str, "\001");
+            contents = strtok_r(current->contents.str, "\001", &saveptr);
             current->key = LIST;
-            current->children = parse_markdown(contents, extensions, references, notes, labels);
+            current->children = parse_markdown(parser, contents, extensions, references, notes, labels);
             last_child = current->children;
-            while ((contents = strtok(NULL, "\001"))) {
+            while ((contents = strtok_r(NULL, "\001", &saveptr))) {
                 while (last_child->next != NULL)
                     last_child = last_child->next;
-                last_child->next = parse_markdown(contents, extensions, references, notes, labels);
+                last_child->next = parse_markdown(parser, contents, extensions, references, notes, labels);
             }
-            free(current->contents.str);
             current->contents.str = NULL;
         }
+        /* Children are processed in place, and may be shared (notes), so
+           they are not assigned to. */
         if (current->children != NULL)
-            current->children = process_raw_blocks(current->children, extensions, references, notes, labels);
+            process_raw_blocks(parser, current->children, extensions, references, notes, labels);
         current = current->next;
     }
     return input;
 }
 
-/* markdown_to_gstring - convert markdown text to the output format specified.
- * Returns a GString, which must be freed after use using g_string_free(). */
-GString * markdown_to_g_string(char *text, int extensions, int output_format) {
+/* document_section - a stretch of a document that is parsed on its own */
+typedef struct {
+    int start;              /* Offset of the section's first line. */
+    int limit;              /* Offset of the blank lines that end it. */
+    int end;                /* Offset at which its parse stopped. */
+    element *blocks;        /* Its top-level blocks, with RAWs processed. */
+} document_section;
+
+/* section_queue - the sections of a document, shared by the threads
+ * that parse them */
+typedef struct {
+    char *text;
+    int extensions;
+    element *references;
+    element *notes;
+    element *labels;
+    document_section *sections;
+    int count;
+    int next;               /* Index of the next section to hand out. */
+#ifndef _WIN32
+    pthread_mutex_t lock;
+#endif
+} section_queue;
+
+/* section_worker - a thread parsing sections, with a parser of its own */
+typedef struct {
+    section_queue *queue;
+    mmd_parser_t *parser;
+} section_worker;
+
+/* blank_lines_start - offset of the first of the blank lines directly
+ * before the line starting at 'pos' (or 'pos' itself if there are none) */
+static int blank_lines_start(char *text, int pos) {
+    int line;
+    int i;
+
+    while (pos > 0) {
+        line = pos - 1;
+        while (line > 0 && text[line - 1] != '\n')
+            line--;
+        for (i = line; text[i] == ' ' || text[i] == '\t'; i++)
+            ;
+        if (text[i] != '\n')
+            break;
+        pos = line;
+    }
+    return pos;
+}
+
+/* find_sections - split the 'len' characters of 'text' into at most
+ * 'count' sections of roughly equal size.  Sections start at ATX
+ * headings that follow a blank line, where a top-level block almost
+ * always starts; parse_in_sections copes with the rare exceptions.
+ * Returns the number of sections. */
+static int find_sections(char *text, int len, int count, document_section *sections) {
+    int size = len / count;
+    int found = 0;
+    int pos;
+    int i;
+    char *eol;
+    bool blank;
+
+    if (size < SECTION_MIN_SIZE)
+        size = SECTION_MIN_SIZE;
+
+    sections[found++].start = 0;
+    pos = size;
+    while (found < count && pos < len) {
+        /* Find the first line after 'pos' that starts with '#' and follows
+           a blank line. */
+        blank = false;
+        while (pos < len && !(blank && text[pos - 1] == '\n' && text[pos] == '#')) {
+            eol = memchr(text + pos, '\n', len - pos);
+            if (eol == NULL) {
+                pos = len;
+                break;
+            }
+            blank = (text[pos - 1] == '\n');
+            for (i = pos; blank && i < eol - text; i++)
+                blank = (text[i] == ' ' || text[i] == '\t');
+            pos = eol - text + 1;
+        }
+        if (pos >= len)
+            break;
+        sections[found++].start = pos;
+        pos += size;
+    }
+
+    for (pos = 0; pos < found; pos++) {
+        sections[pos].limit = (pos + 1 < found)
+            ? blank_lines_start(text, sections[pos + 1].start) : len;
+        sections[pos].blocks = NULL;
+    }
+    return found;
+}
+
+/* parse_sections - parse sections from the queue of 'arg', a
+ * section_worker, until there are none left */
+static void *parse_sections(void *arg) {
+    section_worker *worker = arg;
+    section_queue *queue = worker->queue;
+    document_section *section;
+
+    for (;;) {
+#ifndef _WIN32
+        pthread_mutex_lock(&queue->lock);
+#endif
+        section = (queue->next < queue->count) ? &queue->sections[queue->next++] : NULL;
+#ifndef _WIN32
+        pthread_mutex_unlock(&queue->lock);
+#endif
+        if (section == NULL)
+            break;
+        section->blocks = parse_markdown_section(worker->parser, queue->text + section->start,
+            queue->extensions, queue->references, queue->notes, queue->labels,
+            section == queue->sections, section->limit - section->start, &section->end);
+        section->end += section->start;
+        process_raw_blocks(worker->parser, section->blocks, queue->extensions,
+            queue->references, queue->notes, queue->labels);
+    }
+    return NULL;
+}
+
+/* parse_in_sections - parse 'text' (of length 'len') as
+ * parse_markdown_with_metadata and process_raw_blocks would, splitting it
+ * into sections that are parsed on up to mmd_parser_jobs(parser) threads.
+ *
+ * Only a section that starts where a top-level block starts in a parse
+ * of the whole document yields the same blocks.  The first one does;
+ * each following section is used if the blocks of the one before it
+ * ended in the blank lines before it, and otherwise it is parsed again
+ * from where those blocks did end.  The elements of each thread's parser
+ * are added to 'helpers', which must be freed after printing. */
+static element * parse_in_sections(mmd_parser_t *parser, char *text, int len, int extensions, element *references, element *notes, element *labels, mmd_parser_t **helpers) {
+    section_queue queue;
+    section_worker *workers;
+    document_section *section;
+    element *result = NULL;
+    element *footer = NULL;
+    element **tail = &result;
+    element *blocks;
+    int jobs = mmd_parser_jobs(parser);
+    int pos = 0;
+    int i;
+#ifndef _WIN32
+    pthread_t *threads;
+    int started;
+#endif
+
+    queue.text = text;
+    queue.extensions = extensions;
+    queue.references = references;
+    queue.notes = notes;
+    queue.labels = labels;
+    queue.sections = malloc(jobs * SECTIONS_PER_JOB * sizeof(document_section));
+    queue.count = find_sections(text, len, jobs * SECTIONS_PER_JOB, queue.sections);
+    queue.next = 0;
+    if (jobs > queue.count)
+        jobs = queue.count;
+
+    /* Notes are shared by every reference to them, so their RAWs are
+       processed up front rather than by whichever thread gets there first. */
+    process_raw_blocks(parser, notes, extensions, references, notes, labels);
+
+    workers = malloc(jobs * sizeof(section_worker));
+    for (i = 0; i < jobs; i++) {
+        workers[i].queue = &queue;
+        workers[i].parser = (i == 0) ? parser : mmd_parser_new();
+        helpers[i] = (i == 0) ? NULL : workers[i].parser;
+    }
+#ifndef _WIN32
+    pthread_mutex_init(&queue.lock, NULL);
+    threads = malloc(jobs * sizeof(pthread_t));
+    for (started = 1; started < jobs; started++)
+        if (pthread_create(&threads[started], NULL, parse_sections, &workers[started]) != 0)
+            break;
+    parse_sections(&workers[0]);
+    for (i = 1; i < started; i++)
+        pthread_join(threads[i], NULL);
+    free(threads);
+    pthread_mutex_destroy(&queue.lock);
+#else
+    parse_sections(&workers[0]);
+#endif
+
+    for (i = 0; i < queue.count; i++) {
+        section = &queue.sections[i];
+        if (i > 0 && pos < queue.sections[i - 1].limit)
+            break;          /* No block could be parsed, so the document ends. */
+        if (pos > section->start) {
+            blocks = parse_markdown_section(parser, text + pos, extensions,
+                references, notes, labels, false, section->limit - pos, &section->end);
+            section->end += pos;
+            process_raw_blocks(parser, blocks, extensions, references, notes, labels);
+        } else {
+            blocks = section->blocks;
+        }
+        pos = section->end;
+
+        /* The footer that follows metadata goes at the end of the document. */
+        if (i == 0 && blocks != NULL) {
+            element **last = &blocks;
+            while ((*last)->next != NULL)
+                last = &(*last)->next;
+            if ((*last)->key == FOOTER) {
+                footer = *last;
+                *last = NULL;
+            }
+        }
+        *tail = blocks;
+        while (*tail != NULL)
+            tail = &(*tail)->next;
+    }
+    *tail = footer;
+
+    free(workers);
+    free(queue.sections);
+    return result;
+}
+
+/* parse_document - parse the preformatted 'text' (of length 'len') into the
+ * element tree the writers of every format but OPML print, with unique
+ * anchor ids.  Its document_index is built in 'index', which must be
+ * freed with document_index_free().  Threads that help parse it add their
+ * parsers to 'helpers', which must be freed after printing. */
+static element * parse_document(mmd_parser_t *parser, char *text, int len, int extensions, document_index *index, mmd_parser_t **helpers) {
     element *result;
     element *references;
     element *notes;
     element *labels;
+
+    parse_collect(parser, text, extensions, &references, &notes, &labels);
+    if (mmd_parser_jobs(parser) > 1 && len >= 2 * SECTION_MIN_SIZE) {
+        result = parse_in_sections(parser, text, len, extensions, references, notes, labels, helpers);
+    } else {
+        result = parse_markdown_with_metadata(parser, text, extensions, references, notes, labels);
+        result = process_raw_blocks(parser, result, extensions, references, notes, labels);
+    }
+    assign_anchor_ids(parser, result);
+    document_index_build(index, result);
+    return result;
+}
+
+/* render_job - one output format to print from a parsed document */
+typedef struct {
+    GString *out;
+    element *tree;
+    const document_index *index;
+    int format;
+    int extensions;
+} render_job;
+
+/* render_queue - the formats of a document, shared by the threads that
+ * print them.  The writers only read the tree, so they may share it. */
+typedef struct {
+    render_job *jobs;
+    int count;
+    int next;               /* Index of the next job to hand out. */
+#ifndef _WIN32
+    pthread_mutex_t lock;
+#endif
+} render_queue;
+
+/* render_formats - print jobs from 'arg', a render_queue, until there
+ * are none left */
+static void *render_formats(void *arg) {
+    render_queue *queue = arg;
+    render_job *job;
+
+    for (;;) {
+#ifndef _WIN32
+        pthread_mutex_lock(&queue->lock);
+#endif
+        job = (queue->next < queue->count) ? &queue->jobs[queue->next++] : NULL;
+#ifndef _WIN32
+        pthread_mutex_unlock(&queue->lock);
+#endif
+        if (job == NULL)
+            break;
+        print_element_list(job->out, job->tree, job->index, job->format, job->extensions, 0);
+    }
+    return NULL;
+}
+
+/* mmd_parser_to_g_strings - convert markdown text to each of the 'count'
+ * output formats in 'formats', parsing it only once (OPML, which has a
+ * grammar of its own, is parsed separately).  With more than one job the
+ * formats are printed concurrently.  Returns an array of 'count' GStrings
+ * in the order of 'formats'; free each with g_string_free() and the array
+ * with free(). */
+GString ** mmd_parser_to_g_strings(mmd_parser_t *parser, char *text, int extensions, const int *formats, int count) {
+    element *result = NULL;
+    element *opml = NULL;
+    document_index index;
     GString *formatted_text;
+    GString **out;
+    mmd_parser_t **helpers;
+    render_queue queue;
+    int jobs;
+    int i;
+#ifndef _WIN32
+    pthread_t *threads;
+    int started;
+#endif
+
+    out = malloc(count * sizeof(GString *));
+    queue.jobs = malloc(count * sizeof(render_job));
+    queue.count = count;
+    queue.next = 0;
+
+    formatted_text = preformat_text(text);
+    helpers = calloc(mmd_parser_jobs(parser), sizeof(mmd_parser_t *));
+
+    /* OPML is parsed first, while no references or notes are known. */
+    for (i = 0; i < count && opml == NULL; i++)
+        if (formats[i] == OPML_FORMAT)
+            opml = parse_markdown_for_opml(parser, formatted_text->str, extensions);
+    for (i = 0; i < count && result == NULL; i++)
+        if (formats[i] != OPML_FORMAT)
+            result = parse_document(parser, formatted_text->str,
+                formatted_text->currentStringLength, extensions, &index, helpers);
+
+    g_string_free(formatted_text, TRUE);
+
+    for (i = 0; i < count; i++) {
+        out[i] = g_string_new("");
+        queue.jobs[i].out = out[i];
+        queue.jobs[i].tree = (formats[i] == OPML_FORMAT) ? opml : result;
+        queue.jobs[i].index = (formats[i] == OPML_FORMAT) ? NULL : &index;
+        queue.jobs[i].format = formats[i];
+        queue.jobs[i].extensions = extensions;
+    }
+
+    jobs = (mmd_parser_jobs(parser) < count) ? mmd_parser_jobs(parser) : count;
+#ifndef _WIN32
+    pthread_mutex_init(&queue.lock, NULL);
+    threads = malloc(jobs * sizeof(pthread_t));
+    for (started = 1; started < jobs; started++)
+        if (pthread_create(&threads[started], NULL, render_formats, &queue) != 0)
+            break;
+    render_formats(&queue);
+    for (i = 1; i < started; i++)
+        pthread_join(threads[i], NULL);
+    free(threads);
+    pthread_mutex_destroy(&queue.lock);
+#else
+    render_formats(&queue);
+#endif
+
+    for (i = 0; i < mmd_parser_jobs(parser); i++)
+        mmd_parser_free(helpers[i]);
+    free(helpers);
+    free(queue.jobs);
+    if (result != NULL)
+        document_index_free(&index);
+    mmd_parser_release_elements(parser);
+    return out;
+}
+
+/* mmd_parser_to_g_string - convert markdown text to the output format specified,
+ * using 'parser' for all parse state.  The parser may be reused afterwards.
+ * Returns a GString, which must be freed after use using g_string_free(). */
+GString * mmd_parser_to_g_string(mmd_parser_t *parser, char *text, int extensions, int output_format) {
+    GString **outs;
     GString *out;
-    out = g_string_new("");
+
+    outs = mmd_parser_to_g_strings(parser, text, extensions, &output_format, 1);
+    out = outs[0];
+    free(outs);
+    return out;
+}
+
+/* mmd_parser_write - convert markdown text to the output format specified,
+ * passing the output to 'write' a piece at a time as it is printed rather
+ * than keeping all of it, so that a large document can be written out
+ * without holding its whole output in memory. */
+void mmd_parser_write(mmd_parser_t *parser, char *text, int extensions, int output_format, mmd_write_fn write, void *data) {
+    element *result;
+    document_index index;
+    GString *formatted_text;
+    mmd_parser_t **helpers;
+    int i;
+
+    formatted_text = preformat_text(text);
+    helpers = calloc(mmd_parser_jobs(parser), sizeof(mmd_parser_t *));
+
+    if (output_format == OPML_FORMAT)
+        result = parse_markdown_for_opml(parser, formatted_text->str, extensions);
+    else
+        result = parse_document(parser, formatted_text->str,
+            formatted_text->currentStringLength, extensions, &index, helpers);
+
+    g_string_free(formatted_text, TRUE);
+
+    write_element_list(write, data, result,
+        (output_format == OPML_FORMAT) ? NULL : &index, output_format, extensions, 0);
+
+    for (i = 0; i < mmd_parser_jobs(parser); i++)
+        mmd_parser_free(helpers[i]);
+    free(helpers);
+    if (output_format != OPML_FORMAT)
+        document_index_free(&index);
+    mmd_parser_release_elements(parser);
+}
+
+/* mmd_document - a parsed document, kept to be printed again and again */
+struct mmd_document {
+    mmd_parser_t *parser;   /* Owns the elements of 'tree', unless the
+                               document was loaded from a file. */
+    mmd_parser_t **helpers; /* Own the elements other threads parsed. */
+    element *tree;
+    document_index index;   /* What is known about 'tree' as a whole. */
+    char *text;             /* Preformatted text, for OPML's own parse. */
+    int extensions;
+    tree_contents loaded;   /* Elements of a document loaded from a file. */
+    char *data;             /* Contents of that file. */
+    size_t mapped;          /* Length of the mapping holding 'data', or 0
+                               if 'data' was read into malloc'd memory. */
+};
+
+/* mmd_document_new - parse markdown text once, using up to 'jobs' threads,
+ * into a document that can be printed any number of times, in any format,
+ * with mmd_document_to_g_string().  Free with mmd_document_free(). */
+mmd_document_t * mmd_document_new(char *text, int extensions, int jobs) {
+    mmd_document_t *doc = malloc(sizeof(mmd_document_t));
+    GString *formatted_text;
+
+    memset(doc, 0, sizeof(mmd_document_t));
+    doc->parser = mmd_parser_new();
+    mmd_parser_set_jobs(doc->parser, jobs);
+    doc->helpers = calloc(mmd_parser_jobs(doc->parser), sizeof(mmd_parser_t *));
+    doc->extensions = extensions;
 
     formatted_text = preformat_text(text);
+    doc->tree = parse_document(doc->parser, formatted_text->str,
+        formatted_text->currentStringLength, extensions, &doc->index, doc->helpers);
+    doc->text = g_string_free(formatted_text, FALSE);
+    return doc;
+}
+
+/* mmd_document_to_g_string - print a parsed document in the output format
+ * specified.  A 'base_header_level' other than 0 overrides the one in the
+ * document's metadata.  The document is not changed, so it may be printed
+ * from several threads at once.  OPML has a grammar of its own and is
+ * parsed anew from the document's text each time.
+ * Returns a GString, which must be freed after use using g_string_free(). */
+GString * mmd_document_to_g_string(const mmd_document_t *doc, int output_format, int base_header_level) {
+    GString *out = g_string_new("");
+    mmd_parser_t *parser;
 
     if (output_format == OPML_FORMAT) {
-        result = parse_markdown_for_opml(formatted_text->str, extensions);
+        parser = mmd_parser_new();
+        print_element_list(out, parse_markdown_for_opml(parser, doc->text, doc->extensions),
+            NULL, output_format, doc->extensions, base_header_level);
+        mmd_parser_free(parser);
     } else {
-        references = parse_references(formatted_text->str, extensions);
-        notes = parse_notes(formatted_text->str, extensions, references);
-        labels = parse_labels(formatted_text->str, extensions, references, notes);
-        result = parse_markdown_with_metadata(formatted_text->str, extensions, references, notes, labels);
+        print_element_list(out, doc->tree, &doc->index, output_format, doc->extensions, base_header_level);
+    }
+    return out;
+}
 
-        result = process_raw_blocks(result, extensions, references, notes, labels);
+/* mmd_document_write - like mmd_document_to_g_string(), but pass the
+ * output to 'write' a piece at a time as it is printed. */
+void mmd_document_write(const mmd_document_t *doc, int output_format, int base_header_level, mmd_write_fn write, void *data) {
+    mmd_parser_t *parser;
+
+    if (output_format == OPML_FORMAT) {
+        parser = mmd_parser_new();
+        write_element_list(write, data, parse_markdown_for_opml(parser, doc->text, doc->extensions),
+            NULL, output_format, doc->extensions, base_header_level);
+        mmd_parser_free(parser);
+    } else {
+        write_element_list(write, data, doc->tree, &doc->index, output_format, doc->extensions, base_header_level);
     }
+}
 
-    g_string_free(formatted_text, TRUE);
+/* mmd_document_save - write a parsed document to the file at 'path', from
+ * which mmd_document_load() can load it, in this or another process.
+ * Returns false, with errno set, if the file could not be written. */
+bool mmd_document_save(const mmd_document_t *doc, char *path) {
+    FILE *out;
+    bool ok;
 
-    print_element_list(out, result, output_format, extensions);
+    if ((out = fopen(path, "wb")) == NULL)
+        return false;
+    ok = tree_save(out, doc->tree, doc->text, doc->extensions);
+    ok = (fclose(out) == 0) && ok;
+    return ok;
+}
 
-    free_element_list(result);
+/* mmd_document_load - load a document saved by mmd_document_save().  The
+ * file is mapped rather than read where possible, and the document is
+ * printed from the mapping.  Returns NULL, with errno set, if the file
+ * could not be read or is not a document file of this version. */
+mmd_document_t * mmd_document_load(char *path) {
+    mmd_document_t *doc;
+    struct stat info;
+    size_t len = 0;
+    ssize_t count;
+    char *data;
+    int fd;
 
-    if (output_format != OPML_FORMAT) {
-        free_element_list(references);
-        free_element_list(labels);
+    if ((fd = open(path, O_RDONLY)) < 0)
+        return NULL;
+    if (fstat(fd, &info) != 0) {
+        close(fd);
+        return NULL;
+    }
+    doc = calloc(1, sizeof(mmd_document_t));
+#ifndef _WIN32
+    data = mmap(NULL, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (info.st_size > 0 && data != MAP_FAILED) {
+        doc->data = data;
+        doc->mapped = info.st_size;
+        len = info.st_size;
     }
+#endif
+    if (doc->data == NULL) {
+        doc->data = malloc(info.st_size + 1);
+        while (len < (size_t)info.st_size) {
+            count = read(fd, doc->data + len, info.st_size - len);
+            if (count < 0 && errno == EINTR)
+                continue;
+            if (count <= 0)
+                break;
+            len += count;
+        }
+    }
+    close(fd);
+
+    if (!tree_load(doc->data, len, &doc->loaded)) {
+        mmd_document_free(doc);
+        errno = EINVAL;
+        return NULL;
+    }
+    doc->tree = doc->loaded.root;
+    doc->text = doc->loaded.text;
+    doc->extensions = doc->loaded.extensions;
+    document_index_build(&doc->index, doc->tree);
+    return doc;
+}
+
+/* mmd_document_features - which of the features of enum
+ * mmd_document_features the document uses, as a mask */
+int mmd_document_features(const mmd_document_t *doc) {
+    const key_set *keys = &doc->index.keys;
+    int features = 0;
+
+    if (key_set_has(keys, METADATA))
+        features |= MMD_FEATURE_METADATA;
+    if (key_set_has(keys, NOTE))
+        features |= MMD_FEATURE_NOTES;
+    if (key_set_has(keys, CITATION) || key_set_has(keys, NOCITATION))
+        features |= MMD_FEATURE_CITATIONS;
+    if (key_set_has(keys, GLOSSARY))
+        features |= MMD_FEATURE_GLOSSARY;
+    if (key_set_has(keys, TABLE))
+        features |= MMD_FEATURE_TABLES;
+    if (key_set_has(keys, MATHSPAN))
+        features |= MMD_FEATURE_MATH;
+    if (key_set_has(keys, IMAGE) || key_set_has(keys, IMAGEBLOCK))
+        features |= MMD_FEATURE_IMAGES;
+    return features;
+}
+
+/* mmd_document_metadata - step through the metadata of a document in the
+ * order it is given.  Start with '*cursor' NULL; each call that returns
+ * true sets 'key' and 'value' to the next entry and advances '*cursor'.
+ * Keys are normalized (lowercase, without spaces), as the writers see
+ * them; a key given twice is returned twice. */
+bool mmd_document_metadata(const mmd_document_t *doc, mmd_metadata_cursor *cursor, const char **key, const char **value) {
+    const element *next;
+
+    if (*cursor == NULL)
+        next = (doc->index.metadata != NULL) ? doc->index.metadata->children : NULL;
+    else
+        next = ((const element *) *cursor)->next;
+    if (next == NULL)
+        return false;
+    *key = next->contents.str;
+    *value = next->children->contents.str;
+    *cursor = next;
+    return true;
+}
+
+/* mmd_document_metadata_value - the value of the metadata 'key' of a
+ * document, or NULL if it has none.  'key' is normalized first, so
+ * "LaTeX Mode" finds the value of latexmode.  The value belongs to the
+ * document. */
+const char * mmd_document_metadata_value(const mmd_document_t *doc, const char *key) {
+    element *entry = document_index_metadata(&doc->index, (char *) key);
+    return (entry != NULL) ? entry->children->contents.str : NULL;
+}
+
+/* mmd_document_free - free a parsed document and all of its elements */
+void mmd_document_free(mmd_document_t *doc) {
+    int i;
+
+    if (doc == NULL)
+        return;
+    document_index_free(&doc->index);
+    if (doc->parser != NULL) {
+        for (i = 0; i < mmd_parser_jobs(doc->parser); i++)
+            mmd_parser_free(doc->helpers[i]);
+        free(doc->helpers);
+        mmd_parser_free(doc->parser);
+        free(doc->text);
+    } else {
+        free(doc->loaded.nodes);
+        free(doc->loaded.links);
+#ifndef _WIN32
+        if (doc->mapped != 0)
+            munmap(doc->data, doc->mapped);
+        else
+#endif
+            free(doc->data);
+    }
+    free(doc);
+}
+
+/* markdown_to_gstring - convert markdown text to the output format specified.
+ * Returns a GString, which must be freed after use using g_string_free(). */
+GString * markdown_to_g_string(char *text, int extensions, int output_format) {
+    mmd_parser_t *parser;
+    GString *out;
+
+    parser = mmd_parser_new();
+    out = mmd_parser_to_g_string(parser, text, extensions, output_format);
+    mmd_parser_free(parser);
     return out;
 }
 
@@ -199,13 +883,15 @@ char * extract_metadata_value(char *text, int extensions, char *key) {
     char *value;
     element *result;
     GString *formatted_text;
+    mmd_parser_t *parser;
 
     formatted_text = preformat_text(text);
     
-    result = parse_metadata_only(formatted_text->str, extensions);
-    
+    parser = mmd_parser_new();
+    result = parse_metadata_only(parser, formatted_text->str, extensions);
     value = metavalue_for_key(key, result->children);
-    free_element_list(result);
+    mmd_parser_free(parser);
+    g_string_free(formatted_text, TRUE);
     return value;
 }
 
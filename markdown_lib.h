@@ -23,6 +23,52 @@ enum markdown_formats {
     ODF_BODY_FORMAT
 };
 
+/* Receives output as it is printed, 'len' bytes at a time.  'text' is
+ * not NUL-terminated and is only valid during the call. */
+typedef void (*mmd_write_fn)(const char *text, size_t len, void *data);
+
+/* Opaque parser handle.  A parser holds all the state of a conversion,
+ * so separate parsers may be used concurrently from different threads;
+ * a single parser must not be shared between threads without locking. */
+typedef struct mmd_parser mmd_parser_t;
+
+mmd_parser_t * mmd_parser_new(void);
+void mmd_parser_free(mmd_parser_t *parser);
+void mmd_parser_set_jobs(mmd_parser_t *parser, int jobs);
+GString * mmd_parser_to_g_string(mmd_parser_t *parser, char *text, int extensions, int output_format);
+GString ** mmd_parser_to_g_strings(mmd_parser_t *parser, char *text, int extensions, const int *formats, int count);
+void mmd_parser_write(mmd_parser_t *parser, char *text, int extensions, int output_format, mmd_write_fn write, void *data);
+
+/* Features a parsed document may use; see mmd_document_features(). */
+enum mmd_document_features {
+    MMD_FEATURE_METADATA     = 1 << 0,
+    MMD_FEATURE_NOTES        = 1 << 1,
+    MMD_FEATURE_CITATIONS    = 1 << 2,
+    MMD_FEATURE_GLOSSARY     = 1 << 3,
+    MMD_FEATURE_TABLES       = 1 << 4,
+    MMD_FEATURE_MATH         = 1 << 5,
+    MMD_FEATURE_IMAGES       = 1 << 6,
+};
+
+/* Parsed document.  Printing never changes it, so one document may be
+ * kept and printed any number of times, in different formats, from
+ * different threads at once. */
+typedef struct mmd_document mmd_document_t;
+
+mmd_document_t * mmd_document_new(char *text, int extensions, int jobs);
+GString * mmd_document_to_g_string(const mmd_document_t *doc, int output_format, int base_header_level);
+void mmd_document_write(const mmd_document_t *doc, int output_format, int base_header_level, mmd_write_fn write, void *data);
+bool mmd_document_save(const mmd_document_t *doc, char *path);
+mmd_document_t * mmd_document_load(char *path);
+int mmd_document_features(const mmd_document_t *doc);
+
+/* Position in the metadata of a document; see mmd_document_metadata(). */
+typedef const void *mmd_metadata_cursor;
+
+bool mmd_document_metadata(const mmd_document_t *doc, mmd_metadata_cursor *cursor, const char **key, const char **value);
+const char * mmd_document_metadata_value(const mmd_document_t *doc, const char *key);
+void mmd_document_free(mmd_document_t *doc);
+
 GString * markdown_to_g_string(char *text, int extensions, int output_format);
 char * markdown_to_string(char *text, int extensions, int output_format);
 
@@ -6,6 +6,9 @@
   
   portions Copyright (c) 2010-2011 Fletcher T. Penney
 
+  A change to what is printed for some input must bump
+  OUTPUT_CACHE_FORMAT in markdown.c.
+
   This program is free software; you can redistribute it and/or modify
   it under the terms of the GNU General Public License or the MIT
   license.  See LICENSE for details.
@@ -27,61 +30,89 @@
 #include "utility_functions.c"
 #include "odf.c"
 
-static int extensions;
-static int base_header_level = 1;
-static char *latex_footer;
-static int table_column = 0;
-static char *table_alignment;
-static char cell_type = 'd';
-static int language = ENGLISH;
-static bool html_footer = FALSE;
-static int odf_type = 0;
-static bool in_list = FALSE;
-static bool no_latex_footnote = FALSE;
-static bool am_printing_html_footnote = FALSE;
-static int footnote_counter_to_print = 0;
-static int odf_list_needs_end_p = 0;
+#define OUTPUT_CHUNK_SIZE (64 * 1024)   /* Bytes kept before output is
+                                           passed on, when streaming. */
+
+/* render_state - everything that changes while a document is printed.
+ * print_element_list() sets up a fresh one for each call and passes it
+ * down to the element printers, so that several documents (or several
+ * formats of the same document) can be printed at once on different
+ * threads. */
+typedef struct RenderState {
+    int extensions;             /* Syntax extensions selected. */
+    const document_index *index;    /* What is known about the document
+                                       as a whole, or NULL if nothing. */
+    int padded;                 /* Number of newlines after last output. */
+    GSList *endnotes;           /* List of endnotes to print after main content. */
+    GSList *strings;            /* Strings owned by the render state. */
+    struct NoteRecord *notes;   /* What printing has recorded about notes. */
+    int notes_size;
+    int notes_count;
+    int notenumber;             /* Number of footnote. */
+    mmd_write_fn write;         /* Where output is flushed to, or NULL to
+                                   keep all of it in the GString. */
+    void *write_data;
+
+    /* MultiMarkdown state */
+    int base_header_level;
+    bool header_level_fixed;    /* Caller chose base_header_level, so
+                                   metadata does not change it. */
+    char *latex_footer;
+    int table_column;
+    char *table_alignment;
+    char cell_type;
+    int language;
+    bool html_footer;
+    int odf_type;
+    bool no_latex_footnote;
+    bool am_printing_html_footnote;
+    int footnote_counter_to_print;
+    int odf_list_needs_end_p;
+    bool in_list_item;          /* True if we're printing contents of a
+                                   groff list item. */
+} render_state;
 
 static void print_html_string(GString *out, char *str, bool obfuscate);
-static void print_html_element_list(GString *out, element *list, bool obfuscate);
-static void print_html_element(GString *out, element *elt, bool obfuscate);
+static void print_html_element_list(render_state *st, GString *out, element *list, bool obfuscate);
+static void print_html_element(render_state *st, GString *out, element *elt, bool obfuscate);
 static void print_latex_string(GString *out, char *str);
-static void print_latex_element_list(GString *out, element *list);
-static void print_latex_element(GString *out, element *elt);
+static void print_latex_element_list(render_state *st, GString *out, element *list);
+static void print_latex_element(render_state *st, GString *out, element *elt);
 static void print_groff_string(GString *out, char *str);
-static void print_groff_mm_element_list(GString *out, element *list);
-static void print_groff_mm_element(GString *out, element *elt, int count);
+static void print_groff_mm_element_list(render_state *st, GString *out, element *list);
+static void print_groff_mm_element(render_state *st, GString *out, element *elt, int count);
 static void print_odf_code_string(GString *out, char *str);
 static void print_odf_string(GString *out, char *str);
-static void print_odf_element_list(GString *out, element *list);
-static void print_odf_element(GString *out, element *elt);
-static void print_odf_body_element_list(GString *out, element *list);
+static void print_odf_element_list(render_state *st, GString *out, element *list);
+static void print_odf_element(render_state *st, GString *out, element *elt);
+static void print_odf_body_element_list(render_state *st, GString *out, element *list);
 static bool list_contains_key(element *list, int key);
 
 
 /* MultiMarkdown Routines */
-static void print_html_header(GString *out, element *elt, bool obfuscate);
+static void print_html_header(render_state *st, GString *out, element *elt, bool obfuscate);
 static void print_html_footer(GString *out, bool obfuscate);
 
-static void print_latex_header(GString *out, element *elt);
-static void print_latex_footer(GString *out);
+static void print_latex_header(render_state *st, GString *out, element *elt);
+static void print_latex_footer(render_state *st, GString *out);
 
-static void print_memoir_element_list(GString *out, element *list);
-static void print_memoir_element(GString *out, element *elt);
+static void print_memoir_element_list(render_state *st, GString *out, element *list);
+static void print_memoir_element(render_state *st, GString *out, element *elt);
 
-static void print_beamer_element_list(GString *out, element *list);
-static void print_beamer_element(GString *out, element *elt);
+static void print_beamer_element_list(render_state *st, GString *out, element *list);
+static void print_beamer_element(render_state *st, GString *out, element *elt);
 
 static void print_opml_string(GString *out, char *str);
-static void print_opml_element_list(GString *out, element *list);
-static void print_opml_element(GString *out, element *elt);
-static void print_opml_metadata(GString *out, element *elt);
-static void print_opml_section_and_children(GString *out, element *list);
+static void print_opml_element_list(render_state *st, GString *out, element *list);
+static void print_opml_element(render_state *st, GString *out, element *elt);
+static void print_opml_metadata(render_state *st, GString *out, element *elt);
+static void print_opml_section_and_children(render_state *st, GString *out, element *list);
 
-element * print_html_headingsection(GString *out, element *list, bool obfuscate);
+element * print_html_headingsection(render_state *st, GString *out, element *list, bool obfuscate);
 
-static bool is_html_complete_doc(element *meta);
-static int find_latex_mode(int format, element *list);
+static bool is_html_complete_doc(render_state *st, element *meta);
+static int find_latex_mode(render_state *st, int format, element *list);
+static element * find_metadata(render_state *st, element *list, char *key);
 element * metadata_for_key(char *key, element *list);
 char * metavalue_for_key(char *key, element *list);
 
@@ -89,6 +120,7 @@ element * element_for_attribute(char *querystring, element *list);
 char * dimension_for_attribute(char *querystring, element *list);
 
 element * locator_for_citation(element *elt);
+element * note_for_citation(element *elt);
 
 /**********************************************************************
 
@@ -96,18 +128,106 @@ element * locator_for_citation(element *elt);
 
  ***********************************************************************/
 
-static int padded = 2;      /* Number of newlines after last output.
-                               Starts at 2 so no newlines are needed at start.
-                               */
+/* render_state_init - set up state for printing a new document */
+static void render_state_init(render_state *st, int exts) {
+    memset(st, 0, sizeof(render_state));
+    st->extensions = exts;
+    st->padded = 2;  /* set padding to 2, so no extra blank lines at beginning */
+    st->base_header_level = 1;
+    st->cell_type = 'd';
+    st->language = ENGLISH;
+}
+
+/* set_base_header_level - apply a header level given in metadata, unless
+ * the caller of print_element_list chose one */
+static void set_base_header_level(render_state *st, char *value) {
+    if (!st->header_level_fixed)
+        st->base_header_level = atoi(value);
+}
+
+/* render_state_free - free what the render state owns once printing is done */
+static void render_state_free(render_state *st) {
+    GSList *step;
+    for (step = st->strings; step != NULL; step = step->next)
+        free(step->data);
+    g_slist_free(st->strings);
+    st->strings = NULL;
+    free(st->notes);
+    st->notes = NULL;
+}
 
-static GSList *endnotes = NULL; /* List of endnotes to print after main content. */
-static int notenumber = 0;  /* Number of footnote. */
+/* flush_output - hand what has been printed to 'out' so far to the
+ * render state's write function, once there is enough of it.  The
+ * printers only ever append to 'out', so it may be emptied between any
+ * two elements. */
+static void flush_output(render_state *st, GString *out) {
+    if (st->write == NULL || out->currentStringLength < OUTPUT_CHUNK_SIZE)
+        return;
+    st->write(out->str, out->currentStringLength, st->write_data);
+    out->currentStringLength = 0;
+    out->str[0] = '\0';
+}
+
+/* Writers that escape text with print_escaped(), one bit each. */
+#define ESCAPE_HTML     1
+#define ESCAPE_ODF      2
+#define ESCAPE_OPML     4
+#define ESCAPE_LATEX    8
+#define ESCAPE_GROFF    16
+
+/* escape_bytes - for each byte, the writers that do not print it as it
+ * is.  The NUL byte ends every string, so it is marked for all of them. */
+static const unsigned char escape_bytes[256] = {
+    31,  0,  0,  0,  0,  0,  0,  0,  0,  0, 14,  0,  0,  4,  0,  0,   /* 0x00 */
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,   /* 0x10 */
+     2,  0,  7,  8,  8,  8, 15,  0,  0,  0,  0,  0,  0,  0,  0,  8,   /* 0x20 */
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0, 15,  0,   /* 0x30 */
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,   /* 0x40 */
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 24,  0,  8,  8,   /* 0x50 */
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,   /* 0x60 */
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  8,  8,  8,  0,   /* 0x70 */
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,   /* 0x80 */
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,   /* 0x90 */
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,   /* 0xA0 */
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,   /* 0xB0 */
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,   /* 0xC0 */
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,   /* 0xD0 */
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,   /* 0xE0 */
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0    /* 0xF0 */
+};
+
+/* print_escaped - print 'str' for 'writer', copying each run of bytes it
+ * leaves as they are in one go.  Every other byte is passed to 'escape',
+ * which prints it and returns the last byte it has dealt with.
+ *
+ * Unlike plain_run_length() in markdown_lib.c, which scans the whole
+ * input, this scans a byte at a time.  Text is printed a word at a time,
+ * so most strings are shorter than one SSE2 vector, and the runs between
+ * escaped bytes are shorter still. */
+static void print_escaped(GString *out, char *str, int writer, char *(*escape)(GString *out, char *str)) {
+    char *run;
+
+    for (;;) {
+        run = str;
+        while ((escape_bytes[(unsigned char) *str] & writer) == 0)
+            str++;
+        g_string_append_len(out, run, str - run);
+        if (*str == '\0')
+            return;
+        str = escape(out, str) + 1;
+    }
+}
+
+/* may_contain - false if the document is known not to contain 'key' */
+static bool may_contain(render_state *st, int key) {
+    return st->index == NULL || key_set_has(&st->index->keys, key);
+}
 
 /* pad - add newlines if needed */
-static void pad(GString *out, int num) {
-    while (num-- > padded)
-        g_string_append_printf(out, "\n");;
-    padded = num;
+static void pad(render_state *st, GString *out, int num) {
+    while (num-- > st->padded)
+        g_string_append_literal(out, "\n");;
+    st->padded = num;
 }
 
 /* determine whether a certain element is contained within a given list */
@@ -135,140 +255,228 @@ bool list_contains_key(element *list, int key) {
 
  ***********************************************************************/
 
+/* escape_html - print the character at 'str', escaping for HTML */
+static char *escape_html(GString *out, char *str) {
+    switch (*str) {
+    case '&':
+        g_string_append_literal(out, "&amp;");
+        break;
+    case '<':
+        g_string_append_literal(out, "&lt;");
+        break;
+    case '>':
+        g_string_append_literal(out, "&gt;");
+        break;
+    case '"':
+        g_string_append_literal(out, "&quot;");
+        break;
+    default:
+        g_string_append_c(out, *str);
+    }
+    return str;
+}
+
 /* print_html_string - print string, escaping for HTML  
  * If obfuscate selected, convert characters to hex or decimal entities at random */
 static void print_html_string(GString *out, char *str, bool obfuscate) {
+    if (!obfuscate) {
+        print_escaped(out, str, ESCAPE_HTML, escape_html);
+        return;
+    }
     while (*str != '\0') {
         switch (*str) {
-        case '&':
-            g_string_append_printf(out, "&amp;");
-            break;
-        case '<':
-            g_string_append_printf(out, "&lt;");
-            break;
-        case '>':
-            g_string_append_printf(out, "&gt;");
-            break;
-        case '"':
-            g_string_append_printf(out, "&quot;");
+        case '&': case '<': case '>': case '"':
+            escape_html(out, str);
             break;
         default:
-            if (obfuscate) {
-                if (rand() % 2 == 0)
-                    g_string_append_printf(out, "&#%d;", (int) *str);
-                else
-                    g_string_append_printf(out, "&#x%x;", (unsigned int) *str);
-            }
+            if (rand() % 2 == 0)
+                g_string_append_printf(out, "&#%d;", (int) *str);
             else
-                g_string_append_c(out, *str);
+                g_string_append_printf(out, "&#x%x;", (unsigned int) *str);
         }
     str++;
     }
 }
 
 /* print_html_element_list - print a list of elements as HTML */
-static void print_html_element_list(GString *out, element *list, bool obfuscate) {
+static void print_html_element_list(render_state *st, GString *out, element *list, bool obfuscate) {
     while (list != NULL) {
         if (list->key == HEADINGSECTION) {
-            list = print_html_headingsection(out, list, obfuscate);
+            list = print_html_headingsection(st, out, list, obfuscate);
         } else {
-            print_html_element(out, list, obfuscate);
+            print_html_element(st, out, list, obfuscate);
             list = list->next;
         }
     }
 }
 
-/* add_endnote - add an endnote to global endnotes list. */
-static void add_endnote(element *elt) {
-    endnotes = g_slist_prepend(endnotes, elt);
+/* render_strdup - copy a string that must last until printing is done.
+ * The copy is owned by the render state and freed by render_state_free(). */
+static char *render_strdup(render_state *st, const char *str) {
+    char *copy = strdup(str);
+    st->strings = g_slist_prepend(st->strings, copy);
+    return copy;
+}
+
+/* NoteRecord - what printing has recorded about a note, i.e. about the
+ * content list shared by every reference to it: the number or key it was
+ * given where it was first referenced, and whether that reference was a
+ * citation.  Notes are tracked here rather than in the tree, so that
+ * printing leaves the tree as it found it. */
+typedef struct NoteRecord {
+    element *note;
+    char *mark;
+    bool cited;
+} note_record;
+
+/* note_record_for - the record for 'note', which is added if it does not
+ * exist and 'create' is set; otherwise NULL if there is none */
+static note_record *note_record_for(render_state *st, element *note, bool create) {
+    note_record *old;
+    int old_size;
+    size_t slot;
+    int i;
+
+    if (create && 2 * (st->notes_count + 1) > st->notes_size) {
+        old = st->notes;
+        old_size = st->notes_size;
+        st->notes_size = old_size ? 2 * old_size : 64;
+        st->notes = calloc(st->notes_size, sizeof(note_record));
+        st->notes_count = 0;
+        for (i = 0; i < old_size; i++)
+            if (old[i].note != NULL)
+                *note_record_for(st, old[i].note, true) = old[i];
+        free(old);
+    }
+    if (st->notes_size == 0)
+        return NULL;
+    slot = ((size_t) note / sizeof(element)) & (st->notes_size - 1);
+    while (st->notes[slot].note != NULL && st->notes[slot].note != note)
+        slot = (slot + 1) & (st->notes_size - 1);
+    if (st->notes[slot].note == NULL) {
+        if (!create)
+            return NULL;
+        st->notes[slot].note = note;
+        st->notes_count++;
+    }
+    return &st->notes[slot];
+}
+
+/* note_mark - the number or key 'note' has been given, or NULL */
+static char *note_mark(render_state *st, element *note) {
+    note_record *record = note_record_for(st, note, false);
+    return (record != NULL && record->mark != NULL) ? record->mark : note->contents.str;
+}
+
+/* set_note_mark - record the number or key 'note' has been given */
+static void set_note_mark(render_state *st, element *note, char *mark) {
+    note_record_for(st, note, true)->mark = render_strdup(st, mark);
+}
+
+/* note_key - the key of 'note', which is CITATION once it has been cited */
+static int note_key(render_state *st, element *note) {
+    note_record *record = note_record_for(st, note, false);
+    return (record != NULL && record->cited) ? CITATION : note->key;
+}
+
+/* set_note_cited - record that 'note' has been cited */
+static void set_note_cited(render_state *st, element *note) {
+    note_record_for(st, note, true)->cited = true;
+}
+
+/* add_endnote - add an endnote to the endnotes list. */
+static void add_endnote(render_state *st, element *elt) {
+    st->endnotes = g_slist_prepend(st->endnotes, elt);
 }
 
 /* print_html_element - print an element as HTML */
-static void print_html_element(GString *out, element *elt, bool obfuscate) {
+static void print_html_element(render_state *st, GString *out, element *elt, bool obfuscate) {
     int lev;
     char *label;
     element *attribute;
     element *locator = NULL;
+    element *note;
     char *height;
     char *width;
+    flush_output(st, out);
     switch (elt->key) {
     case SPACE:
-        g_string_append_printf(out, "%s", elt->contents.str);
+        g_string_append(out, elt->contents.str);
         break;
     case LINEBREAK:
-        g_string_append_printf(out, "<br/>\n");
+        g_string_append_literal(out, "<br/>\n");
         break;
     case STR:
         print_html_string(out, elt->contents.str, obfuscate);
         break;
     case ELLIPSIS:
-        localize_typography(out, ELLIP, language, HTMLOUT);
+        localize_typography(out, ELLIP, st->language, HTMLOUT);
         break;
     case EMDASH:
-        localize_typography(out, MDASH, language, HTMLOUT);
+        localize_typography(out, MDASH, st->language, HTMLOUT);
         break;
     case ENDASH:
-        localize_typography(out, NDASH, language, HTMLOUT);
+        localize_typography(out, NDASH, st->language, HTMLOUT);
         break;
     case APOSTROPHE:
-        localize_typography(out, APOS, language, HTMLOUT);
+        localize_typography(out, APOS, st->language, HTMLOUT);
         break;
     case SINGLEQUOTED:
-        localize_typography(out, LSQUOTE, language, HTMLOUT);
-        print_html_element_list(out, elt->children, obfuscate);
-        localize_typography(out, RSQUOTE, language, HTMLOUT);
+        localize_typography(out, LSQUOTE, st->language, HTMLOUT);
+        print_html_element_list(st, out, elt->children, obfuscate);
+        localize_typography(out, RSQUOTE, st->language, HTMLOUT);
         break;
     case DOUBLEQUOTED:
-        localize_typography(out, LDQUOTE, language, HTMLOUT);
-        print_html_element_list(out, elt->children, obfuscate);
-        localize_typography(out, RDQUOTE, language, HTMLOUT);
+        localize_typography(out, LDQUOTE, st->language, HTMLOUT);
+        print_html_element_list(st, out, elt->children, obfuscate);
+        localize_typography(out, RDQUOTE, st->language, HTMLOUT);
         break;
     case CODE:
-        g_string_append_printf(out, "<code>");
+        g_string_append_literal(out, "<code>");
         print_html_string(out, elt->contents.str, obfuscate);
-        g_string_append_printf(out, "</code>");
+        g_string_append_literal(out, "</code>");
         break;
     case HTML:
-        g_string_append_printf(out, "%s", elt->contents.str);
+        g_string_append(out, elt->contents.str);
         break;
     case LINK:
         if (strstr(elt->contents.link->url, "mailto:") == elt->contents.link->url)
             obfuscate = true;  /* obfuscate mailto: links */
-        g_string_append_printf(out, "<a href=\"");
+        g_string_append_literal(out, "<a href=\"");
         print_html_string(out, elt->contents.link->url, obfuscate);
-        g_string_append_printf(out, "\"");
+        g_string_append_literal(out, "\"");
         if (strlen(elt->contents.link->title) > 0) {
-            g_string_append_printf(out, " title=\"");
+            g_string_append_literal(out, " title=\"");
             print_html_string(out, elt->contents.link->title, obfuscate);
-            g_string_append_printf(out, "\"");
+            g_string_append_literal(out, "\"");
         }
-        print_html_element_list(out, elt->contents.link->attr, obfuscate);
-        g_string_append_printf(out, ">");
-        print_html_element_list(out, elt->contents.link->label, obfuscate);
-        g_string_append_printf(out, "</a>");
+        print_html_element_list(st, out, elt->contents.link->attr, obfuscate);
+        g_string_append_literal(out, ">");
+        print_html_element_list(st, out, elt->contents.link->label, obfuscate);
+        g_string_append_literal(out, "</a>");
         break;
     case IMAGEBLOCK:
-        pad(out, 2);
+        pad(st, out, 2);
     case IMAGE:
         if (elt->key == IMAGEBLOCK) {
-            g_string_append_printf(out, "<figure>\n");
+            g_string_append_literal(out, "<figure>\n");
         }
-        g_string_append_printf(out, "<img src=\"");
+        g_string_append_literal(out, "<img src=\"");
         print_html_string(out, elt->contents.link->url, obfuscate);
-        g_string_append_printf(out, "\" alt=\"");
+        g_string_append_literal(out, "\" alt=\"");
         print_raw_element_list(out,elt->contents.link->label);
-        if ( (extension(EXT_COMPATIBILITY)) || 
+        if ( (st->extensions & EXT_COMPATIBILITY) || 
             (strcmp(elt->contents.link->identifier, "") == 0) ) {
-            g_string_append_printf(out, "\"");
+            g_string_append_literal(out, "\"");
         } else {
-            if (!(extension(EXT_COMPATIBILITY))) {
+            if (!(st->extensions & EXT_COMPATIBILITY)) {
 				g_string_append_printf(out, "\" id=\"%s\"",elt->contents.link->identifier);
 			}
         }
         if (strlen(elt->contents.link->title) > 0) {
-            g_string_append_printf(out, " title=\"");
+            g_string_append_literal(out, " title=\"");
             print_html_string(out, elt->contents.link->title, obfuscate);
-            g_string_append_printf(out, "\"");
+            g_string_append_literal(out, "\"");
         }
         width = NULL;
         height = NULL;
@@ -281,134 +489,132 @@ static void print_html_element(GString *out, element *elt, bool obfuscate) {
             width = strdup(attribute->children->contents.str);
         }
         if ((height != NULL) || (width != NULL)) {
-            g_string_append_printf(out, " style=\"");
+            g_string_append_literal(out, " style=\"");
             if (height != NULL)
                 g_string_append_printf(out, "height:%s;", height);
             if (width != NULL)
                 g_string_append_printf(out, "width:%s;", width);
-            g_string_append_printf(out, "\"");
+            g_string_append_literal(out, "\"");
         }
-        print_html_element_list(out, elt->contents.link->attr, obfuscate);
-        g_string_append_printf(out, " />");
+        print_html_element_list(st, out, elt->contents.link->attr, obfuscate);
+        g_string_append_literal(out, " />");
         if (elt->key == IMAGEBLOCK) {
             if (elt->contents.link->label != NULL) {
-                g_string_append_printf(out, "\n<figcaption>");
-                print_html_element_list(out, elt->contents.link->label, obfuscate);
-                g_string_append_printf(out, "</figcaption>");
+                g_string_append_literal(out, "\n<figcaption>");
+                print_html_element_list(st, out, elt->contents.link->label, obfuscate);
+                g_string_append_literal(out, "</figcaption>");
             }
-            g_string_append_printf(out, "</figure>\n");
+            g_string_append_literal(out, "</figure>\n");
         }
         free(height);
         free(width);
         break;
     case EMPH:
-        g_string_append_printf(out, "<em>");
-        print_html_element_list(out, elt->children, obfuscate);
-        g_string_append_printf(out, "</em>");
+        g_string_append_literal(out, "<em>");
+        print_html_element_list(st, out, elt->children, obfuscate);
+        g_string_append_literal(out, "</em>");
         break;
     case STRONG:
-        g_string_append_printf(out, "<strong>");
-        print_html_element_list(out, elt->children, obfuscate);
-        g_string_append_printf(out, "</strong>");
+        g_string_append_literal(out, "<strong>");
+        print_html_element_list(st, out, elt->children, obfuscate);
+        g_string_append_literal(out, "</strong>");
         break;
     case LIST:
-        print_html_element_list(out, elt->children, obfuscate);
+        print_html_element_list(st, out, elt->children, obfuscate);
         break;
     case RAW:
         /* Shouldn't occur - these are handled by process_raw_blocks() */
         assert(elt->key != RAW);
         break;
     case H1: case H2: case H3: case H4: case H5: case H6:
-        lev = elt->key - H1 + base_header_level;  /* assumes H1 ... H6 are in order */
+        lev = elt->key - H1 + st->base_header_level;  /* assumes H1 ... H6 are in order */
         if (lev > 6)
             lev = 6;
-        pad(out, 2);
-        if ( extension(EXT_COMPATIBILITY) ) {
+        pad(st, out, 2);
+        if ( (st->extensions & EXT_COMPATIBILITY) ) {
             /* Use regular Markdown header format */
             g_string_append_printf(out, "<h%1d>", lev);
-            print_html_element_list(out, elt->children, obfuscate);
+            print_html_element_list(st, out, elt->children, obfuscate);
         } else if (elt->children->key == AUTOLABEL) {
             /* generate a label for each header (MMD)*/
-            g_string_append_printf(out, "<h%d id=\"%s\">", lev,elt->children->contents.str);
-            print_html_element_list(out, elt->children->next, obfuscate);
+            g_string_append_printf(out, "<h%d id=\"%s\">", lev, elt->contents.str);
+            print_html_element_list(st, out, elt->children->next, obfuscate);
         } else {
-            label = label_from_element_list(elt->children, obfuscate);
-            g_string_append_printf(out, "<h%d id=\"%s\">", lev, label);
-            print_html_element_list(out, elt->children, obfuscate);
-            free(label);
+            g_string_append_printf(out, "<h%d id=\"%s\">", lev, elt->contents.str);
+            print_html_element_list(st, out, elt->children, obfuscate);
         }
         g_string_append_printf(out, "</h%1d>", lev);
-        padded = 0;
+        st->padded = 0;
         break;
     case PLAIN:
-        pad(out, 1);
-        print_html_element_list(out, elt->children, obfuscate);
-        padded = 0;
+        pad(st, out, 1);
+        print_html_element_list(st, out, elt->children, obfuscate);
+        st->padded = 0;
         break;
     case PARA:
-        pad(out, 2);
-        g_string_append_printf(out, "<p>");
-        print_html_element_list(out, elt->children, obfuscate);
-		if (am_printing_html_footnote && ( elt->next == NULL)) {
-			g_string_append_printf(out, " <a href=\"#fnref:%d\" title=\"return to article\" class=\"reversefootnote\">&#160;&#8617;</a>", footnote_counter_to_print);
+        pad(st, out, 2);
+        g_string_append_literal(out, "<p>");
+        print_html_element_list(st, out, elt->children, obfuscate);
+		if (st->am_printing_html_footnote && ( elt->next == NULL)) {
+			g_string_append_printf(out, " <a href=\"#fnref:%d\" title=\"return to article\" class=\"reversefootnote\">&#160;&#8617;</a>", st->footnote_counter_to_print);
 			/* Only print once. For now, it's the first paragraph, until
 				I can figure out to make it the last paragraph */
-			am_printing_html_footnote = FALSE;
+			st->am_printing_html_footnote = FALSE;
 		}
-        g_string_append_printf(out, "</p>");
-        padded = 0;
+        g_string_append_literal(out, "</p>");
+        st->padded = 0;
         break;
     case HRULE:
-        pad(out, 2);
-        g_string_append_printf(out, "<hr />");
-        padded = 0;
+        pad(st, out, 2);
+        g_string_append_literal(out, "<hr />");
+        st->padded = 0;
         break;
     case HTMLBLOCK:
-        pad(out, 2);
-        g_string_append_printf(out, "%s", elt->contents.str);
-        padded = 0;
+        pad(st, out, 2);
+        g_string_append(out, elt->contents.str);
+        st->padded = 0;
         break;
     case VERBATIM:
-        pad(out, 2);
-        g_string_append_printf(out, "%s", "<pre><code>");
+        pad(st, out, 2);
+        g_string_append_literal(out, "<pre><code>");
         print_html_string(out, elt->contents.str, obfuscate);
-        g_string_append_printf(out, "%s", "</code></pre>");
-        padded = 0;
+        g_string_append_literal(out, "</code></pre>");
+        st->padded = 0;
         break;
     case BULLETLIST:
-        pad(out, 2);
-        g_string_append_printf(out, "%s", "<ul>");
-        padded = 0;
-        print_html_element_list(out, elt->children, obfuscate);
-        pad(out, 1);
-        g_string_append_printf(out, "%s", "</ul>");
-        padded = 0;
+        pad(st, out, 2);
+        g_string_append_literal(out, "<ul>");
+        st->padded = 0;
+        print_html_element_list(st, out, elt->children, obfuscate);
+        pad(st, out, 1);
+        g_string_append_literal(out, "</ul>");
+        st->padded = 0;
         break;
     case ORDEREDLIST:
-        pad(out, 2);
-        g_string_append_printf(out, "%s", "<ol>");
-        padded = 0;
-        print_html_element_list(out, elt->children, obfuscate);
-        pad(out, 1);
-        g_string_append_printf(out, "</ol>");
-        padded = 0;
+        pad(st, out, 2);
+        g_string_append_literal(out, "<ol>");
+        st->padded = 0;
+        print_html_element_list(st, out, elt->children, obfuscate);
+        pad(st, out, 1);
+        g_string_append_literal(out, "</ol>");
+        st->padded = 0;
         break;
     case LISTITEM:
-        pad(out, 1);
-        g_string_append_printf(out, "<li>");
-        padded = 2;
-        print_html_element_list(out, elt->children, obfuscate);
-        g_string_append_printf(out, "</li>");
-        padded = 0;
+        pad(st, out, 1);
+        g_string_append_literal(out, "<li>");
+        st->padded = 2;
+        print_html_element_list(st, out, elt->children, obfuscate);
+        g_string_append_literal(out, "</li>");
+        st->padded = 0;
         break;
     case BLOCKQUOTE:
-        pad(out, 2);
-        g_string_append_printf(out, "<blockquote>\n");
-        padded = 2;
-        print_html_element_list(out, elt->children, obfuscate);
-        pad(out, 1);
-        g_string_append_printf(out, "</blockquote>");
-        padded = 0;
+        pad(st, out, 2);
+        g_string_append_literal(out, "<blockquote>\n");
+        st->padded = 2;
+        print_html_element_list(st, out, elt->children, obfuscate);
+        pad(st, out, 1);
+        g_string_append_literal(out, "</blockquote>");
+        st->padded = 0;
         break;
     case REFERENCE:
         /* Nonprinting */
@@ -420,42 +626,41 @@ static void print_html_element(GString *out, element *elt, bool obfuscate) {
         /* if contents.str == 0, then print note; else ignore, since this
          * is a note block that has been incorporated into the notes list */
         if (elt->contents.str == 0) {
-            if ( (elt->children->contents.str == 0) ){
+            if (note_mark(st, elt->children) == 0) {
                 /* The referenced note has not been used before */
-                add_endnote(elt->children);
-                ++notenumber;
-                char buf[5];
-                sprintf(buf,"%d",notenumber);
+                add_endnote(st, elt->children);
+                ++st->notenumber;
+                char buf[12];
+                sprintf(buf,"%d",st->notenumber);
                 /* Assign footnote number for future use */
-                elt->children->contents.str = strdup(buf);
-                if (elt->children->key == GLOSSARYTERM) {
+                set_note_mark(st, elt->children, buf);
+                if (note_key(st, elt->children) == GLOSSARYTERM) {
                     g_string_append_printf(out, "<a href=\"#fn:%d\" id=\"fnref:%d\" title=\"see footnote\" class=\"footnote glossary\">[%d]</a>",
-                                notenumber, notenumber, notenumber);
+                                st->notenumber, st->notenumber, st->notenumber);
                 } else {
                     g_string_append_printf(out, "<a href=\"#fn:%d\" id=\"fnref:%d\" title=\"see footnote\" class=\"footnote\">[%d]</a>",
-                                notenumber, notenumber, notenumber);
+                                st->notenumber, st->notenumber, st->notenumber);
                 }
             } else {
                 /* The referenced note has already been used */
                 g_string_append_printf(out, "<a href=\"#fn:%s\" title=\"see footnote\" class=\"footnote\">[%s]</a>",
-                    elt->children->contents.str, elt->children->contents.str);
+                    note_mark(st, elt->children), note_mark(st, elt->children));
             }
         }
-        elt->children = NULL;
         break;
     case GLOSSARY:
         /* Shouldn't do anything */
         break;
     case GLOSSARYTERM:
-        g_string_append_printf(out,"<span class=\"glossary name\">");
+        g_string_append_literal(out,"<span class=\"glossary name\">");
         print_html_string(out, elt->children->contents.str, obfuscate);
-        g_string_append_printf(out, "</span>");
+        g_string_append_literal(out, "</span>");
         if ((elt->next != NULL) && (elt->next->key == GLOSSARYSORTKEY) ) {
-            g_string_append_printf(out, "<span class=\"glossary sort\" style=\"display:none\">");
+            g_string_append_literal(out, "<span class=\"glossary sort\" style=\"display:none\">");
             print_html_string(out, elt->next->contents.str, obfuscate);
-            g_string_append_printf(out, "</span>");
+            g_string_append_literal(out, "</span>");
         }
-        g_string_append_printf(out, ": ");
+        g_string_append_literal(out, ": ");
         break;
     case GLOSSARYSORTKEY:
         break;
@@ -471,124 +676,123 @@ static void print_html_element(GString *out, element *elt, bool obfuscate) {
                 g_string_append_printf(out, "<span class=\"notcited\" id=\"%s\"/>", elt->contents.str);
             } else {
                 /* work was cited, so output normally */
-                g_string_append_printf(out, "<span class=\"externalcitation\">");
+                g_string_append_literal(out, "<span class=\"externalcitation\">");
                 if (locator != NULL) {
-                    g_string_append_printf(out, "[");
-                    print_html_element(out,locator,obfuscate);
-                    g_string_append_printf(out, "]");
+                    g_string_append_literal(out, "[");
+                    print_html_element(st, out,locator,obfuscate);
+                    g_string_append_literal(out, "]");
                 }
-                g_string_append_printf(out, "%s",elt->contents.str);
-                g_string_append_printf(out, "</span>");
+                g_string_append(out, elt->contents.str);
+                g_string_append_literal(out, "</span>");
             }
         } else {
             /* reference specified within the MMD document,
                so will output as footnote */
-            if (elt->children->contents.str == NULL) {
+            note = note_for_citation(elt);
+            if (note_mark(st, note) == NULL) {
                 /* Work not previously cited in this document,
                    so create "endnote" */
-                elt->children->key = CITATION;
-                add_endnote(elt->children);
-                ++notenumber;
-                char buf[5];
-                sprintf(buf,"%d",notenumber);
+                set_note_cited(st, note);
+                add_endnote(st, note);
+                ++st->notenumber;
+                char buf[12];
+                sprintf(buf,"%d",st->notenumber);
                 /* Store the number for future reference */
-                elt->children->contents.str = strdup(buf);
+                set_note_mark(st, note, buf);
             }
             if (locator != NULL) {
                 if ( elt->key == NOCITATION ) {
                     g_string_append_printf(out, "<span class=\"notcited\" id=\"%s\">",
-                        elt->children->contents.str);
+                        note_mark(st, note));
                 } else {
-                    g_string_append_printf(out, "<a class=\"citation\" href=\"#fn:%s\" title=\"Jump to citation\">[<span class=\"locator\">", elt->children->contents.str);
-                    print_html_element(out,locator,obfuscate);
+                    g_string_append_printf(out, "<a class=\"citation\" href=\"#fn:%s\" title=\"Jump to citation\">[<span class=\"locator\">", note_mark(st, note));
+                    print_html_element(st, out,locator,obfuscate);
                     g_string_append_printf(out,"</span>, %s]",
-                        elt->children->contents.str);
+                        note_mark(st, note));
                 }
             } else {
                 g_string_append_printf(out, "<a class=\"citation\" href=\"#fn:%s\" title=\"Jump to citation\">[%s]",
-                    elt->children->contents.str, elt->children->contents.str);
+                    note_mark(st, note), note_mark(st, note));
             }
-            /* Now prune children since will likely be shared elsewhere */
-            elt->children = NULL;
 
             g_string_append_printf(out, "<span class=\"citekey\" style=\"display:none\">%s</span>", elt->contents.str);
             if ((locator != NULL) && (elt->key == NOCITATION)) {
-                    g_string_append_printf(out,"</span>");
+                    g_string_append_literal(out,"</span>");
             } else {
-                g_string_append_printf(out,"</a>");
+                g_string_append_literal(out,"</a>");
             }
         }
         break;
     case LOCATOR:
-        print_html_element_list(out, elt->children, obfuscate);
+        print_html_element_list(st, out, elt->children, obfuscate);
         break;
     case DEFLIST:
-        pad(out,1);
-        padded = 1;
-        g_string_append_printf(out, "<dl>\n");
-        print_html_element_list(out, elt->children, obfuscate);
-        g_string_append_printf(out, "</dl>\n");
-        padded = 0;
+        pad(st, out,1);
+        st->padded = 1;
+        g_string_append_literal(out, "<dl>\n");
+        print_html_element_list(st, out, elt->children, obfuscate);
+        g_string_append_literal(out, "</dl>\n");
+        st->padded = 0;
         break;
     case TERM:
-        pad(out,1);
-        g_string_append_printf(out, "<dt>");
-        print_html_element_list(out, elt->children, obfuscate);
-        g_string_append_printf(out, "</dt>\n");
-        padded = 1;
+        pad(st, out,1);
+        g_string_append_literal(out, "<dt>");
+        print_html_element_list(st, out, elt->children, obfuscate);
+        g_string_append_literal(out, "</dt>\n");
+        st->padded = 1;
         break;
     case DEFINITION:
-        pad(out,1);
-        padded = 1;
-        g_string_append_printf(out, "<dd>");
-        print_html_element_list(out, elt->children, obfuscate);
-        g_string_append_printf(out, "</dd>\n");
-        padded = 0;
+        pad(st, out,1);
+        st->padded = 1;
+        g_string_append_literal(out, "<dd>");
+        print_html_element_list(st, out, elt->children, obfuscate);
+        g_string_append_literal(out, "</dd>\n");
+        st->padded = 0;
         break;
     case METADATA:
         /* Metadata is present, so this should be a "complete" document */
-        html_footer = is_html_complete_doc(elt);
-        if (html_footer) {
-            print_html_header(out, elt, obfuscate);
+        st->html_footer = is_html_complete_doc(st, elt);
+        if (st->html_footer) {
+            print_html_header(st, out, elt, obfuscate);
         } else {
-            print_html_element_list(out, elt->children, obfuscate);
+            print_html_element_list(st, out, elt->children, obfuscate);
         }
         break;
     case METAKEY:
         if (strcmp(elt->contents.str, "title") == 0) {
-            g_string_append_printf(out, "\t<title>");
-            print_html_element(out, elt->children, obfuscate);
-            g_string_append_printf(out, "</title>\n");
+            g_string_append_literal(out, "\t<title>");
+            print_html_element(st, out, elt->children, obfuscate);
+            g_string_append_literal(out, "</title>\n");
         } else if (strcmp(elt->contents.str, "css") == 0) {
-            g_string_append_printf(out, "\t<link type=\"text/css\" rel=\"stylesheet\" href=\"");
-            print_html_element(out, elt->children, obfuscate);
-            g_string_append_printf(out, "\"/>\n");
+            g_string_append_literal(out, "\t<link type=\"text/css\" rel=\"stylesheet\" href=\"");
+            print_html_element(st, out, elt->children, obfuscate);
+            g_string_append_literal(out, "\"/>\n");
         } else if (strcmp(elt->contents.str, "xhtmlheader") == 0) {
             print_raw_element(out, elt->children);
-            g_string_append_printf(out, "\n");
+            g_string_append_literal(out, "\n");
         } else if (strcmp(elt->contents.str, "htmlheader") == 0) {
             print_raw_element(out, elt->children);
-            g_string_append_printf(out, "\n");
+            g_string_append_literal(out, "\n");
         } else if (strcmp(elt->contents.str, "baseheaderlevel") == 0) {
-            base_header_level = atoi(elt->children->contents.str);
+            set_base_header_level(st, elt->children->contents.str);
         } else if (strcmp(elt->contents.str, "xhtmlheaderlevel") == 0) {
-            base_header_level = atoi(elt->children->contents.str);
+            set_base_header_level(st, elt->children->contents.str);
         } else if (strcmp(elt->contents.str, "htmlheaderlevel") == 0) {
-            base_header_level = atoi(elt->children->contents.str);
+            set_base_header_level(st, elt->children->contents.str);
         } else if (strcmp(elt->contents.str, "quoteslanguage") == 0) {
             label = label_from_element_list(elt->children, 0);
-            if (strcmp(label, "dutch") == 0) { language = DUTCH; } else 
-            if (strcmp(label, "german") == 0) { language = GERMAN; } else 
-            if (strcmp(label, "germanguillemets") == 0) { language = GERMANGUILL; } else 
-            if (strcmp(label, "french") == 0) { language = FRENCH; } else 
-            if (strcmp(label, "swedish") == 0) { language = SWEDISH; }
+            if (strcmp(label, "dutch") == 0) { st->language = DUTCH; } else 
+            if (strcmp(label, "german") == 0) { st->language = GERMAN; } else 
+            if (strcmp(label, "germanguillemets") == 0) { st->language = GERMANGUILL; } else 
+            if (strcmp(label, "french") == 0) { st->language = FRENCH; } else 
+            if (strcmp(label, "swedish") == 0) { st->language = SWEDISH; }
             free(label);
        } else {
-            g_string_append_printf(out, "\t<meta name=\"");
+            g_string_append_literal(out, "\t<meta name=\"");
             print_html_string(out, elt->contents.str, obfuscate);
-            g_string_append_printf(out, "\" content=\"");
-            print_html_element(out, elt->children, obfuscate);
-            g_string_append_printf(out, "\"/>\n");
+            g_string_append_literal(out, "\" content=\"");
+            print_html_element(st, out, elt->children, obfuscate);
+            g_string_append_literal(out, "\"/>\n");
         }
         break;
     case METAVALUE:
@@ -597,85 +801,91 @@ static void print_html_element(GString *out, element *elt, bool obfuscate) {
     case FOOTER:
         break;
     case HEADINGSECTION:
-        print_html_element_list(out, elt->children, obfuscate);
+        print_html_element_list(st, out, elt->children, obfuscate);
         break;
     case TABLE:
-        g_string_append_printf(out, "\n\n<table>\n");
-        print_html_element_list(out, elt->children, obfuscate);
-        g_string_append_printf(out, "</table>\n");
+        g_string_append_literal(out, "\n\n<table>\n");
+        print_html_element_list(st, out, elt->children, obfuscate);
+        g_string_append_literal(out, "</table>\n");
         break;
     case TABLESEPARATOR:
-        table_alignment = elt->contents.str;
+        st->table_alignment = elt->contents.str;
         break;
     case TABLECAPTION:
-        if (elt->children->key == TABLELABEL) {
-            label = label_from_element_list(elt->children->children,obfuscate);
-        } else {
-            label = label_from_element_list(elt->children,obfuscate);
-        }
-        g_string_append_printf(out, "<caption id=\"%s\">", label);
-        print_html_element_list(out, elt->children, obfuscate);
-        g_string_append_printf(out, "</caption>\n");
-        free(label);
+        g_string_append_printf(out, "<caption id=\"%s\">", elt->contents.str);
+        print_html_element_list(st, out, elt->children, obfuscate);
+        g_string_append_literal(out, "</caption>\n");
         break;
     case TABLELABEL:
         break;
     case TABLEHEAD:
         /* print column alignment for XSLT processing if needed */
-        g_string_append_printf(out, "<colgroup>\n");
-        for (table_column=0;table_column<strlen(table_alignment);table_column++) {
-           if ( strncmp(&table_alignment[table_column],"r",1) == 0) {
-                g_string_append_printf(out, "<col style=\"text-align:right;\"/>\n");
-            } else if ( strncmp(&table_alignment[table_column],"R",1) == 0) {
-                g_string_append_printf(out, "<col style=\"text-align:right;\" class=\"extended\"/>\n");
-            } else if ( strncmp(&table_alignment[table_column],"c",1) == 0) {
-                g_string_append_printf(out, "<col style=\"text-align:center;\"/>\n");
-            } else if ( strncmp(&table_alignment[table_column],"C",1) == 0) {
-                g_string_append_printf(out, "<col style=\"text-align:center;\" class=\"extended\"/>\n");
-            } else if ( strncmp(&table_alignment[table_column],"L",1) == 0) {
-                g_string_append_printf(out, "<col style=\"text-align:left;\" class=\"extended\"/>\n");
+        g_string_append_literal(out, "<colgroup>\n");
+        for (st->table_column=0;st->table_column<strlen(st->table_alignment);st->table_column++) {
+           if ( strncmp(&st->table_alignment[st->table_column],"r",1) == 0) {
+                g_string_append_literal(out, "<col style=\"text-align:right;\"/>\n");
+            } else if ( strncmp(&st->table_alignment[st->table_column],"R",1) == 0) {
+                g_string_append_literal(out, "<col style=\"text-align:right;\" class=\"extended\"/>\n");
+            } else if ( strncmp(&st->table_alignment[st->table_column],"c",1) == 0) {
+                g_string_append_literal(out, "<col style=\"text-align:center;\"/>\n");
+            } else if ( strncmp(&st->table_alignment[st->table_column],"C",1) == 0) {
+                g_string_append_literal(out, "<col style=\"text-align:center;\" class=\"extended\"/>\n");
+            } else if ( strncmp(&st->table_alignment[st->table_column],"L",1) == 0) {
+                g_string_append_literal(out, "<col style=\"text-align:left;\" class=\"extended\"/>\n");
             } else {
-                g_string_append_printf(out, "<col style=\"text-align:left;\"/>\n");
+                g_string_append_literal(out, "<col style=\"text-align:left;\"/>\n");
             }
         }
-        g_string_append_printf(out, "</colgroup>\n");
-        cell_type = 'h';
-        g_string_append_printf(out, "\n<thead>\n");
-        print_html_element_list(out, elt->children, obfuscate);
-        g_string_append_printf(out, "</thead>\n");
-        cell_type = 'd';
+        g_string_append_literal(out, "</colgroup>\n");
+        st->cell_type = 'h';
+        g_string_append_literal(out, "\n<thead>\n");
+        print_html_element_list(st, out, elt->children, obfuscate);
+        g_string_append_literal(out, "</thead>\n");
+        st->cell_type = 'd';
         break;
     case TABLEBODY:
-        g_string_append_printf(out, "\n<tbody>\n");
-        print_html_element_list(out, elt->children, obfuscate);
-        g_string_append_printf(out, "</tbody>\n");
+        g_string_append_literal(out, "\n<tbody>\n");
+        print_html_element_list(st, out, elt->children, obfuscate);
+        g_string_append_literal(out, "</tbody>\n");
         break;
     case TABLEROW:
-        g_string_append_printf(out, "<tr>\n");
-        table_column = 0;
-        print_html_element_list(out, elt->children, obfuscate);
-        g_string_append_printf(out, "</tr>\n");
+        g_string_append_literal(out, "<tr>\n");
+        st->table_column = 0;
+        print_html_element_list(st, out, elt->children, obfuscate);
+        g_string_append_literal(out, "</tr>\n");
         break;
     case TABLECELL:
-        if ( strncmp(&table_alignment[table_column],"r",1) == 0) {
-            g_string_append_printf(out, "\t<t%c style=\"text-align:right;\"", cell_type);
-        } else if ( strncmp(&table_alignment[table_column],"R",1) == 0) {
-            g_string_append_printf(out, "\t<t%c style=\"text-align:right;\"", cell_type);
-        } else if ( strncmp(&table_alignment[table_column],"c",1) == 0) {
-            g_string_append_printf(out, "\t<t%c style=\"text-align:center;\"", cell_type);
-        } else if ( strncmp(&table_alignment[table_column],"C",1) == 0) {
-            g_string_append_printf(out, "\t<t%c style=\"text-align:center;\"", cell_type);
+        if ( strncmp(&st->table_alignment[st->table_column],"r",1) == 0) {
+            g_string_append_literal(out, "\t<t");
+            g_string_append_c(out, st->cell_type);
+            g_string_append_literal(out, " style=\"text-align:right;\"");
+        } else if ( strncmp(&st->table_alignment[st->table_column],"R",1) == 0) {
+            g_string_append_literal(out, "\t<t");
+            g_string_append_c(out, st->cell_type);
+            g_string_append_literal(out, " style=\"text-align:right;\"");
+        } else if ( strncmp(&st->table_alignment[st->table_column],"c",1) == 0) {
+            g_string_append_literal(out, "\t<t");
+            g_string_append_c(out, st->cell_type);
+            g_string_append_literal(out, " style=\"text-align:center;\"");
+        } else if ( strncmp(&st->table_alignment[st->table_column],"C",1) == 0) {
+            g_string_append_literal(out, "\t<t");
+            g_string_append_c(out, st->cell_type);
+            g_string_append_literal(out, " style=\"text-align:center;\"");
         } else {
-            g_string_append_printf(out, "\t<t%c style=\"text-align:left;\"", cell_type);
+            g_string_append_literal(out, "\t<t");
+            g_string_append_c(out, st->cell_type);
+            g_string_append_literal(out, " style=\"text-align:left;\"");
         }
         if ((elt->children != NULL) && (elt->children->key == CELLSPAN)) {
             g_string_append_printf(out, " colspan=\"%d\"",(int)strlen(elt->children->contents.str)+1);
         }
-        g_string_append_printf(out, ">");
-        padded = 2;
-        print_html_element_list(out, elt->children, obfuscate);
-        g_string_append_printf(out, "</t%c>\n", cell_type);
-        table_column++;
+        g_string_append_literal(out, ">");
+        st->padded = 2;
+        print_html_element_list(st, out, elt->children, obfuscate);
+        g_string_append_literal(out, "</t");
+        g_string_append_c(out, st->cell_type);
+        g_string_append_literal(out, ">\n");
+        st->table_column++;
         break;
     case CELLSPAN:
         break;
@@ -688,12 +898,11 @@ static void print_html_element(GString *out, element *elt, bool obfuscate) {
         }
         break;
     case MATHSPAN:
+        /* Replace the closing "\\]" or "\\)" with "\]" or "\)" */
         if ( elt->contents.str[strlen(elt->contents.str)-1] == ']') {
-            elt->contents.str[strlen(elt->contents.str)-3] = '\0';
-            g_string_append_printf(out, "<span class=\"math\">%s\\]</span>", elt->contents.str);
+            g_string_append_printf(out, "<span class=\"math\">%.*s\\]</span>", (int)strlen(elt->contents.str)-3, elt->contents.str);
         } else {
-            elt->contents.str[strlen(elt->contents.str)-3] = '\0';
-            g_string_append_printf(out, "<span class=\"math\">%s\\)</span>", elt->contents.str);
+            g_string_append_printf(out, "<span class=\"math\">%.*s\\)</span>", (int)strlen(elt->contents.str)-3, elt->contents.str);
         }
         break;
     default: 
@@ -702,48 +911,48 @@ static void print_html_element(GString *out, element *elt, bool obfuscate) {
     }
 }
 
-static void print_html_endnotes(GString *out) {
+static void print_html_endnotes(render_state *st, GString *out) {
     int counter = 0;
     GSList *note;
     element *note_elt;
-    if (endnotes == NULL) 
+    if (st->endnotes == NULL) 
         return;
-    note = g_slist_reverse(endnotes);
-    g_string_append_printf(out, "<div class=\"footnotes\">\n<hr />\n<ol>");
+    note = g_slist_reverse(st->endnotes);
+    g_string_append_literal(out, "<div class=\"footnotes\">\n<hr />\n<ol>");
     while (note != NULL) {
         note_elt = note->data;
         counter++;
-        pad(out, 1);
-        if (note_elt->key == CITATION) {
-            g_string_append_printf(out, "<li id=\"fn:%s\" class=\"citation\"><span class=\"citekey\" style=\"display:none\">", note_elt->contents.str);
+        pad(st, out, 1);
+        if (note_key(st, note_elt) == CITATION) {
+            g_string_append_printf(out, "<li id=\"fn:%s\" class=\"citation\"><span class=\"citekey\" style=\"display:none\">", note_mark(st, note_elt));
             element *temp = note_elt;
             while ( temp != NULL ) {
                 if (temp->key == NOTELABEL)
                     print_html_string(out, temp->contents.str, 0);
                 temp = temp->next;
             }
-            g_string_append_printf(out, "</span>");
-            padded = 2;
-            print_html_element_list(out, note_elt->children, false);
-            pad(out, 1);
-            g_string_append_printf(out, "</li>");
+            g_string_append_literal(out, "</span>");
+            st->padded = 2;
+            print_html_element_list(st, out, note_elt->children, false);
+            pad(st, out, 1);
+            g_string_append_literal(out, "</li>");
         } else {
             g_string_append_printf(out, "<li id=\"fn:%d\">\n", counter);
-            padded = 2;
-			am_printing_html_footnote = TRUE;
-			footnote_counter_to_print = counter;
-            print_html_element_list(out, note_elt, false);
-			am_printing_html_footnote = FALSE;
-			footnote_counter_to_print = 0;
-            pad(out, 1);
-            g_string_append_printf(out, "</li>");
+            st->padded = 2;
+			st->am_printing_html_footnote = TRUE;
+			st->footnote_counter_to_print = counter;
+            print_html_element_list(st, out, note_elt, false);
+			st->am_printing_html_footnote = FALSE;
+			st->footnote_counter_to_print = 0;
+            pad(st, out, 1);
+            g_string_append_literal(out, "</li>");
         }
         note = note->next;
     }
-    pad(out, 1);
-    g_string_append_printf(out, "</ol>\n</div>\n");
+    pad(st, out, 1);
+    g_string_append_literal(out, "</ol>\n</div>\n");
 
-    g_slist_free(endnotes);
+    g_slist_free(st->endnotes);
 }
 
 /**********************************************************************
@@ -752,145 +961,155 @@ static void print_html_endnotes(GString *out) {
 
  ***********************************************************************/
 
-/* print_latex_string - print string, escaping for LaTeX */
-static void print_latex_string(GString *out, char *str) {
+/* escape_latex - print the character at 'str', escaping for LaTeX */
+static char *escape_latex(GString *out, char *str) {
     char *tmp;
-    while (*str != '\0') {
-        switch (*str) {
-          case '{': case '}': case '$': case '%':
-          case '&': case '_': case '#':
-            g_string_append_printf(out, "\\%c", *str);
-            break;
-        case '^':
-            g_string_append_printf(out, "\\^{}");
-            break;
-        case '\\':
-            g_string_append_printf(out, "$\\backslash$");
-            break;
-        case '~':
-            g_string_append_printf(out, "\\ensuremath{\\sim}");
-            break;
-        case '|':
-            g_string_append_printf(out, "\\textbar{}");
-            break;
-        case '<':
-            g_string_append_printf(out, "$<$");
-            break;
-        case '>':
-            g_string_append_printf(out, "$>$");
-            break;
-        case '/':
+    switch (*str) {
+      case '{': case '}': case '$': case '%':
+      case '&': case '_': case '#':
+        g_string_append_c(out, '\\');
+        g_string_append_c(out, *str);
+        break;
+    case '^':
+        g_string_append_literal(out, "\\^{}");
+        break;
+    case '\\':
+        g_string_append_literal(out, "$\\backslash$");
+        break;
+    case '~':
+        g_string_append_literal(out, "\\ensuremath{\\sim}");
+        break;
+    case '|':
+        g_string_append_literal(out, "\\textbar{}");
+        break;
+    case '<':
+        g_string_append_literal(out, "$<$");
+        break;
+    case '>':
+        g_string_append_literal(out, "$>$");
+        break;
+    case '/':
+        str++;
+        while (*str == '/') {
+            g_string_append_literal(out, "/");
             str++;
-            while (*str == '/') {
-                g_string_append_printf(out, "/");
-                str++;
-            }
-            g_string_append_printf(out, "\\slash ");
-            str--;
-            break;
-        case '\n':
-            tmp = str;
+        }
+        g_string_append_literal(out, "\\slash ");
+        str--;
+        break;
+    case '\n':
+        tmp = str;
+        tmp--;
+        if (*tmp == ' ') {
             tmp--;
             if (*tmp == ' ') {
-                tmp--;
-                if (*tmp == ' ') {
-                    g_string_append_printf(out, "\\\\\n");
-                } else {
-                    g_string_append_printf(out, "\n");
-                }
+                g_string_append_literal(out, "\\\\\n");
             } else {
-                g_string_append_printf(out, "\n");
+                g_string_append_literal(out, "\n");
             }
-            break;
-        default:
-            g_string_append_c(out, *str);
+        } else {
+            g_string_append_literal(out, "\n");
         }
-    str++;
+        break;
+    default:
+        g_string_append_c(out, *str);
     }
+    return str;
 }
 
-static void print_latex_endnotes(GString *out) {
+/* print_latex_string - print string, escaping for LaTeX */
+static void print_latex_string(GString *out, char *str) {
+    print_escaped(out, str, ESCAPE_LATEX, escape_latex);
+}
+
+static void print_latex_endnotes(render_state *st, GString *out) {
     GSList *note;
     element *note_elt;
-    if (endnotes == NULL) 
+    if (st->endnotes == NULL) 
         return;
-    note = g_slist_reverse(endnotes);
-    pad(out,2);
-    g_string_append_printf(out, "\\begin{thebibliography}{0}");
+    note = g_slist_reverse(st->endnotes);
+    pad(st, out,2);
+    g_string_append_literal(out, "\\begin{thebibliography}{0}");
     while (note != NULL) {
         note_elt = note->data;
-        pad(out, 1);
-        g_string_append_printf(out, "\\bibitem{%s}\n", note_elt->contents.str);
-        padded=2;
-        print_latex_element_list(out, note_elt);
-        pad(out, 1);
+        pad(st, out, 1);
+        g_string_append_printf(out, "\\bibitem{%s}\n", note_mark(st, note_elt));
+        st->padded=2;
+        print_latex_element_list(st, out, note_elt);
+        pad(st, out, 1);
         note = note->next;
     }
-    pad(out, 1);
-    g_string_append_printf(out, "\\end{thebibliography}\n");
-    padded = 1;
-    g_slist_free(endnotes);
+    pad(st, out, 1);
+    g_string_append_literal(out, "\\end{thebibliography}\n");
+    st->padded = 1;
+    g_slist_free(st->endnotes);
 }
 
 /* print_latex_element_list - print a list of elements as LaTeX */
-static void print_latex_element_list(GString *out, element *list) {
+static void print_latex_element_list(render_state *st, GString *out, element *list) {
     while (list != NULL) {
-        print_latex_element(out, list);
+        print_latex_element(st, out, list);
         list = list->next;
     }
 }
 
 /* print_latex_element - print an element as LaTeX */
-static void print_latex_element(GString *out, element *elt) {
+static void print_latex_element(render_state *st, GString *out, element *elt) {
+    char *key;
+    int keylen;
+    bool textual;
+    element *locator;
+    element *note;
+    char *mark;
     int lev;
     char *label;
     char *height;
     char *width;
     double floatnum;
+    flush_output(st, out);
     switch (elt->key) {
     case SPACE:
-        g_string_append_printf(out, "%s", elt->contents.str);
+        g_string_append(out, elt->contents.str);
         break;
     case LINEBREAK:
-        g_string_append_printf(out, "\\\\\n");
+        g_string_append_literal(out, "\\\\\n");
         break;
     case STR:
         print_latex_string(out, elt->contents.str);
         break;
     case ELLIPSIS:
-        localize_typography(out, ELLIP, language, LATEXOUT);
+        localize_typography(out, ELLIP, st->language, LATEXOUT);
         break;
     case EMDASH: 
-        localize_typography(out, MDASH, language, LATEXOUT);
+        localize_typography(out, MDASH, st->language, LATEXOUT);
         break;
     case ENDASH: 
-        localize_typography(out, NDASH, language, LATEXOUT);
+        localize_typography(out, NDASH, st->language, LATEXOUT);
         break;
     case APOSTROPHE:
-        localize_typography(out, APOS, language, LATEXOUT);
+        localize_typography(out, APOS, st->language, LATEXOUT);
         break;
     case SINGLEQUOTED:
-        localize_typography(out, LSQUOTE, language, LATEXOUT);
-        print_latex_element_list(out, elt->children);
-        localize_typography(out, RSQUOTE, language, LATEXOUT);
+        localize_typography(out, LSQUOTE, st->language, LATEXOUT);
+        print_latex_element_list(st, out, elt->children);
+        localize_typography(out, RSQUOTE, st->language, LATEXOUT);
         break;
     case DOUBLEQUOTED:
-        localize_typography(out, LDQUOTE, language, LATEXOUT);
-        print_latex_element_list(out, elt->children);
-        localize_typography(out, RDQUOTE, language, LATEXOUT);
+        localize_typography(out, LDQUOTE, st->language, LATEXOUT);
+        print_latex_element_list(st, out, elt->children);
+        localize_typography(out, RDQUOTE, st->language, LATEXOUT);
         break;
     case CODE:
-        g_string_append_printf(out, "\\texttt{");
+        g_string_append_literal(out, "\\texttt{");
         print_latex_string(out, elt->contents.str);
-        g_string_append_printf(out, "}");
+        g_string_append_literal(out, "}");
         break;
     case HTML:
         /* don't print HTML */
         /* but do print HTML comments for raw LaTeX */
         if (strncmp(elt->contents.str,"<!--",4) == 0) {
             /* trim "-->" from end */
-            elt->contents.str[strlen(elt->contents.str)-3] = '\0';
-            g_string_append_printf(out, "%s", &elt->contents.str[4]);
+            g_string_append_printf(out, "%.*s", (int)strlen(elt->contents.str)-7, &elt->contents.str[4]);
         }
         break;
     case LINK:
@@ -898,7 +1117,7 @@ static void print_latex_element(GString *out, element *elt) {
             /* This is a link to anchor within document */
             label = label_from_string(elt->contents.link->url,0);
             if (elt->contents.link->label != NULL) {
-                    print_latex_element_list(out, elt->contents.link->label);
+                    print_latex_element_list(st, out, elt->contents.link->label);
                 g_string_append_printf(out, " (\\autoref\{%s})", label);             
             } else {
                 g_string_append_printf(out, "\\autoref\{%s}", label);
@@ -911,7 +1130,7 @@ static void print_latex_element(GString *out, element *elt) {
             /* This is a <link> */
             g_string_append_printf(out, "\\href{%s}{", elt->contents.link->url);
             print_latex_string(out, elt->contents.link->url);
-            g_string_append_printf(out, "}");
+            g_string_append_literal(out, "}");
         } else if ( (elt->contents.link->label != NULL) && 
                 ( elt->contents.link->label->contents.str != NULL) &&
                 ( strcmp(&elt->contents.link->url[7], 
@@ -921,34 +1140,34 @@ static void print_latex_element(GString *out, element *elt) {
         } else {
             /* This is a [text](link) */
             g_string_append_printf(out, "\\href{%s}{", elt->contents.link->url);
-            print_latex_element_list(out, elt->contents.link->label);
-            g_string_append_printf(out, "}");
-            if ( no_latex_footnote == FALSE ) {
+            print_latex_element_list(st, out, elt->contents.link->label);
+            g_string_append_literal(out, "}");
+            if ( st->no_latex_footnote == FALSE ) {
                 g_string_append_printf(out, "\\footnote{\\href{%s}{", elt->contents.link->url);
                 print_latex_string(out, elt->contents.link->url);
-                g_string_append_printf(out, "}}");
+                g_string_append_literal(out, "}}");
             }
         }
         break;
     case IMAGEBLOCK:
-        pad(out, 2);
+        pad(st, out, 2);
     case IMAGE:
         /* Figure if we have height, width, neither */
         height = dimension_for_attribute("height", elt->contents.link->attr);
         width = dimension_for_attribute("width", elt->contents.link->attr);
         if (elt->key == IMAGEBLOCK) {
-            g_string_append_printf(out, "\\begin{figure}[htbp]\n\\centering\n");
+            g_string_append_literal(out, "\\begin{figure}[htbp]\n\\centering\n");
         }
-        g_string_append_printf(out, "\\includegraphics[");
+        g_string_append_literal(out, "\\includegraphics[");
         if ((height == NULL) && (width == NULL)) {
             /* No dimensions given */
-            g_string_append_printf(out,"keepaspectratio,width=\\textwidth,height=0.75\\textheight");
+            g_string_append_literal(out,"keepaspectratio,width=\\textwidth,height=0.75\\textheight");
         } else {
             /* at least one dimension given */
             if ((height != NULL) && (width != NULL)) {
                 
             } else {
-                g_string_append_printf(out, "keepaspectratio,");
+                g_string_append_literal(out, "keepaspectratio,");
             }
             if (width != NULL) {
                 if (width[strlen(width)-1] == '%') {
@@ -960,7 +1179,7 @@ static void print_latex_element(GString *out, element *elt) {
                     g_string_append_printf(out,"width=%s,", width);
                 }
             } else {
-                g_string_append_printf(out, "width=\\textwidth,");
+                g_string_append_literal(out, "width=\\textwidth,");
             }
             if (height != NULL) {
                 if (height[strlen(height)-1] == '%') {
@@ -972,151 +1191,147 @@ static void print_latex_element(GString *out, element *elt) {
                     g_string_append_printf(out,"height=%s",height);
                 }
             } else {
-                g_string_append_printf(out, "height=0.75\\textheight");
+                g_string_append_literal(out, "height=0.75\\textheight");
             }
         }
 
         g_string_append_printf(out, "]{%s}\n", elt->contents.link->url);
         if (elt->key == IMAGEBLOCK) {
            if (elt->contents.link->label != NULL) {
-                g_string_append_printf(out, "\\caption{");
-                print_latex_element_list(out, elt->contents.link->label);
-                g_string_append_printf(out, "}\n");
+                g_string_append_literal(out, "\\caption{");
+                print_latex_element_list(st, out, elt->contents.link->label);
+                g_string_append_literal(out, "}\n");
             }
             g_string_append_printf(out, "\\label{%s}\n", elt->contents.link->identifier);
-            g_string_append_printf(out,"\\end{figure}\n");
+            g_string_append_literal(out,"\\end{figure}\n");
         }
         free(height);
         free(width);
         break;
     case EMPH:
-        g_string_append_printf(out, "\\emph{");
-        print_latex_element_list(out, elt->children);
-        g_string_append_printf(out, "}");
+        g_string_append_literal(out, "\\emph{");
+        print_latex_element_list(st, out, elt->children);
+        g_string_append_literal(out, "}");
         break;
     case STRONG:
-        g_string_append_printf(out, "\\textbf{");
-        print_latex_element_list(out, elt->children);
-        g_string_append_printf(out, "}");
+        g_string_append_literal(out, "\\textbf{");
+        print_latex_element_list(st, out, elt->children);
+        g_string_append_literal(out, "}");
         break;
     case LIST:
-        print_latex_element_list(out, elt->children);
+        print_latex_element_list(st, out, elt->children);
         break;
     case RAW:
         /* Shouldn't occur - these are handled by process_raw_blocks() */
         assert(elt->key != RAW);
         break;
     case H1: case H2: case H3: case H4: case H5: case H6:
-        pad(out, 2);
-        lev = elt->key - H1 + base_header_level;  /* assumes H1 ... H6 are in order */
+        pad(st, out, 2);
+        lev = elt->key - H1 + st->base_header_level;  /* assumes H1 ... H6 are in order */
         switch (lev) {
             case 1:
-                g_string_append_printf(out, "\\part{");
+                g_string_append_literal(out, "\\part{");
                 break;
             case 2:
-                g_string_append_printf(out, "\\chapter{");
+                g_string_append_literal(out, "\\chapter{");
                 break;
             case 3:
-                g_string_append_printf(out, "\\section{");
+                g_string_append_literal(out, "\\section{");
                 break;
             case 4:
-                g_string_append_printf(out, "\\subsection{");
+                g_string_append_literal(out, "\\subsection{");
                 break;
             case 5:
-                g_string_append_printf(out, "\\subsubsection{");
+                g_string_append_literal(out, "\\subsubsection{");
                 break;
             case 6:
-                g_string_append_printf(out, "\\paragraph{");
+                g_string_append_literal(out, "\\paragraph{");
                 break;
             case 7:
-                g_string_append_printf(out, "\\subparagraph{");
+                g_string_append_literal(out, "\\subparagraph{");
                 break;
             default:
-                g_string_append_printf(out, "\\noindent\\textbf{");
+                g_string_append_literal(out, "\\noindent\\textbf{");
                 break;
         }
         /* generate a label for each header (MMD);
             don't allow footnotes since invalid here */
-        no_latex_footnote = TRUE;
+        st->no_latex_footnote = TRUE;
         if (elt->children->key == AUTOLABEL) {
-            label = label_from_string(elt->children->contents.str,0);
-            print_latex_element_list(out, elt->children->next);
+            print_latex_element_list(st, out, elt->children->next);
         } else {
-            label = label_from_element_list(elt->children,0);
-            print_latex_element_list(out, elt->children);
+            print_latex_element_list(st, out, elt->children);
         }
-        no_latex_footnote = FALSE;
-        g_string_append_printf(out, "}\n\\label{");
-        g_string_append_printf(out, "%s", label);
-        g_string_append_printf(out, "}\n");
-        free(label);
-        padded = 1;
+        st->no_latex_footnote = FALSE;
+        g_string_append_literal(out, "}\n\\label{");
+        g_string_append(out, elt->contents.str);
+        g_string_append_literal(out, "}\n");
+        st->padded = 1;
         break;
     case PLAIN:
-        pad(out, 1);
-        print_latex_element_list(out, elt->children);
-        padded = 0;
+        pad(st, out, 1);
+        print_latex_element_list(st, out, elt->children);
+        st->padded = 0;
         break;
     case PARA:
-        pad(out, 2);
-        print_latex_element_list(out, elt->children);
-        padded = 0;
+        pad(st, out, 2);
+        print_latex_element_list(st, out, elt->children);
+        st->padded = 0;
         break;
     case HRULE:
-        pad(out, 2);
-        g_string_append_printf(out, "\\begin{center}\\rule{3in}{0.4pt}\\end{center}\n");
-        padded = 0;
+        pad(st, out, 2);
+        g_string_append_literal(out, "\\begin{center}\\rule{3in}{0.4pt}\\end{center}\n");
+        st->padded = 0;
         break;
     case HTMLBLOCK:
         /* don't print HTML block */
         /* but do print HTML comments for raw LaTeX */
         if (strncmp(elt->contents.str,"<!--",4) == 0) {
-            pad(out, 2);
+            pad(st, out, 2);
             /* trim "-->" from end */
-            elt->contents.str[strlen(elt->contents.str)-3] = '\0';
-            g_string_append_printf(out, "%s", &elt->contents.str[4]);
-            padded = 0;
+            g_string_append_printf(out, "%.*s", (int)strlen(elt->contents.str)-7, &elt->contents.str[4]);
+            st->padded = 0;
         }
         break;
     case VERBATIM:
-        pad(out, 1);
-        g_string_append_printf(out, "\n\\begin{verbatim}\n");
+        pad(st, out, 1);
+        g_string_append_literal(out, "\n\\begin{verbatim}\n");
         print_raw_element(out, elt);
-        g_string_append_printf(out, "\\end{verbatim}\n");
-        padded = 0;
+        g_string_append_literal(out, "\\end{verbatim}\n");
+        st->padded = 0;
         break;
     case BULLETLIST:
-        pad(out, 1);
-        g_string_append_printf(out, "\n\\begin{itemize}");
-        padded = 0;
-        print_latex_element_list(out, elt->children);
-        g_string_append_printf(out, "\n\\end{itemize}");
-        padded = 0;
+        pad(st, out, 1);
+        g_string_append_literal(out, "\n\\begin{itemize}");
+        st->padded = 0;
+        print_latex_element_list(st, out, elt->children);
+        g_string_append_literal(out, "\n\\end{itemize}");
+        st->padded = 0;
         break;
     case ORDEREDLIST:
-        pad(out, 2);
-        g_string_append_printf(out, "\\begin{enumerate}");
-        padded = 0;
-        print_latex_element_list(out, elt->children);
-        pad(out, 1);
-        g_string_append_printf(out, "\\end{enumerate}");
-        padded = 0;
+        pad(st, out, 2);
+        g_string_append_literal(out, "\\begin{enumerate}");
+        st->padded = 0;
+        print_latex_element_list(st, out, elt->children);
+        pad(st, out, 1);
+        g_string_append_literal(out, "\\end{enumerate}");
+        st->padded = 0;
         break;
     case LISTITEM:
-        pad(out, 1);
-        g_string_append_printf(out, "\\item ");
-        padded = 2;
-        print_latex_element_list(out, elt->children);
-        g_string_append_printf(out, "\n");
+        pad(st, out, 1);
+        g_string_append_literal(out, "\\item ");
+        st->padded = 2;
+        print_latex_element_list(st, out, elt->children);
+        g_string_append_literal(out, "\n");
         break;
     case BLOCKQUOTE:
-        pad(out, 2);
-        g_string_append_printf(out, "\\begin{quote}");
-        padded = 0;
-        print_latex_element_list(out, elt->children);
-        pad(out, 1);
-        g_string_append_printf(out, "\\end{quote}");
-        padded = 0;
+        pad(st, out, 2);
+        g_string_append_literal(out, "\\begin{quote}");
+        st->padded = 0;
+        print_latex_element_list(st, out, elt->children);
+        pad(st, out, 1);
+        g_string_append_literal(out, "\\end{quote}");
+        st->padded = 0;
         break;
     case NOTELABEL:
         /* Nonprinting */
@@ -1127,32 +1342,31 @@ static void print_latex_element(GString *out, element *elt) {
         if (elt->contents.str == 0) {
             if (elt->children->key == GLOSSARYTERM) {
                 g_string_append_printf(out, "\\newglossaryentry{%s}{", elt->children->children->contents.str);
-                padded = 2;
+                st->padded = 2;
                 if (elt->children->next->key == GLOSSARYSORTKEY) {
-                    g_string_append_printf(out, "sort={");
+                    g_string_append_literal(out, "sort={");
                     print_latex_string(out, elt->children->next->contents.str);
-                    g_string_append_printf(out, "},");
+                    g_string_append_literal(out, "},");
                 }
-                print_latex_element_list(out, elt->children);
+                print_latex_element_list(st, out, elt->children);
                 g_string_append_printf(out, "}}\\glsadd{%s}", elt->children->children->contents.str);
-                padded = 0;
+                st->padded = 0;
             } else {
-                g_string_append_printf(out, "\\footnote{");
-                padded = 2;
-                print_latex_element_list(out, elt->children);
-                g_string_append_printf(out, "}");
-                padded = 0;
+                g_string_append_literal(out, "\\footnote{");
+                st->padded = 2;
+                print_latex_element_list(st, out, elt->children);
+                g_string_append_literal(out, "}");
+                st->padded = 0;
             }
-            elt->children = NULL;
         }
         break;
     case GLOSSARY:
         /* This shouldn't do anything */
         break;
     case GLOSSARYTERM:
-        g_string_append_printf(out, "name={");
+        g_string_append_literal(out, "name={");
         print_latex_string(out, elt->children->contents.str);
-        g_string_append_printf(out, "},description={");
+        g_string_append_literal(out, "},description={");
         break;
     case GLOSSARYSORTKEY:
         break;
@@ -1161,122 +1375,101 @@ static void print_latex_element(GString *out, element *elt) {
         break;
     case NOCITATION:
     case CITATION:
-        if (strncmp(elt->contents.str,"[#",2) == 0) {
-            /* This should be used as a bibtex citation key after trimming */
-            elt->contents.str[strlen(elt->contents.str)-1] = '\0';
-            if (elt->key == NOCITATION ) {
-                g_string_append_printf(out, "~\\nocite{%s}", &elt->contents.str[2]);
+        /* The citation key, without the brackets of a bibtex key and
+           without the ';' that asks for a textual citation */
+        key = elt->contents.str;
+        keylen = strlen(key);
+        if (strncmp(key,"[#",2) == 0) {
+            key += 2;
+            keylen -= 3;
+        }
+        textual = (elt->key != NOCITATION) && (keylen > 0) && (key[keylen - 1] == ';');
+        if (textual)
+            keylen--;
+        locator = locator_for_citation(elt);
+        if (elt->key == NOCITATION ) {
+            g_string_append_printf(out, "~\\nocite{%.*s}", keylen, key);
+        } else if (locator != NULL) {
+            if (textual) {
+                g_string_append_literal(out, " \\citet[");
             } else {
-                if ((elt->children != NULL) && (elt->children->key == LOCATOR)) {
-                    if (strcmp(&elt->contents.str[strlen(elt->contents.str) - 1],";") == 0) {
-                        g_string_append_printf(out, " \\citet[");
-                        elt->contents.str[strlen(elt->contents.str) - 1] = '\0';
-                    } else {
-                        g_string_append_printf(out, "~\\citep[");
-                    }
-                    print_latex_element(out,elt->children);
-                    g_string_append_printf(out, "]{%s}",&elt->contents.str[2]);
-                } else {
-                    if (strcmp(&elt->contents.str[strlen(elt->contents.str) - 1],";") == 0) {
-                        elt->contents.str[strlen(elt->contents.str) - 1] = '\0';
-                        g_string_append_printf(out, " \\citet{%s}", &elt->contents.str[2]);
-                    } else {
-                        g_string_append_printf(out, "~\\citep{%s}", &elt->contents.str[2]);
-                    }
-                }
+                g_string_append_literal(out, "~\\citep[");
             }
+            print_latex_element(st, out, locator);
+            g_string_append_printf(out, "]{%.*s}", keylen, key);
+        } else if (textual) {
+            g_string_append_printf(out, " \\citet{%.*s}", keylen, key);
         } else {
+            g_string_append_printf(out, "~\\citep{%.*s}", keylen, key);
+        }
+        if (strncmp(elt->contents.str,"[#",2) != 0) {
             /* This citation was specified in the document itself */
-            if (elt->key == NOCITATION ) {
-                g_string_append_printf(out, "~\\nocite{%s}", elt->contents.str);
-                element *temp;
-                temp = elt->children;
-                elt->children = temp->next;
-                free_element(temp);
-            } else {
-                if ((elt->children != NULL) && (elt->children->key == LOCATOR)){
-                    if (strcmp(&elt->contents.str[strlen(elt->contents.str) - 1],";") == 0) {
-                        g_string_append_printf(out, " \\citet[");
-                        elt->contents.str[strlen(elt->contents.str) - 1] = '\0';
-                    } else {
-                        g_string_append_printf(out, "~\\citep[");
-                    }
-                    print_latex_element(out,elt->children);
-                    g_string_append_printf(out, "]{%s}",elt->contents.str);
-                    element *temp;
-                    temp = elt->children;
-                    elt->children = temp->next;
-                    free_element(temp);
-                } else {
-                    if (strcmp(&elt->contents.str[strlen(elt->contents.str) - 1],";") == 0) {
-                        elt->contents.str[strlen(elt->contents.str) - 1] = '\0';
-                        g_string_append_printf(out, " \\citet{%s}", elt->contents.str);
-                    } else {
-                        g_string_append_printf(out, "~\\citep{%s}", elt->contents.str);
-                    }
-                }
-            }
-            if ((elt->children != NULL) && (elt->children->contents.str == NULL)) {
-                elt->children->contents.str = strdup(elt->contents.str);
-                add_endnote(elt->children);
+            note = (elt->key == NOCITATION) ? elt->children->next : note_for_citation(elt);
+            if ((note != NULL) && (note_mark(st, note) == NULL)) {
+                /* The key is stored as a mark so the bibliography can use it */
+                mark = malloc(keylen + 1);
+                memcpy(mark, key, keylen);
+                mark[keylen] = '\0';
+                set_note_mark(st, note, mark);
+                free(mark);
+                add_endnote(st, note);
             }
-            elt->children = NULL;
         }
         break;
     case LOCATOR:
-        print_latex_element_list(out, elt->children);
+        print_latex_element_list(st, out, elt->children);
         break;
     case DEFLIST:
-        g_string_append_printf(out, "\\begin{description}");
-        padded = 0;
-        print_latex_element_list(out, elt->children);
-        pad(out,1);
-        g_string_append_printf(out, "\\end{description}");
-        padded = 0;
+        g_string_append_literal(out, "\\begin{description}");
+        st->padded = 0;
+        print_latex_element_list(st, out, elt->children);
+        pad(st, out,1);
+        g_string_append_literal(out, "\\end{description}");
+        st->padded = 0;
         break;
     case TERM:
-        pad(out,2);
-        g_string_append_printf(out, "\\item[");
-        print_latex_element_list(out, elt->children);
-        g_string_append_printf(out, "]");
-        padded = 0;
+        pad(st, out,2);
+        g_string_append_literal(out, "\\item[");
+        print_latex_element_list(st, out, elt->children);
+        g_string_append_literal(out, "]");
+        st->padded = 0;
         break;
     case DEFINITION:
-        pad(out,2);
-        padded = 2;
-        print_latex_element_list(out, elt->children);
-        padded = 0;
+        pad(st, out,2);
+        st->padded = 2;
+        print_latex_element_list(st, out, elt->children);
+        st->padded = 0;
         break;
     case METADATA:
         /* Metadata is present, so this should be a "complete" document */
-        print_latex_header(out, elt);
-        html_footer = is_html_complete_doc(elt);
+        print_latex_header(st, out, elt);
+        st->html_footer = is_html_complete_doc(st, elt);
         break;
     case METAKEY:
         if (strcmp(elt->contents.str, "title") == 0) {
-            g_string_append_printf(out, "\\def\\mytitle{");
-            print_latex_element_list(out, elt->children);
-            g_string_append_printf(out, "}\n");
+            g_string_append_literal(out, "\\def\\mytitle{");
+            print_latex_element_list(st, out, elt->children);
+            g_string_append_literal(out, "}\n");
         } else if (strcmp(elt->contents.str, "author") == 0) {
-            g_string_append_printf(out, "\\def\\myauthor{");
-            print_latex_element_list(out, elt->children);
-            g_string_append_printf(out, "}\n");
+            g_string_append_literal(out, "\\def\\myauthor{");
+            print_latex_element_list(st, out, elt->children);
+            g_string_append_literal(out, "}\n");
         } else if (strcmp(elt->contents.str, "date") == 0) {
-            g_string_append_printf(out, "\\def\\mydate{");
-            print_latex_element_list(out, elt->children);
-            g_string_append_printf(out, "}\n");
+            g_string_append_literal(out, "\\def\\mydate{");
+            print_latex_element_list(st, out, elt->children);
+            g_string_append_literal(out, "}\n");
         } else if (strcmp(elt->contents.str, "copyright") == 0) {
-            g_string_append_printf(out, "\\def\\mycopyright{");
-            print_latex_element_list(out, elt->children);
-            g_string_append_printf(out, "}\n");
+            g_string_append_literal(out, "\\def\\mycopyright{");
+            print_latex_element_list(st, out, elt->children);
+            g_string_append_literal(out, "}\n");
         } else if (strcmp(elt->contents.str, "baseheaderlevel") == 0) {
-            base_header_level = atoi(elt->children->contents.str);
+            set_base_header_level(st, elt->children->contents.str);
         } else if (strcmp(elt->contents.str, "latexheaderlevel") == 0) {
-            base_header_level = atoi(elt->children->contents.str);
+            set_base_header_level(st, elt->children->contents.str);
         } else if (strcmp(elt->contents.str, "latexinput") == 0) {
             g_string_append_printf(out, "\\input{%s}\n", elt->children->contents.str);
         } else if (strcmp(elt->contents.str, "latexfooter") == 0) {
-            latex_footer = elt->children->contents.str;
+            st->latex_footer = elt->children->contents.str;
         } else if (strcmp(elt->contents.str, "bibtex") == 0) {
             g_string_append_printf(out, "\\def\\bibliocommand{\\bibliography{%s}}\n",elt->children->contents.str);
         } else if (strcmp(elt->contents.str, "xhtmlheader") == 0) {
@@ -1284,80 +1477,74 @@ static void print_latex_element(GString *out, element *elt) {
         } else if (strcmp(elt->contents.str, "css") == 0) {
         } else if (strcmp(elt->contents.str, "quoteslanguage") == 0) {
             label = label_from_element_list(elt->children, 0);
-            if (strcmp(label, "dutch") == 0) { language = DUTCH; } else 
-            if (strcmp(label, "german") == 0) { language = GERMAN; } else 
-            if (strcmp(label, "germanguillemets") == 0) { language = GERMANGUILL; } else 
-            if (strcmp(label, "french") == 0) { language = FRENCH; } else 
-            if (strcmp(label, "swedish") == 0) { language = SWEDISH; }
+            if (strcmp(label, "dutch") == 0) { st->language = DUTCH; } else 
+            if (strcmp(label, "german") == 0) { st->language = GERMAN; } else 
+            if (strcmp(label, "germanguillemets") == 0) { st->language = GERMANGUILL; } else 
+            if (strcmp(label, "french") == 0) { st->language = FRENCH; } else 
+            if (strcmp(label, "swedish") == 0) { st->language = SWEDISH; }
             free(label);
         } else {
-            g_string_append_printf(out, "\\def\\");
+            g_string_append_literal(out, "\\def\\");
             print_latex_string(out, elt->contents.str);
-            g_string_append_printf(out, "{");
-            print_latex_element_list(out, elt->children);
-            g_string_append_printf(out, "}\n");
+            g_string_append_literal(out, "{");
+            print_latex_element_list(st, out, elt->children);
+            g_string_append_literal(out, "}\n");
         }
         break;
     case METAVALUE:
         print_latex_string(out, elt->contents.str);
         break;
     case FOOTER:
-        print_latex_endnotes(out);
-        print_latex_footer(out);
+        print_latex_endnotes(st, out);
+        print_latex_footer(st, out);
         break;
     case HEADINGSECTION:
-        print_latex_element_list(out, elt->children);
+        print_latex_element_list(st, out, elt->children);
         break;
     case TABLE:
-        pad(out, 2);
-        g_string_append_printf(out, "\\begin{table}[htbp]\n\\begin{minipage}{\\linewidth}\n\\setlength{\\tymax}{0.5\\linewidth}\n\\centering\n\\small\n");
-        print_latex_element_list(out, elt->children);
-        g_string_append_printf(out, "\n\\end{tabulary}\n\\end{minipage}\n\\end{table}\n");
-        padded = 0;
+        pad(st, out, 2);
+        g_string_append_literal(out, "\\begin{table}[htbp]\n\\begin{minipage}{\\linewidth}\n\\setlength{\\tymax}{0.5\\linewidth}\n\\centering\n\\small\n");
+        print_latex_element_list(st, out, elt->children);
+        g_string_append_literal(out, "\n\\end{tabulary}\n\\end{minipage}\n\\end{table}\n");
+        st->padded = 0;
         break;
     case TABLESEPARATOR:
         g_string_append_printf(out, "\\begin{tabulary}{\\textwidth}{@{}%s@{}} \\toprule\n", elt->contents.str);
         break;
     case TABLECAPTION:
-        if (elt->children->key == TABLELABEL) {
-            label = label_from_element_list(elt->children->children,0);
-        } else {
-            label = label_from_element_list(elt->children,0);
-        }
-        g_string_append_printf(out, "\\caption{");
-        print_latex_element_list(out, elt->children);
-        g_string_append_printf(out, "}\n\\label{%s}\n",label);
-        free(label);
+        g_string_append_literal(out, "\\caption{");
+        print_latex_element_list(st, out, elt->children);
+        g_string_append_printf(out, "}\n\\label{%s}\n", elt->contents.str);
         break;
     case TABLELABEL:
         break;
     case TABLEHEAD:
-        print_latex_element_list(out, elt->children);
-        g_string_append_printf(out, "\\midrule\n");
+        print_latex_element_list(st, out, elt->children);
+        g_string_append_literal(out, "\\midrule\n");
         break;
     case TABLEBODY:
-        print_latex_element_list(out, elt->children);
+        print_latex_element_list(st, out, elt->children);
         if ( ( elt->next != NULL ) && (elt->next->key == TABLEBODY) ) {
-            g_string_append_printf(out, "\n\\midrule\n");
+            g_string_append_literal(out, "\n\\midrule\n");
         } else {
-            g_string_append_printf(out, "\n\\bottomrule\n");
+            g_string_append_literal(out, "\n\\bottomrule\n");
         }
         break;
     case TABLEROW:
-        print_latex_element_list(out, elt->children);
-        g_string_append_printf(out, "\\\\\n");
+        print_latex_element_list(st, out, elt->children);
+        g_string_append_literal(out, "\\\\\n");
         break;
     case TABLECELL:
-        padded = 2;
+        st->padded = 2;
         if ((elt->children != NULL) && (elt->children->key == CELLSPAN)) {
             g_string_append_printf(out, "\\multicolumn{%d}{c}{", (int)strlen(elt->children->contents.str)+1);
         }
-        print_latex_element_list(out, elt->children);
+        print_latex_element_list(st, out, elt->children);
         if ((elt->children != NULL) && (elt->children->key == CELLSPAN)) {
-            g_string_append_printf(out, "}");
+            g_string_append_literal(out, "}");
         }
         if (elt->next != NULL) {
-            g_string_append_printf(out, "&");
+            g_string_append_literal(out, "&");
         }
         break;
     case CELLSPAN:
@@ -1368,15 +1555,12 @@ static void print_latex_element(GString *out, element *elt) {
         break;
     case MATHSPAN:
         if (strncmp(&elt->contents.str[2],"\\begin",5) == 0) {
-            elt->contents.str[strlen(elt->contents.str)-3] = '\0';
-            g_string_append_printf(out, "%s",&elt->contents.str[2]);
+            g_string_append_printf(out, "%.*s", (int)strlen(elt->contents.str)-5, &elt->contents.str[2]);
         } else {
             if ( elt->contents.str[strlen(elt->contents.str)-1] == ']') {
-                elt->contents.str[strlen(elt->contents.str)-3] = '\0';
-                g_string_append_printf(out, "%s\\]", elt->contents.str);
+                g_string_append_printf(out, "%.*s\\]", (int)strlen(elt->contents.str)-3, elt->contents.str);
             } else {
-                elt->contents.str[strlen(elt->contents.str)-3] = '\0';
-                g_string_append_printf(out, "$%s$", &elt->contents.str[2]);
+                g_string_append_printf(out, "$%.*s$", (int)strlen(elt->contents.str)-5, &elt->contents.str[2]);
             }
         }
         break;
@@ -1392,107 +1576,109 @@ static void print_latex_element(GString *out, element *elt) {
 
  ***********************************************************************/
 
-static bool in_list_item = false; /* True if we're parsing contents of a list item. */
+/* escape_groff - print the character at 'str', escaping for groff */
+static char *escape_groff(GString *out, char *str) {
+    switch (*str) {
+    case '\\':
+        g_string_append_literal(out, "\\e");
+        break;
+    default:
+        g_string_append_c(out, *str);
+    }
+    return str;
+}
 
 /* print_groff_string - print string, escaping for groff */
 static void print_groff_string(GString *out, char *str) {
-    while (*str != '\0') {
-        switch (*str) {
-        case '\\':
-            g_string_append_printf(out, "\\e");
-            break;
-        default:
-            g_string_append_c(out, *str);
-        }
-    str++;
-    }
+    print_escaped(out, str, ESCAPE_GROFF, escape_groff);
 }
 
 /* print_groff_mm_element_list - print a list of elements as groff ms */
-static void print_groff_mm_element_list(GString *out, element *list) {
+static void print_groff_mm_element_list(render_state *st, GString *out, element *list) {
     int count = 1;
     while (list != NULL) {
-        print_groff_mm_element(out, list, count);
+        print_groff_mm_element(st, out, list, count);
         list = list->next;
         count++;
     }
 }
 
 /* print_groff_mm_element - print an element as groff ms */
-static void print_groff_mm_element(GString *out, element *elt, int count) {
+static void print_groff_mm_element(render_state *st, GString *out, element *elt, int count) {
     int lev;
+    flush_output(st, out);
     switch (elt->key) {
     case SPACE:
-        g_string_append_printf(out, "%s", elt->contents.str);
-        padded = 0;
+        g_string_append(out, elt->contents.str);
+        st->padded = 0;
         break;
     case LINEBREAK:
-        pad(out, 1);
-        g_string_append_printf(out, ".br\n");
-        padded = 0;
+        pad(st, out, 1);
+        g_string_append_literal(out, ".br\n");
+        st->padded = 0;
         break;
     case STR:
         print_groff_string(out, elt->contents.str);
-        padded = 0;
+        st->padded = 0;
         break;
     case ELLIPSIS:
-        g_string_append_printf(out, "...");
+        localize_typography(out, ELLIP, st->language, GROFFOUT);
         break;
     case EMDASH:
-        g_string_append_printf(out, "\\[em]");
+        localize_typography(out, MDASH, st->language, GROFFOUT);
         break;
     case ENDASH:
-        g_string_append_printf(out, "\\[en]");
+        localize_typography(out, NDASH, st->language, GROFFOUT);
         break;
     case APOSTROPHE:
-        g_string_append_printf(out, "'");
+        localize_typography(out, APOS, st->language, GROFFOUT);
         break;
     case SINGLEQUOTED:
-        g_string_append_printf(out, "`");
-        print_groff_mm_element_list(out, elt->children);
-        g_string_append_printf(out, "'");
+        localize_typography(out, LSQUOTE, st->language, GROFFOUT);
+        print_groff_mm_element_list(st, out, elt->children);
+        localize_typography(out, RSQUOTE, st->language, GROFFOUT);
         break;
     case DOUBLEQUOTED:
-        g_string_append_printf(out, "\\[lq]");
-        print_groff_mm_element_list(out, elt->children);
-        g_string_append_printf(out, "\\[rq]");
+        localize_typography(out, LDQUOTE, st->language, GROFFOUT);
+        print_groff_mm_element_list(st, out, elt->children);
+        localize_typography(out, RDQUOTE, st->language, GROFFOUT);
         break;
     case CODE:
-        g_string_append_printf(out, "\\fC");
+        g_string_append_literal(out, "\\fC");
         print_groff_string(out, elt->contents.str);
-        g_string_append_printf(out, "\\fR");
-        padded = 0;
+        g_string_append_literal(out, "\\fR");
+        st->padded = 0;
         break;
     case HTML:
         /* don't print HTML */
         break;
     case LINK:
-        print_groff_mm_element_list(out, elt->contents.link->label);
+        print_groff_mm_element_list(st, out, elt->contents.link->label);
         g_string_append_printf(out, " (%s)", elt->contents.link->url);
-        padded = 0;
+        st->padded = 0;
         break;
     case IMAGE:
-        g_string_append_printf(out, "[IMAGE: ");
-        print_groff_mm_element_list(out, elt->contents.link->label);
-        g_string_append_printf(out, "]");
-        padded = 0;
+        g_string_append_literal(out, "[IMAGE: ");
+        print_groff_mm_element_list(st, out, elt->contents.link->label);
+        g_string_append_literal(out, "]");
+        st->padded = 0;
         /* not supported */
         break;
     case EMPH:
-        g_string_append_printf(out, "\\fI");
-        print_groff_mm_element_list(out, elt->children);
-        g_string_append_printf(out, "\\fR");
-        padded = 0;
+        g_string_append_literal(out, "\\fI");
+        print_groff_mm_element_list(st, out, elt->children);
+        g_string_append_literal(out, "\\fR");
+        st->padded = 0;
         break;
     case STRONG:
-        g_string_append_printf(out, "\\fB");
-        print_groff_mm_element_list(out, elt->children);
-        g_string_append_printf(out, "\\fR");
-        padded = 0;
+        g_string_append_literal(out, "\\fB");
+        print_groff_mm_element_list(st, out, elt->children);
+        g_string_append_literal(out, "\\fR");
+        st->padded = 0;
         break;
     case LIST:
-        print_groff_mm_element_list(out, elt->children);
-        padded = 0;
+        print_groff_mm_element_list(st, out, elt->children);
+        st->padded = 0;
         break;
     case RAW:
         /* Shouldn't occur - these are handled by process_raw_blocks() */
@@ -1500,73 +1686,73 @@ static void print_groff_mm_element(GString *out, element *elt, int count) {
         break;
     case H1: case H2: case H3: case H4: case H5: case H6:
         lev = elt->key - H1 + 1;
-        pad(out, 1);
+        pad(st, out, 1);
         g_string_append_printf(out, ".H %d \"", lev);
-        print_groff_mm_element_list(out, elt->children);
-        g_string_append_printf(out, "\"");
-        padded = 0;
+        print_groff_mm_element_list(st, out, elt->children);
+        g_string_append_literal(out, "\"");
+        st->padded = 0;
         break;
     case PLAIN:
-        pad(out, 1);
-        print_groff_mm_element_list(out, elt->children);
-        padded = 0;
+        pad(st, out, 1);
+        print_groff_mm_element_list(st, out, elt->children);
+        st->padded = 0;
         break;
     case PARA:
-        pad(out, 1);
-        if (!in_list_item || count != 1)
-            g_string_append_printf(out, ".P\n");
-        print_groff_mm_element_list(out, elt->children);
-        padded = 0;
+        pad(st, out, 1);
+        if (!st->in_list_item || count != 1)
+            g_string_append_literal(out, ".P\n");
+        print_groff_mm_element_list(st, out, elt->children);
+        st->padded = 0;
         break;
     case HRULE:
-        pad(out, 1);
-        g_string_append_printf(out, "\\l'\\n(.lu*8u/10u'");
-        padded = 0;
+        pad(st, out, 1);
+        g_string_append_literal(out, "\\l'\\n(.lu*8u/10u'");
+        st->padded = 0;
         break;
     case HTMLBLOCK:
         /* don't print HTML block */
         break;
     case VERBATIM:
-        pad(out, 1);
-        g_string_append_printf(out, ".VERBON 2\n");
+        pad(st, out, 1);
+        g_string_append_literal(out, ".VERBON 2\n");
         print_groff_string(out, elt->contents.str);
-        g_string_append_printf(out, ".VERBOFF");
-        padded = 0;
+        g_string_append_literal(out, ".VERBOFF");
+        st->padded = 0;
         break;
     case BULLETLIST:
-        pad(out, 1);
-        g_string_append_printf(out, ".BL");
-        padded = 0;
-        print_groff_mm_element_list(out, elt->children);
-        pad(out, 1);
-        g_string_append_printf(out, ".LE 1");
-        padded = 0;
+        pad(st, out, 1);
+        g_string_append_literal(out, ".BL");
+        st->padded = 0;
+        print_groff_mm_element_list(st, out, elt->children);
+        pad(st, out, 1);
+        g_string_append_literal(out, ".LE 1");
+        st->padded = 0;
         break;
     case ORDEREDLIST:
-        pad(out, 1);
-        g_string_append_printf(out, ".AL");
-        padded = 0;
-        print_groff_mm_element_list(out, elt->children);
-        pad(out, 1);
-        g_string_append_printf(out, ".LE 1");
-        padded = 0;
+        pad(st, out, 1);
+        g_string_append_literal(out, ".AL");
+        st->padded = 0;
+        print_groff_mm_element_list(st, out, elt->children);
+        pad(st, out, 1);
+        g_string_append_literal(out, ".LE 1");
+        st->padded = 0;
         break;
     case LISTITEM:
-        pad(out, 1);
-        g_string_append_printf(out, ".LI\n");
-        in_list_item = true;
-        padded = 2;
-        print_groff_mm_element_list(out, elt->children);
-        in_list_item = false;
+        pad(st, out, 1);
+        g_string_append_literal(out, ".LI\n");
+        st->in_list_item = true;
+        st->padded = 2;
+        print_groff_mm_element_list(st, out, elt->children);
+        st->in_list_item = false;
         break;
     case BLOCKQUOTE:
-        pad(out, 1);
-        g_string_append_printf(out, ".DS I\n");
-        padded = 2;
-        print_groff_mm_element_list(out, elt->children);
-        pad(out, 1);
-        g_string_append_printf(out, ".DE");
-        padded = 0;
+        pad(st, out, 1);
+        g_string_append_literal(out, ".DS I\n");
+        st->padded = 2;
+        print_groff_mm_element_list(st, out, elt->children);
+        pad(st, out, 1);
+        g_string_append_literal(out, ".DE");
+        st->padded = 0;
         break;
     case NOTELABEL:
         /* Nonprinting */
@@ -1575,13 +1761,13 @@ static void print_groff_mm_element(GString *out, element *elt, int count) {
         /* if contents.str == 0, then print note; else ignore, since this
          * is a note block that has been incorporated into the notes list */
         if (elt->contents.str == 0) {
-            g_string_append_printf(out, "\\*F\n");
-            g_string_append_printf(out, ".FS\n");
-            padded = 2;
-            print_groff_mm_element_list(out, elt->children);
-            pad(out, 1);
-            g_string_append_printf(out, ".FE\n");
-            padded = 1; 
+            g_string_append_literal(out, "\\*F\n");
+            g_string_append_literal(out, ".FS\n");
+            st->padded = 2;
+            print_groff_mm_element_list(st, out, elt->children);
+            pad(st, out, 1);
+            g_string_append_literal(out, ".FE\n");
+            st->padded = 1; 
         }
         break;
     case REFERENCE:
@@ -1599,172 +1785,181 @@ static void print_groff_mm_element(GString *out, element *elt, int count) {
 
  ***********************************************************************/
 
-/* print_odf_code_string - print string, escaping for HTML and saving newlines 
-*/
-static void print_odf_code_string(GString *out, char *str) {
+/* escape_odf_code - print the character at 'str', escaping for HTML and
+ * saving newlines */
+static char *escape_odf_code(GString *out, char *str) {
     char *tmp;
-    while (*str != '\0') {
-        switch (*str) {
-        case '&':
-            g_string_append_printf(out, "&amp;");
-            break;
-        case '<':
-            g_string_append_printf(out, "&lt;");
-            break;
-        case '>':
-            g_string_append_printf(out, "&gt;");
-            break;
-        case '"':
-            g_string_append_printf(out, "&quot;");
-            break;
-        case '\n':
-            g_string_append_printf(out, "<text:line-break/>");
-            break;
-        case ' ':
-            tmp = str;
+    switch (*str) {
+    case '&':
+        g_string_append_literal(out, "&amp;");
+        break;
+    case '<':
+        g_string_append_literal(out, "&lt;");
+        break;
+    case '>':
+        g_string_append_literal(out, "&gt;");
+        break;
+    case '"':
+        g_string_append_literal(out, "&quot;");
+        break;
+    case '\n':
+        g_string_append_literal(out, "<text:line-break/>");
+        break;
+    case ' ':
+        tmp = str;
+        tmp++;
+        if (*tmp == ' ') {
             tmp++;
             if (*tmp == ' ') {
                 tmp++;
                 if (*tmp == ' ') {
-                    tmp++;
-                    if (*tmp == ' ') {
-                        g_string_append_printf(out, "<text:tab/>");
-                        str = tmp;
-                    } else {
-                        g_string_append_printf(out, " ");
-                    }
+                    g_string_append_literal(out, "<text:tab/>");
+                    str = tmp;
                 } else {
-                    g_string_append_printf(out, " ");
+                    g_string_append_literal(out, " ");
                 }
             } else {
-                g_string_append_printf(out, " ");
+                g_string_append_literal(out, " ");
             }
-            break;
-        default:
-               g_string_append_c(out, *str);
+        } else {
+            g_string_append_literal(out, " ");
         }
-    str++;
+        break;
+    default:
+        g_string_append_c(out, *str);
     }
+    return str;
 }
 
-/* print_odf_string - print string, escaping for HTML and saving newlines */
-static void print_odf_string(GString *out, char *str) {
+/* print_odf_code_string - print string, escaping for HTML and saving newlines 
+*/
+static void print_odf_code_string(GString *out, char *str) {
+    print_escaped(out, str, ESCAPE_ODF, escape_odf_code);
+}
+
+/* escape_odf - print the character at 'str', escaping for HTML and saving
+ * newlines */
+static char *escape_odf(GString *out, char *str) {
     char *tmp;
-    while (*str != '\0') {
-        switch (*str) {
-        case '&':
-            g_string_append_printf(out, "&amp;");
-            break;
-        case '<':
-            g_string_append_printf(out, "&lt;");
-            break;
-        case '>':
-            g_string_append_printf(out, "&gt;");
-            break;
-        case '"':
-            g_string_append_printf(out, "&quot;");
-            break;
-        case '\n':
-            tmp = str;
+    switch (*str) {
+    case '&':
+        g_string_append_literal(out, "&amp;");
+        break;
+    case '<':
+        g_string_append_literal(out, "&lt;");
+        break;
+    case '>':
+        g_string_append_literal(out, "&gt;");
+        break;
+    case '"':
+        g_string_append_literal(out, "&quot;");
+        break;
+    case '\n':
+        tmp = str;
+        tmp--;
+        if (*tmp == ' ') {
             tmp--;
             if (*tmp == ' ') {
-                tmp--;
-                if (*tmp == ' ') {
-                    g_string_append_printf(out, "<text:line-break/>");
-                } else {
-                    g_string_append_printf(out, "\n");
-                }
+                g_string_append_literal(out, "<text:line-break/>");
             } else {
-                g_string_append_printf(out, "\n");
+                g_string_append_literal(out, "\n");
             }
-            break;
-        case ' ':
-            tmp = str;
+        } else {
+            g_string_append_literal(out, "\n");
+        }
+        break;
+    case ' ':
+        tmp = str;
+        tmp++;
+        if (*tmp == ' ') {
             tmp++;
             if (*tmp == ' ') {
                 tmp++;
                 if (*tmp == ' ') {
-                    tmp++;
-                    if (*tmp == ' ') {
-                        g_string_append_printf(out, "<text:tab/>");
-                        str = tmp;
-                    } else {
-                        g_string_append_printf(out, " ");
-                    }
+                    g_string_append_literal(out, "<text:tab/>");
+                    str = tmp;
                 } else {
-                    g_string_append_printf(out, " ");
+                    g_string_append_literal(out, " ");
                 }
             } else {
-                g_string_append_printf(out, " ");
+                g_string_append_literal(out, " ");
             }
-            break;
-        default:
-               g_string_append_c(out, *str);
+        } else {
+            g_string_append_literal(out, " ");
         }
-    str++;
+        break;
+    default:
+        g_string_append_c(out, *str);
     }
+    return str;
+}
+
+/* print_odf_string - print string, escaping for HTML and saving newlines */
+static void print_odf_string(GString *out, char *str) {
+    print_escaped(out, str, ESCAPE_ODF, escape_odf);
 }
 
 /* print_odf_element_list - print an element list as ODF */
-void print_odf_element_list(GString *out, element *list) {
+void print_odf_element_list(render_state *st, GString *out, element *list) {
     while (list != NULL) {
-        print_odf_element(out, list);
+        print_odf_element(st, out, list);
         list = list->next;
     }
 }
 
 /* print_odf_element - print an element as ODF */
-void print_odf_element(GString *out, element *elt) {
+void print_odf_element(render_state *st, GString *out, element *elt) {
     int lev;
     char *label;
     char *height;
     char *width;
     element *locator = NULL;
+    element *note;
     int old_type = 0;
+    flush_output(st, out);
     switch (elt->key) {
     case SPACE:
-        g_string_append_printf(out, "%s", elt->contents.str);
+        g_string_append(out, elt->contents.str);
         break;
     case LINEBREAK:
-        g_string_append_printf(out, "<text:line-break/>");
+        g_string_append_literal(out, "<text:line-break/>");
         break;
     case STR:
         print_html_string(out, elt->contents.str, 0);
         break;
     case ELLIPSIS:
-        localize_typography(out, ELLIP, language, HTMLOUT);
+        localize_typography(out, ELLIP, st->language, ODFOUT);
         break;
     case EMDASH:
-        localize_typography(out, MDASH, language, HTMLOUT);
+        localize_typography(out, MDASH, st->language, ODFOUT);
         break;
     case ENDASH:
-        localize_typography(out, NDASH, language, HTMLOUT);
+        localize_typography(out, NDASH, st->language, ODFOUT);
         break;
     case APOSTROPHE:
-        localize_typography(out, APOS, language, HTMLOUT);
+        localize_typography(out, APOS, st->language, ODFOUT);
         break;
     case SINGLEQUOTED:
-        localize_typography(out, LSQUOTE, language, HTMLOUT);
-        print_odf_element_list(out, elt->children);
-        localize_typography(out, RSQUOTE, language, HTMLOUT);
+        localize_typography(out, LSQUOTE, st->language, ODFOUT);
+        print_odf_element_list(st, out, elt->children);
+        localize_typography(out, RSQUOTE, st->language, ODFOUT);
         break;
     case DOUBLEQUOTED:
-        localize_typography(out, LDQUOTE, language, HTMLOUT);
-        print_odf_element_list(out, elt->children);
-        localize_typography(out, RDQUOTE, language, HTMLOUT);
+        localize_typography(out, LDQUOTE, st->language, ODFOUT);
+        print_odf_element_list(st, out, elt->children);
+        localize_typography(out, RDQUOTE, st->language, ODFOUT);
         break;
     case CODE:
-        g_string_append_printf(out, "<text:span text:style-name=\"Source_20_Text\">");
+        g_string_append_literal(out, "<text:span text:style-name=\"Source_20_Text\">");
         print_html_string(out, elt->contents.str, 0);
-        g_string_append_printf(out, "</text:span>");
+        g_string_append_literal(out, "</text:span>");
         break;
     case HTML:
         /* don't print HTML */
         /* but do print HTML comments for raw ODF */
         if (strncmp(elt->contents.str,"<!--",4) == 0) {
             /* trim "-->" from end */
-            elt->contents.str[strlen(elt->contents.str)-3] = '\0';
-            g_string_append_printf(out, "%s", &elt->contents.str[4]);
+            g_string_append_printf(out, "%.*s", (int)strlen(elt->contents.str)-7, &elt->contents.str[4]);
         }
         break;
     case LINK:
@@ -1773,233 +1968,227 @@ void print_odf_element(GString *out, element *elt) {
             label = label_from_string(elt->contents.link->url,0);
             if (elt->contents.link->label != NULL) {
                 g_string_append_printf(out, "<text:a xlink:type=\"simple\" xlink:href=\"#%s\">",label);
-                print_latex_element_list(out, elt->contents.link->label);
-                g_string_append_printf(out,"</text:a>");
+                print_latex_element_list(st, out, elt->contents.link->label);
+                g_string_append_literal(out,"</text:a>");
             } else {
                 
             }
         } else {
-            g_string_append_printf(out, "<text:a xlink:type=\"simple\" xlink:href=\"");
+            g_string_append_literal(out, "<text:a xlink:type=\"simple\" xlink:href=\"");
             print_html_string(out, elt->contents.link->url, 0);
-            g_string_append_printf(out, "\"");
+            g_string_append_literal(out, "\"");
             if (strlen(elt->contents.link->title) > 0) {
-                g_string_append_printf(out, " office:name=\"");
+                g_string_append_literal(out, " office:name=\"");
                 print_html_string(out, elt->contents.link->title, 0);
-                g_string_append_printf(out, "\"");
+                g_string_append_literal(out, "\"");
             }
-    /*        print_html_element_list(out, elt->contents.link->attr, obfuscate);*/
-            g_string_append_printf(out, ">");
-            print_odf_element_list(out, elt->contents.link->label);
-            g_string_append_printf(out, "</text:a>");
+    /*        print_html_element_list(st, out, elt->contents.link->attr, obfuscate);*/
+            g_string_append_literal(out, ">");
+            print_odf_element_list(st, out, elt->contents.link->label);
+            g_string_append_literal(out, "</text:a>");
         }
         break;
     case IMAGEBLOCK:
-        g_string_append_printf(out, "<text:p>\n");
+        g_string_append_literal(out, "<text:p>\n");
     case IMAGE:
         height = dimension_for_attribute("height", elt->contents.link->attr);
         width = dimension_for_attribute("width", elt->contents.link->attr);
-        g_string_append_printf(out, "<draw:frame text:anchor-type=\"as-char\"\ndraw:z-index=\"0\" draw:style-name=\"fr1\" ");
+        g_string_append_literal(out, "<draw:frame text:anchor-type=\"as-char\"\ndraw:z-index=\"0\" draw:style-name=\"fr1\" ");
         /* need both attributes for image to be visible */
         if ((width != NULL)) {
             g_string_append_printf(out, "svg:width=\"%s\"\n", width);
         } else {
-            g_string_append_printf(out, "svg:width=\"95%%\"\n");
+            g_string_append_literal(out, "svg:width=\"95%\"\n");
         }
-        g_string_append_printf(out, ">\n<draw:text-box><text:p><draw:frame text:anchor-type=\"as-char\" draw:z-index=\"1\" ");
+        g_string_append_literal(out, ">\n<draw:text-box><text:p><draw:frame text:anchor-type=\"as-char\" draw:z-index=\"1\" ");
         if ((height != NULL) && (width != NULL)) {
             g_string_append_printf(out, "svg:height=\"%s\"\n",height);
             g_string_append_printf(out, "svg:width=\"%s\"\n", width);
         }
-        g_string_append_printf(out, "><draw:image xlink:href=\"");
+        g_string_append_literal(out, "><draw:image xlink:href=\"");
         print_odf_string(out, elt->contents.link->url);
-        g_string_append_printf(out,"\" xlink:type=\"simple\" xlink:show=\"embed\" xlink:actuate=\"onLoad\" draw:filter-name=\"&lt;All formats&gt;\"/>\n</draw:frame></text:p>");
+        g_string_append_literal(out,"\" xlink:type=\"simple\" xlink:show=\"embed\" xlink:actuate=\"onLoad\" draw:filter-name=\"&lt;All formats&gt;\"/>\n</draw:frame></text:p>");
         if (elt->key == IMAGEBLOCK) {
-            g_string_append_printf(out, "<text:p>");
+            g_string_append_literal(out, "<text:p>");
             if (elt->contents.link->label != NULL) {
-                g_string_append_printf(out, "Figure <text:sequence text:name=\"Figure\" text:formula=\"ooow:Figure+1\" style:num-format=\"1\"> Update Fields to calculate numbers</text:sequence>: ");
-                print_odf_element_list(out, elt->contents.link->label);
+                g_string_append_literal(out, "Figure <text:sequence text:name=\"Figure\" text:formula=\"ooow:Figure+1\" style:num-format=\"1\"> Update Fields to calculate numbers</text:sequence>: ");
+                print_odf_element_list(st, out, elt->contents.link->label);
             }
-            g_string_append_printf(out, "</text:p></draw:text-box></draw:frame>\n</text:p>\n");
+            g_string_append_literal(out, "</text:p></draw:text-box></draw:frame>\n</text:p>\n");
         } else {
-            g_string_append_printf(out, "</draw:text-box></draw:frame>\n");
+            g_string_append_literal(out, "</draw:text-box></draw:frame>\n");
         }
         break;
     case EMPH:
-        g_string_append_printf(out,
+        g_string_append_literal(out,
             "<text:span text:style-name=\"MMD-Italic\">");
-        print_odf_element_list(out, elt->children);
-        g_string_append_printf(out, "</text:span>");
+        print_odf_element_list(st, out, elt->children);
+        g_string_append_literal(out, "</text:span>");
         break;
     case STRONG:
-        g_string_append_printf(out,
+        g_string_append_literal(out,
             "<text:span text:style-name=\"MMD-Bold\">");
-        print_odf_element_list(out, elt->children);
-        g_string_append_printf(out, "</text:span>");
+        print_odf_element_list(st, out, elt->children);
+        g_string_append_literal(out, "</text:span>");
         break;
     case LIST:
-        print_odf_element_list(out, elt->children);
+        print_odf_element_list(st, out, elt->children);
         break;
     case RAW:
         /* Shouldn't occur - these are handled by process_raw_blocks() */
         assert(elt->key != RAW);
         break;
     case H1: case H2: case H3: case H4: case H5: case H6:
-        lev = elt->key - H1 + base_header_level;  /* assumes H1 ... H6 are in order */
+        lev = elt->key - H1 + st->base_header_level;  /* assumes H1 ... H6 are in order */
         g_string_append_printf(out, "<text:h text:outline-level=\"%d\">", lev);
+        /* generate a label for each header (MMD)*/
+        g_string_append_printf(out,"<text:bookmark text:name=\"%s\"/>", elt->contents.str);
         if (elt->children->key == AUTOLABEL) {
-            /* generate a label for each header (MMD)*/
-            g_string_append_printf(out,"<text:bookmark text:name=\"%s\"/>", elt->children->contents.str);
-            print_odf_element_list(out, elt->children->next);
-            g_string_append_printf(out,"<text:bookmark-end text:name=\"%s\"/>", elt->children->contents.str);
+            print_odf_element_list(st, out, elt->children->next);
         } else {
-            label = label_from_element_list(elt->children, 0);
-            g_string_append_printf(out,"<text:bookmark text:name=\"%s\"/>", label);
-            print_odf_element_list(out, elt->children);
-            g_string_append_printf(out,"<text:bookmark-end text:name=\"%s\"/>", label);
-            free(label);
+            print_odf_element_list(st, out, elt->children);
         }
-        g_string_append_printf(out, "</text:h>\n");
-        padded = 0;
+        g_string_append_printf(out,"<text:bookmark-end text:name=\"%s\"/>", elt->contents.str);
+        g_string_append_literal(out, "</text:h>\n");
+        st->padded = 0;
         break;
     case PLAIN:
-        print_odf_element_list(out, elt->children);
-        padded = 0;
+        print_odf_element_list(st, out, elt->children);
+        st->padded = 0;
         break;
     case PARA:
-        g_string_append_printf(out, "<text:p");
-        switch (odf_type) {
+        g_string_append_literal(out, "<text:p");
+        switch (st->odf_type) {
             case DEFINITION:
             case BLOCKQUOTE:
-                g_string_append_printf(out," text:style-name=\"Quotations\"");
+                g_string_append_literal(out," text:style-name=\"Quotations\"");
                 break;
             case CODE:
-                g_string_append_printf(out," text:style-name=\"Preformatted Text\"");
+                g_string_append_literal(out," text:style-name=\"Preformatted Text\"");
                 break;
             case VERBATIM:
-                g_string_append_printf(out," text:style-name=\"Preformatted Text\"");
+                g_string_append_literal(out," text:style-name=\"Preformatted Text\"");
                 break;
             case ORDEREDLIST:
             case BULLETLIST:
-                g_string_append_printf(out," text:style-name=\"P2\"");
+                g_string_append_literal(out," text:style-name=\"P2\"");
                 break;
             case NOTE:
-                g_string_append_printf(out," text:style-name=\"Footnote\"");
+                g_string_append_literal(out," text:style-name=\"Footnote\"");
                 break;
             default:
-                g_string_append_printf(out," text:style-name=\"Standard\"");
+                g_string_append_literal(out," text:style-name=\"Standard\"");
                 break;
         }
-        g_string_append_printf(out, ">");
-        print_odf_element_list(out, elt->children);
-        g_string_append_printf(out, "</text:p>\n");
+        g_string_append_literal(out, ">");
+        print_odf_element_list(st, out, elt->children);
+        g_string_append_literal(out, "</text:p>\n");
         break;
     case HRULE:
-        g_string_append_printf(out,"<text:p text:style-name=\"Horizontal_20_Line\"/>\n");
+        g_string_append_literal(out,"<text:p text:style-name=\"Horizontal_20_Line\"/>\n");
         break;
     case HTMLBLOCK:
         /* don't print HTML block */
         /* but do print HTML comments for raw ODF */
         if (strncmp(elt->contents.str,"<!--",4) == 0) {
             /* trim "-->" from end */
-            elt->contents.str[strlen(elt->contents.str)-3] = '\0';
-            g_string_append_printf(out, "<text:p text:style-name=\"Standard\">%s</text:p>", &elt->contents.str[4]);
+            g_string_append_printf(out, "<text:p text:style-name=\"Standard\">%.*s</text:p>", (int)strlen(elt->contents.str)-7, &elt->contents.str[4]);
         }
         break;
     case VERBATIM:
-        old_type = odf_type;
-        odf_type = VERBATIM;
-        g_string_append_printf(out, "<text:p text:style-name=\"Preformatted Text\">");
+        old_type = st->odf_type;
+        st->odf_type = VERBATIM;
+        g_string_append_literal(out, "<text:p text:style-name=\"Preformatted Text\">");
         print_odf_code_string(out, elt->contents.str);
-        g_string_append_printf(out, "</text:p>\n");
-        odf_type = old_type;
+        g_string_append_literal(out, "</text:p>\n");
+        st->odf_type = old_type;
         break;
     case BULLETLIST:
-        if ((odf_type == BULLETLIST) ||
-            (odf_type == ORDEREDLIST)) {
+        if ((st->odf_type == BULLETLIST) ||
+            (st->odf_type == ORDEREDLIST)) {
             /* I think this was made unnecessary by another change.
             Same for ORDEREDLIST below */
-            /*  g_string_append_printf(out, "</text:p>"); */
+            /*  g_string_append_literal(out, "</text:p>"); */
         }
-        old_type = odf_type;
-        odf_type = BULLETLIST;
-        if (odf_list_needs_end_p) {
-            g_string_append_printf(out, "%s", "</text:p>");
-            odf_list_needs_end_p = 0;
+        old_type = st->odf_type;
+        st->odf_type = BULLETLIST;
+        if (st->odf_list_needs_end_p) {
+            g_string_append_literal(out, "</text:p>");
+            st->odf_list_needs_end_p = 0;
         }
-        g_string_append_printf(out, "%s", "<text:list>");
-        print_odf_element_list(out, elt->children);
-        g_string_append_printf(out, "%s", "</text:list>");
-        odf_type = old_type;
+        g_string_append_literal(out, "<text:list>");
+        print_odf_element_list(st, out, elt->children);
+        g_string_append_literal(out, "</text:list>");
+        st->odf_type = old_type;
         break;
     case ORDEREDLIST:
-        if ((odf_type == BULLETLIST) ||
-            (odf_type == ORDEREDLIST)) {
-            /* g_string_append_printf(out, "</text:p>"); */
+        if ((st->odf_type == BULLETLIST) ||
+            (st->odf_type == ORDEREDLIST)) {
+            /* g_string_append_literal(out, "</text:p>"); */
         }
-        old_type = odf_type;
-        odf_type = ORDEREDLIST;
-        if (odf_list_needs_end_p) {
-            g_string_append_printf(out, "%s", "</text:p>");
-            odf_list_needs_end_p = 0;
+        old_type = st->odf_type;
+        st->odf_type = ORDEREDLIST;
+        if (st->odf_list_needs_end_p) {
+            g_string_append_literal(out, "</text:p>");
+            st->odf_list_needs_end_p = 0;
         }
-        g_string_append_printf(out, "%s", "<text:list>\n");
-        print_odf_element_list(out, elt->children);
-        g_string_append_printf(out, "%s", "</text:list>\n");
-        odf_type = old_type;
+        g_string_append_literal(out, "<text:list>\n");
+        print_odf_element_list(st, out, elt->children);
+        g_string_append_literal(out, "</text:list>\n");
+        st->odf_type = old_type;
         break;
     case LISTITEM:
-        g_string_append_printf(out, "<text:list-item>\n");
+        g_string_append_literal(out, "<text:list-item>\n");
         if (elt->children->children->key != PARA) {
-            g_string_append_printf(out, "<text:p text:style-name=\"P2\">");
-            odf_list_needs_end_p = 1;
+            g_string_append_literal(out, "<text:p text:style-name=\"P2\">");
+            st->odf_list_needs_end_p = 1;
         }
-        print_odf_element_list(out, elt->children);
+        print_odf_element_list(st, out, elt->children);
 
-       odf_list_needs_end_p = 0;
+       st->odf_list_needs_end_p = 0;
        if ((list_contains_key(elt->children,BULLETLIST) ||
             (list_contains_key(elt->children,ORDEREDLIST)))) {
             } else {
                 if (elt->children->children->key != PARA) {
-                    g_string_append_printf(out, "</text:p>");
+                    g_string_append_literal(out, "</text:p>");
                 }
             }
-        g_string_append_printf(out, "</text:list-item>\n");
+        g_string_append_literal(out, "</text:list-item>\n");
         break;
     case BLOCKQUOTE:
-        old_type = odf_type;
-        odf_type = BLOCKQUOTE;
-        print_odf_element_list(out, elt->children);
-        odf_type = old_type;
+        old_type = st->odf_type;
+        st->odf_type = BLOCKQUOTE;
+        print_odf_element_list(st, out, elt->children);
+        st->odf_type = old_type;
         break;
     case REFERENCE:
         break;
     case NOTELABEL:
         break;
     case NOTE:
-        old_type = odf_type;
-        odf_type = NOTE;
+        old_type = st->odf_type;
+        st->odf_type = NOTE;
         /* if contents.str == 0 then print; else ignore - like above */
         if (elt->contents.str == 0) {
             if (elt->children->key == GLOSSARYTERM) {
-                g_string_append_printf(out, "<text:note text:id=\"\" text:note-class=\"glossary\"><text:note-body>\n");
-                print_odf_element_list(out, elt->children);
-                g_string_append_printf(out, "</text:note-body>\n</text:note>\n");
+                g_string_append_literal(out, "<text:note text:id=\"\" text:note-class=\"glossary\"><text:note-body>\n");
+                print_odf_element_list(st, out, elt->children);
+                g_string_append_literal(out, "</text:note-body>\n</text:note>\n");
             } else {
-                g_string_append_printf(out, "<text:note text:id=\"\" text:note-class=\"footnote\"><text:note-body>\n");
-                print_odf_element_list(out, elt->children);
-                g_string_append_printf(out, "</text:note-body>\n</text:note>\n");
+                g_string_append_literal(out, "<text:note text:id=\"\" text:note-class=\"footnote\"><text:note-body>\n");
+                print_odf_element_list(st, out, elt->children);
+                g_string_append_literal(out, "</text:note-body>\n</text:note>\n");
             }
        }
-        elt->children = NULL;
-        odf_type = old_type;
+        st->odf_type = old_type;
         break;
     case GLOSSARY:
         break;
     case GLOSSARYTERM:
-        g_string_append_printf(out, "<text:p text:style-name=\"Glossary\">");
+        g_string_append_literal(out, "<text:p text:style-name=\"Glossary\">");
         print_odf_string(out, elt->children->contents.str);
-        g_string_append_printf(out, ":");
-        g_string_append_printf(out, "</text:p>");
+        g_string_append_literal(out, ":");
+        g_string_append_literal(out, "</text:p>");
         break;
     case GLOSSARYSORTKEY:
         break;
@@ -2010,74 +2199,74 @@ void print_odf_element(GString *out, element *elt) {
 
         if (strncmp(elt->contents.str,"[#",2) == 0) {
             /* reference specified externally, so just display it */
-            g_string_append_printf(out, "%s", elt->contents.str);
+            g_string_append(out, elt->contents.str);
         } else {
             /* reference specified within the MMD document,
                so will output as footnote */
-            if (elt->children->contents.str == NULL) {
+            note = note_for_citation(elt);
+            if (note_mark(st, note) == NULL) {
                 /* First use of this citation */
-                ++notenumber;
-                char buf[5];
-                sprintf(buf, "%d",notenumber);
+                ++st->notenumber;
+                char buf[12];
+                sprintf(buf, "%d",st->notenumber);
                 /* Store the number for future reference */
-                elt->children->contents.str = strdup(buf);
+                set_note_mark(st, note, buf);
                 
                 /* Insert the footnote here */
-                old_type = odf_type;
-                odf_type = NOTE;
+                old_type = st->odf_type;
+                st->odf_type = NOTE;
                 g_string_append_printf(out, "<text:note text:id=\"cite%s\" text:note-class=\"footnote\"><text:note-body>\n", buf);
-                print_odf_element_list(out, elt->children);
-                g_string_append_printf(out, "</text:note-body>\n</text:note>\n");
-                odf_type = old_type;
+                print_odf_element_list(st, out, note);
+                g_string_append_literal(out, "</text:note-body>\n</text:note>\n");
+                st->odf_type = old_type;
 
-                elt->children->key = CITATION;
+                set_note_cited(st, note);
             } else {
                 /* Additional reference to prior citation,
                    and therefore must link to another footnote */
-                g_string_append_printf(out, "<text:span text:style-name=\"Footnote_20_anchor\"><text:note-ref text:note-class=\"footnote\" text:reference-format=\"text\" text:ref-name=\"cite%s\">%s</text:note-ref></text:span>", elt->children->contents.str, elt->children->contents.str);
+                g_string_append_printf(out, "<text:span text:style-name=\"Footnote_20_anchor\"><text:note-ref text:note-class=\"footnote\" text:reference-format=\"text\" text:ref-name=\"cite%s\">%s</text:note-ref></text:span>", note_mark(st, note), note_mark(st, note));
             }
-            elt->children = NULL;
         }
         break;
     case LOCATOR:
-        print_odf_element_list(out, elt->children);
+        print_odf_element_list(st, out, elt->children);
         break;
     case DEFLIST:
-        print_odf_element_list(out, elt->children);
+        print_odf_element_list(st, out, elt->children);
         break;
     case TERM:
-        g_string_append_printf(out, "<text:p><text:span text:style-name=\"MMD-Bold\">");
-        print_odf_element_list(out, elt->children);
-        g_string_append_printf(out, "</text:span></text:p>");
+        g_string_append_literal(out, "<text:p><text:span text:style-name=\"MMD-Bold\">");
+        print_odf_element_list(st, out, elt->children);
+        g_string_append_literal(out, "</text:span></text:p>");
         break;
     case DEFINITION:
-        old_type = odf_type;
-        odf_type = DEFINITION;
-        g_string_append_printf(out, "<text:p text:style-name=\"Quotations\">");
-        print_odf_element_list(out, elt->children);
-        g_string_append_printf(out, "</text:p>");
-        odf_type = old_type;
+        old_type = st->odf_type;
+        st->odf_type = DEFINITION;
+        g_string_append_literal(out, "<text:p text:style-name=\"Quotations\">");
+        print_odf_element_list(st, out, elt->children);
+        g_string_append_literal(out, "</text:p>");
+        st->odf_type = old_type;
         break;
     case METADATA:
-        g_string_append_printf(out, "<office:meta>\n");
-        print_odf_element_list(out, elt->children);
-        g_string_append_printf(out, "</office:meta>\n");
+        g_string_append_literal(out, "<office:meta>\n");
+        print_odf_element_list(st, out, elt->children);
+        g_string_append_literal(out, "</office:meta>\n");
         element *header;
-        header = metadata_for_key("odfheader",elt);
+        header = find_metadata(st, elt, "odfheader");
         if (header != NULL) {
             print_raw_element(out,header->children);
         }
         break;
     case METAKEY:
         if (strcmp(elt->contents.str, "title") == 0) {
-            g_string_append_printf(out, "<dc:title>");
-            print_odf_element(out, elt->children);
-            g_string_append_printf(out,"</dc:title>\n");
+            g_string_append_literal(out, "<dc:title>");
+            print_odf_element(st, out, elt->children);
+            g_string_append_literal(out,"</dc:title>\n");
         } else if (strcmp(elt->contents.str, "css") == 0) {
         } else if (strcmp(elt->contents.str, "baseheaderlevel") == 0) {
-            base_header_level = atoi(elt->children->contents.str);
+            set_base_header_level(st, elt->children->contents.str);
         } else if (strcmp(elt->contents.str, "odfheaderlevel") == 0) {
-            base_header_level = atoi(elt->children->contents.str);
+            set_base_header_level(st, elt->children->contents.str);
         } else if (strcmp(elt->contents.str, "xhtmlheader") == 0) {
         } else if (strcmp(elt->contents.str, "htmlheader") == 0) {
         } else if (strcmp(elt->contents.str, "odfheader") == 0) {
@@ -2085,23 +2274,23 @@ void print_odf_element(GString *out, element *elt) {
         } else if (strcmp(elt->contents.str, "latexinput") == 0) {
         } else if (strcmp(elt->contents.str, "latexmode") == 0) {
         } else if (strcmp(elt->contents.str, "keywords") == 0) {
-            g_string_append_printf(out, "<meta:keyword>");
-            print_odf_element(out,elt->children);
-            g_string_append_printf(out, "</meta:keyword>\n");
+            g_string_append_literal(out, "<meta:keyword>");
+            print_odf_element(st, out,elt->children);
+            g_string_append_literal(out, "</meta:keyword>\n");
         } else if (strcmp(elt->contents.str, "quoteslanguage") == 0) {
              label = label_from_element_list(elt->children, 0);
-             if (strcmp(label, "dutch") == 0) { language = DUTCH; } else 
-             if (strcmp(label, "german") == 0) { language = GERMAN; } else 
-             if (strcmp(label, "germanguillemets") == 0) { language = GERMANGUILL; } else 
-             if (strcmp(label, "french") == 0) { language = FRENCH; } else 
-             if (strcmp(label, "swedish") == 0) { language = SWEDISH; }
+             if (strcmp(label, "dutch") == 0) { st->language = DUTCH; } else 
+             if (strcmp(label, "german") == 0) { st->language = GERMAN; } else 
+             if (strcmp(label, "germanguillemets") == 0) { st->language = GERMANGUILL; } else 
+             if (strcmp(label, "french") == 0) { st->language = FRENCH; } else 
+             if (strcmp(label, "swedish") == 0) { st->language = SWEDISH; }
              free(label);
         } else {
-            g_string_append_printf(out, "<meta:user-defined meta:name=\"");
+            g_string_append_literal(out, "<meta:user-defined meta:name=\"");
             print_odf_string(out,elt->contents.str);
-            g_string_append_printf(out, "\">");
-            print_odf_element(out, elt->children);
-            g_string_append_printf(out,"</meta:user-defined>\n");
+            g_string_append_literal(out, "\">");
+            print_odf_element(st, out, elt->children);
+            g_string_append_literal(out,"</meta:user-defined>\n");
         }
         break;
     case METAVALUE:
@@ -2110,84 +2299,77 @@ void print_odf_element(GString *out, element *elt) {
     case FOOTER:
         break;
     case HEADINGSECTION:
-        print_odf_element_list(out, elt->children);
+        print_odf_element_list(st, out, elt->children);
         break;
     case TABLE:
-        g_string_append_printf(out,"\n<table:table>\n");
-        print_odf_element_list(out, elt->children);
-        g_string_append_printf(out, "</table:table>");
+        g_string_append_literal(out,"\n<table:table>\n");
+        print_odf_element_list(st, out, elt->children);
+        g_string_append_literal(out, "</table:table>");
         /* print caption if present */
         if (elt->children->key == TABLECAPTION) {
-            if (elt->children->children->key == TABLELABEL) {
-                label = label_from_element_list(elt->children->children->children,0);
-            } else {
-                label = label_from_element_list(elt->children->children,0);
-            }
+            label = elt->children->contents.str;
             g_string_append_printf(out,"<text:p><text:bookmark text:name=\"%s\"/>Table <text:sequence text:name=\"Table\" text:formula=\"ooow:Table+1\" style:num-format=\"1\"> Update Fields to calculate numbers</text:sequence>:", label);
-            print_odf_element_list(out,elt->children->children);
+            print_odf_element_list(st, out,elt->children->children);
             g_string_append_printf(out, "<text:bookmark-end text:name=\"%s\"/></text:p>\n",label);
-            free(label);
         }
         break;
    case TABLESEPARATOR:
-       table_alignment = elt->contents.str;
+       st->table_alignment = elt->contents.str;
        break;
     case TABLECAPTION:
         break;
     case TABLELABEL:
         break;
     case TABLEHEAD:
-        for (table_column=0;table_column<strlen(table_alignment);table_column++) {
-            g_string_append_printf(out, "<table:table-column/>\n");
+        for (st->table_column=0;st->table_column<strlen(st->table_alignment);st->table_column++) {
+            g_string_append_literal(out, "<table:table-column/>\n");
         }
-        cell_type = 'h';
-        print_odf_element_list(out, elt->children);
-        cell_type = 'd';
+        st->cell_type = 'h';
+        print_odf_element_list(st, out, elt->children);
+        st->cell_type = 'd';
         break;
     case TABLEBODY:
-        print_odf_element_list(out,elt->children);
+        print_odf_element_list(st, out,elt->children);
         break;
     case TABLEROW:
-        g_string_append_printf(out, "<table:table-row>\n");
-        table_column = 0;
-        print_odf_element_list(out,elt->children);
-        g_string_append_printf(out,"</table:table-row>\n");
+        g_string_append_literal(out, "<table:table-row>\n");
+        st->table_column = 0;
+        print_odf_element_list(st, out,elt->children);
+        g_string_append_literal(out,"</table:table-row>\n");
         break;
     case TABLECELL:
-        g_string_append_printf(out, "<table:table-cell");
+        g_string_append_literal(out, "<table:table-cell");
         if ((elt->children != NULL) && (elt->children->key == CELLSPAN)) {
             g_string_append_printf(out, " table:number-columns-spanned=\"%d\"",(int)strlen(elt->children->contents.str)+1);
         }
-        g_string_append_printf(out,">\n<text:p");
-        if (cell_type == 'h') {
-            g_string_append_printf(out, " text:style-name=\"Table_20_Heading\"");
+        g_string_append_literal(out,">\n<text:p");
+        if (st->cell_type == 'h') {
+            g_string_append_literal(out, " text:style-name=\"Table_20_Heading\"");
         } else {
-            if ( strncmp(&table_alignment[table_column],"r",1) == 0) {
-                g_string_append_printf(out, " text:style-name=\"MMD-Table-Right\"");
-            } else if ( strncmp(&table_alignment[table_column],"R",1) == 0) {
-                g_string_append_printf(out, " text:style-name=\"MMD-Table-Right\"");
-            } else if ( strncmp(&table_alignment[table_column],"c",1) == 0) {
-                g_string_append_printf(out, " text:style-name=\"MMD-Table-Center\"");
-            } else if ( strncmp(&table_alignment[table_column],"C",1) == 0) {
-                g_string_append_printf(out, " text:style-name=\"MMD-Table-Center\"");
+            if ( strncmp(&st->table_alignment[st->table_column],"r",1) == 0) {
+                g_string_append_literal(out, " text:style-name=\"MMD-Table-Right\"");
+            } else if ( strncmp(&st->table_alignment[st->table_column],"R",1) == 0) {
+                g_string_append_literal(out, " text:style-name=\"MMD-Table-Right\"");
+            } else if ( strncmp(&st->table_alignment[st->table_column],"c",1) == 0) {
+                g_string_append_literal(out, " text:style-name=\"MMD-Table-Center\"");
+            } else if ( strncmp(&st->table_alignment[st->table_column],"C",1) == 0) {
+                g_string_append_literal(out, " text:style-name=\"MMD-Table-Center\"");
             } else {
-                g_string_append_printf(out, " text:style-name=\"MMD-Table\"");
+                g_string_append_literal(out, " text:style-name=\"MMD-Table\"");
 }
         }
-        g_string_append_printf(out, ">");
-        print_odf_element_list(out,elt->children);
-        g_string_append_printf(out, "</text:p>\n</table:table-cell>\n");
-        table_column++;
+        g_string_append_literal(out, ">");
+        print_odf_element_list(st, out,elt->children);
+        g_string_append_literal(out, "</text:p>\n</table:table-cell>\n");
+        st->table_column++;
         break;
     case CELLSPAN:
         break;  
     case MATHSPAN:
         if ( elt->contents.str[strlen(elt->contents.str)-1] == ']') {
-            elt->contents.str[strlen(elt->contents.str)-3] = '\0';
-            g_string_append_printf(out, "<text:span text:style-name=\"math\">%s\\]</text:span>", elt->contents.str);
+            g_string_append_printf(out, "<text:span text:style-name=\"math\">%.*s\\]</text:span>", (int)strlen(elt->contents.str)-3, elt->contents.str);
         } else {
-            elt->contents.str[strlen(elt->contents.str)-3] = '\0';
-            g_string_append_printf(out, "<text:span text:style-name=\"math\">%s\\)</text:span>", elt->contents.str);
+            g_string_append_printf(out, "<text:span text:style-name=\"math\">%.*s\\)</text:span>", (int)strlen(elt->contents.str)-3, elt->contents.str);
         }
         break;  default:
         fprintf(stderr, "print_html_element encountered unknown element key = %d\n", elt->key);
@@ -2201,62 +2383,51 @@ void print_odf_element(GString *out, element *elt) {
 
  ***********************************************************************/
 
-void print_element_list(GString *out, element *elt, int format, int exts) {
-    /* Initialize globals */
-    endnotes = NULL;
-    notenumber = 0;
-
-    /* And MultiMarkdown globals */
-    base_header_level = 1;
-    language = ENGLISH;
-    html_footer = FALSE;
-    no_latex_footnote = FALSE;
-
-    extensions = exts;
-    padded = 2;  /* set padding to 2, so no extra blank lines at beginning */
-
-    format = find_latex_mode(format, elt);
+/* print_document - print the document 'elt' in 'format' to 'out', with
+ * a render state that has already been set up. */
+static void print_document(render_state *st, GString *out, element *elt, int format) {
+    format = find_latex_mode(st, format, elt);
     switch (format) {
     case HTML_FORMAT:
-        print_html_element_list(out, elt, false);
-        if (endnotes != NULL) {
-            pad(out, 2);
-            print_html_endnotes(out);
+        print_html_element_list(st, out, elt, false);
+        if (st->endnotes != NULL) {
+            pad(st, out, 2);
+            print_html_endnotes(st, out);
         }
-        if (html_footer == TRUE) print_html_footer(out, false);
+        if (st->html_footer == TRUE) print_html_footer(out, false);
         break;
     case LATEX_FORMAT:
-        print_latex_element_list(out, elt);
+        print_latex_element_list(st, out, elt);
         break;
     case MEMOIR_FORMAT:
-        print_memoir_element_list(out, elt);
+        print_memoir_element_list(st, out, elt);
         break;
     case BEAMER_FORMAT:
-        print_beamer_element_list(out, elt);
+        print_beamer_element_list(st, out, elt);
         break;
     case OPML_FORMAT:
-        g_string_append_printf(out, "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n<opml version=\"1.0\">\n");
-        g_string_append_printf(out, "<body>\n");
-        print_opml_element_list(out, elt);
-        if (html_footer == TRUE) print_opml_metadata(out, elt);
-        g_string_append_printf(out, "</body>\n</opml>");
+        g_string_append_literal(out, "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n<opml version=\"1.0\">\n");
+        g_string_append_literal(out, "<body>\n");
+        print_opml_element_list(st, out, elt);
+        if (st->html_footer == TRUE) print_opml_metadata(st, out, elt);
+        g_string_append_literal(out, "</body>\n</opml>");
         break;
     case ODF_FORMAT:
         print_odf_header(out);
         if (elt->key == METADATA) {
             /* print metadata */
-            print_odf_element(out,elt);
+            print_odf_element(st, out,elt);
             elt = elt->next;
         }
-        g_string_append_printf(out, "<office:body>\n<office:text>\n");
-        if (elt != NULL) print_odf_element_list(out,elt);
+        g_string_append_literal(out, "<office:body>\n<office:text>\n");
+        if (elt != NULL) print_odf_element_list(st, out,elt);
         print_odf_footer(out);
         break;
     case ODF_BODY_FORMAT:
-        if (elt != NULL) print_odf_body_element_list(out, elt);
+        if (elt != NULL) print_odf_body_element_list(st, out, elt);
         break;
     case GROFF_MM_FORMAT:
-        print_groff_mm_element_list(out, elt);
+        print_groff_mm_element_list(st, out, elt);
         break;
     default:
         fprintf(stderr, "print_element - unknown format = %d\n", format); 
@@ -2264,6 +2435,49 @@ void print_element_list(GString *out, element *elt, int format, int exts) {
     }
 }
 
+/* print_element_list - print the document 'elt' in 'format'.  The tree is
+ * only read, so it may be printed any number of times, and on several
+ * threads at once.  'index', if not NULL, is the document_index of the
+ * tree.  A 'base_header_level' other than 0 overrides the
+ * one the document's metadata gives. */
+void print_element_list(GString *out, element *elt, const document_index *index, int format, int exts, int base_header_level) {
+    render_state state;
+    render_state *st = &state;
+
+    render_state_init(st, exts);
+    st->index = index;
+    if (base_header_level > 0) {
+        st->base_header_level = base_header_level;
+        st->header_level_fixed = true;
+    }
+    print_document(st, out, elt, format);
+    render_state_free(st);
+}
+
+/* write_element_list - like print_element_list(), but instead of keeping
+ * the whole result, pass it to 'write' in pieces of about
+ * OUTPUT_CHUNK_SIZE bytes as it is printed.  The pieces, in order, make
+ * up what print_element_list() would have returned. */
+void write_element_list(mmd_write_fn write, void *data, element *elt, const document_index *index, int format, int exts, int base_header_level) {
+    render_state state;
+    render_state *st = &state;
+    GString *out = g_string_new("");
+
+    render_state_init(st, exts);
+    st->index = index;
+    if (base_header_level > 0) {
+        st->base_header_level = base_header_level;
+        st->header_level_fixed = true;
+    }
+    st->write = write;
+    st->write_data = data;
+    print_document(st, out, elt, format);
+    if (out->currentStringLength > 0)
+        write(out->str, out->currentStringLength, data);
+    g_string_free(out, true);
+    render_state_free(st);
+}
+
 
 /**********************************************************************
 
@@ -2272,223 +2486,224 @@ void print_element_list(GString *out, element *elt, int format, int exts) {
  ***********************************************************************/
 
 
-void print_html_header(GString *out, element *elt, bool obfuscate) {
-    g_string_append_printf(out,
+void print_html_header(render_state *st, GString *out, element *elt, bool obfuscate) {
+    g_string_append_literal(out,
 "<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"yes\" ?>\n<!DOCTYPE html>\n<html xmlns=\"http://www.w3.org/1999/xhtml\">\n<head>\n");
 
-    print_html_element_list(out, elt->children, obfuscate);
-    g_string_append_printf(out, "</head>\n<body>\n");    
+    print_html_element_list(st, out, elt->children, obfuscate);
+    g_string_append_literal(out, "</head>\n<body>\n");    
 }
 
 
 void print_html_footer(GString *out, bool obfuscate) {
-    g_string_append_printf(out, "\n</body>\n</html>");
+    g_string_append_literal(out, "\n</body>\n</html>");
 }
 
 
-void print_latex_header(GString *out, element *elt) {
-    print_latex_element_list(out, elt->children);
+void print_latex_header(render_state *st, GString *out, element *elt) {
+    print_latex_element_list(st, out, elt->children);
 }
 
 
-void print_latex_footer(GString *out) {
-    if (latex_footer != NULL) {
-        pad(out,2);
-        g_string_append_printf(out, "\\input{%s}\n", latex_footer);
+void print_latex_footer(render_state *st, GString *out) {
+    if (st->latex_footer != NULL) {
+        pad(st, out,2);
+        g_string_append_printf(out, "\\input{%s}\n", st->latex_footer);
     }
-    if (html_footer) {
-        g_string_append_printf(out, "\n\\end{document}");
+    if (st->html_footer) {
+        g_string_append_literal(out, "\n\\end{document}");
     }
 }
 
 
 /* print_memoir_element_list - print an element as LaTeX for memoir class */
-void print_memoir_element_list(GString *out, element *list) {
+void print_memoir_element_list(render_state *st, GString *out, element *list) {
     while (list != NULL) {
-        print_memoir_element(out, list);
+        print_memoir_element(st, out, list);
         list = list->next;
     }
 }
 
 
 /* print_memoir_element - print an element as LaTeX for memoir class */
-static void print_memoir_element(GString *out, element *elt) {
+static void print_memoir_element(render_state *st, GString *out, element *elt) {
     int lev;
     char *label;
     switch (elt->key) {
     case VERBATIM:
-        pad(out, 1);
-        g_string_append_printf(out, "\n\\begin{adjustwidth}{2.5em}{2.5em}\n\\begin{verbatim}\n\n");
+        pad(st, out, 1);
+        g_string_append_literal(out, "\n\\begin{adjustwidth}{2.5em}{2.5em}\n\\begin{verbatim}\n\n");
         print_raw_element(out, elt);
-        g_string_append_printf(out, "\n\\end{verbatim}\n\\end{adjustwidth}");
-        padded = 0;
+        g_string_append_literal(out, "\n\\end{verbatim}\n\\end{adjustwidth}");
+        st->padded = 0;
         break;
     case HEADINGSECTION:
-        print_memoir_element_list(out, elt->children);
+        print_memoir_element_list(st, out, elt->children);
         break;
     case DEFLIST:
-        g_string_append_printf(out, "\\begin{description}");
-        padded = 0;
-        print_memoir_element_list(out, elt->children);
-        pad(out,1);
-        g_string_append_printf(out, "\\end{description}");
-        padded = 0;
+        g_string_append_literal(out, "\\begin{description}");
+        st->padded = 0;
+        print_memoir_element_list(st, out, elt->children);
+        pad(st, out,1);
+        g_string_append_literal(out, "\\end{description}");
+        st->padded = 0;
         break;
     case DEFINITION:
-        pad(out,2);
-        padded = 2;
-        print_memoir_element_list(out, elt->children);
-        padded = 0;
+        pad(st, out,2);
+        st->padded = 2;
+        print_memoir_element_list(st, out, elt->children);
+        st->padded = 0;
         break;
     default:
         /* most things are not changed for memoir output */
-        print_latex_element(out, elt);
+        print_latex_element(st, out, elt);
     }
 }
 
 
 /* print_beamer_element_list - print an element as LaTeX for beamer class */
-void print_beamer_element_list(GString *out, element *list) {
+void print_beamer_element_list(render_state *st, GString *out, element *list) {
     while (list != NULL) {
-        print_beamer_element(out, list);
+        print_beamer_element(st, out, list);
         list = list->next;
     }
 }
 
-static void print_beamer_endnotes(GString *out) {
+static void print_beamer_endnotes(render_state *st, GString *out) {
     GSList *note;
     element *note_elt;
-    if (endnotes == NULL) 
+    if (st->endnotes == NULL) 
         return;
-    note = g_slist_reverse(endnotes);
-    pad(out,2);
-    g_string_append_printf(out, "\\part{Bibliography}\n\\begin{frame}[allowframebreaks]\n\\frametitle{Bibliography}\n\\def\\newblock{}\n\\begin{thebibliography}{0}\n");
+    note = g_slist_reverse(st->endnotes);
+    pad(st, out,2);
+    g_string_append_literal(out, "\\part{Bibliography}\n\\begin{frame}[allowframebreaks]\n\\frametitle{Bibliography}\n\\def\\newblock{}\n\\begin{thebibliography}{0}\n");
     while (note != NULL) {
         note_elt = note->data;
-        pad(out, 1);
-        g_string_append_printf(out, "\\bibitem{%s}\n", note_elt->contents.str);
-        padded=2;
-        print_latex_element_list(out, note_elt);
-        pad(out, 1);
+        pad(st, out, 1);
+        g_string_append_printf(out, "\\bibitem{%s}\n", note_mark(st, note_elt));
+        st->padded=2;
+        print_latex_element_list(st, out, note_elt);
+        pad(st, out, 1);
         note = note->next;
     }
-    pad(out, 1);
-    g_string_append_printf(out, "\\end{thebibliography}\n\\end{frame}\n\n");
-    padded = 2;
-    g_slist_free(endnotes);
+    pad(st, out, 1);
+    g_string_append_literal(out, "\\end{thebibliography}\n\\end{frame}\n\n");
+    st->padded = 2;
+    g_slist_free(st->endnotes);
 }
 
 /* print_beamer_element - print an element as LaTeX for beamer class */
-static void print_beamer_element(GString *out, element *elt) {
+static void print_beamer_element(render_state *st, GString *out, element *elt) {
     int lev;
-    char *label;
     switch (elt->key) {
         case FOOTER:
-            print_beamer_endnotes(out);
-            g_string_append_printf(out, "\\mode<all>\n");
-            print_latex_footer(out);
-            g_string_append_printf(out, "\\mode*\n");
+            print_beamer_endnotes(st, out);
+            g_string_append_literal(out, "\\mode<all>\n");
+            print_latex_footer(st, out);
+            g_string_append_literal(out, "\\mode*\n");
             break;
         case LISTITEM:
-            pad(out, 1);
-            g_string_append_printf(out, "\\item<+-> ");
-            padded = 2;
-            print_latex_element_list(out, elt->children);
-            g_string_append_printf(out, "\n");
+            pad(st, out, 1);
+            g_string_append_literal(out, "\\item<+-> ");
+            st->padded = 2;
+            print_latex_element_list(st, out, elt->children);
+            g_string_append_literal(out, "\n");
             break;
         case HEADINGSECTION:
-            if (elt->children->key -H1 + base_header_level == 3) {
-                pad(out,2);
-               g_string_append_printf(out, "\\begin{frame}");
-                if (list_contains_key(elt->children,VERBATIM)) {
-                    g_string_append_printf(out, "[fragile]");
+            if (elt->children->key -H1 + st->base_header_level == 3) {
+                pad(st, out,2);
+               g_string_append_literal(out, "\\begin{frame}");
+                if (may_contain(st, VERBATIM) && list_contains_key(elt->children,VERBATIM)) {
+                    g_string_append_literal(out, "[fragile]");
                 }
-                padded = 0;
-                print_beamer_element_list(out, elt->children);
-                g_string_append_printf(out, "\n\n\\end{frame}\n\n");
-                padded = 2;
-            } else if (elt->children->key -H1 + base_header_level == 4) {
-                pad(out, 1);
-                g_string_append_printf(out, "\\mode<article>{\n");
-                padded = 0;
-                print_beamer_element_list(out, elt->children->next);
-                g_string_append_printf(out, "\n\n}\n\n");
-                padded = 2;
+                st->padded = 0;
+                print_beamer_element_list(st, out, elt->children);
+                g_string_append_literal(out, "\n\n\\end{frame}\n\n");
+                st->padded = 2;
+            } else if (elt->children->key -H1 + st->base_header_level == 4) {
+                pad(st, out, 1);
+                g_string_append_literal(out, "\\mode<article>{\n");
+                st->padded = 0;
+                print_beamer_element_list(st, out, elt->children->next);
+                g_string_append_literal(out, "\n\n}\n\n");
+                st->padded = 2;
             } else {
-                print_beamer_element_list(out, elt->children);
+                print_beamer_element_list(st, out, elt->children);
             }
             break;
         case H1: case H2: case H3: case H4: case H5: case H6:
-            pad(out, 2);
-            lev = elt->key - H1 + base_header_level;  /* assumes H1 ... H6 are in order */
+            pad(st, out, 2);
+            lev = elt->key - H1 + st->base_header_level;  /* assumes H1 ... H6 are in order */
             switch (lev) {
                 case 1:
-                    g_string_append_printf(out, "\\part{");
+                    g_string_append_literal(out, "\\part{");
                     break;
                 case 2:
-                    g_string_append_printf(out, "\\section{");
+                    g_string_append_literal(out, "\\section{");
                     break;
                 case 3:
-                    g_string_append_printf(out, "\\frametitle{");
+                    g_string_append_literal(out, "\\frametitle{");
                     break;
                 default:
-                    g_string_append_printf(out, "\\emph{");
+                    g_string_append_literal(out, "\\emph{");
                     break;
             }
             /* generate a label for each header (MMD);
                 don't allow footnotes since invalid here */
-            no_latex_footnote = TRUE;
+            st->no_latex_footnote = TRUE;
             if (elt->children->key == AUTOLABEL) {
-                label = label_from_string(elt->children->contents.str,0);
-                print_latex_element_list(out, elt->children->next);
+                print_latex_element_list(st, out, elt->children->next);
             } else {
-                label = label_from_element_list(elt->children,0);
-                print_latex_element_list(out, elt->children);
+                print_latex_element_list(st, out, elt->children);
             }
-            no_latex_footnote = FALSE;
-            g_string_append_printf(out, "}\n\\label{");
-            g_string_append_printf(out, "%s", label);
-            g_string_append_printf(out, "}\n");
-            free(label);
-            padded = 1;
+            st->no_latex_footnote = FALSE;
+            g_string_append_literal(out, "}\n\\label{");
+            g_string_append(out, elt->contents.str);
+            g_string_append_literal(out, "}\n");
+            st->padded = 1;
             break;
         default:
-        print_latex_element(out, elt);
+        print_latex_element(st, out, elt);
     }
 }
 
 
-element * print_html_headingsection(GString *out, element *list, bool obfuscate) {
+element * print_html_headingsection(render_state *st, GString *out, element *list, bool obfuscate) {
     element *base = list;
-    print_html_element_list(out, list->children, obfuscate);
+    print_html_element_list(st, out, list->children, obfuscate);
     
     list = list->next;
     while ( (list != NULL) && (list->key == HEADINGSECTION) && (list->children->key > base->children->key) && (list->children->key <= H6)) {
-        list = print_html_headingsection(out, list, obfuscate);
+        list = print_html_headingsection(st, out, list, obfuscate);
     }
 
     return list;
 }
 
 /* look for "LaTeX Mode" metadata and change format to match */
-static int find_latex_mode(int format, element *list) {
+static int find_latex_mode(render_state *st, int format, element *list) {
     element *latex_mode;
     char *label;
     
     if (format != LATEX_FORMAT) return format;
     
-    if (list_contains_key(list,METAKEY)) {
-        latex_mode = metadata_for_key("latexmode", list);
-        if ( latex_mode != NULL) {
-            label = label_from_element_list(latex_mode->children, 0);
-            if (strcmp(label, "beamer") == 0) { format = BEAMER_FORMAT; } else 
-            if (strcmp(label, "memoir") == 0) { format = MEMOIR_FORMAT; } 
-            free(label);
-        }
-        return format;
-    } else {
-        return format;
+    latex_mode = find_metadata(st, list, "latexmode");
+    if ( latex_mode != NULL) {
+        label = label_from_element_list(latex_mode->children, 0);
+        if (strcmp(label, "beamer") == 0) { format = BEAMER_FORMAT; } else 
+        if (strcmp(label, "memoir") == 0) { format = MEMOIR_FORMAT; } 
+        free(label);
     }
+    return format;
+}
+
+/* find_metadata - return the METAKEY for 'key' in the metadata of the
+ * document 'list', or NULL.  'key' must already be normalized, as
+ * label_from_string() would make it. */
+static element * find_metadata(render_state *st, element *list, char *key) {
+    if (st->index != NULL)
+        return lookup_table_find(&st->index->metadata_table, key);
+    return metadata_for_key(key, list);
 }
 
 
@@ -2608,7 +2823,7 @@ char * dimension_for_attribute(char *querystring, element *list) {
     
     if ((strcmp(dimension,upper) == 0) && (dimension[strlen(dimension) -1] != '%')) {
         /* no units */
-        g_string_append_printf(result, "pt");
+        g_string_append_literal(result, "pt");
     }
 
     free(upper);
@@ -2620,108 +2835,119 @@ char * dimension_for_attribute(char *querystring, element *list) {
 }
 
 /* Check metadata keys and determine if I need a complete document */
-static bool is_html_complete_doc(element *meta) {
+static bool is_html_complete_doc(render_state *st, element *meta) {
+    static char *settings[] = { "baseheaderlevel", "xhtmlheaderlevel",
+        "htmlheaderlevel", "latexheaderlevel", "odfheaderlevel",
+        "quoteslanguage", NULL };
     element *step;
-    step = meta->children;
-    
-    while (step != NULL) {
-        if ((strcmp(step->contents.str, "baseheaderlevel") != 0) &&
-            (strcmp(step->contents.str, "xhtmlheaderlevel") != 0) &&
-            (strcmp(step->contents.str, "htmlheaderlevel") != 0) &&
-            (strcmp(step->contents.str, "latexheaderlevel") != 0) &&
-            (strcmp(step->contents.str, "odfheaderlevel") != 0) &&
-            (strcmp(step->contents.str, "quoteslanguage") != 0))
-        {
+    int others;
+    int i;
+
+    if (st->index != NULL && st->index->metadata == meta) {
+        /* complete unless every key given is one of the settings */
+        others = st->index->metadata_table.count;
+        for (i = 0; settings[i] != NULL; i++)
+            if (find_metadata(st, meta, settings[i]) != NULL)
+                others--;
+        return others > 0;
+    }
+
+    for (step = meta->children; step != NULL; step = step->next) {
+        for (i = 0; settings[i] != NULL; i++)
+            if (strcmp(step->contents.str, settings[i]) == 0)
+                break;
+        if (settings[i] == NULL)
             return TRUE;
-        }
-        step = step->next;
     }
-    
     return FALSE;
 }
 
-/* if citation has a locator, return as element and "prune", else NULL */
+/* if citation has a locator, return it as element, else NULL */
 element * locator_for_citation(element *elt) {
-    element *result;
-    
     if ((elt->children != NULL) && (elt->children->key == LOCATOR)) {
         /* Locator is present */
-        result = elt->children;
-        elt->children = elt->children->next;
-        return result;
+        return elt->children;
     } else {
         /* no locator exists */
         return NULL;
     }
 }
 
+/* return the note a citation refers to, which follows its locator if any */
+element * note_for_citation(element *elt) {
+    element *locator = locator_for_citation(elt);
+
+    return (locator != NULL) ? locator->next : elt->children;
+}
+
 /* print_opml_element_list - print an element list as OPML */
-void print_opml_element_list(GString *out, element *list) {
+void print_opml_element_list(render_state *st, GString *out, element *list) {
     int lev;
     while (list != NULL) {
         if (list->key == HEADINGSECTION) {
             lev = list->children->key;
             
-            print_opml_section_and_children(out, list);
+            print_opml_section_and_children(st, out, list);
             
             while ((list->next != NULL) && (list->next->key == HEADINGSECTION)
                 && (list->next->children->key > lev)) {
                     list = list->next;
             }
         } else {
-            print_opml_element(out, list);
+            print_opml_element(st, out, list);
         }
         list = list->next;
     }
 }
 
 /* print_opml_section_and_children - print section and "children" */
-static void print_opml_section_and_children(GString *out, element *list) {
+static void print_opml_section_and_children(render_state *st, GString *out, element *list) {
     int lev = list->children->key;
     /* Print current section, aka "parent" */
-    print_opml_element(out, list);
+    print_opml_element(st, out, list);
     
     /* check for children */
     while ((list->next != NULL) && (list->next->key == HEADINGSECTION) 
         && (list->next->children->key > lev)) {
             /* next item is also HEADINGSECTION and is child */
             if (list->next->children->key - lev == 1)
-                print_opml_section_and_children(out,list->next);
+                print_opml_section_and_children(st, out,list->next);
             list = list->next;
         }
-    g_string_append_printf(out, "</outline>\n");
+    g_string_append_literal(out, "</outline>\n");
 }
 
 /* print_opml_element - print an element as OPML */
-static void print_opml_element(GString *out, element *elt) {
+static void print_opml_element(render_state *st, GString *out, element *elt) {
+    flush_output(st, out);
     switch (elt->key) {
         case METADATA:
             /* Metadata is present, so will need to be appended */
-            html_footer = true;
+            st->html_footer = true;
             break;
         case METAKEY:
-            g_string_append_printf(out, "<outline text=\"");
+            g_string_append_literal(out, "<outline text=\"");
             print_opml_string(out,elt->contents.str);
-            g_string_append_printf(out, "\" _note=\"");
+            g_string_append_literal(out, "\" _note=\"");
             print_opml_string(out, elt->children->contents.str);
-            g_string_append_printf(out, "\"/>");
+            g_string_append_literal(out, "\"/>");
             break;
         case HEADINGSECTION:
             /* Need to handle "nesting" properly */
-            g_string_append_printf(out, "<outline ");
+            g_string_append_literal(out, "<outline ");
             
             /* Print header */
-            print_opml_element(out,elt->children);
+            print_opml_element(st, out,elt->children);
             
             /* print remainder of paragraphs as note */
-            g_string_append_printf(out, " _note=\"");
-            print_opml_element_list(out,elt->children->next);
-            g_string_append_printf(out, "\">");
+            g_string_append_literal(out, " _note=\"");
+            print_opml_element_list(st, out,elt->children->next);
+            g_string_append_literal(out, "\">");
             break;
         case H1: case H2: case H3: case H4: case H5: case H6: 
-            g_string_append_printf(out, "text=\"");
+            g_string_append_literal(out, "text=\"");
             print_opml_string(out, elt->contents.str);
-            g_string_append_printf(out,"\"");
+            g_string_append_literal(out,"\"");
             break;
         case VERBATIM:
             print_opml_string(out, elt->contents.str);
@@ -2733,12 +2959,12 @@ static void print_opml_element(GString *out, element *elt) {
             print_opml_string(out, elt->contents.str);
             break;
         case LINEBREAK:
-            g_string_append_printf(out, "  &#10;");
+            g_string_append_literal(out, "  &#10;");
             break;
         case PLAIN:
-            print_opml_element_list(out,elt->children);
+            print_opml_element_list(st, out,elt->children);
             if ((elt->next != NULL) && (elt->next->key == PLAIN)) {
-                g_string_append_printf(out, "&#10;");
+                g_string_append_literal(out, "&#10;");
             }
             break;
         default: 
@@ -2747,65 +2973,59 @@ static void print_opml_element(GString *out, element *elt) {
     }
 }
 
+/* escape_opml - print the character at 'str', escaping for OPML */
+static char *escape_opml(GString *out, char *str) {
+    switch (*str) {
+    case '&':
+        g_string_append_literal(out, "&amp;");
+        break;
+    case '<':
+        g_string_append_literal(out, "&lt;");
+        break;
+    case '>':
+        g_string_append_literal(out, "&gt;");
+        break;
+    case '"':
+        g_string_append_literal(out, "&quot;");
+        break;
+    case '\n': case '\r':
+        g_string_append_literal(out, "&#10;");
+        break;
+    default:
+        g_string_append_c(out, *str);
+    }
+    return str;
+}
+
 /* print_opml_string - print string, escaping for OPML */
 static void print_opml_string(GString *out, char *str) {
-    while (*str != '\0') {
-        switch (*str) {
-        case '&':
-            g_string_append_printf(out, "&amp;");
-            break;
-        case '<':
-            g_string_append_printf(out, "&lt;");
-            break;
-        case '>':
-            g_string_append_printf(out, "&gt;");
-            break;
-        case '"':
-            g_string_append_printf(out, "&quot;");
-            break;
-        case '\n': case '\r':
-            g_string_append_printf(out, "&#10;");
-            break;
-        default:
-            g_string_append_c(out, *str);
-        }
-    str++;
-    }
+    print_escaped(out, str, ESCAPE_OPML, escape_opml);
 }
 
 
 /* print_opml_metadata - add metadata as last outline item */
-static void print_opml_metadata(GString *out, element *elt) {
-    g_string_append_printf(out, "<outline text=\"Metadata\">\n");
-    print_opml_element_list(out, elt->children);
-    g_string_append_printf(out, "</outline>");
+static void print_opml_metadata(render_state *st, GString *out, element *elt) {
+    g_string_append_literal(out, "<outline text=\"Metadata\">\n");
+    print_opml_element_list(st, out, elt->children);
+    g_string_append_literal(out, "</outline>");
 }
 
 /* print_odf_body_element - print an element as ODF */
-void print_odf_body_element(GString *out, element *elt) {
+void print_odf_body_element(render_state *st, GString *out, element *elt) {
     switch (elt->key) {
     case PARA:
-        print_odf_element_list(out, elt->children);
+        print_odf_element_list(st, out, elt->children);
         break;
     default:
-        print_odf_element(out, elt);
+        print_odf_element(st, out, elt);
     }
 }
 
 /* print_odf_body_element_list - print an element list as ODF for specific 
     places, eg image captions */
-void print_odf_body_element_list(GString *out, element *list) {
+void print_odf_body_element_list(render_state *st, GString *out, element *list) {
     while (list != NULL) {
-        print_odf_body_element(out, list);
+        print_odf_body_element(st, out, list);
         list = list->next;
     }
 }
-
-/* bogus function just references a couple globals defined in utility_functions.c but not used in this source file */
-static void bogus_function()
-{
-	static char* bogus;
-	bogus = charbuf;
-	static element* bogus2;
-	bogus2 = parse_result;
-}
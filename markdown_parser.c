@@ -0,0 +1,10620 @@
+/* A recursive-descent parser generated by peg 0.1.2 */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#define YYRULECOUNT 305
+
+/**********************************************************************
+
+  markdown_parser.leg - markdown parser in C using a PEG grammar.
+  (c) 2008 John MacFarlane (jgm at berkeley dot edu).
+  
+  portions Copyright (c) 2010-2011 Fletcher T. Penney
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License or the MIT
+  license.  See LICENSE for details.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+ ***********************************************************************/
+
+#include <stdbool.h>
+#include <assert.h>
+#include <limits.h>
+#include "markdown_peg.h"
+#include "utility_functions.c"
+
+#define YY_DEBUG_OFF
+
+/* extension = returns true if extension is selected */
+static bool extension(mmd_parser_t *parser, int ext) {
+    return (parser->syntax_extensions & ext);
+}
+
+/* mk_slice - constructor for SLICE element viewing 'len' characters at
+ * 'start', which must stay in place until the slice is joined (normally
+ * the parser's input buffer, or a string constant).  Nothing is copied. */
+static element * mk_slice(mmd_parser_t *parser, char *start, int len) {
+    element *result;
+    result = mk_element(parser, SLICE);
+    result->contents.str = start;
+    result->len = len;
+    return result;
+}
+
+/* set_anchor_id - store in the contents of a heading or table caption
+ * the id that links to it: its explicit label if it has one, otherwise
+ * one made from its text.  The writers print it as it is;
+ * assign_anchor_ids() makes the generated ones unique once the whole
+ * document is parsed.  Returns 'elt'. */
+static element *set_anchor_id(mmd_parser_t *parser, element *elt) {
+    element *text = elt->children;
+    GString *raw;
+    char *id;
+
+    if (text != NULL && text->key == AUTOLABEL) {
+        elt->contents.str = text->contents.str;
+        return elt;
+    }
+    if (text != NULL && text->key == TABLELABEL)
+        text = text->children;
+    raw = g_string_new("");
+    print_raw_element_list(raw, text);
+    id = label_from_string(raw->str, 0);
+    elt->contents.str = parser_strdup(parser, id);
+    free(id);
+    g_string_free(raw, true);
+    return elt;
+}
+
+/**********************************************************************
+
+  PEG grammar and parser actions for markdown syntax.
+
+ ***********************************************************************/
+
+
+#define YY_MEMO
+#ifndef YY_LOCAL
+#define YY_LOCAL(T)	static T
+#endif
+#ifndef YY_ACTION
+#define YY_ACTION(T)	static T
+#endif
+#ifndef YY_RULE
+#define YY_RULE(T)	static T
+#endif
+#ifndef YY_PARSE
+#define YY_PARSE(T)	T
+#endif
+#ifndef YYPARSE
+#define YYPARSE		yyparse
+#endif
+#ifndef YYPARSEFROM
+#define YYPARSEFROM	yyparsefrom
+#endif
+#ifndef YYRELEASE
+#define YYRELEASE	yyrelease
+#endif
+#ifndef YY_INPUT
+#define YY_INPUT(buf, result, max_size)			\
+  {							\
+    int yyc= getchar();					\
+    result= (EOF == yyc) ? 0 : (*(buf)= yyc, 1);	\
+    yyprintf((stderr, "<%c>", yyc));			\
+  }
+#endif
+#ifndef YY_BEGIN
+#define YY_BEGIN	( yy->__begin= yy->__pos, 1)
+#endif
+#ifndef YY_END
+#define YY_END		( yy->__end= yy->__pos, 1)
+#endif
+#ifdef YY_DEBUG
+# define yyprintf(args)	fprintf args
+#else
+# define yyprintf(args)
+#endif
+#ifndef YYSTYPE
+#define YYSTYPE	int
+#endif
+#ifdef YY_MEMO
+#define YY_OUTER	(-0x7fffffff)
+#endif
+#ifdef YY_WINDOW
+#define YY_INWINDOW(yy)	((yy)->__pos >= (yy)->__base && (yy)->__pos < (yy)->__limit)
+#define YY_CHAR(yy)	((yy)->__buf[(yy)->__pos - (yy)->__base])
+#else
+#define YY_INWINDOW(yy)	((yy)->__pos < (yy)->__limit)
+#define YY_CHAR(yy)	((yy)->__buf[(yy)->__pos])
+#endif
+
+typedef struct _yycontext yycontext;
+typedef void (*yyaction)(yycontext *yy, char *yytext, int yyleng);
+typedef struct _yythunk { int begin, end;  yyaction  action;  struct _yythunk *next; } yythunk;
+
+#ifdef YY_MEMO
+typedef struct _yymemo {
+  int rule, pos, generation, ok, endpos, begin, end, thunks, thunkcount;
+} yymemo;
+
+typedef struct _yymemoframe {
+  int pos, thunkpos, begin, end, outerbegin, outerend, outer;
+} yymemoframe;
+#endif
+
+struct _yycontext {
+  char     *__buf;
+  int       __buflen;
+  int       __base;
+  int       __pos;
+  int       __limit;
+  char     *__text;
+  int       __textlen;
+  int       __textpos;
+  int       __begin;
+  int       __end;
+  int       __textmax;
+  yythunk  *__thunks;
+  int       __thunkslen;
+  int       __thunkpos;
+  YYSTYPE   __;
+  YYSTYPE  *__val;
+  YYSTYPE  *__vals;
+  int       __valslen;
+#ifdef YY_MEMO
+  int       __outerbegin;
+  int       __outerend;
+  int       __outer;
+  yymemo   *__memos;
+  int       __memoslen;
+  int       __memocount;
+  int       __memogeneration;
+  yythunk  *__memothunks;
+  int       __memothunkslen;
+  int       __memothunkpos;
+#endif
+#ifdef YY_CTX_MEMBERS
+  YY_CTX_MEMBERS
+#endif
+};
+
+#ifndef YY_PART
+
+YY_LOCAL(int) yyrefill(yycontext *yy)
+{
+#ifdef YY_BUFFER
+#ifdef YY_WINDOW
+  return YY_WINDOW(yy->__pos, yy->__buf, yy->__base, yy->__limit);
+#else
+  return 0;
+#endif
+#else
+  int yyn;
+  while (yy->__buflen - yy->__pos < 512)
+    {
+      yy->__buflen *= 2;
+      yy->__buf= realloc(yy->__buf, yy->__buflen);
+    }
+  YY_INPUT((yy->__buf + yy->__pos), yyn, (yy->__buflen - yy->__pos));
+  if (!yyn) return 0;
+  yy->__limit += yyn;
+  return 1;
+#endif
+}
+
+YY_LOCAL(int) yymatchDot(yycontext *yy)
+{
+  if (!YY_INWINDOW(yy) && !yyrefill(yy)) return 0;
+  ++yy->__pos;
+  return 1;
+}
+
+YY_LOCAL(int) yymatchChar(yycontext *yy, int c)
+{
+  if (!YY_INWINDOW(yy) && !yyrefill(yy)) return 0;
+  if (YY_CHAR(yy) == c)
+    {
+      ++yy->__pos;
+      yyprintf((stderr, "  ok   yymatchChar(%c) @ %s\n", c, yy->__buf+yy->__pos-yy->__base));
+      return 1;
+    }
+  yyprintf((stderr, "  fail yymatchChar(%c) @ %s\n", c, yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+
+YY_LOCAL(int) yymatchString(yycontext *yy, char *s)
+{
+  int yysav= yy->__pos;
+  while (*s)
+    {
+      if (!YY_INWINDOW(yy) && !yyrefill(yy)) return 0;
+      if (YY_CHAR(yy) != *s)
+        {
+          yy->__pos= yysav;
+          return 0;
+        }
+      ++s;
+      ++yy->__pos;
+    }
+  return 1;
+}
+
+YY_LOCAL(int) yymatchClass(yycontext *yy, unsigned char *bits)
+{
+  int c;
+  if (!YY_INWINDOW(yy) && !yyrefill(yy)) return 0;
+  c= YY_CHAR(yy);
+  if (bits[c >> 3] & (1 << (c & 7)))
+    {
+      ++yy->__pos;
+      yyprintf((stderr, "  ok   yymatchClass @ %s\n", yy->__buf+yy->__pos-yy->__base));
+      return 1;
+    }
+  yyprintf((stderr, "  fail yymatchClass @ %s\n", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+
+YY_LOCAL(void) yyDo(yycontext *yy, yyaction action, int begin, int end)
+{
+  while (yy->__thunkpos >= yy->__thunkslen)
+    {
+      yy->__thunkslen *= 2;
+      yy->__thunks= realloc(yy->__thunks, sizeof(yythunk) * yy->__thunkslen);
+    }
+  yy->__thunks[yy->__thunkpos].begin=  begin;
+  yy->__thunks[yy->__thunkpos].end=    end;
+  yy->__thunks[yy->__thunkpos].action= action;
+  ++yy->__thunkpos;
+}
+
+YY_LOCAL(int) yyText(yycontext *yy, int begin, int end)
+{
+  int yyleng;
+#ifdef YY_MEMO
+  if (YY_OUTER == begin) begin= yy->__outerbegin, yy->__outer= 1;
+  if (YY_OUTER == end)   end=   yy->__outerend,   yy->__outer= 1;
+#endif
+  yy->__textpos= begin;
+  yyleng= end - begin;
+  if (yyleng <= 0)
+    yyleng= 0;
+  else
+    {
+      while (yy->__textlen < (yyleng - 1))
+	{
+	  yy->__textlen *= 2;
+	  yy->__text= realloc(yy->__text, yy->__textlen);
+	}
+#ifdef YY_WINDOW
+      {
+	int pos, len;
+	for (pos= begin;  pos < end;  pos += len)
+	  {
+	    if ((pos < yy->__base || pos >= yy->__limit) && !YY_WINDOW(pos, yy->__buf, yy->__base, yy->__limit)) break;
+	    len= (end < yy->__limit ? end : yy->__limit) - pos;
+	    memcpy(yy->__text + (pos - begin), yy->__buf + (pos - yy->__base), len);
+	  }
+	yyleng= pos - begin;
+      }
+#else
+      memcpy(yy->__text, yy->__buf + begin, yyleng);
+#endif
+    }
+  yy->__text[yyleng]= '\0';
+  return yyleng;
+}
+
+YY_LOCAL(void) yyDone(yycontext *yy)
+{
+  int pos;
+  for (pos= 0;  pos < yy->__thunkpos;  ++pos)
+    {
+      yythunk *thunk= &yy->__thunks[pos];
+      int yyleng= thunk->end ? yyText(yy, thunk->begin, thunk->end) : thunk->begin;
+      yyprintf((stderr, "DO [%d] %p %s\n", pos, thunk->action, yy->__text));
+      thunk->action(yy, yy->__text, yyleng);
+    }
+  yy->__thunkpos= 0;
+}
+
+#ifdef YY_MEMO
+
+YY_LOCAL(void) yyMemoClear(yycontext *yy)
+{
+  ++yy->__memogeneration;
+  yy->__memocount= yy->__memothunkpos= 0;
+}
+
+YY_LOCAL(yymemo *) yyMemoSlot(yycontext *yy, yymemo *memos, int len, int rule, int pos)
+{
+  unsigned int hash= ((unsigned int)pos * 2654435761u) ^ ((unsigned int)rule * 40503u);
+  yymemo *memo;
+  for (;;)
+    {
+      memo= &memos[hash & (len - 1)];
+      if (memo->generation != yy->__memogeneration || (memo->rule == rule && memo->pos == pos))
+	return memo;
+      ++hash;
+    }
+}
+
+YY_LOCAL(int) yyMemoLookup(yycontext *yy, int rule)
+{
+  yymemo *memo;
+  int i;
+  if (!yy->__memoslen) return -1;
+  memo= yyMemoSlot(yy, yy->__memos, yy->__memoslen, rule, yy->__pos);
+  if (memo->generation != yy->__memogeneration) return -1;
+  yyprintf((stderr, "  memo %d @ %d -> %d\n", rule, yy->__pos, memo->ok));
+  while (yy->__thunkpos + memo->thunkcount >= yy->__thunkslen)
+    {
+      yy->__thunkslen *= 2;
+      yy->__thunks= realloc(yy->__thunks, sizeof(yythunk) * yy->__thunkslen);
+    }
+  for (i= 0;  i < memo->thunkcount;  ++i)
+    {
+      yythunk *thunk= &yy->__thunks[yy->__thunkpos++];
+      *thunk= yy->__memothunks[memo->thunks + i];
+      if (YY_OUTER == thunk->begin) thunk->begin= yy->__begin;
+      if (YY_OUTER == thunk->end)   thunk->end=   yy->__end;
+    }
+  if (YY_OUTER != memo->begin) yy->__begin= memo->begin;
+  if (YY_OUTER != memo->end)   yy->__end=   memo->end;
+  if (memo->ok) yy->__pos= memo->endpos;
+  return memo->ok;
+}
+
+YY_LOCAL(void) yyMemoEnter(yycontext *yy, yymemoframe *frame)
+{
+  frame->pos= yy->__pos;
+  frame->thunkpos= yy->__thunkpos;
+  frame->begin= yy->__begin;
+  frame->end= yy->__end;
+  frame->outerbegin= yy->__outerbegin;
+  frame->outerend= yy->__outerend;
+  frame->outer= yy->__outer;
+  if (YY_OUTER != yy->__begin) yy->__outerbegin= yy->__begin;
+  if (YY_OUTER != yy->__end)   yy->__outerend=   yy->__end;
+  yy->__begin= yy->__end= YY_OUTER;
+  yy->__outer= 0;
+}
+
+YY_LOCAL(int) yyMemoLeave(yycontext *yy, yymemoframe *frame, int rule, int ok)
+{
+  yymemo *memo;
+  int i;
+  if (!yy->__outer)
+    {
+      if (2 * (yy->__memocount + 1) > yy->__memoslen)
+	{
+	  yymemo *memos= yy->__memos;
+	  int len= yy->__memoslen;
+	  yy->__memoslen= len ? 2 * len : 1024;
+	  yy->__memos= calloc(yy->__memoslen, sizeof(yymemo));
+	  for (i= 0;  i < len;  ++i)
+	    if (memos[i].generation == yy->__memogeneration)
+	      *yyMemoSlot(yy, yy->__memos, yy->__memoslen, memos[i].rule, memos[i].pos)= memos[i];
+	  free(memos);
+	}
+      memo= yyMemoSlot(yy, yy->__memos, yy->__memoslen, rule, frame->pos);
+      if (memo->generation != yy->__memogeneration) ++yy->__memocount;
+      memo->rule= rule;
+      memo->pos= frame->pos;
+      memo->generation= yy->__memogeneration;
+      memo->ok= ok;
+      memo->endpos= yy->__pos;
+      memo->begin= yy->__begin;
+      memo->end= yy->__end;
+      memo->thunks= yy->__memothunkpos;
+      memo->thunkcount= yy->__thunkpos - frame->thunkpos;
+      while (yy->__memothunkpos + memo->thunkcount >= yy->__memothunkslen)
+	{
+	  yy->__memothunkslen= yy->__memothunkslen ? 2 * yy->__memothunkslen : 1024;
+	  yy->__memothunks= realloc(yy->__memothunks, sizeof(yythunk) * yy->__memothunkslen);
+	}
+      memcpy(yy->__memothunks + yy->__memothunkpos, yy->__thunks + frame->thunkpos, sizeof(yythunk) * memo->thunkcount);
+      yy->__memothunkpos += memo->thunkcount;
+    }
+  for (i= frame->thunkpos;  i < yy->__thunkpos;  ++i)
+    {
+      if (YY_OUTER == yy->__thunks[i].begin) yy->__thunks[i].begin= frame->begin;
+      if (YY_OUTER == yy->__thunks[i].end)   yy->__thunks[i].end=   frame->end;
+    }
+  if (YY_OUTER == yy->__begin) yy->__begin= frame->begin;
+  if (YY_OUTER == yy->__end)   yy->__end=   frame->end;
+  yy->__outer= frame->outer || (yy->__outer && (YY_OUTER == frame->begin || YY_OUTER == frame->end));
+  yy->__outerbegin= frame->outerbegin;
+  yy->__outerend= frame->outerend;
+  return ok;
+}
+
+#endif
+
+YY_LOCAL(void) yyCommit(yycontext *yy)
+{
+#ifdef YY_MEMO
+  yyMemoClear(yy);
+#endif
+#ifdef YY_BUFFER
+  yy->__thunkpos= 0;
+#else
+  if ((yy->__limit -= yy->__pos))
+    {
+      memmove(yy->__buf, yy->__buf + yy->__pos, yy->__limit);
+    }
+  yy->__begin -= yy->__pos;
+  yy->__end -= yy->__pos;
+  yy->__pos= yy->__thunkpos= 0;
+#endif
+}
+
+YY_LOCAL(int) yyAccept(yycontext *yy, int tp0)
+{
+  if (tp0)
+    {
+      fprintf(stderr, "accept denied at %d\n", tp0);
+      return 0;
+    }
+  else
+    {
+      yyDone(yy);
+      yyCommit(yy);
+    }
+  return 1;
+}
+
+YY_LOCAL(void) yyPush(yycontext *yy, char *text, int count)
+{
+  yy->__val += count;
+  while (yy->__valslen <= yy->__val - yy->__vals)
+    {
+      long offset= yy->__val - yy->__vals;
+      yy->__valslen *= 2;
+      yy->__vals= realloc(yy->__vals, sizeof(YYSTYPE) * yy->__valslen);
+      yy->__val= yy->__vals + offset;
+    }
+}
+YY_LOCAL(void) yyPop(yycontext *yy, char *text, int count)	{ yy->__val -= count; }
+YY_LOCAL(void) yySet(yycontext *yy, char *text, int count)	{ yy->__val[count]= yy->__; }
+
+#endif /* YY_PART */
+
+#define	YYACCEPT	yyAccept(yy, yythunkpos0)
+
+YY_RULE(int) yy_MarkdownHtmlAttribute(yycontext *yy); /* 305 */
+YY_RULE(int) yy_OPMLSectionBlock(yycontext *yy); /* 304 */
+YY_RULE(int) yy_OPMLHeading(yycontext *yy); /* 303 */
+YY_RULE(int) yy_OPMLPlain(yycontext *yy); /* 302 */
+YY_RULE(int) yy_OPMLHeadingSection(yycontext *yy); /* 301 */
+YY_RULE(int) yy_OPMLBlock(yycontext *yy); /* 300 */
+YY_RULE(int) yy_DocForOPML(yycontext *yy); /* 299 */
+YY_RULE(int) yy_RightAlign(yycontext *yy); /* 298 */
+YY_RULE(int) yy_CenterAlign(yycontext *yy); /* 297 */
+YY_RULE(int) yy_LeftAlign(yycontext *yy); /* 296 */
+YY_RULE(int) yy_RightAlignWrap(yycontext *yy); /* 295 */
+YY_RULE(int) yy_CenterAlignWrap(yycontext *yy); /* 294 */
+YY_RULE(int) yy_LeftAlignWrap(yycontext *yy); /* 293 */
+YY_RULE(int) yy_AlignmentCell(yycontext *yy); /* 292 */
+YY_RULE(int) yy_CellStr(yycontext *yy); /* 291 */
+YY_RULE(int) yy_FullCell(yycontext *yy); /* 290 */
+YY_RULE(int) yy_EmptyCell(yycontext *yy); /* 289 */
+YY_RULE(int) yy_ExtendedCell(yycontext *yy); /* 288 */
+YY_RULE(int) yy_TableCell(yycontext *yy); /* 287 */
+YY_RULE(int) yy_CellDivider(yycontext *yy); /* 286 */
+YY_RULE(int) yy_TableLine(yycontext *yy); /* 285 */
+YY_RULE(int) yy_Definition(yycontext *yy); /* 284 */
+YY_RULE(int) yy_Term(yycontext *yy); /* 283 */
+YY_RULE(int) yy_TermLine(yycontext *yy); /* 282 */
+YY_RULE(int) yy_LabelFromSource(yycontext *yy); /* 281 */
+YY_RULE(int) yy_TableBody(yycontext *yy); /* 280 */
+YY_RULE(int) yy_TableCaption(yycontext *yy); /* 279 */
+YY_RULE(int) yy_SeparatorLine(yycontext *yy); /* 278 */
+YY_RULE(int) yy_TableRow(yycontext *yy); /* 277 */
+YY_RULE(int) yy_LabelSourceLine(yycontext *yy); /* 276 */
+YY_RULE(int) yy_LabelCandidate(yycontext *yy); /* 275 */
+YY_RULE(int) yy_LabelSource(yycontext *yy); /* 274 */
+YY_RULE(int) yy_Collect(yycontext *yy); /* 273 */
+YY_RULE(int) yy_RawCitationReference(yycontext *yy); /* 272 */
+YY_RULE(int) yy_CitationReferenceSingle(yycontext *yy); /* 271 */
+YY_RULE(int) yy_CitationReferenceDouble(yycontext *yy); /* 270 */
+YY_RULE(int) yy_InlineNote(yycontext *yy); /* 269 */
+YY_RULE(int) yy_RawNoteBlock(yycontext *yy); /* 268 */
+YY_RULE(int) yy_GlossarySortKey(yycontext *yy); /* 267 */
+YY_RULE(int) yy_GlossaryTerm(yycontext *yy); /* 266 */
+YY_RULE(int) yy_RawNoteReference(yycontext *yy); /* 265 */
+YY_RULE(int) yy_DoubleQuoteEnd(yycontext *yy); /* 264 */
+YY_RULE(int) yy_DoubleQuoteStart(yycontext *yy); /* 263 */
+YY_RULE(int) yy_SingleQuoteEnd(yycontext *yy); /* 262 */
+YY_RULE(int) yy_SingleQuoteStart(yycontext *yy); /* 261 */
+YY_RULE(int) yy_EnDash(yycontext *yy); /* 260 */
+YY_RULE(int) yy_EmDash(yycontext *yy); /* 259 */
+YY_RULE(int) yy_Apostrophe(yycontext *yy); /* 258 */
+YY_RULE(int) yy_DoubleQuoted(yycontext *yy); /* 257 */
+YY_RULE(int) yy_SingleQuoted(yycontext *yy); /* 256 */
+YY_RULE(int) yy_Dash(yycontext *yy); /* 255 */
+YY_RULE(int) yy_Ellipsis(yycontext *yy); /* 254 */
+YY_RULE(int) yy_Digit(yycontext *yy); /* 253 */
+YY_RULE(int) yy_NonAlphanumeric(yycontext *yy); /* 252 */
+YY_RULE(int) yy_ExtendedSpecialChar(yycontext *yy); /* 251 */
+YY_RULE(int) yy_Quoted(yycontext *yy); /* 250 */
+YY_RULE(int) yy_HtmlTag(yycontext *yy); /* 249 */
+YY_RULE(int) yy_Ticks5(yycontext *yy); /* 248 */
+YY_RULE(int) yy_Ticks4(yycontext *yy); /* 247 */
+YY_RULE(int) yy_Ticks3(yycontext *yy); /* 246 */
+YY_RULE(int) yy_Ticks2(yycontext *yy); /* 245 */
+YY_RULE(int) yy_Ticks1(yycontext *yy); /* 244 */
+YY_RULE(int) yy_EmptyTitle(yycontext *yy); /* 243 */
+YY_RULE(int) yy_RefTitleParens(yycontext *yy); /* 242 */
+YY_RULE(int) yy_RefTitleDouble(yycontext *yy); /* 241 */
+YY_RULE(int) yy_RefTitleSingle(yycontext *yy); /* 240 */
+YY_RULE(int) yy_UnQuotedValue(yycontext *yy); /* 239 */
+YY_RULE(int) yy_QuotedValue(yycontext *yy); /* 238 */
+YY_RULE(int) yy_AttrValue(yycontext *yy); /* 237 */
+YY_RULE(int) yy_AttrKey(yycontext *yy); /* 236 */
+YY_RULE(int) yy_Attribute(yycontext *yy); /* 235 */
+YY_RULE(int) yy_Attributes(yycontext *yy); /* 234 */
+YY_RULE(int) yy_RefTitle(yycontext *yy); /* 233 */
+YY_RULE(int) yy_RefSrc(yycontext *yy); /* 232 */
+YY_RULE(int) yy_AutoLinkEmail(yycontext *yy); /* 231 */
+YY_RULE(int) yy_AutoLinkUrl(yycontext *yy); /* 230 */
+YY_RULE(int) yy_TitleDouble(yycontext *yy); /* 229 */
+YY_RULE(int) yy_TitleSingle(yycontext *yy); /* 228 */
+YY_RULE(int) yy_Nonspacechar(yycontext *yy); /* 227 */
+YY_RULE(int) yy_SourceContents(yycontext *yy); /* 226 */
+YY_RULE(int) yy_Title(yycontext *yy); /* 225 */
+YY_RULE(int) yy_Source(yycontext *yy); /* 224 */
+YY_RULE(int) yy_ReferenceLinkSingle(yycontext *yy); /* 223 */
+YY_RULE(int) yy_ReferenceLinkDouble(yycontext *yy); /* 222 */
+YY_RULE(int) yy_AutoLink(yycontext *yy); /* 221 */
+YY_RULE(int) yy_ReferenceLink(yycontext *yy); /* 220 */
+YY_RULE(int) yy_ExplicitLink(yycontext *yy); /* 219 */
+YY_RULE(int) yy_TwoUlClose(yycontext *yy); /* 218 */
+YY_RULE(int) yy_TwoUlOpen(yycontext *yy); /* 217 */
+YY_RULE(int) yy_TwoStarClose(yycontext *yy); /* 216 */
+YY_RULE(int) yy_TwoStarOpen(yycontext *yy); /* 215 */
+YY_RULE(int) yy_StrongUl(yycontext *yy); /* 214 */
+YY_RULE(int) yy_OneUlClose(yycontext *yy); /* 213 */
+YY_RULE(int) yy_OneUlOpen(yycontext *yy); /* 212 */
+YY_RULE(int) yy_StrongStar(yycontext *yy); /* 211 */
+YY_RULE(int) yy_OneStarClose(yycontext *yy); /* 210 */
+YY_RULE(int) yy_OneStarOpen(yycontext *yy); /* 209 */
+YY_RULE(int) yy_EmphUl(yycontext *yy); /* 208 */
+YY_RULE(int) yy_EmphStar(yycontext *yy); /* 207 */
+YY_RULE(int) yy_StarLine(yycontext *yy); /* 206 */
+YY_RULE(int) yy_UlLine(yycontext *yy); /* 205 */
+YY_RULE(int) yy_SpecialChar(yycontext *yy); /* 204 */
+YY_RULE(int) yy_Eof(yycontext *yy); /* 203 */
+YY_RULE(int) yy_NormalEndline(yycontext *yy); /* 202 */
+YY_RULE(int) yy_TerminalEndline(yycontext *yy); /* 201 */
+YY_RULE(int) yy_LineBreak(yycontext *yy); /* 200 */
+YY_RULE(int) yy_CharEntity(yycontext *yy); /* 199 */
+YY_RULE(int) yy_DecEntity(yycontext *yy); /* 198 */
+YY_RULE(int) yy_HexEntity(yycontext *yy); /* 197 */
+YY_RULE(int) yy_AposChunk(yycontext *yy); /* 196 */
+YY_RULE(int) yy_Alphanumeric(yycontext *yy); /* 195 */
+YY_RULE(int) yy_StrChunk(yycontext *yy); /* 194 */
+YY_RULE(int) yy_NormalChar(yycontext *yy); /* 193 */
+YY_RULE(int) yy_Symbol(yycontext *yy); /* 192 */
+YY_RULE(int) yy_Smart(yycontext *yy); /* 191 */
+YY_RULE(int) yy_EscapedChar(yycontext *yy); /* 190 */
+YY_RULE(int) yy_Entity(yycontext *yy); /* 189 */
+YY_RULE(int) yy_RawHtml(yycontext *yy); /* 188 */
+YY_RULE(int) yy_Code(yycontext *yy); /* 187 */
+YY_RULE(int) yy_NoteReference(yycontext *yy); /* 186 */
+YY_RULE(int) yy_Link(yycontext *yy); /* 185 */
+YY_RULE(int) yy_Image(yycontext *yy); /* 184 */
+YY_RULE(int) yy_CitationReference(yycontext *yy); /* 183 */
+YY_RULE(int) yy_Emph(yycontext *yy); /* 182 */
+YY_RULE(int) yy_Strong(yycontext *yy); /* 181 */
+YY_RULE(int) yy_Space(yycontext *yy); /* 180 */
+YY_RULE(int) yy_UlOrStarLine(yycontext *yy); /* 179 */
+YY_RULE(int) yy_MathSpan(yycontext *yy); /* 178 */
+YY_RULE(int) yy_Str(yycontext *yy); /* 177 */
+YY_RULE(int) yy_InStyleTags(yycontext *yy); /* 176 */
+YY_RULE(int) yy_StyleClose(yycontext *yy); /* 175 */
+YY_RULE(int) yy_StyleOpen(yycontext *yy); /* 174 */
+YY_RULE(int) yy_HtmlBlockType(yycontext *yy); /* 173 */
+YY_RULE(int) yy_HtmlBlockSelfClosing(yycontext *yy); /* 172 */
+YY_RULE(int) yy_HtmlComment(yycontext *yy); /* 171 */
+YY_RULE(int) yy_MarkdownHtmlTagOpen(yycontext *yy); /* 170 */
+YY_RULE(int) yy_HtmlBlockScript(yycontext *yy); /* 169 */
+YY_RULE(int) yy_HtmlBlockCloseScript(yycontext *yy); /* 168 */
+YY_RULE(int) yy_HtmlBlockOpenScript(yycontext *yy); /* 167 */
+YY_RULE(int) yy_HtmlBlockTr(yycontext *yy); /* 166 */
+YY_RULE(int) yy_HtmlBlockCloseTr(yycontext *yy); /* 165 */
+YY_RULE(int) yy_HtmlBlockOpenTr(yycontext *yy); /* 164 */
+YY_RULE(int) yy_HtmlBlockThead(yycontext *yy); /* 163 */
+YY_RULE(int) yy_HtmlBlockCloseThead(yycontext *yy); /* 162 */
+YY_RULE(int) yy_HtmlBlockOpenThead(yycontext *yy); /* 161 */
+YY_RULE(int) yy_HtmlBlockTh(yycontext *yy); /* 160 */
+YY_RULE(int) yy_HtmlBlockCloseTh(yycontext *yy); /* 159 */
+YY_RULE(int) yy_HtmlBlockOpenTh(yycontext *yy); /* 158 */
+YY_RULE(int) yy_HtmlBlockTfoot(yycontext *yy); /* 157 */
+YY_RULE(int) yy_HtmlBlockCloseTfoot(yycontext *yy); /* 156 */
+YY_RULE(int) yy_HtmlBlockOpenTfoot(yycontext *yy); /* 155 */
+YY_RULE(int) yy_HtmlBlockTd(yycontext *yy); /* 154 */
+YY_RULE(int) yy_HtmlBlockCloseTd(yycontext *yy); /* 153 */
+YY_RULE(int) yy_HtmlBlockOpenTd(yycontext *yy); /* 152 */
+YY_RULE(int) yy_HtmlBlockTbody(yycontext *yy); /* 151 */
+YY_RULE(int) yy_HtmlBlockCloseTbody(yycontext *yy); /* 150 */
+YY_RULE(int) yy_HtmlBlockOpenTbody(yycontext *yy); /* 149 */
+YY_RULE(int) yy_HtmlBlockLi(yycontext *yy); /* 148 */
+YY_RULE(int) yy_HtmlBlockCloseLi(yycontext *yy); /* 147 */
+YY_RULE(int) yy_HtmlBlockOpenLi(yycontext *yy); /* 146 */
+YY_RULE(int) yy_HtmlBlockFrameset(yycontext *yy); /* 145 */
+YY_RULE(int) yy_HtmlBlockCloseFrameset(yycontext *yy); /* 144 */
+YY_RULE(int) yy_HtmlBlockOpenFrameset(yycontext *yy); /* 143 */
+YY_RULE(int) yy_HtmlBlockDt(yycontext *yy); /* 142 */
+YY_RULE(int) yy_HtmlBlockCloseDt(yycontext *yy); /* 141 */
+YY_RULE(int) yy_HtmlBlockOpenDt(yycontext *yy); /* 140 */
+YY_RULE(int) yy_HtmlBlockDd(yycontext *yy); /* 139 */
+YY_RULE(int) yy_HtmlBlockCloseDd(yycontext *yy); /* 138 */
+YY_RULE(int) yy_HtmlBlockOpenDd(yycontext *yy); /* 137 */
+YY_RULE(int) yy_HtmlBlockUl(yycontext *yy); /* 136 */
+YY_RULE(int) yy_HtmlBlockCloseUl(yycontext *yy); /* 135 */
+YY_RULE(int) yy_HtmlBlockOpenUl(yycontext *yy); /* 134 */
+YY_RULE(int) yy_HtmlBlockTable(yycontext *yy); /* 133 */
+YY_RULE(int) yy_HtmlBlockCloseTable(yycontext *yy); /* 132 */
+YY_RULE(int) yy_HtmlBlockOpenTable(yycontext *yy); /* 131 */
+YY_RULE(int) yy_HtmlBlockPre(yycontext *yy); /* 130 */
+YY_RULE(int) yy_HtmlBlockClosePre(yycontext *yy); /* 129 */
+YY_RULE(int) yy_HtmlBlockOpenPre(yycontext *yy); /* 128 */
+YY_RULE(int) yy_HtmlBlockP(yycontext *yy); /* 127 */
+YY_RULE(int) yy_HtmlBlockCloseP(yycontext *yy); /* 126 */
+YY_RULE(int) yy_HtmlBlockOpenP(yycontext *yy); /* 125 */
+YY_RULE(int) yy_HtmlBlockOl(yycontext *yy); /* 124 */
+YY_RULE(int) yy_HtmlBlockCloseOl(yycontext *yy); /* 123 */
+YY_RULE(int) yy_HtmlBlockOpenOl(yycontext *yy); /* 122 */
+YY_RULE(int) yy_HtmlBlockNoscript(yycontext *yy); /* 121 */
+YY_RULE(int) yy_HtmlBlockCloseNoscript(yycontext *yy); /* 120 */
+YY_RULE(int) yy_HtmlBlockOpenNoscript(yycontext *yy); /* 119 */
+YY_RULE(int) yy_HtmlBlockNoframes(yycontext *yy); /* 118 */
+YY_RULE(int) yy_HtmlBlockCloseNoframes(yycontext *yy); /* 117 */
+YY_RULE(int) yy_HtmlBlockOpenNoframes(yycontext *yy); /* 116 */
+YY_RULE(int) yy_HtmlBlockMenu(yycontext *yy); /* 115 */
+YY_RULE(int) yy_HtmlBlockCloseMenu(yycontext *yy); /* 114 */
+YY_RULE(int) yy_HtmlBlockOpenMenu(yycontext *yy); /* 113 */
+YY_RULE(int) yy_HtmlBlockH6(yycontext *yy); /* 112 */
+YY_RULE(int) yy_HtmlBlockCloseH6(yycontext *yy); /* 111 */
+YY_RULE(int) yy_HtmlBlockOpenH6(yycontext *yy); /* 110 */
+YY_RULE(int) yy_HtmlBlockH5(yycontext *yy); /* 109 */
+YY_RULE(int) yy_HtmlBlockCloseH5(yycontext *yy); /* 108 */
+YY_RULE(int) yy_HtmlBlockOpenH5(yycontext *yy); /* 107 */
+YY_RULE(int) yy_HtmlBlockH4(yycontext *yy); /* 106 */
+YY_RULE(int) yy_HtmlBlockCloseH4(yycontext *yy); /* 105 */
+YY_RULE(int) yy_HtmlBlockOpenH4(yycontext *yy); /* 104 */
+YY_RULE(int) yy_HtmlBlockH3(yycontext *yy); /* 103 */
+YY_RULE(int) yy_HtmlBlockCloseH3(yycontext *yy); /* 102 */
+YY_RULE(int) yy_HtmlBlockOpenH3(yycontext *yy); /* 101 */
+YY_RULE(int) yy_HtmlBlockH2(yycontext *yy); /* 100 */
+YY_RULE(int) yy_HtmlBlockCloseH2(yycontext *yy); /* 99 */
+YY_RULE(int) yy_HtmlBlockOpenH2(yycontext *yy); /* 98 */
+YY_RULE(int) yy_HtmlBlockH1(yycontext *yy); /* 97 */
+YY_RULE(int) yy_HtmlBlockCloseH1(yycontext *yy); /* 96 */
+YY_RULE(int) yy_HtmlBlockOpenH1(yycontext *yy); /* 95 */
+YY_RULE(int) yy_HtmlBlockForm(yycontext *yy); /* 94 */
+YY_RULE(int) yy_HtmlBlockCloseForm(yycontext *yy); /* 93 */
+YY_RULE(int) yy_HtmlBlockOpenForm(yycontext *yy); /* 92 */
+YY_RULE(int) yy_HtmlBlockFieldset(yycontext *yy); /* 91 */
+YY_RULE(int) yy_HtmlBlockCloseFieldset(yycontext *yy); /* 90 */
+YY_RULE(int) yy_HtmlBlockOpenFieldset(yycontext *yy); /* 89 */
+YY_RULE(int) yy_HtmlBlockDl(yycontext *yy); /* 88 */
+YY_RULE(int) yy_HtmlBlockCloseDl(yycontext *yy); /* 87 */
+YY_RULE(int) yy_HtmlBlockOpenDl(yycontext *yy); /* 86 */
+YY_RULE(int) yy_HtmlBlockDiv(yycontext *yy); /* 85 */
+YY_RULE(int) yy_HtmlBlockCloseDiv(yycontext *yy); /* 84 */
+YY_RULE(int) yy_HtmlBlockDir(yycontext *yy); /* 83 */
+YY_RULE(int) yy_HtmlBlockCloseDir(yycontext *yy); /* 82 */
+YY_RULE(int) yy_HtmlBlockOpenDir(yycontext *yy); /* 81 */
+YY_RULE(int) yy_HtmlBlockCenter(yycontext *yy); /* 80 */
+YY_RULE(int) yy_HtmlBlockCloseCenter(yycontext *yy); /* 79 */
+YY_RULE(int) yy_HtmlBlockOpenCenter(yycontext *yy); /* 78 */
+YY_RULE(int) yy_HtmlBlockBlockquote(yycontext *yy); /* 77 */
+YY_RULE(int) yy_HtmlBlockCloseBlockquote(yycontext *yy); /* 76 */
+YY_RULE(int) yy_HtmlBlockOpenBlockquote(yycontext *yy); /* 75 */
+YY_RULE(int) yy_HtmlBlockAddress(yycontext *yy); /* 74 */
+YY_RULE(int) yy_HtmlBlockCloseAddress(yycontext *yy); /* 73 */
+YY_RULE(int) yy_HtmlAttribute(yycontext *yy); /* 72 */
+YY_RULE(int) yy_Spnl(yycontext *yy); /* 71 */
+YY_RULE(int) yy_HtmlBlockOpenAddress(yycontext *yy); /* 70 */
+YY_RULE(int) yy_OptionallyIndentedLine(yycontext *yy); /* 69 */
+YY_RULE(int) yy_Indent(yycontext *yy); /* 68 */
+YY_RULE(int) yy_ListBlockLine(yycontext *yy); /* 67 */
+YY_RULE(int) yy_ListContinuationBlock(yycontext *yy); /* 66 */
+YY_RULE(int) yy_ListBlock(yycontext *yy); /* 65 */
+YY_RULE(int) yy_Enumerator(yycontext *yy); /* 64 */
+YY_RULE(int) yy_ListItemTight(yycontext *yy); /* 63 */
+YY_RULE(int) yy_ListLoose(yycontext *yy); /* 62 */
+YY_RULE(int) yy_ListTight(yycontext *yy); /* 61 */
+YY_RULE(int) yy_Spacechar(yycontext *yy); /* 60 */
+YY_RULE(int) yy_Bullet(yycontext *yy); /* 59 */
+YY_RULE(int) yy_VerbatimChunk(yycontext *yy); /* 58 */
+YY_RULE(int) yy_IndentedLine(yycontext *yy); /* 57 */
+YY_RULE(int) yy_NonblankIndentedLine(yycontext *yy); /* 56 */
+YY_RULE(int) yy_Line(yycontext *yy); /* 55 */
+YY_RULE(int) yy_BlockQuoteRaw(yycontext *yy); /* 54 */
+YY_RULE(int) yy_Endline(yycontext *yy); /* 53 */
+YY_RULE(int) yy_SetextBottom2(yycontext *yy); /* 52 */
+YY_RULE(int) yy_SetextBottom1(yycontext *yy); /* 51 */
+YY_RULE(int) yy_SetextHeading2(yycontext *yy); /* 50 */
+YY_RULE(int) yy_SetextHeading1(yycontext *yy); /* 49 */
+YY_RULE(int) yy_SetextHeading(yycontext *yy); /* 48 */
+YY_RULE(int) yy_AtxHeading(yycontext *yy); /* 47 */
+YY_RULE(int) yy_AtxStart(yycontext *yy); /* 46 */
+YY_RULE(int) yy_AutoLabel(yycontext *yy); /* 45 */
+YY_RULE(int) yy_AtxInline(yycontext *yy); /* 44 */
+YY_RULE(int) yy_Inlines(yycontext *yy); /* 43 */
+YY_RULE(int) yy_NonindentSpace(yycontext *yy); /* 42 */
+YY_RULE(int) yy_HeadingSectionBlock(yycontext *yy); /* 41 */
+YY_RULE(int) yy_Plain(yycontext *yy); /* 40 */
+YY_RULE(int) yy_Para(yycontext *yy); /* 39 */
+YY_RULE(int) yy_HtmlBlockOpenDiv(yycontext *yy); /* 38 */
+YY_RULE(int) yy_ImageBlock(yycontext *yy); /* 37 */
+YY_RULE(int) yy_Table(yycontext *yy); /* 36 */
+YY_RULE(int) yy_StyleBlock(yycontext *yy); /* 35 */
+YY_RULE(int) yy_HtmlBlock(yycontext *yy); /* 34 */
+YY_RULE(int) yy_BulletList(yycontext *yy); /* 33 */
+YY_RULE(int) yy_OrderedList(yycontext *yy); /* 32 */
+YY_RULE(int) yy_HeadingSection(yycontext *yy); /* 31 */
+YY_RULE(int) yy_HorizontalRule(yycontext *yy); /* 30 */
+YY_RULE(int) yy_Reference(yycontext *yy); /* 29 */
+YY_RULE(int) yy_Note(yycontext *yy); /* 28 */
+YY_RULE(int) yy_Glossary(yycontext *yy); /* 27 */
+YY_RULE(int) yy_DefinitionList(yycontext *yy); /* 26 */
+YY_RULE(int) yy_Verbatim(yycontext *yy); /* 25 */
+YY_RULE(int) yy_BlockQuote(yycontext *yy); /* 24 */
+YY_RULE(int) yy_RawLine(yycontext *yy); /* 23 */
+YY_RULE(int) yy_BlankLine(yycontext *yy); /* 22 */
+YY_RULE(int) yy_SingleLineMetaKeyValue(yycontext *yy); /* 21 */
+YY_RULE(int) yy_AlphanumericAscii(yycontext *yy); /* 20 */
+YY_RULE(int) yy_MetaDataValue(yycontext *yy); /* 19 */
+YY_RULE(int) yy_SkipBlock(yycontext *yy); /* 18 */
+YY_RULE(int) yy_MetaDataOnly(yycontext *yy); /* 17 */
+YY_RULE(int) yy_MetaDataKeyValue(yycontext *yy); /* 16 */
+YY_RULE(int) yy_DocSection(yycontext *yy); /* 15 */
+YY_RULE(int) yy_MetaData(yycontext *yy); /* 14 */
+YY_RULE(int) yy_Newline(yycontext *yy); /* 13 */
+YY_RULE(int) yy_Sp(yycontext *yy); /* 12 */
+YY_RULE(int) yy_MetaDataKey(yycontext *yy); /* 11 */
+YY_RULE(int) yy_DocWithMetaData(yycontext *yy); /* 10 */
+YY_RULE(int) yy_Block(yycontext *yy); /* 9 */
+YY_RULE(int) yy_StartList(yycontext *yy); /* 8 */
+YY_RULE(int) yy_BOM(yycontext *yy); /* 7 */
+YY_RULE(int) yy_Doc(yycontext *yy); /* 6 */
+YY_RULE(int) yy_HtmlBlockInTags(yycontext *yy); /* 5 */
+YY_RULE(int) yy_ListItem(yycontext *yy); /* 4 */
+YY_RULE(int) yy_Heading(yycontext *yy); /* 3 */
+YY_RULE(int) yy_Label(yycontext *yy); /* 2 */
+YY_RULE(int) yy_Inline(yycontext *yy); /* 1 */
+
+YY_ACTION(void) yy_6_MarkdownHtmlTagOpen(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_6_MarkdownHtmlTagOpen\n"));
+  
+                __ = mk_str_from_list(yy->parser, a,false);
+                __->key = HTML;
+            ;
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_5_MarkdownHtmlTagOpen(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_5_MarkdownHtmlTagOpen\n"));
+   a = cons(mk_slice(yy->parser, ">", 1),a);;
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_4_MarkdownHtmlTagOpen(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_4_MarkdownHtmlTagOpen\n"));
+  a = cons(mk_slice(yy->parser, " ", 1),a);
+                a = cons(mk_match(),a);;
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_3_MarkdownHtmlTagOpen(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_3_MarkdownHtmlTagOpen\n"));
+  a = cons(mk_slice(yy->parser, " ", 1),a);
+                a = cons(mk_match(),a);;
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_2_MarkdownHtmlTagOpen(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_2_MarkdownHtmlTagOpen\n"));
+  a = cons(mk_match(),a);;
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_MarkdownHtmlTagOpen(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_1_MarkdownHtmlTagOpen\n"));
+  a = cons(mk_slice(yy->parser, "<", 1),a);;
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_2_OPMLPlain(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_2_OPMLPlain\n"));
+   __ = mk_list(yy->parser, PLAIN, a); ;
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_OPMLPlain(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_1_OPMLPlain\n"));
+   a = cons(mk_str(yy->parser, yytext), a); ;
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_OPMLHeading(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define s yy->__val[-1]
+  yyprintf((stderr, "do yy_1_OPMLHeading\n"));
+  
+        __ = mk_str(yy->parser, yytext);
+        __->key = s->key;
+    ;
+#undef s
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_3_OPMLHeadingSection(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_3_OPMLHeadingSection\n"));
+   __ = mk_list(yy->parser, HEADINGSECTION, a);;
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_2_OPMLHeadingSection(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_2_OPMLHeadingSection\n"));
+  a = cons(__, a); ;
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_OPMLHeadingSection(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_1_OPMLHeadingSection\n"));
+   a = cons(__, a); ;
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_3_DocForOPML(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define b yy->__val[-1]
+#define a yy->__val[-2]
+  yyprintf((stderr, "do yy_3_DocForOPML\n"));
+   yy->parser->parse_result = reverse(a); ;
+#undef b
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_2_DocForOPML(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define b yy->__val[-1]
+#define a yy->__val[-2]
+  yyprintf((stderr, "do yy_2_DocForOPML\n"));
+   a = cons(__, a); ;
+#undef b
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_DocForOPML(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define b yy->__val[-1]
+#define a yy->__val[-2]
+  yyprintf((stderr, "do yy_1_DocForOPML\n"));
+   a = cons(__, a); ;
+#undef b
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_MathSpan(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+  yyprintf((stderr, "do yy_1_MathSpan\n"));
+  
+    /* Basically, these delimiters indicate math in LaTeX syntax, and the
+       delimiters are compatible with MathJax and LaTeX
+       ASCIIMathML is *not* supported */
+    __ = mk_str(yy->parser, yytext);
+    __->key = MATHSPAN;
+;
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_AutoLabel(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+  yyprintf((stderr, "do yy_1_AutoLabel\n"));
+   
+    char *label = label_from_string(yytext,0);
+    __ = mk_str(yy->parser, label);
+    __->key = AUTOLABEL;
+    free(label);
+;
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_2_TableCaption(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define c yy->__val[-1]
+#define a yy->__val[-2]
+#define b yy->__val[-3]
+  yyprintf((stderr, "do yy_2_TableCaption\n"));
+  
+    __ = a;
+    __->key = TABLECAPTION;
+    if ( (b != NULL) && (b->key == TABLELABEL) ) {
+        b->next = __->children;
+        __->children = b;
+    }
+    set_anchor_id(yy->parser, __);
+;
+#undef c
+#undef a
+#undef b
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_TableCaption(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define c yy->__val[-1]
+#define a yy->__val[-2]
+#define b yy->__val[-3]
+  yyprintf((stderr, "do yy_1_TableCaption\n"));
+   b = c; b->key = TABLELABEL;;
+#undef c
+#undef a
+#undef b
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_RightAlign(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+  yyprintf((stderr, "do yy_1_RightAlign\n"));
+   __ = mk_str(yy->parser, "r");;
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_RightAlignWrap(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+  yyprintf((stderr, "do yy_1_RightAlignWrap\n"));
+   __ = mk_str(yy->parser, "R");;
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_CenterAlign(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+  yyprintf((stderr, "do yy_1_CenterAlign\n"));
+   __ = mk_str(yy->parser, "c");;
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_CenterAlignWrap(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+  yyprintf((stderr, "do yy_1_CenterAlignWrap\n"));
+   __ = mk_str(yy->parser, "C");;
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_LeftAlign(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+  yyprintf((stderr, "do yy_1_LeftAlign\n"));
+   __ = mk_str(yy->parser, "l");;
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_LeftAlignWrap(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+  yyprintf((stderr, "do yy_1_LeftAlignWrap\n"));
+   __ = mk_str(yy->parser, "L");;
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_2_SeparatorLine(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_2_SeparatorLine\n"));
+  
+        __ = mk_str_from_list(yy->parser, a,false);
+        __->key = TABLESEPARATOR;
+    ;
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_SeparatorLine(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_1_SeparatorLine\n"));
+   a = cons(__, a);;
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_EmptyCell(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+  yyprintf((stderr, "do yy_1_EmptyCell\n"));
+   __ = mk_element(yy->parser, TABLECELL);;
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_2_FullCell(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_2_FullCell\n"));
+   __ = mk_list(yy->parser, TABLECELL,a); ;
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_FullCell(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_1_FullCell\n"));
+   a = cons(__,a);
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_CellStr(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+  yyprintf((stderr, "do yy_1_CellStr\n"));
+   __ = mk_str(yy->parser, yytext); ;
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_ExtendedCell(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+  yyprintf((stderr, "do yy_1_ExtendedCell\n"));
+  
+        element *span;
+        span = mk_str(yy->parser, yytext);
+        span->key = CELLSPAN;
+        span->next = __->children;
+        __->children = span;
+    ;
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_2_TableRow(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_2_TableRow\n"));
+   __ = mk_list(yy->parser, TABLEROW, a); ;
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_TableRow(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_1_TableRow\n"));
+   a = cons(__, a); ;
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_2_TableBody(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_2_TableBody\n"));
+   __ = mk_list(yy->parser, TABLEBODY, a);;
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_TableBody(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_1_TableBody\n"));
+  a = cons(__, a);;
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_7_Table(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define b yy->__val[-1]
+#define a yy->__val[-2]
+  yyprintf((stderr, "do yy_7_Table\n"));
+  
+        if (b != NULL) { append_list(b,a); };
+        __ = mk_list(yy->parser, TABLE, a);
+    ;
+#undef b
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_6_Table(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define b yy->__val[-1]
+#define a yy->__val[-2]
+  yyprintf((stderr, "do yy_6_Table\n"));
+   b = cons(__, b);;
+#undef b
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_5_Table(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define b yy->__val[-1]
+#define a yy->__val[-2]
+  yyprintf((stderr, "do yy_5_Table\n"));
+   a = cons(__, a); ;
+#undef b
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_4_Table(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define b yy->__val[-1]
+#define a yy->__val[-2]
+  yyprintf((stderr, "do yy_4_Table\n"));
+   a = cons(__, a);;
+#undef b
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_3_Table(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define b yy->__val[-1]
+#define a yy->__val[-2]
+  yyprintf((stderr, "do yy_3_Table\n"));
+   append_list(__,a); ;
+#undef b
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_2_Table(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define b yy->__val[-1]
+#define a yy->__val[-2]
+  yyprintf((stderr, "do yy_2_Table\n"));
+   __->key = TABLEHEAD; a = cons(__, a); ;
+#undef b
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_Table(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define b yy->__val[-1]
+#define a yy->__val[-2]
+  yyprintf((stderr, "do yy_1_Table\n"));
+   b = cons(__, b);;
+#undef b
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_7_Definition(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define b yy->__val[-1]
+#define a yy->__val[-2]
+  yyprintf((stderr, "do yy_7_Definition\n"));
+   if (b != NULL) { a = cons(b,a);}
+                element *raw = mk_str_from_list(yy->parser, a, false);
+                raw->key = RAW;
+                __ = mk_list(yy->parser, DEFINITION,raw);
+            ;
+#undef b
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_6_Definition(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define b yy->__val[-1]
+#define a yy->__val[-2]
+  yyprintf((stderr, "do yy_6_Definition\n"));
+   a = cons(mk_slice(yy->parser, "\n", 1),a);;
+#undef b
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_5_Definition(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define b yy->__val[-1]
+#define a yy->__val[-2]
+  yyprintf((stderr, "do yy_5_Definition\n"));
+   a = cons(mk_match(),a);;
+#undef b
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_4_Definition(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define b yy->__val[-1]
+#define a yy->__val[-2]
+  yyprintf((stderr, "do yy_4_Definition\n"));
+  a = cons(mk_slice(yy->parser, "\n", 1),a);;
+#undef b
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_3_Definition(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define b yy->__val[-1]
+#define a yy->__val[-2]
+  yyprintf((stderr, "do yy_3_Definition\n"));
+   a = cons(mk_match(), a);;
+#undef b
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_2_Definition(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define b yy->__val[-1]
+#define a yy->__val[-2]
+  yyprintf((stderr, "do yy_2_Definition\n"));
+   a = cons(mk_match(), a);;
+#undef b
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_Definition(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define b yy->__val[-1]
+#define a yy->__val[-2]
+  yyprintf((stderr, "do yy_1_Definition\n"));
+   b = cons(mk_slice(yy->parser, "\n", 1),b); ;
+#undef b
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_2_Term(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_2_Term\n"));
+  
+            __ = mk_list(yy->parser, TERM,a);
+        ;
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_Term(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_1_Term\n"));
+  a = cons(__, a);;
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_3_DefinitionList(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_3_DefinitionList\n"));
+   __ = mk_list(yy->parser, LIST, a);
+                    __->key = DEFLIST;
+                ;
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_2_DefinitionList(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_2_DefinitionList\n"));
+   a = cons(__, a);;
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_DefinitionList(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_1_DefinitionList\n"));
+   a = cons(__, a); ;
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_2_LabelFromSource(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define c yy->__val[-1]
+#define b yy->__val[-2]
+  yyprintf((stderr, "do yy_2_LabelFromSource\n"));
+   yy->parser->parse_result = mk_str(yy->parser, c->contents.str); ;
+#undef c
+#undef b
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_LabelFromSource(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define c yy->__val[-1]
+#define b yy->__val[-2]
+  yyprintf((stderr, "do yy_1_LabelFromSource\n"));
+   yy->parser->parse_result = mk_str(yy->parser, b->contents.str); ;
+#undef c
+#undef b
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_3_LabelSource(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define b yy->__val[-1]
+  yyprintf((stderr, "do yy_3_LabelSource\n"));
+   __ = mk_str(yy->parser, yytext); __->key = RAW; ;
+#undef b
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_2_LabelSource(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define b yy->__val[-1]
+  yyprintf((stderr, "do yy_2_LabelSource\n"));
+   __ = mk_str(yy->parser, yytext); __->key = RAW; ;
+#undef b
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_LabelSource(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define b yy->__val[-1]
+  yyprintf((stderr, "do yy_1_LabelSource\n"));
+   __ = mk_str(yy->parser, b->contents.str); ;
+#undef b
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_4_Collect(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define d yy->__val[-1]
+#define c yy->__val[-2]
+#define b yy->__val[-3]
+#define a yy->__val[-4]
+  yyprintf((stderr, "do yy_4_Collect\n"));
+     yy->parser->references = reverse(a);
+                yy->parser->notes = reverse(b);
+                yy->parser->labels = reverse(c);
+            ;
+#undef d
+#undef c
+#undef b
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_3_Collect(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define d yy->__val[-1]
+#define c yy->__val[-2]
+#define b yy->__val[-3]
+#define a yy->__val[-4]
+  yyprintf((stderr, "do yy_3_Collect\n"));
+   c = cons(d, c); ;
+#undef d
+#undef c
+#undef b
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_2_Collect(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define d yy->__val[-1]
+#define c yy->__val[-2]
+#define b yy->__val[-3]
+#define a yy->__val[-4]
+  yyprintf((stderr, "do yy_2_Collect\n"));
+   b = cons(d, b); ;
+#undef d
+#undef c
+#undef b
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_Collect(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define d yy->__val[-1]
+#define c yy->__val[-2]
+#define b yy->__val[-3]
+#define a yy->__val[-4]
+  yyprintf((stderr, "do yy_1_Collect\n"));
+   a = cons(d, a); ;
+#undef d
+#undef c
+#undef b
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_RawCitationReference(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+  yyprintf((stderr, "do yy_1_RawCitationReference\n"));
+   __ = mk_str(yy->parser, yytext); ;
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_CitationReferenceSingle(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define ref yy->__val[-1]
+  yyprintf((stderr, "do yy_1_CitationReferenceSingle\n"));
+     element *match;
+                    if (find_note(yy->parser, &match, ref->contents.str)) {
+                        __ = mk_element(yy->parser, CITATION);
+                        assert(match->children != NULL);
+                        __->children = match->children;
+                        __->contents.str = parser_strdup(yy->parser, ref->contents.str);
+                    } else {
+                        char *s;
+                        s = malloc(strlen(ref->contents.str) + 4);
+                        sprintf(s, "[#%s]", ref->contents.str);
+                        __ = mk_str(yy->parser, s);
+                        __->key = CITATION;
+                        free(s);
+                    }
+                ;
+#undef ref
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_CitationReferenceDouble(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define ref yy->__val[-1]
+#define b yy->__val[-2]
+  yyprintf((stderr, "do yy_1_CitationReferenceDouble\n"));
+     element *match;
+                    if (find_note(yy->parser, &match, ref->contents.str)) {
+                        /* This citation is specified within the document */
+                        __ = mk_element(yy->parser, CITATION);
+                        assert(match->children != NULL);
+                        b->next = match->children;
+                        b->key = LOCATOR;
+                        __->children = b;
+                        __->contents.str = parser_strdup(yy->parser, ref->contents.str);
+                    } else {
+                        /* Citation not specified - likely bibtex citation */
+                        /* TODO: fix this - need to print label as well */
+                        char *s;
+                        s = malloc(strlen(ref->contents.str) + 4);
+                        sprintf(s, "[#%s]", ref->contents.str);
+                        __ = mk_str(yy->parser, s);
+                        __->key = CITATION;
+                        b->key = LOCATOR;
+                        __->children = b;
+                        free(s);
+                    }
+                    GString *label = g_string_new("");
+                    char *lab;
+                    print_raw_element_list(label, b->children);
+                    lab = label_from_string(label->str,0);
+                    if (strcmp(lab,"notcited") == 0 ) {
+                        __->key = NOCITATION;
+                    }
+                    g_string_free(label, true);
+                    free(lab);
+                ;
+#undef ref
+#undef b
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_3_RawNoteBlock(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_3_RawNoteBlock\n"));
+     __ = mk_str_from_list(yy->parser, a, true);
+                    __->key = RAW;
+                ;
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_2_RawNoteBlock(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_2_RawNoteBlock\n"));
+   a = cons(mk_match(), a); ;
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_RawNoteBlock(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_1_RawNoteBlock\n"));
+   a = cons(__, a); ;
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_2_InlineNote(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_2_InlineNote\n"));
+   __ = mk_list(yy->parser, NOTE, a);
+                  __->contents.str = 0; ;
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_InlineNote(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_1_InlineNote\n"));
+   a = cons(__, a); ;
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_3_Note(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+#define ref yy->__val[-2]
+  yyprintf((stderr, "do yy_3_Note\n"));
+     element *label;
+                    label = mk_str(yy->parser, ref->contents.str);
+                    label->key = NOTELABEL;
+                    a = cons(label,a);
+                    __ = mk_list(yy->parser, NOTE, a);
+                    __->contents.str = parser_strdup(yy->parser, ref->contents.str);
+                ;
+#undef a
+#undef ref
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_2_Note(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+#define ref yy->__val[-2]
+  yyprintf((stderr, "do yy_2_Note\n"));
+   a = cons(__, a); ;
+#undef a
+#undef ref
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_Note(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+#define ref yy->__val[-2]
+  yyprintf((stderr, "do yy_1_Note\n"));
+   a = cons(__, a); ;
+#undef a
+#undef ref
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_GlossarySortKey(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+  yyprintf((stderr, "do yy_1_GlossarySortKey\n"));
+   __ = mk_str(yy->parser, yytext);
+        __->key = GLOSSARYSORTKEY; ;
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_GlossaryTerm(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+  yyprintf((stderr, "do yy_1_GlossaryTerm\n"));
+   
+        __ = mk_list(yy->parser, LIST, NULL);
+        __->contents.str = 0;
+        __->children = mk_str(yy->parser, yytext);
+        __->key = GLOSSARYTERM;
+    ;
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_5_Glossary(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define ref yy->__val[-1]
+#define a yy->__val[-2]
+  yyprintf((stderr, "do yy_5_Glossary\n"));
+   __ = mk_list(yy->parser, GLOSSARY, a);
+                __->contents.str = parser_strdup(yy->parser, ref->contents.str);
+            ;
+#undef ref
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_4_Glossary(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define ref yy->__val[-1]
+#define a yy->__val[-2]
+  yyprintf((stderr, "do yy_4_Glossary\n"));
+   a = cons(__, a); ;
+#undef ref
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_3_Glossary(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define ref yy->__val[-1]
+#define a yy->__val[-2]
+  yyprintf((stderr, "do yy_3_Glossary\n"));
+   a = cons(__, a); ;
+#undef ref
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_2_Glossary(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define ref yy->__val[-1]
+#define a yy->__val[-2]
+  yyprintf((stderr, "do yy_2_Glossary\n"));
+   a = cons(__, a); ;
+#undef ref
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_Glossary(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define ref yy->__val[-1]
+#define a yy->__val[-2]
+  yyprintf((stderr, "do yy_1_Glossary\n"));
+   a = cons(__, a); ;
+#undef ref
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_RawNoteReference(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+  yyprintf((stderr, "do yy_1_RawNoteReference\n"));
+   __ = mk_str(yy->parser, yytext); ;
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_NoteReference(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define ref yy->__val[-1]
+  yyprintf((stderr, "do yy_1_NoteReference\n"));
+     element *match;
+                    if (find_note(yy->parser, &match, ref->contents.str)) {
+                        __ = mk_element(yy->parser, NOTE);
+                        assert(match->children != NULL);
+                        __->children = match->children;
+                        __->contents.str = 0;
+                    } else {
+                        char *s;
+                        s = malloc(strlen(ref->contents.str) + 4);
+                        sprintf(s, "[^%s]", ref->contents.str);
+                        __ = mk_str(yy->parser, s);
+                        free(s);
+                    }
+                ;
+#undef ref
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_2_DoubleQuoted(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define b yy->__val[-1]
+#define a yy->__val[-2]
+  yyprintf((stderr, "do yy_2_DoubleQuoted\n"));
+   __ = mk_list(yy->parser, DOUBLEQUOTED, a); ;
+#undef b
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_DoubleQuoted(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define b yy->__val[-1]
+#define a yy->__val[-2]
+  yyprintf((stderr, "do yy_1_DoubleQuoted\n"));
+   a = cons(b, a); ;
+#undef b
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_2_SingleQuoted(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define b yy->__val[-1]
+#define a yy->__val[-2]
+  yyprintf((stderr, "do yy_2_SingleQuoted\n"));
+   __ = mk_list(yy->parser, SINGLEQUOTED, a); ;
+#undef b
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_SingleQuoted(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define b yy->__val[-1]
+#define a yy->__val[-2]
+  yyprintf((stderr, "do yy_1_SingleQuoted\n"));
+   a = cons(b, a); ;
+#undef b
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_EmDash(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+  yyprintf((stderr, "do yy_1_EmDash\n"));
+   __ = mk_element(yy->parser, EMDASH);
+            __->contents.str  = parser_strdup(yy->parser, yytext);
+         ;
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_EnDash(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+  yyprintf((stderr, "do yy_1_EnDash\n"));
+   __ = mk_element(yy->parser, ENDASH); 
+            __->contents.str  = parser_strdup(yy->parser, yytext);
+         ;
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_Ellipsis(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+  yyprintf((stderr, "do yy_1_Ellipsis\n"));
+   __ = mk_element(yy->parser, ELLIPSIS); ;
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_Apostrophe(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+  yyprintf((stderr, "do yy_1_Apostrophe\n"));
+   __ = mk_element(yy->parser, APOSTROPHE); ;
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_Line(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+  yyprintf((stderr, "do yy_1_Line\n"));
+   __ = mk_match(); ;
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_StartList(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+  yyprintf((stderr, "do yy_1_StartList\n"));
+   __ = NULL; ;
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_RawHtml(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+  yyprintf((stderr, "do yy_1_RawHtml\n"));
+     if (extension(yy->parser, EXT_FILTER_HTML)) {
+                    __ = mk_list(yy->parser, LIST, NULL);
+                } else {
+                    __ = mk_str(yy->parser, yytext);
+                    __->key = HTML;
+                }
+            ;
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_Code(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+  yyprintf((stderr, "do yy_1_Code\n"));
+   __ = mk_str(yy->parser, yytext); __->key = CODE; ;
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_RefTitle(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+  yyprintf((stderr, "do yy_1_RefTitle\n"));
+   __ = mk_str(yy->parser, yytext); 
+                __->key = RAW;;
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_RefSrc(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+  yyprintf((stderr, "do yy_1_RefSrc\n"));
+   __ = mk_str(yy->parser, yytext); 
+           __->key = HTML; ;
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_2_Label(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_2_Label\n"));
+   __ = mk_list(yy->parser, LIST, a); ;
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_Label(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_1_Label\n"));
+   a = cons(__, a); ;
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_AttrValue(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+  yyprintf((stderr, "do yy_1_AttrValue\n"));
+   __ = mk_str(yy->parser, yytext);
+            __->key = ATTRVALUE;
+        ;
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_AttrKey(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+  yyprintf((stderr, "do yy_1_AttrKey\n"));
+  
+            char *lab;
+            lab = label_from_string(yytext,0);
+            __ = mk_str(yy->parser, lab);
+            __->key = ATTRKEY;
+            free(lab);
+        ;
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_Attribute(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define b yy->__val[-1]
+#define a yy->__val[-2]
+  yyprintf((stderr, "do yy_1_Attribute\n"));
+   
+        __ = a;
+        __->children = b;
+    ;
+#undef b
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_2_Attributes(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_2_Attributes\n"));
+   __ = mk_list(yy->parser, LIST,a); ;
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_Attributes(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_1_Attributes\n"));
+   a =cons(__,a);;
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_2_Reference(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define t yy->__val[-1]
+#define s yy->__val[-2]
+#define l yy->__val[-3]
+#define a yy->__val[-4]
+  yyprintf((stderr, "do yy_2_Reference\n"));
+   
+            char *label;
+            GString *text = g_string_new("");
+            print_raw_element_list(text, l->children);
+            label = label_from_string(text->str,0);
+            if (a == NULL) {
+                __ = mk_link(yy->parser, l->children, s->contents.str,
+                    t->contents.str, a, label);
+            } else {
+                __ = mk_link(yy->parser, l->children, s->contents.str,
+                    t->contents.str, a->children, label);
+            }
+            free(label);
+            g_string_free(text, TRUE);
+            __->key = REFERENCE;
+        ;
+#undef t
+#undef s
+#undef l
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_Reference(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define t yy->__val[-1]
+#define s yy->__val[-2]
+#define l yy->__val[-3]
+#define a yy->__val[-4]
+  yyprintf((stderr, "do yy_1_Reference\n"));
+   a = cons(__,a);;
+#undef t
+#undef s
+#undef l
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_AutoLinkEmail(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+  yyprintf((stderr, "do yy_1_AutoLinkEmail\n"));
+     char *mailto = malloc(strlen(yytext) + 8);
+                    sprintf(mailto, "mailto:%s", yytext);
+                    __ = mk_link(yy->parser, mk_str(yy->parser, yytext), mailto, "", NULL, "");
+                    free(mailto);
+                ;
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_AutoLinkUrl(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+  yyprintf((stderr, "do yy_1_AutoLinkUrl\n"));
+     __ = mk_link(yy->parser, mk_str(yy->parser, yytext), yytext, "", NULL, ""); ;
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_Title(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+  yyprintf((stderr, "do yy_1_Title\n"));
+   __ = mk_str(yy->parser, yytext); ;
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_Source(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+  yyprintf((stderr, "do yy_1_Source\n"));
+   __ = mk_str(yy->parser, yytext); ;
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_ExplicitLink(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define t yy->__val[-1]
+#define s yy->__val[-2]
+#define l yy->__val[-3]
+  yyprintf((stderr, "do yy_1_ExplicitLink\n"));
+  
+                    __ = mk_link(yy->parser, l->children, s->contents.str, t->contents.str, NULL, "");
+                ;
+#undef t
+#undef s
+#undef l
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_ReferenceLinkSingle(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_1_ReferenceLinkSingle\n"));
+     link match;
+                           if (find_reference(yy->parser, &match, a->children)) {
+                               __ = mk_link(yy->parser, a->children, match.url, match.title, match.attr, match.identifier);
+                           } else if ( !extension(yy->parser, EXT_COMPATIBILITY) && 
+                            find_label(yy->parser, &match, a->children)) {
+                                GString *text = g_string_new("");
+                                print_raw_element_list(text, a->children);
+                                char *lab = label_from_string(text->str,0);
+                                GString *label = g_string_new(lab);
+                                g_string_prepend(label,"#");
+                                __ = mk_link(yy->parser, a->children, label->str, "", NULL, lab);
+                                g_string_free(text, TRUE);
+                                g_string_free(label, TRUE);
+                                free(lab);
+                           } else {
+                               element *result;
+                               result = mk_element(yy->parser, LIST);
+                               result->children = cons(mk_str(yy->parser, "["), cons(a, cons(mk_str(yy->parser, "]"), mk_str(yy->parser, yytext))));
+                               __ = result;
+                           }
+                       ;
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_ReferenceLinkDouble(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define b yy->__val[-1]
+#define a yy->__val[-2]
+  yyprintf((stderr, "do yy_1_ReferenceLinkDouble\n"));
+     link match;
+                           if (find_reference(yy->parser, &match, b->children)) {
+                               __ = mk_link(yy->parser, a->children, match.url, match.title, match.attr, match.identifier);
+                           } else if ( !extension(yy->parser, EXT_COMPATIBILITY) && 
+                            find_label(yy->parser, &match, b->children)) {
+                                GString *text = g_string_new("");
+                                print_raw_element_list(text, b->children);
+                                char *lab = label_from_string(text->str,0);
+                                GString *label = g_string_new(lab);
+                                g_string_prepend(label,"#");
+                                __ = mk_link(yy->parser, a->children, label->str, "", NULL, lab);
+                                free(lab);
+                                g_string_free(text, TRUE);
+                                g_string_free(label, TRUE);
+                            } else {
+                               element *result;
+                               result = mk_element(yy->parser, LIST);
+                               result->children = cons(mk_str(yy->parser, "["), cons(a, cons(mk_str(yy->parser, "]"), cons(mk_str(yy->parser, "["), cons(b, mk_str(yy->parser, "]"))))));
+                               __ = result;
+                           }
+                       ;
+#undef b
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_Image(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+  yyprintf((stderr, "do yy_1_Image\n"));
+   if (__->key == LINK) {
+              __->key = IMAGE;
+          } else {
+              element *result;
+              result = __;
+              __->children = cons(mk_str(yy->parser, "!"), result->children);
+          } ;
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_ImageBlock(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+  yyprintf((stderr, "do yy_1_ImageBlock\n"));
+   if (__->key == IMAGE) __->key = IMAGEBLOCK; ;
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_3_StrongUl(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_3_StrongUl\n"));
+   __ = mk_list(yy->parser, STRONG, a); ;
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_2_StrongUl(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_2_StrongUl\n"));
+   a = cons(__, a); ;
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_StrongUl(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_1_StrongUl\n"));
+   a = cons(__, a); ;
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_TwoUlClose(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_1_TwoUlClose\n"));
+   __ = a; ;
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_3_StrongStar(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_3_StrongStar\n"));
+   __ = mk_list(yy->parser, STRONG, a); ;
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_2_StrongStar(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_2_StrongStar\n"));
+   a = cons(__, a); ;
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_StrongStar(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_1_StrongStar\n"));
+   a = cons(__, a); ;
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_TwoStarClose(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_1_TwoStarClose\n"));
+   __ = a; ;
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_3_EmphUl(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_3_EmphUl\n"));
+   __ = mk_list(yy->parser, EMPH, a); ;
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_2_EmphUl(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_2_EmphUl\n"));
+   a = cons(__, a); ;
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_EmphUl(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_1_EmphUl\n"));
+   a = cons(__, a); ;
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_OneUlClose(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_1_OneUlClose\n"));
+   __ = a; ;
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_3_EmphStar(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_3_EmphStar\n"));
+   __ = mk_list(yy->parser, EMPH, a); ;
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_2_EmphStar(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_2_EmphStar\n"));
+   a = cons(__, a); ;
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_EmphStar(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_1_EmphStar\n"));
+   a = cons(__, a); ;
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_OneStarClose(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_1_OneStarClose\n"));
+   __ = a; ;
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_UlOrStarLine(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+  yyprintf((stderr, "do yy_1_UlOrStarLine\n"));
+   __ = mk_str(yy->parser, yytext); ;
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_Symbol(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+  yyprintf((stderr, "do yy_1_Symbol\n"));
+   __ = mk_str(yy->parser, yytext); ;
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_LineBreak(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+  yyprintf((stderr, "do yy_1_LineBreak\n"));
+   __ = mk_element(yy->parser, LINEBREAK); ;
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_TerminalEndline(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+  yyprintf((stderr, "do yy_1_TerminalEndline\n"));
+   __ = NULL; ;
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_NormalEndline(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+  yyprintf((stderr, "do yy_1_NormalEndline\n"));
+   __ = mk_str(yy->parser, "\n");
+                    __->key = SPACE; ;
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_Entity(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+  yyprintf((stderr, "do yy_1_Entity\n"));
+   __ = mk_str(yy->parser, yytext); __->key = HTML; ;
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_EscapedChar(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+  yyprintf((stderr, "do yy_1_EscapedChar\n"));
+   __ = mk_str(yy->parser, yytext); ;
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_AposChunk(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+  yyprintf((stderr, "do yy_1_AposChunk\n"));
+   __ = mk_element(yy->parser, APOSTROPHE); ;
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_StrChunk(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+  yyprintf((stderr, "do yy_1_StrChunk\n"));
+   __ = mk_str(yy->parser, yytext); ;
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_3_Str(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_3_Str\n"));
+   if (a->next == NULL) { __ = a; } else { __ = mk_list(yy->parser, LIST, a); } ;
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_2_Str(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_2_Str\n"));
+   a = cons(__, a); ;
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_Str(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_1_Str\n"));
+   a = cons(mk_str(yy->parser, yytext), a); ;
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_Space(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+  yyprintf((stderr, "do yy_1_Space\n"));
+   __ = mk_str(yy->parser, " ");
+          __->key = SPACE; ;
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_3_Inlines(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define c yy->__val[-1]
+#define a yy->__val[-2]
+  yyprintf((stderr, "do yy_3_Inlines\n"));
+   __ = mk_list(yy->parser, LIST, a); ;
+#undef c
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_2_Inlines(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define c yy->__val[-1]
+#define a yy->__val[-2]
+  yyprintf((stderr, "do yy_2_Inlines\n"));
+   a = cons(c, a); ;
+#undef c
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_Inlines(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define c yy->__val[-1]
+#define a yy->__val[-2]
+  yyprintf((stderr, "do yy_1_Inlines\n"));
+   a = cons(__, a); ;
+#undef c
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_StyleBlock(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+  yyprintf((stderr, "do yy_1_StyleBlock\n"));
+     if (extension(yy->parser, EXT_FILTER_STYLES)) {
+                        __ = mk_list(yy->parser, LIST, NULL);
+                    } else {
+                        __ = mk_str(yy->parser, yytext);
+                        __->key = HTMLBLOCK;
+                    }
+                ;
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_HtmlBlock(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+  yyprintf((stderr, "do yy_1_HtmlBlock\n"));
+     if (extension(yy->parser, EXT_FILTER_HTML)) {
+                    __ = mk_list(yy->parser, LIST, NULL);
+                } else {
+                    __ = mk_str(yy->parser, yytext);
+                    if ( extension(yy->parser, EXT_PROCESS_HTML)) __->key = RAW;
+                        else __->key = HTMLBLOCK;
+                }
+            ;
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_OrderedList(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+  yyprintf((stderr, "do yy_1_OrderedList\n"));
+   __->key = ORDEREDLIST; ;
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_3_ListContinuationBlock(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_3_ListContinuationBlock\n"));
+    __ = mk_str_from_list(yy->parser, a, false); ;
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_2_ListContinuationBlock(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_2_ListContinuationBlock\n"));
+   a = cons(__, a); ;
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_ListContinuationBlock(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_1_ListContinuationBlock\n"));
+     if (strlen(yytext) == 0)
+                                   a = cons(mk_slice(yy->parser, "\001", 1), a); /* block separator */
+                              else
+                                   a = cons(mk_match(), a); ;
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_3_ListBlock(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_3_ListBlock\n"));
+   __ = mk_str_from_list(yy->parser, a, false); ;
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_2_ListBlock(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_2_ListBlock\n"));
+   a = cons(__, a); ;
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_ListBlock(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_1_ListBlock\n"));
+   a = cons(__, a); ;
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_3_ListItemTight(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_3_ListItemTight\n"));
+    element *raw;
+               raw = mk_str_from_list(yy->parser, a, false);
+               raw->key = RAW;
+               __ = mk_element(yy->parser, LISTITEM);
+               __->children = raw;
+            ;
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_2_ListItemTight(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_2_ListItemTight\n"));
+   a = cons(__, a); ;
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_ListItemTight(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_1_ListItemTight\n"));
+   a = cons(__, a); ;
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_3_ListItem(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_3_ListItem\n"));
+    element *raw;
+               raw = mk_str_from_list(yy->parser, a, false);
+               raw->key = RAW;
+               __ = mk_element(yy->parser, LISTITEM);
+               __->children = raw;
+            ;
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_2_ListItem(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_2_ListItem\n"));
+   a = cons(__, a); ;
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_ListItem(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_1_ListItem\n"));
+   a = cons(__, a); ;
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_2_ListLoose(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define b yy->__val[-1]
+#define a yy->__val[-2]
+  yyprintf((stderr, "do yy_2_ListLoose\n"));
+   __ = mk_list(yy->parser, LIST, a); ;
+#undef b
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_ListLoose(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define b yy->__val[-1]
+#define a yy->__val[-2]
+  yyprintf((stderr, "do yy_1_ListLoose\n"));
+     element *li;
+                  char *str;
+                  li = b->children;
+                  str = arena_alloc(&yy->parser->elements, strlen(li->contents.str) + 3);
+                  strcpy(str, li->contents.str);
+                  strcat(str, "\n\n");  /* In loose list, \n\n added to end of each element */
+                  li->contents.str = str;
+                  a = cons(b, a);
+              ;
+#undef b
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_2_ListTight(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_2_ListTight\n"));
+   __ = mk_list(yy->parser, LIST, a); ;
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_ListTight(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_1_ListTight\n"));
+   a = cons(__, a); ;
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_BulletList(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+  yyprintf((stderr, "do yy_1_BulletList\n"));
+   __->key = BULLETLIST; ;
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_HorizontalRule(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+  yyprintf((stderr, "do yy_1_HorizontalRule\n"));
+   __ = mk_element(yy->parser, HRULE); ;
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_2_Verbatim(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_2_Verbatim\n"));
+   __ = mk_str_from_list(yy->parser, a, false);
+                 __->key = VERBATIM; ;
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_Verbatim(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_1_Verbatim\n"));
+   a = cons(__, a); ;
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_3_VerbatimChunk(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_3_VerbatimChunk\n"));
+   __ = mk_str_from_list(yy->parser, a, false); ;
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_2_VerbatimChunk(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_2_VerbatimChunk\n"));
+   a = cons(__, a); ;
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_VerbatimChunk(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_1_VerbatimChunk\n"));
+   a = cons(mk_slice(yy->parser, "\n", 1), a); ;
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_4_BlockQuoteRaw(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_4_BlockQuoteRaw\n"));
+     __ = mk_str_from_list(yy->parser, a, true);
+                     __->key = RAW;
+                 ;
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_3_BlockQuoteRaw(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_3_BlockQuoteRaw\n"));
+   a = cons(mk_slice(yy->parser, "\n", 1), a); ;
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_2_BlockQuoteRaw(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_2_BlockQuoteRaw\n"));
+   a = cons(__, a); ;
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_BlockQuoteRaw(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_1_BlockQuoteRaw\n"));
+   a = cons(__, a); ;
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_BlockQuote(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_1_BlockQuote\n"));
+    __ = mk_element(yy->parser, BLOCKQUOTE);
+                __->children = a;
+             ;
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_3_HeadingSection(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_3_HeadingSection\n"));
+   __ = mk_list(yy->parser, HEADINGSECTION, a);;
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_2_HeadingSection(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_2_HeadingSection\n"));
+  a = cons(__, a); ;
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_HeadingSection(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_1_HeadingSection\n"));
+   a = cons(__, a); ;
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_3_SetextHeading2(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define b yy->__val[-1]
+#define a yy->__val[-2]
+  yyprintf((stderr, "do yy_3_SetextHeading2\n"));
+   __ = set_anchor_id(yy->parser, mk_list(yy->parser, H2, a)); ;
+#undef b
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_2_SetextHeading2(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define b yy->__val[-1]
+#define a yy->__val[-2]
+  yyprintf((stderr, "do yy_2_SetextHeading2\n"));
+   append_list(b,a);
+#undef b
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_SetextHeading2(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define b yy->__val[-1]
+#define a yy->__val[-2]
+  yyprintf((stderr, "do yy_1_SetextHeading2\n"));
+   a = cons(__, a); ;
+#undef b
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_3_SetextHeading1(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define b yy->__val[-1]
+#define a yy->__val[-2]
+  yyprintf((stderr, "do yy_3_SetextHeading1\n"));
+   __ = set_anchor_id(yy->parser, mk_list(yy->parser, H1, a)); ;
+#undef b
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_2_SetextHeading1(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define b yy->__val[-1]
+#define a yy->__val[-2]
+  yyprintf((stderr, "do yy_2_SetextHeading1\n"));
+   append_list(b,a);;
+#undef b
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_SetextHeading1(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define b yy->__val[-1]
+#define a yy->__val[-2]
+  yyprintf((stderr, "do yy_1_SetextHeading1\n"));
+   a = cons(__, a); ;
+#undef b
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_3_AtxHeading(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define b yy->__val[-1]
+#define a yy->__val[-2]
+#define s yy->__val[-3]
+  yyprintf((stderr, "do yy_3_AtxHeading\n"));
+   __ = set_anchor_id(yy->parser, mk_list(yy->parser, s->key,a)); ;
+#undef b
+#undef a
+#undef s
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_2_AtxHeading(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define b yy->__val[-1]
+#define a yy->__val[-2]
+#define s yy->__val[-3]
+  yyprintf((stderr, "do yy_2_AtxHeading\n"));
+   append_list(b,a);;
+#undef b
+#undef a
+#undef s
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_AtxHeading(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define b yy->__val[-1]
+#define a yy->__val[-2]
+#define s yy->__val[-3]
+  yyprintf((stderr, "do yy_1_AtxHeading\n"));
+   a = cons(__, a); ;
+#undef b
+#undef a
+#undef s
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_AtxStart(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+  yyprintf((stderr, "do yy_1_AtxStart\n"));
+   __ = mk_element(yy->parser, H1 + (strlen(yytext) - 1)); ;
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_Plain(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_1_Plain\n"));
+   __ = a; __->key = PLAIN; ;
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_Para(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_1_Para\n"));
+   __ = a; __->key = PARA; ;
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_4_MetaDataValue(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_4_MetaDataValue\n"));
+   __ = mk_str_from_list(yy->parser, a,false);
+                    trim_trailing_whitespace(__->contents.str);
+                    __->key = METAVALUE;
+                ;
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_3_MetaDataValue(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_3_MetaDataValue\n"));
+   a = cons(mk_match(), a);;
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_2_MetaDataValue(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_2_MetaDataValue\n"));
+   a = cons(mk_slice(yy->parser, "\n", 1), a);;
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_MetaDataValue(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_1_MetaDataValue\n"));
+   a = cons(mk_match(), a); ;
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_MetaDataKey(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+  yyprintf((stderr, "do yy_1_MetaDataKey\n"));
+  
+    char *label = label_from_string(yytext,0);
+    __ = mk_str(yy->parser, label);
+    free(label);
+    __->key = METAKEY;
+;
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_MetaDataKeyValue(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define b yy->__val[-1]
+#define a yy->__val[-2]
+  yyprintf((stderr, "do yy_1_MetaDataKeyValue\n"));
+   __ = a;
+                __->children = b;
+            ;
+#undef b
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_2_MetaDataOnly(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define b yy->__val[-1]
+#define a yy->__val[-2]
+  yyprintf((stderr, "do yy_2_MetaDataOnly\n"));
+   yy->parser->parse_result = mk_list(yy->parser, LIST,a); ;
+#undef b
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_MetaDataOnly(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define b yy->__val[-1]
+#define a yy->__val[-2]
+  yyprintf((stderr, "do yy_1_MetaDataOnly\n"));
+   a = cons(b, a); ;
+#undef b
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_2_MetaData(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_2_MetaData\n"));
+   __ = mk_list(yy->parser, LIST, a);
+                __->key = METADATA;
+            ;
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_MetaData(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_1_MetaData\n"));
+   a = cons(__, a); ;
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_2_DocSection(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_2_DocSection\n"));
+   yy->parser->parse_result = reverse(a); ;
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_DocSection(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_1_DocSection\n"));
+   a = cons(__, a); ;
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_3_DocWithMetaData(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define b yy->__val[-1]
+#define a yy->__val[-2]
+  yyprintf((stderr, "do yy_3_DocWithMetaData\n"));
+   if (b != NULL) a = cons(b, a);
+        yy->parser->parse_result = reverse(a);
+    ;
+#undef b
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_2_DocWithMetaData(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define b yy->__val[-1]
+#define a yy->__val[-2]
+  yyprintf((stderr, "do yy_2_DocWithMetaData\n"));
+   a = cons(__, a); ;
+#undef b
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_DocWithMetaData(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define b yy->__val[-1]
+#define a yy->__val[-2]
+  yyprintf((stderr, "do yy_1_DocWithMetaData\n"));
+   a = cons(__, a); b = mk_element(yy->parser, FOOTER);;
+#undef b
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_2_Doc(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_2_Doc\n"));
+   yy->parser->parse_result = reverse(a); ;
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_Doc(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+#define a yy->__val[-1]
+  yyprintf((stderr, "do yy_1_Doc\n"));
+   a = cons(__, a); ;
+#undef a
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+
+YY_RULE(int) yy_MarkdownHtmlAttribute(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "MarkdownHtmlAttribute"));
+  {  int yypos2= yy->__pos, yythunkpos2= yy->__thunkpos;  if (!yymatchString(yy, "markdown")) goto l3;  goto l2;
+  l3:;	  yy->__pos= yypos2; yy->__thunkpos= yythunkpos2;  if (!yymatchString(yy, "MARKDOWN")) goto l1;
+  }
+  l2:;	  if (!yy_Spnl(yy)) goto l1;  if (!yymatchChar(yy, '=')) goto l1;  if (!yy_Spnl(yy)) goto l1;
+  {  int yypos4= yy->__pos, yythunkpos4= yy->__thunkpos;  if (!yymatchChar(yy, '"')) goto l4;  if (!yy_Spnl(yy)) goto l4;  goto l5;
+  l4:;	  yy->__pos= yypos4; yy->__thunkpos= yythunkpos4;
+  }
+  l5:;	  if (!yymatchChar(yy, '1')) goto l1;
+  {  int yypos6= yy->__pos, yythunkpos6= yy->__thunkpos;  if (!yy_Spnl(yy)) goto l6;  if (!yymatchChar(yy, '"')) goto l6;  goto l7;
+  l6:;	  yy->__pos= yypos6; yy->__thunkpos= yythunkpos6;
+  }
+  l7:;	  if (!yy_Spnl(yy)) goto l1;
+  yyprintf((stderr, "  ok   %s @ %s\n", "MarkdownHtmlAttribute", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "MarkdownHtmlAttribute", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_OPMLSectionBlock(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "OPMLSectionBlock"));
+  l9:;	
+  {  int yypos10= yy->__pos, yythunkpos10= yy->__thunkpos;  if (!yy_BlankLine(yy)) goto l10;  goto l9;
+  l10:;	  yy->__pos= yypos10; yy->__thunkpos= yythunkpos10;
+  }
+  {  int yypos11= yy->__pos, yythunkpos11= yy->__thunkpos;  if (!yy_OPMLHeading(yy)) goto l11;  goto l8;
+  l11:;	  yy->__pos= yypos11; yy->__thunkpos= yythunkpos11;
+  }  if (!yy_OPMLPlain(yy)) goto l8;
+  yyprintf((stderr, "  ok   %s @ %s\n", "OPMLSectionBlock", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l8:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "OPMLSectionBlock", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_OPMLHeading(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;  yyDo(yy, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "OPMLHeading"));
+  {  int yypos13= yy->__pos, yythunkpos13= yy->__thunkpos;  if (!yy_Heading(yy)) goto l12;  yy->__pos= yypos13; yy->__thunkpos= yythunkpos13;
+  }  if (!yy_AtxStart(yy)) goto l12;  yyDo(yy, yySet, -1, 0);
+  {  int yypos14= yy->__pos, yythunkpos14= yy->__thunkpos;  if (!yy_Sp(yy)) goto l14;  goto l15;
+  l14:;	  yy->__pos= yypos14; yy->__thunkpos= yythunkpos14;
+  }
+  l15:;	  if (!(YY_BEGIN)) goto l12;
+  l16:;	
+  {  int yypos17= yy->__pos, yythunkpos17= yy->__thunkpos;
+  {  int yypos18= yy->__pos, yythunkpos18= yy->__thunkpos;  if (!yy_Newline(yy)) goto l18;  goto l17;
+  l18:;	  yy->__pos= yypos18; yy->__thunkpos= yythunkpos18;
+  }
+  {  int yypos19= yy->__pos, yythunkpos19= yy->__thunkpos;
+  {  int yypos20= yy->__pos, yythunkpos20= yy->__thunkpos;  if (!yy_Sp(yy)) goto l20;  goto l21;
+  l20:;	  yy->__pos= yypos20; yy->__thunkpos= yythunkpos20;
+  }
+  l21:;	
+  l22:;	
+  {  int yypos23= yy->__pos, yythunkpos23= yy->__thunkpos;  if (!yymatchChar(yy, '#')) goto l23;  goto l22;
+  l23:;	  yy->__pos= yypos23; yy->__thunkpos= yythunkpos23;
+  }  if (!yy_Sp(yy)) goto l19;  if (!yy_Newline(yy)) goto l19;  goto l17;
+  l19:;	  yy->__pos= yypos19; yy->__thunkpos= yythunkpos19;
+  }  if (!yymatchDot(yy)) goto l17;  goto l16;
+  l17:;	  yy->__pos= yypos17; yy->__thunkpos= yythunkpos17;
+  }  if (!(YY_END)) goto l12;
+  {  int yypos24= yy->__pos, yythunkpos24= yy->__thunkpos;
+  {  int yypos26= yy->__pos, yythunkpos26= yy->__thunkpos;  if (!yy_Sp(yy)) goto l26;  goto l27;
+  l26:;	  yy->__pos= yypos26; yy->__thunkpos= yythunkpos26;
+  }
+  l27:;	  if (!yymatchChar(yy, '#')) goto l24;
+  l28:;	
+  {  int yypos29= yy->__pos, yythunkpos29= yy->__thunkpos;  if (!yymatchChar(yy, '#')) goto l29;  goto l28;
+  l29:;	  yy->__pos= yypos29; yy->__thunkpos= yythunkpos29;
+  }  goto l25;
+  l24:;	  yy->__pos= yypos24; yy->__thunkpos= yythunkpos24;
+  }
+  l25:;	
+  {  int yypos30= yy->__pos, yythunkpos30= yy->__thunkpos;  if (!yy_Sp(yy)) goto l30;  goto l31;
+  l30:;	  yy->__pos= yypos30; yy->__thunkpos= yythunkpos30;
+  }
+  l31:;	  if (!yy_Newline(yy)) goto l12;  yyDo(yy, yy_1_OPMLHeading, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "OPMLHeading", yy->__buf+yy->__pos-yy->__base));  yyDo(yy, yyPop, 1, 0);
+  return 1;
+  l12:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "OPMLHeading", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_OPMLPlain(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;  yyDo(yy, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "OPMLPlain"));  if (!yy_StartList(yy)) goto l32;  yyDo(yy, yySet, -1, 0);
+  {  int yypos35= yy->__pos, yythunkpos35= yy->__thunkpos;  if (!yy_BlankLine(yy)) goto l35;  goto l32;
+  l35:;	  yy->__pos= yypos35; yy->__thunkpos= yythunkpos35;
+  }  if (!yy_RawLine(yy)) goto l32;  yyDo(yy, yy_1_OPMLPlain, yy->__begin, yy->__end);
+  l33:;	
+  {  int yypos34= yy->__pos, yythunkpos34= yy->__thunkpos;
+  {  int yypos36= yy->__pos, yythunkpos36= yy->__thunkpos;  if (!yy_BlankLine(yy)) goto l36;  goto l34;
+  l36:;	  yy->__pos= yypos36; yy->__thunkpos= yythunkpos36;
+  }  if (!yy_RawLine(yy)) goto l34;  yyDo(yy, yy_1_OPMLPlain, yy->__begin, yy->__end);  goto l33;
+  l34:;	  yy->__pos= yypos34; yy->__thunkpos= yythunkpos34;
+  }  yyDo(yy, yy_2_OPMLPlain, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "OPMLPlain", yy->__buf+yy->__pos-yy->__base));  yyDo(yy, yyPop, 1, 0);
+  return 1;
+  l32:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "OPMLPlain", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_OPMLHeadingSection(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;  yyDo(yy, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "OPMLHeadingSection"));  if (!yy_StartList(yy)) goto l37;  yyDo(yy, yySet, -1, 0);  if (!yy_OPMLHeading(yy)) goto l37;  yyDo(yy, yy_1_OPMLHeadingSection, yy->__begin, yy->__end);
+  l38:;	
+  {  int yypos39= yy->__pos, yythunkpos39= yy->__thunkpos;  if (!yy_OPMLSectionBlock(yy)) goto l39;  yyDo(yy, yy_2_OPMLHeadingSection, yy->__begin, yy->__end);  goto l38;
+  l39:;	  yy->__pos= yypos39; yy->__thunkpos= yythunkpos39;
+  }  yyDo(yy, yy_3_OPMLHeadingSection, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "OPMLHeadingSection", yy->__buf+yy->__pos-yy->__base));  yyDo(yy, yyPop, 1, 0);
+  return 1;
+  l37:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "OPMLHeadingSection", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_OPMLBlock(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "OPMLBlock"));
+  l41:;	
+  {  int yypos42= yy->__pos, yythunkpos42= yy->__thunkpos;  if (!yy_BlankLine(yy)) goto l42;  goto l41;
+  l42:;	  yy->__pos= yypos42; yy->__thunkpos= yythunkpos42;
+  }
+  {  int yypos43= yy->__pos, yythunkpos43= yy->__thunkpos;  if (!yy_OPMLHeadingSection(yy)) goto l44;  goto l43;
+  l44:;	  yy->__pos= yypos43; yy->__thunkpos= yythunkpos43;  if (!yy_OPMLPlain(yy)) goto l40;
+  }
+  l43:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "OPMLBlock", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l40:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "OPMLBlock", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_DocForOPML(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;  yyDo(yy, yyPush, 2, 0);
+  yyprintf((stderr, "%s\n", "DocForOPML"));  if (!yy_StartList(yy)) goto l45;  yyDo(yy, yySet, -2, 0);  if (!yy_StartList(yy)) goto l45;  yyDo(yy, yySet, -1, 0);
+  {  int yypos46= yy->__pos, yythunkpos46= yy->__thunkpos;
+  {  int yypos48= yy->__pos, yythunkpos48= yy->__thunkpos;  if (!yy_MetaDataKey(yy)) goto l46;  if (!yy_Sp(yy)) goto l46;  if (!yymatchChar(yy, ':')) goto l46;  if (!yy_Sp(yy)) goto l46;
+  {  int yypos49= yy->__pos, yythunkpos49= yy->__thunkpos;  if (!yy_Newline(yy)) goto l49;  goto l46;
+  l49:;	  yy->__pos= yypos49; yy->__thunkpos= yythunkpos49;
+  }  yy->__pos= yypos48; yy->__thunkpos= yythunkpos48;
+  }  if (!yy_MetaData(yy)) goto l46;  yyDo(yy, yy_1_DocForOPML, yy->__begin, yy->__end);  goto l47;
+  l46:;	  yy->__pos= yypos46; yy->__thunkpos= yythunkpos46;
+  }
+  l47:;	
+  l50:;	
+  {  int yypos51= yy->__pos, yythunkpos51= yy->__thunkpos;  if (!yy_OPMLBlock(yy)) goto l51;  yyDo(yy, yy_2_DocForOPML, yy->__begin, yy->__end);  if (!( YYACCEPT )) goto l51;  goto l50;
+  l51:;	  yy->__pos= yypos51; yy->__thunkpos= yythunkpos51;
+  }  yyDo(yy, yy_3_DocForOPML, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "DocForOPML", yy->__buf+yy->__pos-yy->__base));  yyDo(yy, yyPop, 2, 0);
+  return 1;
+  l45:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "DocForOPML", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_RightAlign(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "RightAlign"));  if (!yymatchChar(yy, '-')) goto l52;
+  l53:;	
+  {  int yypos54= yy->__pos, yythunkpos54= yy->__thunkpos;  if (!yymatchChar(yy, '-')) goto l54;  goto l53;
+  l54:;	  yy->__pos= yypos54; yy->__thunkpos= yythunkpos54;
+  }  if (!yymatchChar(yy, ':')) goto l52;
+  {  int yypos55= yy->__pos, yythunkpos55= yy->__thunkpos;
+  {  int yypos56= yy->__pos, yythunkpos56= yy->__thunkpos;  if (!yymatchChar(yy, '-')) goto l56;  goto l52;
+  l56:;	  yy->__pos= yypos56; yy->__thunkpos= yythunkpos56;
+  }
+  {  int yypos57= yy->__pos, yythunkpos57= yy->__thunkpos;  if (!yymatchChar(yy, ':')) goto l57;  goto l52;
+  l57:;	  yy->__pos= yypos57; yy->__thunkpos= yythunkpos57;
+  }  yy->__pos= yypos55; yy->__thunkpos= yythunkpos55;
+  }  yyDo(yy, yy_1_RightAlign, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "RightAlign", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l52:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "RightAlign", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_CenterAlign(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "CenterAlign"));  if (!yymatchChar(yy, ':')) goto l58;
+  l59:;	
+  {  int yypos60= yy->__pos, yythunkpos60= yy->__thunkpos;  if (!yymatchChar(yy, '-')) goto l60;  goto l59;
+  l60:;	  yy->__pos= yypos60; yy->__thunkpos= yythunkpos60;
+  }  if (!yymatchChar(yy, ':')) goto l58;
+  {  int yypos61= yy->__pos, yythunkpos61= yy->__thunkpos;
+  {  int yypos62= yy->__pos, yythunkpos62= yy->__thunkpos;  if (!yymatchChar(yy, '-')) goto l62;  goto l58;
+  l62:;	  yy->__pos= yypos62; yy->__thunkpos= yythunkpos62;
+  }
+  {  int yypos63= yy->__pos, yythunkpos63= yy->__thunkpos;  if (!yymatchChar(yy, ':')) goto l63;  goto l58;
+  l63:;	  yy->__pos= yypos63; yy->__thunkpos= yythunkpos63;
+  }  yy->__pos= yypos61; yy->__thunkpos= yythunkpos61;
+  }  yyDo(yy, yy_1_CenterAlign, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "CenterAlign", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l58:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "CenterAlign", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_LeftAlign(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "LeftAlign"));
+  {  int yypos65= yy->__pos, yythunkpos65= yy->__thunkpos;  if (!yymatchChar(yy, ':')) goto l65;  goto l66;
+  l65:;	  yy->__pos= yypos65; yy->__thunkpos= yythunkpos65;
+  }
+  l66:;	  if (!yymatchChar(yy, '-')) goto l64;
+  l67:;	
+  {  int yypos68= yy->__pos, yythunkpos68= yy->__thunkpos;  if (!yymatchChar(yy, '-')) goto l68;  goto l67;
+  l68:;	  yy->__pos= yypos68; yy->__thunkpos= yythunkpos68;
+  }
+  {  int yypos69= yy->__pos, yythunkpos69= yy->__thunkpos;
+  {  int yypos70= yy->__pos, yythunkpos70= yy->__thunkpos;  if (!yymatchChar(yy, '-')) goto l70;  goto l64;
+  l70:;	  yy->__pos= yypos70; yy->__thunkpos= yythunkpos70;
+  }
+  {  int yypos71= yy->__pos, yythunkpos71= yy->__thunkpos;  if (!yymatchChar(yy, ':')) goto l71;  goto l64;
+  l71:;	  yy->__pos= yypos71; yy->__thunkpos= yythunkpos71;
+  }  yy->__pos= yypos69; yy->__thunkpos= yythunkpos69;
+  }  yyDo(yy, yy_1_LeftAlign, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "LeftAlign", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l64:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "LeftAlign", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_RightAlignWrap(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "RightAlignWrap"));  if (!yymatchChar(yy, '-')) goto l72;
+  l73:;	
+  {  int yypos74= yy->__pos, yythunkpos74= yy->__thunkpos;  if (!yymatchChar(yy, '-')) goto l74;  goto l73;
+  l74:;	  yy->__pos= yypos74; yy->__thunkpos= yythunkpos74;
+  }  if (!yymatchChar(yy, ':')) goto l72;  if (!yymatchChar(yy, '+')) goto l72;
+  {  int yypos75= yy->__pos, yythunkpos75= yy->__thunkpos;
+  {  int yypos76= yy->__pos, yythunkpos76= yy->__thunkpos;  if (!yymatchChar(yy, '-')) goto l76;  goto l72;
+  l76:;	  yy->__pos= yypos76; yy->__thunkpos= yythunkpos76;
+  }
+  {  int yypos77= yy->__pos, yythunkpos77= yy->__thunkpos;  if (!yymatchChar(yy, ':')) goto l77;  goto l72;
+  l77:;	  yy->__pos= yypos77; yy->__thunkpos= yythunkpos77;
+  }  yy->__pos= yypos75; yy->__thunkpos= yythunkpos75;
+  }  yyDo(yy, yy_1_RightAlignWrap, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "RightAlignWrap", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l72:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "RightAlignWrap", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_CenterAlignWrap(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "CenterAlignWrap"));  if (!yymatchChar(yy, ':')) goto l78;
+  l79:;	
+  {  int yypos80= yy->__pos, yythunkpos80= yy->__thunkpos;  if (!yymatchChar(yy, '-')) goto l80;  goto l79;
+  l80:;	  yy->__pos= yypos80; yy->__thunkpos= yythunkpos80;
+  }  if (!yymatchChar(yy, '+')) goto l78;  if (!yymatchChar(yy, ':')) goto l78;
+  {  int yypos81= yy->__pos, yythunkpos81= yy->__thunkpos;
+  {  int yypos82= yy->__pos, yythunkpos82= yy->__thunkpos;  if (!yymatchChar(yy, '-')) goto l82;  goto l78;
+  l82:;	  yy->__pos= yypos82; yy->__thunkpos= yythunkpos82;
+  }
+  {  int yypos83= yy->__pos, yythunkpos83= yy->__thunkpos;  if (!yymatchChar(yy, ':')) goto l83;  goto l78;
+  l83:;	  yy->__pos= yypos83; yy->__thunkpos= yythunkpos83;
+  }  yy->__pos= yypos81; yy->__thunkpos= yythunkpos81;
+  }  yyDo(yy, yy_1_CenterAlignWrap, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "CenterAlignWrap", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l78:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "CenterAlignWrap", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_LeftAlignWrap(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "LeftAlignWrap"));
+  {  int yypos85= yy->__pos, yythunkpos85= yy->__thunkpos;  if (!yymatchChar(yy, ':')) goto l85;  goto l86;
+  l85:;	  yy->__pos= yypos85; yy->__thunkpos= yythunkpos85;
+  }
+  l86:;	  if (!yymatchChar(yy, '-')) goto l84;
+  l87:;	
+  {  int yypos88= yy->__pos, yythunkpos88= yy->__thunkpos;  if (!yymatchChar(yy, '-')) goto l88;  goto l87;
+  l88:;	  yy->__pos= yypos88; yy->__thunkpos= yythunkpos88;
+  }  if (!yymatchChar(yy, '+')) goto l84;
+  {  int yypos89= yy->__pos, yythunkpos89= yy->__thunkpos;
+  {  int yypos90= yy->__pos, yythunkpos90= yy->__thunkpos;  if (!yymatchChar(yy, '-')) goto l90;  goto l84;
+  l90:;	  yy->__pos= yypos90; yy->__thunkpos= yythunkpos90;
+  }
+  {  int yypos91= yy->__pos, yythunkpos91= yy->__thunkpos;  if (!yymatchChar(yy, ':')) goto l91;  goto l84;
+  l91:;	  yy->__pos= yypos91; yy->__thunkpos= yythunkpos91;
+  }  yy->__pos= yypos89; yy->__thunkpos= yythunkpos89;
+  }  yyDo(yy, yy_1_LeftAlignWrap, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "LeftAlignWrap", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l84:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "LeftAlignWrap", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_AlignmentCell(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "AlignmentCell"));  if (!yy_Sp(yy)) goto l92;
+  {  int yypos93= yy->__pos, yythunkpos93= yy->__thunkpos;  if (!yy_CellDivider(yy)) goto l93;  goto l92;
+  l93:;	  yy->__pos= yypos93; yy->__thunkpos= yythunkpos93;
+  }
+  {  int yypos94= yy->__pos, yythunkpos94= yy->__thunkpos;  if (!yy_LeftAlignWrap(yy)) goto l95;  goto l94;
+  l95:;	  yy->__pos= yypos94; yy->__thunkpos= yythunkpos94;  if (!yy_CenterAlignWrap(yy)) goto l96;  goto l94;
+  l96:;	  yy->__pos= yypos94; yy->__thunkpos= yythunkpos94;  if (!yy_RightAlignWrap(yy)) goto l97;  goto l94;
+  l97:;	  yy->__pos= yypos94; yy->__thunkpos= yythunkpos94;  if (!yy_LeftAlign(yy)) goto l98;  goto l94;
+  l98:;	  yy->__pos= yypos94; yy->__thunkpos= yythunkpos94;  if (!yy_CenterAlign(yy)) goto l99;  goto l94;
+  l99:;	  yy->__pos= yypos94; yy->__thunkpos= yythunkpos94;  if (!yy_RightAlign(yy)) goto l92;
+  }
+  l94:;	  if (!yy_Sp(yy)) goto l92;
+  {  int yypos100= yy->__pos, yythunkpos100= yy->__thunkpos;  if (!yy_CellDivider(yy)) goto l100;  goto l101;
+  l100:;	  yy->__pos= yypos100; yy->__thunkpos= yythunkpos100;
+  }
+  l101:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "AlignmentCell", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l92:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "AlignmentCell", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_CellStr(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "CellStr"));  if (!(YY_BEGIN)) goto l102;
+  {  int yypos103= yy->__pos, yythunkpos103= yy->__thunkpos;  if (!yy_CellDivider(yy)) goto l103;  goto l102;
+  l103:;	  yy->__pos= yypos103; yy->__thunkpos= yythunkpos103;
+  }  if (!yy_NormalChar(yy)) goto l102;
+  l104:;	
+  {  int yypos105= yy->__pos, yythunkpos105= yy->__thunkpos;
+  {  int yypos106= yy->__pos, yythunkpos106= yy->__thunkpos;
+  {  int yypos108= yy->__pos, yythunkpos108= yy->__thunkpos;  if (!yy_CellDivider(yy)) goto l108;  goto l107;
+  l108:;	  yy->__pos= yypos108; yy->__thunkpos= yythunkpos108;
+  }  if (!yy_NormalChar(yy)) goto l107;  goto l106;
+  l107:;	  yy->__pos= yypos106; yy->__thunkpos= yythunkpos106;  if (!yymatchChar(yy, '_')) goto l105;
+  l109:;	
+  {  int yypos110= yy->__pos, yythunkpos110= yy->__thunkpos;  if (!yymatchChar(yy, '_')) goto l110;  goto l109;
+  l110:;	  yy->__pos= yypos110; yy->__thunkpos= yythunkpos110;
+  }
+  {  int yypos111= yy->__pos, yythunkpos111= yy->__thunkpos;  if (!yy_Alphanumeric(yy)) goto l105;  yy->__pos= yypos111; yy->__thunkpos= yythunkpos111;
+  }
+  }
+  l106:;	  goto l104;
+  l105:;	  yy->__pos= yypos105; yy->__thunkpos= yythunkpos105;
+  }  if (!(YY_END)) goto l102;  yyDo(yy, yy_1_CellStr, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "CellStr", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l102:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "CellStr", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_FullCell(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;  yyDo(yy, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "FullCell"));  if (!yy_Sp(yy)) goto l112;  if (!yy_StartList(yy)) goto l112;  yyDo(yy, yySet, -1, 0);
+  {  int yypos115= yy->__pos, yythunkpos115= yy->__thunkpos;
+  {  int yypos117= yy->__pos, yythunkpos117= yy->__thunkpos;  if (!yy_CellDivider(yy)) goto l117;  goto l116;
+  l117:;	  yy->__pos= yypos117; yy->__thunkpos= yythunkpos117;
+  }  if (!yy_CellStr(yy)) goto l116;  goto l115;
+  l116:;	  yy->__pos= yypos115; yy->__thunkpos= yythunkpos115;
+  {  int yypos118= yy->__pos, yythunkpos118= yy->__thunkpos;  if (!yy_Newline(yy)) goto l118;  goto l112;
+  l118:;	  yy->__pos= yypos118; yy->__thunkpos= yythunkpos118;
+  }
+  {  int yypos119= yy->__pos, yythunkpos119= yy->__thunkpos;  if (!yy_Endline(yy)) goto l119;  goto l112;
+  l119:;	  yy->__pos= yypos119; yy->__thunkpos= yythunkpos119;
+  }
+  {  int yypos120= yy->__pos, yythunkpos120= yy->__thunkpos;  if (!yy_CellDivider(yy)) goto l120;  goto l112;
+  l120:;	  yy->__pos= yypos120; yy->__thunkpos= yythunkpos120;
+  }
+  {  int yypos121= yy->__pos, yythunkpos121= yy->__thunkpos;  if (!yy_Str(yy)) goto l121;  goto l112;
+  l121:;	  yy->__pos= yypos121; yy->__thunkpos= yythunkpos121;
+  }
+  {  int yypos122= yy->__pos, yythunkpos122= yy->__thunkpos;  if (!yy_Sp(yy)) goto l122;
+  {  int yypos123= yy->__pos, yythunkpos123= yy->__thunkpos;  if (!yy_CellDivider(yy)) goto l122;  yy->__pos= yypos123; yy->__thunkpos= yythunkpos123;
+  }  goto l112;
+  l122:;	  yy->__pos= yypos122; yy->__thunkpos= yythunkpos122;
+  }  if (!yy_Inline(yy)) goto l112;
+  }
+  l115:;	  yyDo(yy, yy_1_FullCell, yy->__begin, yy->__end);
+  l113:;	
+  {  int yypos114= yy->__pos, yythunkpos114= yy->__thunkpos;
+  {  int yypos124= yy->__pos, yythunkpos124= yy->__thunkpos;
+  {  int yypos126= yy->__pos, yythunkpos126= yy->__thunkpos;  if (!yy_CellDivider(yy)) goto l126;  goto l125;
+  l126:;	  yy->__pos= yypos126; yy->__thunkpos= yythunkpos126;
+  }  if (!yy_CellStr(yy)) goto l125;  goto l124;
+  l125:;	  yy->__pos= yypos124; yy->__thunkpos= yythunkpos124;
+  {  int yypos127= yy->__pos, yythunkpos127= yy->__thunkpos;  if (!yy_Newline(yy)) goto l127;  goto l114;
+  l127:;	  yy->__pos= yypos127; yy->__thunkpos= yythunkpos127;
+  }
+  {  int yypos128= yy->__pos, yythunkpos128= yy->__thunkpos;  if (!yy_Endline(yy)) goto l128;  goto l114;
+  l128:;	  yy->__pos= yypos128; yy->__thunkpos= yythunkpos128;
+  }
+  {  int yypos129= yy->__pos, yythunkpos129= yy->__thunkpos;  if (!yy_CellDivider(yy)) goto l129;  goto l114;
+  l129:;	  yy->__pos= yypos129; yy->__thunkpos= yythunkpos129;
+  }
+  {  int yypos130= yy->__pos, yythunkpos130= yy->__thunkpos;  if (!yy_Str(yy)) goto l130;  goto l114;
+  l130:;	  yy->__pos= yypos130; yy->__thunkpos= yythunkpos130;
+  }
+  {  int yypos131= yy->__pos, yythunkpos131= yy->__thunkpos;  if (!yy_Sp(yy)) goto l131;
+  {  int yypos132= yy->__pos, yythunkpos132= yy->__thunkpos;  if (!yy_CellDivider(yy)) goto l131;  yy->__pos= yypos132; yy->__thunkpos= yythunkpos132;
+  }  goto l114;
+  l131:;	  yy->__pos= yypos131; yy->__thunkpos= yythunkpos131;
+  }  if (!yy_Inline(yy)) goto l114;
+  }
+  l124:;	  yyDo(yy, yy_1_FullCell, yy->__begin, yy->__end);  goto l113;
+  l114:;	  yy->__pos= yypos114; yy->__thunkpos= yythunkpos114;
+  }  if (!yy_Sp(yy)) goto l112;
+  {  int yypos133= yy->__pos, yythunkpos133= yy->__thunkpos;  if (!yy_CellDivider(yy)) goto l133;  goto l134;
+  l133:;	  yy->__pos= yypos133; yy->__thunkpos= yythunkpos133;
+  }
+  l134:;	  yyDo(yy, yy_2_FullCell, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "FullCell", yy->__buf+yy->__pos-yy->__base));  yyDo(yy, yyPop, 1, 0);
+  return 1;
+  l112:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "FullCell", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_EmptyCell(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "EmptyCell"));  if (!yy_Sp(yy)) goto l135;  if (!yy_CellDivider(yy)) goto l135;  yyDo(yy, yy_1_EmptyCell, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "EmptyCell", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l135:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "EmptyCell", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_ExtendedCell(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "ExtendedCell"));
+  {  int yypos137= yy->__pos, yythunkpos137= yy->__thunkpos;  if (!yy_EmptyCell(yy)) goto l138;  goto l137;
+  l138:;	  yy->__pos= yypos137; yy->__thunkpos= yythunkpos137;  if (!yy_FullCell(yy)) goto l136;
+  }
+  l137:;	  if (!(YY_BEGIN)) goto l136;  if (!yy_CellDivider(yy)) goto l136;
+  l139:;	
+  {  int yypos140= yy->__pos, yythunkpos140= yy->__thunkpos;  if (!yy_CellDivider(yy)) goto l140;  goto l139;
+  l140:;	  yy->__pos= yypos140; yy->__thunkpos= yythunkpos140;
+  }  if (!(YY_END)) goto l136;  yyDo(yy, yy_1_ExtendedCell, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "ExtendedCell", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l136:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "ExtendedCell", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_TableCell(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "TableCell"));
+  {  int yypos142= yy->__pos, yythunkpos142= yy->__thunkpos;  if (!yy_ExtendedCell(yy)) goto l143;  goto l142;
+  l143:;	  yy->__pos= yypos142; yy->__thunkpos= yythunkpos142;  if (!yy_EmptyCell(yy)) goto l144;  goto l142;
+  l144:;	  yy->__pos= yypos142; yy->__thunkpos= yythunkpos142;  if (!yy_FullCell(yy)) goto l141;
+  }
+  l142:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "TableCell", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l141:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "TableCell", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_CellDivider(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "CellDivider"));  if (!yymatchChar(yy, '|')) goto l145;
+  yyprintf((stderr, "  ok   %s @ %s\n", "CellDivider", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l145:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "CellDivider", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_TableLine(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "TableLine"));
+  l147:;	
+  {  int yypos148= yy->__pos, yythunkpos148= yy->__thunkpos;
+  {  int yypos149= yy->__pos, yythunkpos149= yy->__thunkpos;  if (!yy_Newline(yy)) goto l149;  goto l148;
+  l149:;	  yy->__pos= yypos149; yy->__thunkpos= yythunkpos149;
+  }
+  {  int yypos150= yy->__pos, yythunkpos150= yy->__thunkpos;  if (!yy_CellDivider(yy)) goto l150;  goto l148;
+  l150:;	  yy->__pos= yypos150; yy->__thunkpos= yythunkpos150;
+  }  if (!yymatchDot(yy)) goto l148;  goto l147;
+  l148:;	  yy->__pos= yypos148; yy->__thunkpos= yythunkpos148;
+  }  if (!yy_CellDivider(yy)) goto l146;
+  yyprintf((stderr, "  ok   %s @ %s\n", "TableLine", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l146:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "TableLine", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_Definition(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;  yyDo(yy, yyPush, 2, 0);
+  yyprintf((stderr, "%s\n", "Definition"));  if (!yy_StartList(yy)) goto l151;  yyDo(yy, yySet, -2, 0);  if (!yy_StartList(yy)) goto l151;  yyDo(yy, yySet, -1, 0);
+  {  int yypos152= yy->__pos, yythunkpos152= yy->__thunkpos;  if (!yy_BlankLine(yy)) goto l152;  yyDo(yy, yy_1_Definition, yy->__begin, yy->__end);  goto l153;
+  l152:;	  yy->__pos= yypos152; yy->__thunkpos= yythunkpos152;
+  }
+  l153:;	  if (!yymatchChar(yy, ':')) goto l151;  if (!yy_Sp(yy)) goto l151;  if (!yy_RawLine(yy)) goto l151;  yyDo(yy, yy_2_Definition, yy->__begin, yy->__end);
+  l154:;	
+  {  int yypos155= yy->__pos, yythunkpos155= yy->__thunkpos;
+  {  int yypos156= yy->__pos, yythunkpos156= yy->__thunkpos;  if (!yymatchChar(yy, ':')) goto l156;  goto l155;
+  l156:;	  yy->__pos= yypos156; yy->__thunkpos= yythunkpos156;
+  }
+  {  int yypos157= yy->__pos, yythunkpos157= yy->__thunkpos;  if (!yy_BlankLine(yy)) goto l157;  goto l155;
+  l157:;	  yy->__pos= yypos157; yy->__thunkpos= yythunkpos157;
+  }  if (!yy_RawLine(yy)) goto l155;  yyDo(yy, yy_3_Definition, yy->__begin, yy->__end);  goto l154;
+  l155:;	  yy->__pos= yypos155; yy->__thunkpos= yythunkpos155;
+  }
+  l158:;	
+  {  int yypos159= yy->__pos, yythunkpos159= yy->__thunkpos;  if (!yy_BlankLine(yy)) goto l159;  yyDo(yy, yy_4_Definition, yy->__begin, yy->__end);  if (!yy_IndentedLine(yy)) goto l159;  yyDo(yy, yy_5_Definition, yy->__begin, yy->__end);
+  l160:;	
+  {  int yypos161= yy->__pos, yythunkpos161= yy->__thunkpos;  if (!yy_IndentedLine(yy)) goto l161;  yyDo(yy, yy_5_Definition, yy->__begin, yy->__end);  goto l160;
+  l161:;	  yy->__pos= yypos161; yy->__thunkpos= yythunkpos161;
+  }  yyDo(yy, yy_6_Definition, yy->__begin, yy->__end);  goto l158;
+  l159:;	  yy->__pos= yypos159; yy->__thunkpos= yythunkpos159;
+  }  yyDo(yy, yy_7_Definition, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Definition", yy->__buf+yy->__pos-yy->__base));  yyDo(yy, yyPop, 2, 0);
+  return 1;
+  l151:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Definition", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_Term(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;  yyDo(yy, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "Term"));  if (!yy_StartList(yy)) goto l162;  yyDo(yy, yySet, -1, 0);
+  {  int yypos163= yy->__pos, yythunkpos163= yy->__thunkpos;  if (!yy_BlankLine(yy)) goto l163;  goto l162;
+  l163:;	  yy->__pos= yypos163; yy->__thunkpos= yythunkpos163;
+  }
+  {  int yypos164= yy->__pos, yythunkpos164= yy->__thunkpos;  if (!yymatchChar(yy, ':')) goto l164;  goto l162;
+  l164:;	  yy->__pos= yypos164; yy->__thunkpos= yythunkpos164;
+  }
+  {  int yypos167= yy->__pos, yythunkpos167= yy->__thunkpos;  if (!yy_Newline(yy)) goto l167;  goto l162;
+  l167:;	  yy->__pos= yypos167; yy->__thunkpos= yythunkpos167;
+  }
+  {  int yypos168= yy->__pos, yythunkpos168= yy->__thunkpos;  if (!yy_Endline(yy)) goto l168;  goto l162;
+  l168:;	  yy->__pos= yypos168; yy->__thunkpos= yythunkpos168;
+  }  if (!yy_Inline(yy)) goto l162;  yyDo(yy, yy_1_Term, yy->__begin, yy->__end);
+  l165:;	
+  {  int yypos166= yy->__pos, yythunkpos166= yy->__thunkpos;
+  {  int yypos169= yy->__pos, yythunkpos169= yy->__thunkpos;  if (!yy_Newline(yy)) goto l169;  goto l166;
+  l169:;	  yy->__pos= yypos169; yy->__thunkpos= yythunkpos169;
+  }
+  {  int yypos170= yy->__pos, yythunkpos170= yy->__thunkpos;  if (!yy_Endline(yy)) goto l170;  goto l166;
+  l170:;	  yy->__pos= yypos170; yy->__thunkpos= yythunkpos170;
+  }  if (!yy_Inline(yy)) goto l166;  yyDo(yy, yy_1_Term, yy->__begin, yy->__end);  goto l165;
+  l166:;	  yy->__pos= yypos166; yy->__thunkpos= yythunkpos166;
+  }  if (!yy_Newline(yy)) goto l162;  yyDo(yy, yy_2_Term, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Term", yy->__buf+yy->__pos-yy->__base));  yyDo(yy, yyPop, 1, 0);
+  return 1;
+  l162:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Term", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_TermLine(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "TermLine"));
+  {  int yypos172= yy->__pos, yythunkpos172= yy->__thunkpos;  if (!yymatchChar(yy, ':')) goto l172;  goto l171;
+  l172:;	  yy->__pos= yypos172; yy->__thunkpos= yythunkpos172;
+  }
+  {  int yypos173= yy->__pos, yythunkpos173= yy->__thunkpos;  if (!yy_BlankLine(yy)) goto l173;  goto l171;
+  l173:;	  yy->__pos= yypos173; yy->__thunkpos= yythunkpos173;
+  }
+  l174:;	
+  {  int yypos175= yy->__pos, yythunkpos175= yy->__thunkpos;
+  {  int yypos176= yy->__pos, yythunkpos176= yy->__thunkpos;  if (!yy_Newline(yy)) goto l176;  goto l175;
+  l176:;	  yy->__pos= yypos176; yy->__thunkpos= yythunkpos176;
+  }  if (!yymatchDot(yy)) goto l175;  goto l174;
+  l175:;	  yy->__pos= yypos175; yy->__thunkpos= yythunkpos175;
+  }  if (!yy_Newline(yy)) goto l171;
+  yyprintf((stderr, "  ok   %s @ %s\n", "TermLine", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l171:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "TermLine", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_LabelFromSource(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;  yyDo(yy, yyPush, 2, 0);
+  yyprintf((stderr, "%s\n", "LabelFromSource"));
+  {  int yypos178= yy->__pos, yythunkpos178= yy->__thunkpos;  if (!yy_Heading(yy)) goto l179;  yyDo(yy, yySet, -2, 0);  yyDo(yy, yy_1_LabelFromSource, yy->__begin, yy->__end);  goto l178;
+  l179:;	  yy->__pos= yypos178; yy->__thunkpos= yythunkpos178;  if (!yy_TableCaption(yy)) goto l177;  yyDo(yy, yySet, -1, 0);  yyDo(yy, yy_2_LabelFromSource, yy->__begin, yy->__end);
+  }
+  l178:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "LabelFromSource", yy->__buf+yy->__pos-yy->__base));  yyDo(yy, yyPop, 2, 0);
+  return 1;
+  l177:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "LabelFromSource", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_TableBody(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;  yyDo(yy, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "TableBody"));  if (!yy_StartList(yy)) goto l180;  yyDo(yy, yySet, -1, 0);  if (!yy_TableRow(yy)) goto l180;  yyDo(yy, yy_1_TableBody, yy->__begin, yy->__end);
+  l181:;	
+  {  int yypos182= yy->__pos, yythunkpos182= yy->__thunkpos;  if (!yy_TableRow(yy)) goto l182;  yyDo(yy, yy_1_TableBody, yy->__begin, yy->__end);  goto l181;
+  l182:;	  yy->__pos= yypos182; yy->__thunkpos= yythunkpos182;
+  }  yyDo(yy, yy_2_TableBody, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "TableBody", yy->__buf+yy->__pos-yy->__base));  yyDo(yy, yyPop, 1, 0);
+  return 1;
+  l180:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "TableBody", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_TableCaption(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;  yyDo(yy, yyPush, 3, 0);
+  yyprintf((stderr, "%s\n", "TableCaption"));  if (!yy_StartList(yy)) goto l183;  yyDo(yy, yySet, -3, 0);  if (!yy_Label(yy)) goto l183;  yyDo(yy, yySet, -2, 0);
+  {  int yypos184= yy->__pos, yythunkpos184= yy->__thunkpos;  if (!yy_Label(yy)) goto l184;  yyDo(yy, yySet, -1, 0);  yyDo(yy, yy_1_TableCaption, yy->__begin, yy->__end);  goto l185;
+  l184:;	  yy->__pos= yypos184; yy->__thunkpos= yythunkpos184;
+  }
+  l185:;	  if (!yy_Sp(yy)) goto l183;  if (!yy_Newline(yy)) goto l183;  yyDo(yy, yy_2_TableCaption, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "TableCaption", yy->__buf+yy->__pos-yy->__base));  yyDo(yy, yyPop, 3, 0);
+  return 1;
+  l183:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "TableCaption", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_SeparatorLine(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;  yyDo(yy, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "SeparatorLine"));  if (!yy_StartList(yy)) goto l186;  yyDo(yy, yySet, -1, 0);
+  {  int yypos187= yy->__pos, yythunkpos187= yy->__thunkpos;  if (!yy_TableLine(yy)) goto l186;  yy->__pos= yypos187; yy->__thunkpos= yythunkpos187;
+  }
+  {  int yypos188= yy->__pos, yythunkpos188= yy->__thunkpos;  if (!yy_CellDivider(yy)) goto l188;  goto l189;
+  l188:;	  yy->__pos= yypos188; yy->__thunkpos= yythunkpos188;
+  }
+  l189:;	  if (!yy_AlignmentCell(yy)) goto l186;  yyDo(yy, yy_1_SeparatorLine, yy->__begin, yy->__end);
+  l190:;	
+  {  int yypos191= yy->__pos, yythunkpos191= yy->__thunkpos;  if (!yy_AlignmentCell(yy)) goto l191;  yyDo(yy, yy_1_SeparatorLine, yy->__begin, yy->__end);  goto l190;
+  l191:;	  yy->__pos= yypos191; yy->__thunkpos= yythunkpos191;
+  }  if (!yy_Sp(yy)) goto l186;  if (!yy_Newline(yy)) goto l186;  yyDo(yy, yy_2_SeparatorLine, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "SeparatorLine", yy->__buf+yy->__pos-yy->__base));  yyDo(yy, yyPop, 1, 0);
+  return 1;
+  l186:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "SeparatorLine", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_TableRow(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;  yyDo(yy, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "TableRow"));  if (!yy_StartList(yy)) goto l192;  yyDo(yy, yySet, -1, 0);
+  {  int yypos193= yy->__pos, yythunkpos193= yy->__thunkpos;  if (!yy_SeparatorLine(yy)) goto l193;  goto l192;
+  l193:;	  yy->__pos= yypos193; yy->__thunkpos= yythunkpos193;
+  }
+  {  int yypos194= yy->__pos, yythunkpos194= yy->__thunkpos;  if (!yy_TableLine(yy)) goto l192;  yy->__pos= yypos194; yy->__thunkpos= yythunkpos194;
+  }
+  {  int yypos195= yy->__pos, yythunkpos195= yy->__thunkpos;  if (!yy_CellDivider(yy)) goto l195;  goto l196;
+  l195:;	  yy->__pos= yypos195; yy->__thunkpos= yythunkpos195;
+  }
+  l196:;	  if (!yy_TableCell(yy)) goto l192;  yyDo(yy, yy_1_TableRow, yy->__begin, yy->__end);
+  l197:;	
+  {  int yypos198= yy->__pos, yythunkpos198= yy->__thunkpos;  if (!yy_TableCell(yy)) goto l198;  yyDo(yy, yy_1_TableRow, yy->__begin, yy->__end);  goto l197;
+  l198:;	  yy->__pos= yypos198; yy->__thunkpos= yythunkpos198;
+  }  if (!yy_Sp(yy)) goto l192;  if (!yy_Newline(yy)) goto l192;  yyDo(yy, yy_2_TableRow, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "TableRow", yy->__buf+yy->__pos-yy->__base));  yyDo(yy, yyPop, 1, 0);
+  return 1;
+  l192:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "TableRow", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_LabelSourceLine(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "LabelSourceLine"));
+  l200:;	
+  {  int yypos201= yy->__pos, yythunkpos201= yy->__thunkpos;
+  {  int yypos202= yy->__pos, yythunkpos202= yy->__thunkpos;  if (!yymatchChar(yy, '\r')) goto l202;  goto l201;
+  l202:;	  yy->__pos= yypos202; yy->__thunkpos= yythunkpos202;
+  }
+  {  int yypos203= yy->__pos, yythunkpos203= yy->__thunkpos;  if (!yymatchChar(yy, '\n')) goto l203;  goto l201;
+  l203:;	  yy->__pos= yypos203; yy->__thunkpos= yythunkpos203;
+  }  if (!yymatchDot(yy)) goto l201;  goto l200;
+  l201:;	  yy->__pos= yypos201; yy->__thunkpos= yythunkpos201;
+  }  if (!yy_Newline(yy)) goto l199;
+  yyprintf((stderr, "  ok   %s @ %s\n", "LabelSourceLine", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l199:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "LabelSourceLine", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_LabelCandidate(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "LabelCandidate"));
+  {  int yypos205= yy->__pos, yythunkpos205= yy->__thunkpos;  if (!yymatchChar(yy, '#')) goto l206;  goto l205;
+  l206:;	  yy->__pos= yypos205; yy->__thunkpos= yythunkpos205;  if (!yymatchChar(yy, '[')) goto l207;  goto l205;
+  l207:;	  yy->__pos= yypos205; yy->__thunkpos= yythunkpos205;
+  l208:;	
+  {  int yypos209= yy->__pos, yythunkpos209= yy->__thunkpos;
+  {  int yypos210= yy->__pos, yythunkpos210= yy->__thunkpos;  if (!yy_Newline(yy)) goto l210;  goto l209;
+  l210:;	  yy->__pos= yypos210; yy->__thunkpos= yythunkpos210;
+  }
+  {  int yypos211= yy->__pos, yythunkpos211= yy->__thunkpos;  if (!yymatchChar(yy, '|')) goto l211;  goto l209;
+  l211:;	  yy->__pos= yypos211; yy->__thunkpos= yythunkpos211;
+  }  if (!yymatchDot(yy)) goto l209;  goto l208;
+  l209:;	  yy->__pos= yypos209; yy->__thunkpos= yythunkpos209;
+  }
+  {  int yypos212= yy->__pos, yythunkpos212= yy->__thunkpos;  if (!yymatchChar(yy, '|')) goto l213;  goto l212;
+  l213:;	  yy->__pos= yypos212; yy->__thunkpos= yythunkpos212;  if (!yy_Newline(yy)) goto l204;
+  {  int yypos214= yy->__pos, yythunkpos214= yy->__thunkpos;  if (!yymatchChar(yy, '=')) goto l215;  goto l214;
+  l215:;	  yy->__pos= yypos214; yy->__thunkpos= yythunkpos214;  if (!yymatchChar(yy, '-')) goto l204;
+  }
+  l214:;	
+  }
+  l212:;	
+  }
+  l205:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "LabelCandidate", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l204:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "LabelCandidate", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_LabelSource(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;  yyDo(yy, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "LabelSource"));  if (!( !extension(yy->parser, EXT_COMPATIBILITY) && !extension(yy->parser, EXT_NO_LABELS) )) goto l216;
+  {  int yypos217= yy->__pos, yythunkpos217= yy->__thunkpos;  if (!yy_LabelCandidate(yy)) goto l216;  yy->__pos= yypos217; yy->__thunkpos= yythunkpos217;
+  }
+  {  int yypos218= yy->__pos, yythunkpos218= yy->__thunkpos;
+  {  int yypos220= yy->__pos, yythunkpos220= yy->__thunkpos;
+  l221:;	
+  {  int yypos222= yy->__pos, yythunkpos222= yy->__thunkpos;
+  {  int yypos223= yy->__pos, yythunkpos223= yy->__thunkpos;  if (!yymatchChar(yy, '[')) goto l223;  goto l222;
+  l223:;	  yy->__pos= yypos223; yy->__thunkpos= yythunkpos223;
+  }
+  {  int yypos224= yy->__pos, yythunkpos224= yy->__thunkpos;  if (!yy_Newline(yy)) goto l224;  goto l222;
+  l224:;	  yy->__pos= yypos224; yy->__thunkpos= yythunkpos224;
+  }  if (!yymatchDot(yy)) goto l222;  goto l221;
+  l222:;	  yy->__pos= yypos222; yy->__thunkpos= yythunkpos222;
+  }  if (!yy_Newline(yy)) goto l219;  yy->__pos= yypos220; yy->__thunkpos= yythunkpos220;
+  }  if (!yy_Heading(yy)) goto l219;  yyDo(yy, yySet, -1, 0);  yyDo(yy, yy_1_LabelSource, yy->__begin, yy->__end);  goto l218;
+  l219:;	  yy->__pos= yypos218; yy->__thunkpos= yythunkpos218;
+  {  int yypos226= yy->__pos, yythunkpos226= yy->__thunkpos;
+  {  int yypos228= yy->__pos, yythunkpos228= yy->__thunkpos;  if (!yy_SetextHeading(yy)) goto l227;  yy->__pos= yypos228; yy->__thunkpos= yythunkpos228;
+  }  if (!(YY_BEGIN)) goto l227;  if (!yy_LabelSourceLine(yy)) goto l227;  if (!yy_LabelSourceLine(yy)) goto l227;  if (!(YY_END)) goto l227;  goto l226;
+  l227:;	  yy->__pos= yypos226; yy->__thunkpos= yythunkpos226;
+  {  int yypos230= yy->__pos, yythunkpos230= yy->__thunkpos;  if (!yy_AtxHeading(yy)) goto l229;  yy->__pos= yypos230; yy->__thunkpos= yythunkpos230;
+  }  if (!(YY_BEGIN)) goto l229;  if (!yy_LabelSourceLine(yy)) goto l229;  if (!(YY_END)) goto l229;  goto l226;
+  l229:;	  yy->__pos= yypos226; yy->__thunkpos= yythunkpos226;
+  {  int yypos233= yy->__pos, yythunkpos233= yy->__thunkpos;
+  {  int yypos234= yy->__pos, yythunkpos234= yy->__thunkpos;  if (!yy_TableRow(yy)) goto l235;  goto l234;
+  l235:;	  yy->__pos= yypos234; yy->__thunkpos= yythunkpos234;  if (!yy_SeparatorLine(yy)) goto l225;
+  }
+  l234:;	  yy->__pos= yypos233; yy->__thunkpos= yythunkpos233;
+  }  if (!yy_LabelSourceLine(yy)) goto l225;
+  l231:;	
+  {  int yypos232= yy->__pos, yythunkpos232= yy->__thunkpos;
+  {  int yypos236= yy->__pos, yythunkpos236= yy->__thunkpos;
+  {  int yypos237= yy->__pos, yythunkpos237= yy->__thunkpos;  if (!yy_TableRow(yy)) goto l238;  goto l237;
+  l238:;	  yy->__pos= yypos237; yy->__thunkpos= yythunkpos237;  if (!yy_SeparatorLine(yy)) goto l232;
+  }
+  l237:;	  yy->__pos= yypos236; yy->__thunkpos= yythunkpos236;
+  }  if (!yy_LabelSourceLine(yy)) goto l232;  goto l231;
+  l232:;	  yy->__pos= yypos232; yy->__thunkpos= yythunkpos232;
+  }
+  {  int yypos239= yy->__pos, yythunkpos239= yy->__thunkpos;  if (!yy_TableCaption(yy)) goto l225;  yy->__pos= yypos239; yy->__thunkpos= yythunkpos239;
+  }  if (!(YY_BEGIN)) goto l225;  if (!yy_LabelSourceLine(yy)) goto l225;  if (!(YY_END)) goto l225;
+  }
+  l226:;	  yyDo(yy, yy_2_LabelSource, yy->__begin, yy->__end);  goto l218;
+  l225:;	  yy->__pos= yypos218; yy->__thunkpos= yythunkpos218;
+  {  int yypos240= yy->__pos, yythunkpos240= yy->__thunkpos;  if (!yy_TableCaption(yy)) goto l216;  if (!yy_TableBody(yy)) goto l216;  yy->__pos= yypos240; yy->__thunkpos= yythunkpos240;
+  }  if (!(YY_BEGIN)) goto l216;  if (!yy_LabelSourceLine(yy)) goto l216;  if (!(YY_END)) goto l216;  yyDo(yy, yy_3_LabelSource, yy->__begin, yy->__end);
+  {  int yypos243= yy->__pos, yythunkpos243= yy->__thunkpos;  if (!yy_TableRow(yy)) goto l216;  yy->__pos= yypos243; yy->__thunkpos= yythunkpos243;
+  }  if (!yy_LabelSourceLine(yy)) goto l216;
+  l241:;	
+  {  int yypos242= yy->__pos, yythunkpos242= yy->__thunkpos;
+  {  int yypos244= yy->__pos, yythunkpos244= yy->__thunkpos;  if (!yy_TableRow(yy)) goto l242;  yy->__pos= yypos244; yy->__thunkpos= yythunkpos244;
+  }  if (!yy_LabelSourceLine(yy)) goto l242;  goto l241;
+  l242:;	  yy->__pos= yypos242; yy->__thunkpos= yythunkpos242;
+  }
+  }
+  l218:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "LabelSource", yy->__buf+yy->__pos-yy->__base));  yyDo(yy, yyPop, 1, 0);
+  return 1;
+  l216:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "LabelSource", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_Collect(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;  yyDo(yy, yyPush, 4, 0);
+  yyprintf((stderr, "%s\n", "Collect"));  if (!yy_StartList(yy)) goto l245;  yyDo(yy, yySet, -4, 0);  if (!yy_StartList(yy)) goto l245;  yyDo(yy, yySet, -3, 0);  if (!yy_StartList(yy)) goto l245;  yyDo(yy, yySet, -2, 0);
+  l246:;	
+  {  int yypos247= yy->__pos, yythunkpos247= yy->__thunkpos;
+  {  int yypos248= yy->__pos, yythunkpos248= yy->__thunkpos;  if (!yy_Reference(yy)) goto l249;  yyDo(yy, yySet, -1, 0);  yyDo(yy, yy_1_Collect, yy->__begin, yy->__end);  goto l248;
+  l249:;	  yy->__pos= yypos248; yy->__thunkpos= yythunkpos248;
+  {  int yypos251= yy->__pos, yythunkpos251= yy->__thunkpos;  if (!yy_Glossary(yy)) goto l252;  yyDo(yy, yySet, -1, 0);  goto l251;
+  l252:;	  yy->__pos= yypos251; yy->__thunkpos= yythunkpos251;  if (!yy_Note(yy)) goto l250;  yyDo(yy, yySet, -1, 0);
+  }
+  l251:;	  yyDo(yy, yy_2_Collect, yy->__begin, yy->__end);  goto l248;
+  l250:;	  yy->__pos= yypos248; yy->__thunkpos= yythunkpos248;  if (!yy_LabelSource(yy)) goto l253;  yyDo(yy, yySet, -1, 0);  yyDo(yy, yy_3_Collect, yy->__begin, yy->__end);
+  l254:;	
+  {  int yypos255= yy->__pos, yythunkpos255= yy->__thunkpos;  if (!yy_LabelSource(yy)) goto l255;  yyDo(yy, yySet, -1, 0);  yyDo(yy, yy_3_Collect, yy->__begin, yy->__end);  goto l254;
+  l255:;	  yy->__pos= yypos255; yy->__thunkpos= yythunkpos255;
+  }
+  {  int yypos256= yy->__pos, yythunkpos256= yy->__thunkpos;  if (!yy_SkipBlock(yy)) goto l256;  goto l257;
+  l256:;	  yy->__pos= yypos256; yy->__thunkpos= yythunkpos256;
+  }
+  l257:;	  goto l248;
+  l253:;	  yy->__pos= yypos248; yy->__thunkpos= yythunkpos248;  if (!yy_SkipBlock(yy)) goto l247;
+  }
+  l248:;	  if (!( YYACCEPT )) goto l247;  goto l246;
+  l247:;	  yy->__pos= yypos247; yy->__thunkpos= yythunkpos247;
+  }  yyDo(yy, yy_4_Collect, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Collect", yy->__buf+yy->__pos-yy->__base));  yyDo(yy, yyPop, 4, 0);
+  return 1;
+  l245:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Collect", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_RawCitationReference(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "RawCitationReference"));  if (!yymatchString(yy, "[#")) goto l258;  if (!(YY_BEGIN)) goto l258;
+  {  int yypos261= yy->__pos, yythunkpos261= yy->__thunkpos;  if (!yy_Newline(yy)) goto l261;  goto l258;
+  l261:;	  yy->__pos= yypos261; yy->__thunkpos= yythunkpos261;
+  }
+  {  int yypos262= yy->__pos, yythunkpos262= yy->__thunkpos;  if (!yymatchChar(yy, ']')) goto l262;  goto l258;
+  l262:;	  yy->__pos= yypos262; yy->__thunkpos= yythunkpos262;
+  }  if (!yymatchDot(yy)) goto l258;
+  l259:;	
+  {  int yypos260= yy->__pos, yythunkpos260= yy->__thunkpos;
+  {  int yypos263= yy->__pos, yythunkpos263= yy->__thunkpos;  if (!yy_Newline(yy)) goto l263;  goto l260;
+  l263:;	  yy->__pos= yypos263; yy->__thunkpos= yythunkpos263;
+  }
+  {  int yypos264= yy->__pos, yythunkpos264= yy->__thunkpos;  if (!yymatchChar(yy, ']')) goto l264;  goto l260;
+  l264:;	  yy->__pos= yypos264; yy->__thunkpos= yythunkpos264;
+  }  if (!yymatchDot(yy)) goto l260;  goto l259;
+  l260:;	  yy->__pos= yypos260; yy->__thunkpos= yythunkpos260;
+  }  if (!(YY_END)) goto l258;  if (!yymatchChar(yy, ']')) goto l258;  yyDo(yy, yy_1_RawCitationReference, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "RawCitationReference", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l258:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "RawCitationReference", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_CitationReferenceSingle(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;  yyDo(yy, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "CitationReferenceSingle"));
+  {  int yypos266= yy->__pos, yythunkpos266= yy->__thunkpos;  if (!yymatchString(yy, "[]")) goto l267;  if (!yy_Spnl(yy)) goto l267;  if (!yy_RawCitationReference(yy)) goto l267;  yyDo(yy, yySet, -1, 0);  goto l266;
+  l267:;	  yy->__pos= yypos266; yy->__thunkpos= yythunkpos266;  if (!yy_RawCitationReference(yy)) goto l265;  yyDo(yy, yySet, -1, 0);  if (!(YY_BEGIN)) goto l265;
+  {  int yypos268= yy->__pos, yythunkpos268= yy->__thunkpos;  if (!yy_Spnl(yy)) goto l268;  if (!yymatchString(yy, "[]")) goto l268;  goto l269;
+  l268:;	  yy->__pos= yypos268; yy->__thunkpos= yythunkpos268;
+  }
+  l269:;	  if (!(YY_END)) goto l265;
+  }
+  l266:;	  yyDo(yy, yy_1_CitationReferenceSingle, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "CitationReferenceSingle", yy->__buf+yy->__pos-yy->__base));  yyDo(yy, yyPop, 1, 0);
+  return 1;
+  l265:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "CitationReferenceSingle", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_CitationReferenceDouble(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;  yyDo(yy, yyPush, 2, 0);
+  yyprintf((stderr, "%s\n", "CitationReferenceDouble"));
+  {  int yypos271= yy->__pos, yythunkpos271= yy->__thunkpos;  if (!yymatchString(yy, "[]")) goto l271;  goto l270;
+  l271:;	  yy->__pos= yypos271; yy->__thunkpos= yythunkpos271;
+  }  if (!yy_Label(yy)) goto l270;  yyDo(yy, yySet, -2, 0);  if (!(YY_BEGIN)) goto l270;  if (!yy_Spnl(yy)) goto l270;  if (!(YY_END)) goto l270;
+  {  int yypos272= yy->__pos, yythunkpos272= yy->__thunkpos;  if (!yymatchString(yy, "[]")) goto l272;  goto l270;
+  l272:;	  yy->__pos= yypos272; yy->__thunkpos= yythunkpos272;
+  }  if (!yy_RawCitationReference(yy)) goto l270;  yyDo(yy, yySet, -1, 0);  yyDo(yy, yy_1_CitationReferenceDouble, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "CitationReferenceDouble", yy->__buf+yy->__pos-yy->__base));  yyDo(yy, yyPop, 2, 0);
+  return 1;
+  l270:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "CitationReferenceDouble", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_InlineNote(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;  yyDo(yy, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "InlineNote"));  if (!( extension(yy->parser, EXT_NOTES) )) goto l273;  if (!yymatchString(yy, "^[")) goto l273;  if (!yy_StartList(yy)) goto l273;  yyDo(yy, yySet, -1, 0);
+  {  int yypos276= yy->__pos, yythunkpos276= yy->__thunkpos;  if (!yymatchChar(yy, ']')) goto l276;  goto l273;
+  l276:;	  yy->__pos= yypos276; yy->__thunkpos= yythunkpos276;
+  }  if (!yy_Inline(yy)) goto l273;  yyDo(yy, yy_1_InlineNote, yy->__begin, yy->__end);
+  l274:;	
+  {  int yypos275= yy->__pos, yythunkpos275= yy->__thunkpos;
+  {  int yypos277= yy->__pos, yythunkpos277= yy->__thunkpos;  if (!yymatchChar(yy, ']')) goto l277;  goto l275;
+  l277:;	  yy->__pos= yypos277; yy->__thunkpos= yythunkpos277;
+  }  if (!yy_Inline(yy)) goto l275;  yyDo(yy, yy_1_InlineNote, yy->__begin, yy->__end);  goto l274;
+  l275:;	  yy->__pos= yypos275; yy->__thunkpos= yythunkpos275;
+  }  if (!yymatchChar(yy, ']')) goto l273;  yyDo(yy, yy_2_InlineNote, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "InlineNote", yy->__buf+yy->__pos-yy->__base));  yyDo(yy, yyPop, 1, 0);
+  return 1;
+  l273:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "InlineNote", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_RawNoteBlock(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;  yyDo(yy, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "RawNoteBlock"));  if (!yy_StartList(yy)) goto l278;  yyDo(yy, yySet, -1, 0);
+  {  int yypos281= yy->__pos, yythunkpos281= yy->__thunkpos;  if (!yy_BlankLine(yy)) goto l281;  goto l278;
+  l281:;	  yy->__pos= yypos281; yy->__thunkpos= yythunkpos281;
+  }  if (!yy_OptionallyIndentedLine(yy)) goto l278;  yyDo(yy, yy_1_RawNoteBlock, yy->__begin, yy->__end);
+  l279:;	
+  {  int yypos280= yy->__pos, yythunkpos280= yy->__thunkpos;
+  {  int yypos282= yy->__pos, yythunkpos282= yy->__thunkpos;  if (!yy_BlankLine(yy)) goto l282;  goto l280;
+  l282:;	  yy->__pos= yypos282; yy->__thunkpos= yythunkpos282;
+  }  if (!yy_OptionallyIndentedLine(yy)) goto l280;  yyDo(yy, yy_1_RawNoteBlock, yy->__begin, yy->__end);  goto l279;
+  l280:;	  yy->__pos= yypos280; yy->__thunkpos= yythunkpos280;
+  }  if (!(YY_BEGIN)) goto l278;
+  l283:;	
+  {  int yypos284= yy->__pos, yythunkpos284= yy->__thunkpos;  if (!yy_BlankLine(yy)) goto l284;  goto l283;
+  l284:;	  yy->__pos= yypos284; yy->__thunkpos= yythunkpos284;
+  }  if (!(YY_END)) goto l278;  yyDo(yy, yy_2_RawNoteBlock, yy->__begin, yy->__end);  yyDo(yy, yy_3_RawNoteBlock, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "RawNoteBlock", yy->__buf+yy->__pos-yy->__base));  yyDo(yy, yyPop, 1, 0);
+  return 1;
+  l278:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "RawNoteBlock", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_GlossarySortKey(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "GlossarySortKey"));  if (!yymatchChar(yy, '(')) goto l285;  if (!(YY_BEGIN)) goto l285;
+  l286:;	
+  {  int yypos287= yy->__pos, yythunkpos287= yy->__thunkpos;
+  {  int yypos288= yy->__pos, yythunkpos288= yy->__thunkpos;  if (!yymatchChar(yy, ')')) goto l288;  goto l287;
+  l288:;	  yy->__pos= yypos288; yy->__thunkpos= yythunkpos288;
+  }
+  {  int yypos289= yy->__pos, yythunkpos289= yy->__thunkpos;  if (!yy_Newline(yy)) goto l289;  goto l287;
+  l289:;	  yy->__pos= yypos289; yy->__thunkpos= yythunkpos289;
+  }  if (!yymatchDot(yy)) goto l287;  goto l286;
+  l287:;	  yy->__pos= yypos287; yy->__thunkpos= yythunkpos287;
+  }  if (!(YY_END)) goto l285;  if (!yymatchChar(yy, ')')) goto l285;  yyDo(yy, yy_1_GlossarySortKey, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "GlossarySortKey", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l285:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "GlossarySortKey", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_GlossaryTerm(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "GlossaryTerm"));  if (!(YY_BEGIN)) goto l290;
+  {  int yypos293= yy->__pos, yythunkpos293= yy->__thunkpos;  if (!yy_Newline(yy)) goto l293;  goto l290;
+  l293:;	  yy->__pos= yypos293; yy->__thunkpos= yythunkpos293;
+  }
+  {  int yypos294= yy->__pos, yythunkpos294= yy->__thunkpos;  if (!yymatchChar(yy, '(')) goto l294;  goto l290;
+  l294:;	  yy->__pos= yypos294; yy->__thunkpos= yythunkpos294;
+  }  if (!yymatchDot(yy)) goto l290;
+  l291:;	
+  {  int yypos292= yy->__pos, yythunkpos292= yy->__thunkpos;
+  {  int yypos295= yy->__pos, yythunkpos295= yy->__thunkpos;  if (!yy_Newline(yy)) goto l295;  goto l292;
+  l295:;	  yy->__pos= yypos295; yy->__thunkpos= yythunkpos295;
+  }
+  {  int yypos296= yy->__pos, yythunkpos296= yy->__thunkpos;  if (!yymatchChar(yy, '(')) goto l296;  goto l292;
+  l296:;	  yy->__pos= yypos296; yy->__thunkpos= yythunkpos296;
+  }  if (!yymatchDot(yy)) goto l292;  goto l291;
+  l292:;	  yy->__pos= yypos292; yy->__thunkpos= yythunkpos292;
+  }  if (!(YY_END)) goto l290;  yyDo(yy, yy_1_GlossaryTerm, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "GlossaryTerm", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l290:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "GlossaryTerm", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_RawNoteReference(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "RawNoteReference"));
+  {  int yypos298= yy->__pos, yythunkpos298= yy->__thunkpos;  if (!yymatchString(yy, "[^")) goto l299;  goto l298;
+  l299:;	  yy->__pos= yypos298; yy->__thunkpos= yythunkpos298;  if (!yymatchString(yy, "[#")) goto l297;
+  }
+  l298:;	  if (!(YY_BEGIN)) goto l297;
+  {  int yypos302= yy->__pos, yythunkpos302= yy->__thunkpos;  if (!yy_Newline(yy)) goto l302;  goto l297;
+  l302:;	  yy->__pos= yypos302; yy->__thunkpos= yythunkpos302;
+  }
+  {  int yypos303= yy->__pos, yythunkpos303= yy->__thunkpos;  if (!yymatchChar(yy, ']')) goto l303;  goto l297;
+  l303:;	  yy->__pos= yypos303; yy->__thunkpos= yythunkpos303;
+  }  if (!yymatchDot(yy)) goto l297;
+  l300:;	
+  {  int yypos301= yy->__pos, yythunkpos301= yy->__thunkpos;
+  {  int yypos304= yy->__pos, yythunkpos304= yy->__thunkpos;  if (!yy_Newline(yy)) goto l304;  goto l301;
+  l304:;	  yy->__pos= yypos304; yy->__thunkpos= yythunkpos304;
+  }
+  {  int yypos305= yy->__pos, yythunkpos305= yy->__thunkpos;  if (!yymatchChar(yy, ']')) goto l305;  goto l301;
+  l305:;	  yy->__pos= yypos305; yy->__thunkpos= yythunkpos305;
+  }  if (!yymatchDot(yy)) goto l301;  goto l300;
+  l301:;	  yy->__pos= yypos301; yy->__thunkpos= yythunkpos301;
+  }  if (!(YY_END)) goto l297;  if (!yymatchChar(yy, ']')) goto l297;  yyDo(yy, yy_1_RawNoteReference, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "RawNoteReference", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l297:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "RawNoteReference", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_DoubleQuoteEnd(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "DoubleQuoteEnd"));  if (!yymatchChar(yy, '"')) goto l306;
+  yyprintf((stderr, "  ok   %s @ %s\n", "DoubleQuoteEnd", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l306:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "DoubleQuoteEnd", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_DoubleQuoteStart(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "DoubleQuoteStart"));  if (!yymatchChar(yy, '"')) goto l307;
+  yyprintf((stderr, "  ok   %s @ %s\n", "DoubleQuoteStart", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l307:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "DoubleQuoteStart", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_SingleQuoteEnd(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "SingleQuoteEnd"));  if (!yymatchChar(yy, '\'')) goto l308;
+  {  int yypos309= yy->__pos, yythunkpos309= yy->__thunkpos;  if (!yy_Alphanumeric(yy)) goto l309;  goto l308;
+  l309:;	  yy->__pos= yypos309; yy->__thunkpos= yythunkpos309;
+  }
+  yyprintf((stderr, "  ok   %s @ %s\n", "SingleQuoteEnd", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l308:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "SingleQuoteEnd", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_SingleQuoteStart(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "SingleQuoteStart"));  if (!yymatchChar(yy, '\'')) goto l310;
+  {  int yypos311= yy->__pos, yythunkpos311= yy->__thunkpos;
+  {  int yypos312= yy->__pos, yythunkpos312= yy->__thunkpos;  if (!yy_Spacechar(yy)) goto l313;  goto l312;
+  l313:;	  yy->__pos= yypos312; yy->__thunkpos= yythunkpos312;  if (!yy_Newline(yy)) goto l311;
+  }
+  l312:;	  goto l310;
+  l311:;	  yy->__pos= yypos311; yy->__thunkpos= yythunkpos311;
+  }
+  yyprintf((stderr, "  ok   %s @ %s\n", "SingleQuoteStart", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l310:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "SingleQuoteStart", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_EnDash(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "EnDash"));  if (!(YY_BEGIN)) goto l314;
+  {  int yypos315= yy->__pos, yythunkpos315= yy->__thunkpos;  if (!yymatchString(yy, "--")) goto l316;  goto l315;
+  l316:;	  yy->__pos= yypos315; yy->__thunkpos= yythunkpos315;  if (!yymatchChar(yy, '-')) goto l314;
+  {  int yypos317= yy->__pos, yythunkpos317= yy->__thunkpos;  if (!yy_Digit(yy)) goto l314;  yy->__pos= yypos317; yy->__thunkpos= yythunkpos317;
+  }
+  }
+  l315:;	  if (!(YY_END)) goto l314;  yyDo(yy, yy_1_EnDash, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "EnDash", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l314:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "EnDash", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_EmDash(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "EmDash"));  if (!(YY_BEGIN)) goto l318;  if (!yymatchString(yy, "---")) goto l318;  if (!(YY_END)) goto l318;  yyDo(yy, yy_1_EmDash, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "EmDash", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l318:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "EmDash", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_Apostrophe(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "Apostrophe"));  if (!yymatchChar(yy, '\'')) goto l319;  yyDo(yy, yy_1_Apostrophe, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Apostrophe", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l319:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Apostrophe", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_DoubleQuoted(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;  yyDo(yy, yyPush, 2, 0);
+  yyprintf((stderr, "%s\n", "DoubleQuoted"));  if (!yy_DoubleQuoteStart(yy)) goto l320;  if (!yy_StartList(yy)) goto l320;  yyDo(yy, yySet, -2, 0);
+  {  int yypos323= yy->__pos, yythunkpos323= yy->__thunkpos;  if (!yy_DoubleQuoteEnd(yy)) goto l323;  goto l320;
+  l323:;	  yy->__pos= yypos323; yy->__thunkpos= yythunkpos323;
+  }  if (!yy_Inline(yy)) goto l320;  yyDo(yy, yySet, -1, 0);  yyDo(yy, yy_1_DoubleQuoted, yy->__begin, yy->__end);
+  l321:;	
+  {  int yypos322= yy->__pos, yythunkpos322= yy->__thunkpos;
+  {  int yypos324= yy->__pos, yythunkpos324= yy->__thunkpos;  if (!yy_DoubleQuoteEnd(yy)) goto l324;  goto l322;
+  l324:;	  yy->__pos= yypos324; yy->__thunkpos= yythunkpos324;
+  }  if (!yy_Inline(yy)) goto l322;  yyDo(yy, yySet, -1, 0);  yyDo(yy, yy_1_DoubleQuoted, yy->__begin, yy->__end);  goto l321;
+  l322:;	  yy->__pos= yypos322; yy->__thunkpos= yythunkpos322;
+  }  if (!yy_DoubleQuoteEnd(yy)) goto l320;  yyDo(yy, yy_2_DoubleQuoted, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "DoubleQuoted", yy->__buf+yy->__pos-yy->__base));  yyDo(yy, yyPop, 2, 0);
+  return 1;
+  l320:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "DoubleQuoted", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_SingleQuoted(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;  yyDo(yy, yyPush, 2, 0);
+  yyprintf((stderr, "%s\n", "SingleQuoted"));  if (!yy_SingleQuoteStart(yy)) goto l325;  if (!yy_StartList(yy)) goto l325;  yyDo(yy, yySet, -2, 0);
+  {  int yypos328= yy->__pos, yythunkpos328= yy->__thunkpos;  if (!yy_SingleQuoteEnd(yy)) goto l328;  goto l325;
+  l328:;	  yy->__pos= yypos328; yy->__thunkpos= yythunkpos328;
+  }  if (!yy_Inline(yy)) goto l325;  yyDo(yy, yySet, -1, 0);  yyDo(yy, yy_1_SingleQuoted, yy->__begin, yy->__end);
+  l326:;	
+  {  int yypos327= yy->__pos, yythunkpos327= yy->__thunkpos;
+  {  int yypos329= yy->__pos, yythunkpos329= yy->__thunkpos;  if (!yy_SingleQuoteEnd(yy)) goto l329;  goto l327;
+  l329:;	  yy->__pos= yypos329; yy->__thunkpos= yythunkpos329;
+  }  if (!yy_Inline(yy)) goto l327;  yyDo(yy, yySet, -1, 0);  yyDo(yy, yy_1_SingleQuoted, yy->__begin, yy->__end);  goto l326;
+  l327:;	  yy->__pos= yypos327; yy->__thunkpos= yythunkpos327;
+  }  if (!yy_SingleQuoteEnd(yy)) goto l325;  yyDo(yy, yy_2_SingleQuoted, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "SingleQuoted", yy->__buf+yy->__pos-yy->__base));  yyDo(yy, yyPop, 2, 0);
+  return 1;
+  l325:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "SingleQuoted", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_Dash(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "Dash"));
+  {  int yypos331= yy->__pos, yythunkpos331= yy->__thunkpos;  if (!yy_EmDash(yy)) goto l332;  goto l331;
+  l332:;	  yy->__pos= yypos331; yy->__thunkpos= yythunkpos331;  if (!yy_EnDash(yy)) goto l330;
+  }
+  l331:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "Dash", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l330:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Dash", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_Ellipsis(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "Ellipsis"));
+  {  int yypos334= yy->__pos, yythunkpos334= yy->__thunkpos;  if (!yymatchString(yy, "...")) goto l335;  goto l334;
+  l335:;	  yy->__pos= yypos334; yy->__thunkpos= yythunkpos334;  if (!yymatchString(yy, ". . .")) goto l333;
+  }
+  l334:;	  yyDo(yy, yy_1_Ellipsis, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Ellipsis", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l333:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Ellipsis", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_Digit(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "Digit"));  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\000\000\377\003\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l336;
+  yyprintf((stderr, "  ok   %s @ %s\n", "Digit", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l336:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Digit", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_NonAlphanumeric(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "NonAlphanumeric"));  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\000\000\377\377\377\377\377\037\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l337;
+  yyprintf((stderr, "  ok   %s @ %s\n", "NonAlphanumeric", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l337:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "NonAlphanumeric", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_ExtendedSpecialChar(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "ExtendedSpecialChar"));
+  {  int yypos339= yy->__pos, yythunkpos339= yy->__thunkpos;  if (!( extension(yy->parser, EXT_SMART) )) goto l340;
+  {  int yypos341= yy->__pos, yythunkpos341= yy->__thunkpos;  if (!yymatchChar(yy, '.')) goto l342;  goto l341;
+  l342:;	  yy->__pos= yypos341; yy->__thunkpos= yythunkpos341;  if (!yymatchChar(yy, '-')) goto l343;  goto l341;
+  l343:;	  yy->__pos= yypos341; yy->__thunkpos= yythunkpos341;  if (!yymatchChar(yy, '\'')) goto l344;  goto l341;
+  l344:;	  yy->__pos= yypos341; yy->__thunkpos= yythunkpos341;  if (!yymatchChar(yy, '"')) goto l340;
+  }
+  l341:;	  goto l339;
+  l340:;	  yy->__pos= yypos339; yy->__thunkpos= yythunkpos339;  if (!( extension(yy->parser, EXT_NOTES) )) goto l338;  if (!yymatchChar(yy, '^')) goto l338;
+  }
+  l339:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "ExtendedSpecialChar", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l338:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "ExtendedSpecialChar", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_Quoted(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "Quoted"));
+  {  int yypos346= yy->__pos, yythunkpos346= yy->__thunkpos;  if (!yymatchChar(yy, '"')) goto l347;
+  l348:;	
+  {  int yypos349= yy->__pos, yythunkpos349= yy->__thunkpos;
+  {  int yypos350= yy->__pos, yythunkpos350= yy->__thunkpos;  if (!yymatchChar(yy, '"')) goto l350;  goto l349;
+  l350:;	  yy->__pos= yypos350; yy->__thunkpos= yythunkpos350;
+  }  if (!yymatchDot(yy)) goto l349;  goto l348;
+  l349:;	  yy->__pos= yypos349; yy->__thunkpos= yythunkpos349;
+  }  if (!yymatchChar(yy, '"')) goto l347;  goto l346;
+  l347:;	  yy->__pos= yypos346; yy->__thunkpos= yythunkpos346;  if (!yymatchChar(yy, '\'')) goto l345;
+  l351:;	
+  {  int yypos352= yy->__pos, yythunkpos352= yy->__thunkpos;
+  {  int yypos353= yy->__pos, yythunkpos353= yy->__thunkpos;  if (!yymatchChar(yy, '\'')) goto l353;  goto l352;
+  l353:;	  yy->__pos= yypos353; yy->__thunkpos= yythunkpos353;
+  }  if (!yymatchDot(yy)) goto l352;  goto l351;
+  l352:;	  yy->__pos= yypos352; yy->__thunkpos= yythunkpos352;
+  }  if (!yymatchChar(yy, '\'')) goto l345;
+  }
+  l346:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "Quoted", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l345:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Quoted", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlTag(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlTag"));  if (!yymatchChar(yy, '<')) goto l354;  if (!yy_Spnl(yy)) goto l354;
+  {  int yypos355= yy->__pos, yythunkpos355= yy->__thunkpos;  if (!yymatchChar(yy, '/')) goto l355;  goto l356;
+  l355:;	  yy->__pos= yypos355; yy->__thunkpos= yythunkpos355;
+  }
+  l356:;	  if (!yy_AlphanumericAscii(yy)) goto l354;
+  l357:;	
+  {  int yypos358= yy->__pos, yythunkpos358= yy->__thunkpos;  if (!yy_AlphanumericAscii(yy)) goto l358;  goto l357;
+  l358:;	  yy->__pos= yypos358; yy->__thunkpos= yythunkpos358;
+  }  if (!yy_Spnl(yy)) goto l354;
+  l359:;	
+  {  int yypos360= yy->__pos, yythunkpos360= yy->__thunkpos;  if (!yy_HtmlAttribute(yy)) goto l360;  goto l359;
+  l360:;	  yy->__pos= yypos360; yy->__thunkpos= yythunkpos360;
+  }
+  {  int yypos361= yy->__pos, yythunkpos361= yy->__thunkpos;  if (!yymatchChar(yy, '/')) goto l361;  goto l362;
+  l361:;	  yy->__pos= yypos361; yy->__thunkpos= yythunkpos361;
+  }
+  l362:;	  if (!yy_Spnl(yy)) goto l354;  if (!yymatchChar(yy, '>')) goto l354;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlTag", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l354:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlTag", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_Ticks5(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "Ticks5"));  if (!yymatchString(yy, "`````")) goto l363;
+  {  int yypos364= yy->__pos, yythunkpos364= yy->__thunkpos;  if (!yymatchChar(yy, '`')) goto l364;  goto l363;
+  l364:;	  yy->__pos= yypos364; yy->__thunkpos= yythunkpos364;
+  }
+  yyprintf((stderr, "  ok   %s @ %s\n", "Ticks5", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l363:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Ticks5", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_Ticks4(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "Ticks4"));  if (!yymatchString(yy, "````")) goto l365;
+  {  int yypos366= yy->__pos, yythunkpos366= yy->__thunkpos;  if (!yymatchChar(yy, '`')) goto l366;  goto l365;
+  l366:;	  yy->__pos= yypos366; yy->__thunkpos= yythunkpos366;
+  }
+  yyprintf((stderr, "  ok   %s @ %s\n", "Ticks4", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l365:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Ticks4", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_Ticks3(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "Ticks3"));  if (!yymatchString(yy, "```")) goto l367;
+  {  int yypos368= yy->__pos, yythunkpos368= yy->__thunkpos;  if (!yymatchChar(yy, '`')) goto l368;  goto l367;
+  l368:;	  yy->__pos= yypos368; yy->__thunkpos= yythunkpos368;
+  }
+  yyprintf((stderr, "  ok   %s @ %s\n", "Ticks3", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l367:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Ticks3", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_Ticks2(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "Ticks2"));  if (!yymatchString(yy, "``")) goto l369;
+  {  int yypos370= yy->__pos, yythunkpos370= yy->__thunkpos;  if (!yymatchChar(yy, '`')) goto l370;  goto l369;
+  l370:;	  yy->__pos= yypos370; yy->__thunkpos= yythunkpos370;
+  }
+  yyprintf((stderr, "  ok   %s @ %s\n", "Ticks2", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l369:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Ticks2", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_Ticks1(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "Ticks1"));  if (!yymatchChar(yy, '`')) goto l371;
+  {  int yypos372= yy->__pos, yythunkpos372= yy->__thunkpos;  if (!yymatchChar(yy, '`')) goto l372;  goto l371;
+  l372:;	  yy->__pos= yypos372; yy->__thunkpos= yythunkpos372;
+  }
+  yyprintf((stderr, "  ok   %s @ %s\n", "Ticks1", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l371:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Ticks1", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_EmptyTitle(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "EmptyTitle"));  if (!(YY_BEGIN)) goto l373;  if (!yymatchString(yy, "")) goto l373;  if (!(YY_END)) goto l373;
+  yyprintf((stderr, "  ok   %s @ %s\n", "EmptyTitle", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l373:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "EmptyTitle", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_RefTitleParens(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "RefTitleParens"));  if (!yy_Spnl(yy)) goto l374;  if (!yymatchChar(yy, '(')) goto l374;  if (!(YY_BEGIN)) goto l374;
+  l375:;	
+  {  int yypos376= yy->__pos, yythunkpos376= yy->__thunkpos;
+  {  int yypos377= yy->__pos, yythunkpos377= yy->__thunkpos;
+  {  int yypos378= yy->__pos, yythunkpos378= yy->__thunkpos;  if (!yymatchChar(yy, ')')) goto l379;  if (!yy_Sp(yy)) goto l379;  if (!yy_Newline(yy)) goto l379;  goto l378;
+  l379:;	  yy->__pos= yypos378; yy->__thunkpos= yythunkpos378;  if (!yy_Newline(yy)) goto l380;  goto l378;
+  l380:;	  yy->__pos= yypos378; yy->__thunkpos= yythunkpos378;  if (!( !extension(yy->parser, EXT_COMPATIBILITY) )) goto l377;  if (!yymatchChar(yy, ')')) goto l377;  if (!yy_Sp(yy)) goto l377;  if (!yy_AlphanumericAscii(yy)) goto l377;
+  l381:;	
+  {  int yypos382= yy->__pos, yythunkpos382= yy->__thunkpos;  if (!yy_AlphanumericAscii(yy)) goto l382;  goto l381;
+  l382:;	  yy->__pos= yypos382; yy->__thunkpos= yythunkpos382;
+  }  if (!yymatchChar(yy, '=')) goto l377;
+  }
+  l378:;	  goto l376;
+  l377:;	  yy->__pos= yypos377; yy->__thunkpos= yythunkpos377;
+  }  if (!yymatchDot(yy)) goto l376;  goto l375;
+  l376:;	  yy->__pos= yypos376; yy->__thunkpos= yythunkpos376;
+  }  if (!(YY_END)) goto l374;  if (!yymatchChar(yy, ')')) goto l374;
+  yyprintf((stderr, "  ok   %s @ %s\n", "RefTitleParens", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l374:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "RefTitleParens", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_RefTitleDouble(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "RefTitleDouble"));  if (!yy_Spnl(yy)) goto l383;  if (!yymatchChar(yy, '"')) goto l383;  if (!(YY_BEGIN)) goto l383;
+  l384:;	
+  {  int yypos385= yy->__pos, yythunkpos385= yy->__thunkpos;
+  {  int yypos386= yy->__pos, yythunkpos386= yy->__thunkpos;
+  {  int yypos387= yy->__pos, yythunkpos387= yy->__thunkpos;  if (!yymatchChar(yy, '"')) goto l388;  if (!yy_Sp(yy)) goto l388;  if (!yy_Newline(yy)) goto l388;  goto l387;
+  l388:;	  yy->__pos= yypos387; yy->__thunkpos= yythunkpos387;  if (!yy_Newline(yy)) goto l389;  goto l387;
+  l389:;	  yy->__pos= yypos387; yy->__thunkpos= yythunkpos387;  if (!( !extension(yy->parser, EXT_COMPATIBILITY) )) goto l386;  if (!yymatchChar(yy, '"')) goto l386;  if (!yy_Sp(yy)) goto l386;  if (!yy_AlphanumericAscii(yy)) goto l386;
+  l390:;	
+  {  int yypos391= yy->__pos, yythunkpos391= yy->__thunkpos;  if (!yy_AlphanumericAscii(yy)) goto l391;  goto l390;
+  l391:;	  yy->__pos= yypos391; yy->__thunkpos= yythunkpos391;
+  }  if (!yymatchChar(yy, '=')) goto l386;
+  }
+  l387:;	  goto l385;
+  l386:;	  yy->__pos= yypos386; yy->__thunkpos= yythunkpos386;
+  }  if (!yymatchDot(yy)) goto l385;  goto l384;
+  l385:;	  yy->__pos= yypos385; yy->__thunkpos= yythunkpos385;
+  }  if (!(YY_END)) goto l383;  if (!yymatchChar(yy, '"')) goto l383;
+  yyprintf((stderr, "  ok   %s @ %s\n", "RefTitleDouble", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l383:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "RefTitleDouble", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_RefTitleSingle(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "RefTitleSingle"));  if (!yy_Spnl(yy)) goto l392;  if (!yymatchChar(yy, '\'')) goto l392;  if (!(YY_BEGIN)) goto l392;
+  l393:;	
+  {  int yypos394= yy->__pos, yythunkpos394= yy->__thunkpos;
+  {  int yypos395= yy->__pos, yythunkpos395= yy->__thunkpos;
+  {  int yypos396= yy->__pos, yythunkpos396= yy->__thunkpos;  if (!yymatchChar(yy, '\'')) goto l397;  if (!yy_Sp(yy)) goto l397;  if (!yy_Newline(yy)) goto l397;  goto l396;
+  l397:;	  yy->__pos= yypos396; yy->__thunkpos= yythunkpos396;  if (!yy_Newline(yy)) goto l398;  goto l396;
+  l398:;	  yy->__pos= yypos396; yy->__thunkpos= yythunkpos396;  if (!( !extension(yy->parser, EXT_COMPATIBILITY) )) goto l395;  if (!yymatchChar(yy, '\'')) goto l395;  if (!yy_Sp(yy)) goto l395;  if (!yy_AlphanumericAscii(yy)) goto l395;
+  l399:;	
+  {  int yypos400= yy->__pos, yythunkpos400= yy->__thunkpos;  if (!yy_AlphanumericAscii(yy)) goto l400;  goto l399;
+  l400:;	  yy->__pos= yypos400; yy->__thunkpos= yythunkpos400;
+  }  if (!yymatchChar(yy, '=')) goto l395;
+  }
+  l396:;	  goto l394;
+  l395:;	  yy->__pos= yypos395; yy->__thunkpos= yythunkpos395;
+  }  if (!yymatchDot(yy)) goto l394;  goto l393;
+  l394:;	  yy->__pos= yypos394; yy->__thunkpos= yythunkpos394;
+  }  if (!(YY_END)) goto l392;  if (!yymatchChar(yy, '\'')) goto l392;
+  yyprintf((stderr, "  ok   %s @ %s\n", "RefTitleSingle", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l392:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "RefTitleSingle", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_UnQuotedValue(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "UnQuotedValue"));  if (!(YY_BEGIN)) goto l401;
+  {  int yypos404= yy->__pos, yythunkpos404= yy->__thunkpos;  if (!yy_AlphanumericAscii(yy)) goto l405;  goto l404;
+  l405:;	  yy->__pos= yypos404; yy->__thunkpos= yythunkpos404;  if (!yymatchChar(yy, '.')) goto l401;
+  }
+  l404:;	
+  l402:;	
+  {  int yypos403= yy->__pos, yythunkpos403= yy->__thunkpos;
+  {  int yypos406= yy->__pos, yythunkpos406= yy->__thunkpos;  if (!yy_AlphanumericAscii(yy)) goto l407;  goto l406;
+  l407:;	  yy->__pos= yypos406; yy->__thunkpos= yythunkpos406;  if (!yymatchChar(yy, '.')) goto l403;
+  }
+  l406:;	  goto l402;
+  l403:;	  yy->__pos= yypos403; yy->__thunkpos= yythunkpos403;
+  }  if (!(YY_END)) goto l401;
+  yyprintf((stderr, "  ok   %s @ %s\n", "UnQuotedValue", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l401:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "UnQuotedValue", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_QuotedValue(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "QuotedValue"));  if (!yymatchChar(yy, '"')) goto l408;  if (!(YY_BEGIN)) goto l408;
+  l409:;	
+  {  int yypos410= yy->__pos, yythunkpos410= yy->__thunkpos;
+  {  int yypos411= yy->__pos, yythunkpos411= yy->__thunkpos;  if (!yymatchChar(yy, '"')) goto l411;  goto l410;
+  l411:;	  yy->__pos= yypos411; yy->__thunkpos= yythunkpos411;
+  }  if (!yymatchDot(yy)) goto l410;  goto l409;
+  l410:;	  yy->__pos= yypos410; yy->__thunkpos= yythunkpos410;
+  }  if (!(YY_END)) goto l408;  if (!yymatchChar(yy, '"')) goto l408;
+  yyprintf((stderr, "  ok   %s @ %s\n", "QuotedValue", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l408:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "QuotedValue", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_AttrValue(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "AttrValue"));
+  {  int yypos413= yy->__pos, yythunkpos413= yy->__thunkpos;  if (!yy_QuotedValue(yy)) goto l414;  goto l413;
+  l414:;	  yy->__pos= yypos413; yy->__thunkpos= yythunkpos413;  if (!yy_UnQuotedValue(yy)) goto l412;
+  }
+  l413:;	  yyDo(yy, yy_1_AttrValue, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "AttrValue", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l412:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "AttrValue", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_AttrKey(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "AttrKey"));  if (!(YY_BEGIN)) goto l415;  if (!yy_AlphanumericAscii(yy)) goto l415;
+  l416:;	
+  {  int yypos417= yy->__pos, yythunkpos417= yy->__thunkpos;  if (!yy_AlphanumericAscii(yy)) goto l417;  goto l416;
+  l417:;	  yy->__pos= yypos417; yy->__thunkpos= yythunkpos417;
+  }  if (!(YY_END)) goto l415;  yyDo(yy, yy_1_AttrKey, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "AttrKey", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l415:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "AttrKey", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_Attribute(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;  yyDo(yy, yyPush, 2, 0);
+  yyprintf((stderr, "%s\n", "Attribute"));  if (!yy_Spnl(yy)) goto l418;  if (!yy_AttrKey(yy)) goto l418;  yyDo(yy, yySet, -2, 0);  if (!yymatchChar(yy, '=')) goto l418;  if (!yy_AttrValue(yy)) goto l418;  yyDo(yy, yySet, -1, 0);  yyDo(yy, yy_1_Attribute, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Attribute", yy->__buf+yy->__pos-yy->__base));  yyDo(yy, yyPop, 2, 0);
+  return 1;
+  l418:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Attribute", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_Attributes(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;  yyDo(yy, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "Attributes"));  if (!yy_StartList(yy)) goto l419;  yyDo(yy, yySet, -1, 0);  if (!yy_Attribute(yy)) goto l419;  yyDo(yy, yy_1_Attributes, yy->__begin, yy->__end);
+  l420:;	
+  {  int yypos421= yy->__pos, yythunkpos421= yy->__thunkpos;  if (!yy_Attribute(yy)) goto l421;  yyDo(yy, yy_1_Attributes, yy->__begin, yy->__end);  goto l420;
+  l421:;	  yy->__pos= yypos421; yy->__thunkpos= yythunkpos421;
+  }  yyDo(yy, yy_2_Attributes, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Attributes", yy->__buf+yy->__pos-yy->__base));  yyDo(yy, yyPop, 1, 0);
+  return 1;
+  l419:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Attributes", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_RefTitle(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "RefTitle"));
+  {  int yypos423= yy->__pos, yythunkpos423= yy->__thunkpos;  if (!yy_RefTitleSingle(yy)) goto l424;  goto l423;
+  l424:;	  yy->__pos= yypos423; yy->__thunkpos= yythunkpos423;  if (!yy_RefTitleDouble(yy)) goto l425;  goto l423;
+  l425:;	  yy->__pos= yypos423; yy->__thunkpos= yythunkpos423;  if (!yy_RefTitleParens(yy)) goto l426;  goto l423;
+  l426:;	  yy->__pos= yypos423; yy->__thunkpos= yythunkpos423;  if (!yy_EmptyTitle(yy)) goto l422;
+  }
+  l423:;	  yyDo(yy, yy_1_RefTitle, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "RefTitle", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l422:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "RefTitle", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_RefSrc(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "RefSrc"));  if (!(YY_BEGIN)) goto l427;  if (!yy_Nonspacechar(yy)) goto l427;
+  l428:;	
+  {  int yypos429= yy->__pos, yythunkpos429= yy->__thunkpos;  if (!yy_Nonspacechar(yy)) goto l429;  goto l428;
+  l429:;	  yy->__pos= yypos429; yy->__thunkpos= yythunkpos429;
+  }  if (!(YY_END)) goto l427;  yyDo(yy, yy_1_RefSrc, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "RefSrc", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l427:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "RefSrc", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_AutoLinkEmail(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "AutoLinkEmail"));  if (!yymatchChar(yy, '<')) goto l430;
+  {  int yypos431= yy->__pos, yythunkpos431= yy->__thunkpos;  if (!yymatchString(yy, "mailto:")) goto l431;  goto l432;
+  l431:;	  yy->__pos= yypos431; yy->__thunkpos= yythunkpos431;
+  }
+  l432:;	  if (!(YY_BEGIN)) goto l430;  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\000\050\377\003\376\377\377\207\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l430;
+  l433:;	
+  {  int yypos434= yy->__pos, yythunkpos434= yy->__thunkpos;  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\000\050\377\003\376\377\377\207\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l434;  goto l433;
+  l434:;	  yy->__pos= yypos434; yy->__thunkpos= yythunkpos434;
+  }  if (!yymatchChar(yy, '@')) goto l430;
+  {  int yypos437= yy->__pos, yythunkpos437= yy->__thunkpos;  if (!yy_Newline(yy)) goto l437;  goto l430;
+  l437:;	  yy->__pos= yypos437; yy->__thunkpos= yythunkpos437;
+  }
+  {  int yypos438= yy->__pos, yythunkpos438= yy->__thunkpos;  if (!yymatchChar(yy, '>')) goto l438;  goto l430;
+  l438:;	  yy->__pos= yypos438; yy->__thunkpos= yythunkpos438;
+  }  if (!yymatchDot(yy)) goto l430;
+  l435:;	
+  {  int yypos436= yy->__pos, yythunkpos436= yy->__thunkpos;
+  {  int yypos439= yy->__pos, yythunkpos439= yy->__thunkpos;  if (!yy_Newline(yy)) goto l439;  goto l436;
+  l439:;	  yy->__pos= yypos439; yy->__thunkpos= yythunkpos439;
+  }
+  {  int yypos440= yy->__pos, yythunkpos440= yy->__thunkpos;  if (!yymatchChar(yy, '>')) goto l440;  goto l436;
+  l440:;	  yy->__pos= yypos440; yy->__thunkpos= yythunkpos440;
+  }  if (!yymatchDot(yy)) goto l436;  goto l435;
+  l436:;	  yy->__pos= yypos436; yy->__thunkpos= yythunkpos436;
+  }  if (!(YY_END)) goto l430;  if (!yymatchChar(yy, '>')) goto l430;  yyDo(yy, yy_1_AutoLinkEmail, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "AutoLinkEmail", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l430:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "AutoLinkEmail", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_AutoLinkUrl(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "AutoLinkUrl"));  if (!yymatchChar(yy, '<')) goto l441;  if (!(YY_BEGIN)) goto l441;  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\000\000\000\000\376\377\377\007\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l441;
+  l442:;	
+  {  int yypos443= yy->__pos, yythunkpos443= yy->__thunkpos;  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\000\000\000\000\376\377\377\007\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l443;  goto l442;
+  l443:;	  yy->__pos= yypos443; yy->__thunkpos= yythunkpos443;
+  }  if (!yymatchString(yy, "://")) goto l441;
+  {  int yypos446= yy->__pos, yythunkpos446= yy->__thunkpos;  if (!yy_Newline(yy)) goto l446;  goto l441;
+  l446:;	  yy->__pos= yypos446; yy->__thunkpos= yythunkpos446;
+  }
+  {  int yypos447= yy->__pos, yythunkpos447= yy->__thunkpos;  if (!yymatchChar(yy, '>')) goto l447;  goto l441;
+  l447:;	  yy->__pos= yypos447; yy->__thunkpos= yythunkpos447;
+  }  if (!yymatchDot(yy)) goto l441;
+  l444:;	
+  {  int yypos445= yy->__pos, yythunkpos445= yy->__thunkpos;
+  {  int yypos448= yy->__pos, yythunkpos448= yy->__thunkpos;  if (!yy_Newline(yy)) goto l448;  goto l445;
+  l448:;	  yy->__pos= yypos448; yy->__thunkpos= yythunkpos448;
+  }
+  {  int yypos449= yy->__pos, yythunkpos449= yy->__thunkpos;  if (!yymatchChar(yy, '>')) goto l449;  goto l445;
+  l449:;	  yy->__pos= yypos449; yy->__thunkpos= yythunkpos449;
+  }  if (!yymatchDot(yy)) goto l445;  goto l444;
+  l445:;	  yy->__pos= yypos445; yy->__thunkpos= yythunkpos445;
+  }  if (!(YY_END)) goto l441;  if (!yymatchChar(yy, '>')) goto l441;  yyDo(yy, yy_1_AutoLinkUrl, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "AutoLinkUrl", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l441:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "AutoLinkUrl", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_TitleDouble(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "TitleDouble"));  if (!yymatchChar(yy, '"')) goto l450;  if (!(YY_BEGIN)) goto l450;
+  l451:;	
+  {  int yypos452= yy->__pos, yythunkpos452= yy->__thunkpos;
+  {  int yypos453= yy->__pos, yythunkpos453= yy->__thunkpos;  if (!yymatchChar(yy, '"')) goto l453;  if (!yy_Sp(yy)) goto l453;
+  {  int yypos454= yy->__pos, yythunkpos454= yy->__thunkpos;  if (!yymatchChar(yy, ')')) goto l455;  goto l454;
+  l455:;	  yy->__pos= yypos454; yy->__thunkpos= yythunkpos454;  if (!yy_Newline(yy)) goto l453;
+  }
+  l454:;	  goto l452;
+  l453:;	  yy->__pos= yypos453; yy->__thunkpos= yythunkpos453;
+  }  if (!yymatchDot(yy)) goto l452;  goto l451;
+  l452:;	  yy->__pos= yypos452; yy->__thunkpos= yythunkpos452;
+  }  if (!(YY_END)) goto l450;  if (!yymatchChar(yy, '"')) goto l450;
+  yyprintf((stderr, "  ok   %s @ %s\n", "TitleDouble", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l450:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "TitleDouble", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_TitleSingle(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "TitleSingle"));  if (!yymatchChar(yy, '\'')) goto l456;  if (!(YY_BEGIN)) goto l456;
+  l457:;	
+  {  int yypos458= yy->__pos, yythunkpos458= yy->__thunkpos;
+  {  int yypos459= yy->__pos, yythunkpos459= yy->__thunkpos;  if (!yymatchChar(yy, '\'')) goto l459;  if (!yy_Sp(yy)) goto l459;
+  {  int yypos460= yy->__pos, yythunkpos460= yy->__thunkpos;  if (!yymatchChar(yy, ')')) goto l461;  goto l460;
+  l461:;	  yy->__pos= yypos460; yy->__thunkpos= yythunkpos460;  if (!yy_Newline(yy)) goto l459;
+  }
+  l460:;	  goto l458;
+  l459:;	  yy->__pos= yypos459; yy->__thunkpos= yythunkpos459;
+  }  if (!yymatchDot(yy)) goto l458;  goto l457;
+  l458:;	  yy->__pos= yypos458; yy->__thunkpos= yythunkpos458;
+  }  if (!(YY_END)) goto l456;  if (!yymatchChar(yy, '\'')) goto l456;
+  yyprintf((stderr, "  ok   %s @ %s\n", "TitleSingle", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l456:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "TitleSingle", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_Nonspacechar(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "Nonspacechar"));
+  {  int yypos463= yy->__pos, yythunkpos463= yy->__thunkpos;  if (!yy_Spacechar(yy)) goto l463;  goto l462;
+  l463:;	  yy->__pos= yypos463; yy->__thunkpos= yythunkpos463;
+  }
+  {  int yypos464= yy->__pos, yythunkpos464= yy->__thunkpos;  if (!yy_Newline(yy)) goto l464;  goto l462;
+  l464:;	  yy->__pos= yypos464; yy->__thunkpos= yythunkpos464;
+  }  if (!yymatchDot(yy)) goto l462;
+  yyprintf((stderr, "  ok   %s @ %s\n", "Nonspacechar", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l462:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Nonspacechar", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_SourceContents(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "SourceContents"));
+  {  int yypos466= yy->__pos, yythunkpos466= yy->__thunkpos;
+  {  int yypos470= yy->__pos, yythunkpos470= yy->__thunkpos;
+  {  int yypos474= yy->__pos, yythunkpos474= yy->__thunkpos;  if (!yymatchChar(yy, '(')) goto l474;  goto l471;
+  l474:;	  yy->__pos= yypos474; yy->__thunkpos= yythunkpos474;
+  }
+  {  int yypos475= yy->__pos, yythunkpos475= yy->__thunkpos;  if (!yymatchChar(yy, ')')) goto l475;  goto l471;
+  l475:;	  yy->__pos= yypos475; yy->__thunkpos= yythunkpos475;
+  }
+  {  int yypos476= yy->__pos, yythunkpos476= yy->__thunkpos;  if (!yymatchChar(yy, '>')) goto l476;  goto l471;
+  l476:;	  yy->__pos= yypos476; yy->__thunkpos= yythunkpos476;
+  }  if (!yy_Nonspacechar(yy)) goto l471;
+  l472:;	
+  {  int yypos473= yy->__pos, yythunkpos473= yy->__thunkpos;
+  {  int yypos477= yy->__pos, yythunkpos477= yy->__thunkpos;  if (!yymatchChar(yy, '(')) goto l477;  goto l473;
+  l477:;	  yy->__pos= yypos477; yy->__thunkpos= yythunkpos477;
+  }
+  {  int yypos478= yy->__pos, yythunkpos478= yy->__thunkpos;  if (!yymatchChar(yy, ')')) goto l478;  goto l473;
+  l478:;	  yy->__pos= yypos478; yy->__thunkpos= yythunkpos478;
+  }
+  {  int yypos479= yy->__pos, yythunkpos479= yy->__thunkpos;  if (!yymatchChar(yy, '>')) goto l479;  goto l473;
+  l479:;	  yy->__pos= yypos479; yy->__thunkpos= yythunkpos479;
+  }  if (!yy_Nonspacechar(yy)) goto l473;  goto l472;
+  l473:;	  yy->__pos= yypos473; yy->__thunkpos= yythunkpos473;
+  }  goto l470;
+  l471:;	  yy->__pos= yypos470; yy->__thunkpos= yythunkpos470;  if (!yymatchChar(yy, '(')) goto l467;  if (!yy_SourceContents(yy)) goto l467;  if (!yymatchChar(yy, ')')) goto l467;
+  }
+  l470:;	
+  l468:;	
+  {  int yypos469= yy->__pos, yythunkpos469= yy->__thunkpos;
+  {  int yypos480= yy->__pos, yythunkpos480= yy->__thunkpos;
+  {  int yypos484= yy->__pos, yythunkpos484= yy->__thunkpos;  if (!yymatchChar(yy, '(')) goto l484;  goto l481;
+  l484:;	  yy->__pos= yypos484; yy->__thunkpos= yythunkpos484;
+  }
+  {  int yypos485= yy->__pos, yythunkpos485= yy->__thunkpos;  if (!yymatchChar(yy, ')')) goto l485;  goto l481;
+  l485:;	  yy->__pos= yypos485; yy->__thunkpos= yythunkpos485;
+  }
+  {  int yypos486= yy->__pos, yythunkpos486= yy->__thunkpos;  if (!yymatchChar(yy, '>')) goto l486;  goto l481;
+  l486:;	  yy->__pos= yypos486; yy->__thunkpos= yythunkpos486;
+  }  if (!yy_Nonspacechar(yy)) goto l481;
+  l482:;	
+  {  int yypos483= yy->__pos, yythunkpos483= yy->__thunkpos;
+  {  int yypos487= yy->__pos, yythunkpos487= yy->__thunkpos;  if (!yymatchChar(yy, '(')) goto l487;  goto l483;
+  l487:;	  yy->__pos= yypos487; yy->__thunkpos= yythunkpos487;
+  }
+  {  int yypos488= yy->__pos, yythunkpos488= yy->__thunkpos;  if (!yymatchChar(yy, ')')) goto l488;  goto l483;
+  l488:;	  yy->__pos= yypos488; yy->__thunkpos= yythunkpos488;
+  }
+  {  int yypos489= yy->__pos, yythunkpos489= yy->__thunkpos;  if (!yymatchChar(yy, '>')) goto l489;  goto l483;
+  l489:;	  yy->__pos= yypos489; yy->__thunkpos= yythunkpos489;
+  }  if (!yy_Nonspacechar(yy)) goto l483;  goto l482;
+  l483:;	  yy->__pos= yypos483; yy->__thunkpos= yythunkpos483;
+  }  goto l480;
+  l481:;	  yy->__pos= yypos480; yy->__thunkpos= yythunkpos480;  if (!yymatchChar(yy, '(')) goto l469;  if (!yy_SourceContents(yy)) goto l469;  if (!yymatchChar(yy, ')')) goto l469;
+  }
+  l480:;	  goto l468;
+  l469:;	  yy->__pos= yypos469; yy->__thunkpos= yythunkpos469;
+  }  goto l466;
+  l467:;	  yy->__pos= yypos466; yy->__thunkpos= yythunkpos466;  if (!yymatchString(yy, "")) goto l465;
+  }
+  l466:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "SourceContents", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l465:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "SourceContents", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_Title(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "Title"));
+  {  int yypos491= yy->__pos, yythunkpos491= yy->__thunkpos;  if (!yy_TitleSingle(yy)) goto l492;  goto l491;
+  l492:;	  yy->__pos= yypos491; yy->__thunkpos= yythunkpos491;  if (!yy_TitleDouble(yy)) goto l493;  goto l491;
+  l493:;	  yy->__pos= yypos491; yy->__thunkpos= yythunkpos491;  if (!(YY_BEGIN)) goto l490;  if (!yymatchString(yy, "")) goto l490;  if (!(YY_END)) goto l490;
+  }
+  l491:;	  yyDo(yy, yy_1_Title, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Title", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l490:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Title", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_Source(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "Source"));
+  {  int yypos495= yy->__pos, yythunkpos495= yy->__thunkpos;  if (!yymatchChar(yy, '<')) goto l496;  if (!(YY_BEGIN)) goto l496;  if (!yy_SourceContents(yy)) goto l496;  if (!(YY_END)) goto l496;  if (!yymatchChar(yy, '>')) goto l496;  goto l495;
+  l496:;	  yy->__pos= yypos495; yy->__thunkpos= yythunkpos495;  if (!(YY_BEGIN)) goto l494;  if (!yy_SourceContents(yy)) goto l494;  if (!(YY_END)) goto l494;
+  }
+  l495:;	  yyDo(yy, yy_1_Source, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Source", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l494:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Source", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_ReferenceLinkSingle(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;  yyDo(yy, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "ReferenceLinkSingle"));  if (!yy_Label(yy)) goto l497;  yyDo(yy, yySet, -1, 0);  if (!(YY_BEGIN)) goto l497;
+  {  int yypos498= yy->__pos, yythunkpos498= yy->__thunkpos;  if (!yy_Spnl(yy)) goto l498;  if (!yymatchString(yy, "[]")) goto l498;  goto l499;
+  l498:;	  yy->__pos= yypos498; yy->__thunkpos= yythunkpos498;
+  }
+  l499:;	  if (!(YY_END)) goto l497;  yyDo(yy, yy_1_ReferenceLinkSingle, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "ReferenceLinkSingle", yy->__buf+yy->__pos-yy->__base));  yyDo(yy, yyPop, 1, 0);
+  return 1;
+  l497:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "ReferenceLinkSingle", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_ReferenceLinkDouble(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;  yyDo(yy, yyPush, 2, 0);
+  yyprintf((stderr, "%s\n", "ReferenceLinkDouble"));  if (!yy_Label(yy)) goto l500;  yyDo(yy, yySet, -2, 0);  if (!(YY_BEGIN)) goto l500;  if (!yy_Spnl(yy)) goto l500;  if (!(YY_END)) goto l500;
+  {  int yypos501= yy->__pos, yythunkpos501= yy->__thunkpos;  if (!yymatchString(yy, "[]")) goto l501;  goto l500;
+  l501:;	  yy->__pos= yypos501; yy->__thunkpos= yythunkpos501;
+  }  if (!yy_Label(yy)) goto l500;  yyDo(yy, yySet, -1, 0);  yyDo(yy, yy_1_ReferenceLinkDouble, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "ReferenceLinkDouble", yy->__buf+yy->__pos-yy->__base));  yyDo(yy, yyPop, 2, 0);
+  return 1;
+  l500:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "ReferenceLinkDouble", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_AutoLink(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "AutoLink"));
+  {  int yypos503= yy->__pos, yythunkpos503= yy->__thunkpos;  if (!yy_AutoLinkUrl(yy)) goto l504;  goto l503;
+  l504:;	  yy->__pos= yypos503; yy->__thunkpos= yythunkpos503;  if (!yy_AutoLinkEmail(yy)) goto l502;
+  }
+  l503:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "AutoLink", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l502:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "AutoLink", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_ReferenceLink(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "ReferenceLink"));
+  {  int yypos506= yy->__pos, yythunkpos506= yy->__thunkpos;  if (!yy_ReferenceLinkDouble(yy)) goto l507;  goto l506;
+  l507:;	  yy->__pos= yypos506; yy->__thunkpos= yythunkpos506;  if (!yy_ReferenceLinkSingle(yy)) goto l505;
+  }
+  l506:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "ReferenceLink", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l505:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "ReferenceLink", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_ExplicitLink(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;  yyDo(yy, yyPush, 3, 0);
+  yyprintf((stderr, "%s\n", "ExplicitLink"));  if (!yy_Label(yy)) goto l508;  yyDo(yy, yySet, -3, 0);  if (!yy_Spnl(yy)) goto l508;  if (!yymatchChar(yy, '(')) goto l508;  if (!yy_Sp(yy)) goto l508;  if (!yy_Source(yy)) goto l508;  yyDo(yy, yySet, -2, 0);  if (!yy_Spnl(yy)) goto l508;  if (!yy_Title(yy)) goto l508;  yyDo(yy, yySet, -1, 0);  if (!yy_Sp(yy)) goto l508;  if (!yymatchChar(yy, ')')) goto l508;  yyDo(yy, yy_1_ExplicitLink, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "ExplicitLink", yy->__buf+yy->__pos-yy->__base));  yyDo(yy, yyPop, 3, 0);
+  return 1;
+  l508:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "ExplicitLink", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_TwoUlClose(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;  yyDo(yy, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "TwoUlClose"));
+  {  int yypos510= yy->__pos, yythunkpos510= yy->__thunkpos;  if (!yy_Spacechar(yy)) goto l510;  goto l509;
+  l510:;	  yy->__pos= yypos510; yy->__thunkpos= yythunkpos510;
+  }
+  {  int yypos511= yy->__pos, yythunkpos511= yy->__thunkpos;  if (!yy_Newline(yy)) goto l511;  goto l509;
+  l511:;	  yy->__pos= yypos511; yy->__thunkpos= yythunkpos511;
+  }  if (!yy_Inline(yy)) goto l509;  yyDo(yy, yySet, -1, 0);  if (!yymatchString(yy, "__")) goto l509;
+  {  int yypos512= yy->__pos, yythunkpos512= yy->__thunkpos;  if (!yy_Alphanumeric(yy)) goto l512;  goto l509;
+  l512:;	  yy->__pos= yypos512; yy->__thunkpos= yythunkpos512;
+  }  yyDo(yy, yy_1_TwoUlClose, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "TwoUlClose", yy->__buf+yy->__pos-yy->__base));  yyDo(yy, yyPop, 1, 0);
+  return 1;
+  l509:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "TwoUlClose", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_TwoUlOpen(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "TwoUlOpen"));
+  {  int yypos514= yy->__pos, yythunkpos514= yy->__thunkpos;  if (!yy_UlLine(yy)) goto l514;  goto l513;
+  l514:;	  yy->__pos= yypos514; yy->__thunkpos= yythunkpos514;
+  }  if (!yymatchString(yy, "__")) goto l513;
+  {  int yypos515= yy->__pos, yythunkpos515= yy->__thunkpos;  if (!yy_Spacechar(yy)) goto l515;  goto l513;
+  l515:;	  yy->__pos= yypos515; yy->__thunkpos= yythunkpos515;
+  }
+  {  int yypos516= yy->__pos, yythunkpos516= yy->__thunkpos;  if (!yy_Newline(yy)) goto l516;  goto l513;
+  l516:;	  yy->__pos= yypos516; yy->__thunkpos= yythunkpos516;
+  }
+  yyprintf((stderr, "  ok   %s @ %s\n", "TwoUlOpen", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l513:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "TwoUlOpen", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_TwoStarClose(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;  yyDo(yy, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "TwoStarClose"));
+  {  int yypos518= yy->__pos, yythunkpos518= yy->__thunkpos;  if (!yy_Spacechar(yy)) goto l518;  goto l517;
+  l518:;	  yy->__pos= yypos518; yy->__thunkpos= yythunkpos518;
+  }
+  {  int yypos519= yy->__pos, yythunkpos519= yy->__thunkpos;  if (!yy_Newline(yy)) goto l519;  goto l517;
+  l519:;	  yy->__pos= yypos519; yy->__thunkpos= yythunkpos519;
+  }  if (!yy_Inline(yy)) goto l517;  yyDo(yy, yySet, -1, 0);  if (!yymatchString(yy, "**")) goto l517;  yyDo(yy, yy_1_TwoStarClose, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "TwoStarClose", yy->__buf+yy->__pos-yy->__base));  yyDo(yy, yyPop, 1, 0);
+  return 1;
+  l517:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "TwoStarClose", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_TwoStarOpen(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "TwoStarOpen"));
+  {  int yypos521= yy->__pos, yythunkpos521= yy->__thunkpos;  if (!yy_StarLine(yy)) goto l521;  goto l520;
+  l521:;	  yy->__pos= yypos521; yy->__thunkpos= yythunkpos521;
+  }  if (!yymatchString(yy, "**")) goto l520;
+  {  int yypos522= yy->__pos, yythunkpos522= yy->__thunkpos;  if (!yy_Spacechar(yy)) goto l522;  goto l520;
+  l522:;	  yy->__pos= yypos522; yy->__thunkpos= yythunkpos522;
+  }
+  {  int yypos523= yy->__pos, yythunkpos523= yy->__thunkpos;  if (!yy_Newline(yy)) goto l523;  goto l520;
+  l523:;	  yy->__pos= yypos523; yy->__thunkpos= yythunkpos523;
+  }
+  yyprintf((stderr, "  ok   %s @ %s\n", "TwoStarOpen", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l520:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "TwoStarOpen", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_StrongUl(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;  yyDo(yy, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "StrongUl"));  if (!yy_TwoUlOpen(yy)) goto l524;  if (!yy_StartList(yy)) goto l524;  yyDo(yy, yySet, -1, 0);
+  l525:;	
+  {  int yypos526= yy->__pos, yythunkpos526= yy->__thunkpos;
+  {  int yypos527= yy->__pos, yythunkpos527= yy->__thunkpos;  if (!yy_TwoUlClose(yy)) goto l527;  goto l526;
+  l527:;	  yy->__pos= yypos527; yy->__thunkpos= yythunkpos527;
+  }  if (!yy_Inline(yy)) goto l526;  yyDo(yy, yy_1_StrongUl, yy->__begin, yy->__end);  goto l525;
+  l526:;	  yy->__pos= yypos526; yy->__thunkpos= yythunkpos526;
+  }  if (!yy_TwoUlClose(yy)) goto l524;  yyDo(yy, yy_2_StrongUl, yy->__begin, yy->__end);  yyDo(yy, yy_3_StrongUl, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "StrongUl", yy->__buf+yy->__pos-yy->__base));  yyDo(yy, yyPop, 1, 0);
+  return 1;
+  l524:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "StrongUl", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_OneUlClose(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;  yyDo(yy, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "OneUlClose"));
+  {  int yypos529= yy->__pos, yythunkpos529= yy->__thunkpos;  if (!yy_Spacechar(yy)) goto l529;  goto l528;
+  l529:;	  yy->__pos= yypos529; yy->__thunkpos= yythunkpos529;
+  }
+  {  int yypos530= yy->__pos, yythunkpos530= yy->__thunkpos;  if (!yy_Newline(yy)) goto l530;  goto l528;
+  l530:;	  yy->__pos= yypos530; yy->__thunkpos= yythunkpos530;
+  }  if (!yy_Inline(yy)) goto l528;  yyDo(yy, yySet, -1, 0);
+  {  int yypos531= yy->__pos, yythunkpos531= yy->__thunkpos;  if (!yy_StrongUl(yy)) goto l531;  goto l528;
+  l531:;	  yy->__pos= yypos531; yy->__thunkpos= yythunkpos531;
+  }  if (!yymatchChar(yy, '_')) goto l528;
+  {  int yypos532= yy->__pos, yythunkpos532= yy->__thunkpos;  if (!yy_Alphanumeric(yy)) goto l532;  goto l528;
+  l532:;	  yy->__pos= yypos532; yy->__thunkpos= yythunkpos532;
+  }  yyDo(yy, yy_1_OneUlClose, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "OneUlClose", yy->__buf+yy->__pos-yy->__base));  yyDo(yy, yyPop, 1, 0);
+  return 1;
+  l528:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "OneUlClose", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_OneUlOpen(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "OneUlOpen"));
+  {  int yypos534= yy->__pos, yythunkpos534= yy->__thunkpos;  if (!yy_UlLine(yy)) goto l534;  goto l533;
+  l534:;	  yy->__pos= yypos534; yy->__thunkpos= yythunkpos534;
+  }  if (!yymatchChar(yy, '_')) goto l533;
+  {  int yypos535= yy->__pos, yythunkpos535= yy->__thunkpos;  if (!yy_Spacechar(yy)) goto l535;  goto l533;
+  l535:;	  yy->__pos= yypos535; yy->__thunkpos= yythunkpos535;
+  }
+  {  int yypos536= yy->__pos, yythunkpos536= yy->__thunkpos;  if (!yy_Newline(yy)) goto l536;  goto l533;
+  l536:;	  yy->__pos= yypos536; yy->__thunkpos= yythunkpos536;
+  }
+  yyprintf((stderr, "  ok   %s @ %s\n", "OneUlOpen", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l533:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "OneUlOpen", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_StrongStar(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;  yyDo(yy, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "StrongStar"));  if (!yy_TwoStarOpen(yy)) goto l537;  if (!yy_StartList(yy)) goto l537;  yyDo(yy, yySet, -1, 0);
+  l538:;	
+  {  int yypos539= yy->__pos, yythunkpos539= yy->__thunkpos;
+  {  int yypos540= yy->__pos, yythunkpos540= yy->__thunkpos;  if (!yy_TwoStarClose(yy)) goto l540;  goto l539;
+  l540:;	  yy->__pos= yypos540; yy->__thunkpos= yythunkpos540;
+  }  if (!yy_Inline(yy)) goto l539;  yyDo(yy, yy_1_StrongStar, yy->__begin, yy->__end);  goto l538;
+  l539:;	  yy->__pos= yypos539; yy->__thunkpos= yythunkpos539;
+  }  if (!yy_TwoStarClose(yy)) goto l537;  yyDo(yy, yy_2_StrongStar, yy->__begin, yy->__end);  yyDo(yy, yy_3_StrongStar, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "StrongStar", yy->__buf+yy->__pos-yy->__base));  yyDo(yy, yyPop, 1, 0);
+  return 1;
+  l537:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "StrongStar", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_OneStarClose(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;  yyDo(yy, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "OneStarClose"));
+  {  int yypos542= yy->__pos, yythunkpos542= yy->__thunkpos;  if (!yy_Spacechar(yy)) goto l542;  goto l541;
+  l542:;	  yy->__pos= yypos542; yy->__thunkpos= yythunkpos542;
+  }
+  {  int yypos543= yy->__pos, yythunkpos543= yy->__thunkpos;  if (!yy_Newline(yy)) goto l543;  goto l541;
+  l543:;	  yy->__pos= yypos543; yy->__thunkpos= yythunkpos543;
+  }  if (!yy_Inline(yy)) goto l541;  yyDo(yy, yySet, -1, 0);
+  {  int yypos544= yy->__pos, yythunkpos544= yy->__thunkpos;  if (!yy_StrongStar(yy)) goto l544;  goto l541;
+  l544:;	  yy->__pos= yypos544; yy->__thunkpos= yythunkpos544;
+  }  if (!yymatchChar(yy, '*')) goto l541;  yyDo(yy, yy_1_OneStarClose, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "OneStarClose", yy->__buf+yy->__pos-yy->__base));  yyDo(yy, yyPop, 1, 0);
+  return 1;
+  l541:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "OneStarClose", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_OneStarOpen(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "OneStarOpen"));
+  {  int yypos546= yy->__pos, yythunkpos546= yy->__thunkpos;  if (!yy_StarLine(yy)) goto l546;  goto l545;
+  l546:;	  yy->__pos= yypos546; yy->__thunkpos= yythunkpos546;
+  }  if (!yymatchChar(yy, '*')) goto l545;
+  {  int yypos547= yy->__pos, yythunkpos547= yy->__thunkpos;  if (!yy_Spacechar(yy)) goto l547;  goto l545;
+  l547:;	  yy->__pos= yypos547; yy->__thunkpos= yythunkpos547;
+  }
+  {  int yypos548= yy->__pos, yythunkpos548= yy->__thunkpos;  if (!yy_Newline(yy)) goto l548;  goto l545;
+  l548:;	  yy->__pos= yypos548; yy->__thunkpos= yythunkpos548;
+  }
+  yyprintf((stderr, "  ok   %s @ %s\n", "OneStarOpen", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l545:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "OneStarOpen", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_EmphUl(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;  yyDo(yy, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "EmphUl"));  if (!yy_OneUlOpen(yy)) goto l549;  if (!yy_StartList(yy)) goto l549;  yyDo(yy, yySet, -1, 0);
+  l550:;	
+  {  int yypos551= yy->__pos, yythunkpos551= yy->__thunkpos;
+  {  int yypos552= yy->__pos, yythunkpos552= yy->__thunkpos;  if (!yy_OneUlClose(yy)) goto l552;  goto l551;
+  l552:;	  yy->__pos= yypos552; yy->__thunkpos= yythunkpos552;
+  }  if (!yy_Inline(yy)) goto l551;  yyDo(yy, yy_1_EmphUl, yy->__begin, yy->__end);  goto l550;
+  l551:;	  yy->__pos= yypos551; yy->__thunkpos= yythunkpos551;
+  }  if (!yy_OneUlClose(yy)) goto l549;  yyDo(yy, yy_2_EmphUl, yy->__begin, yy->__end);  yyDo(yy, yy_3_EmphUl, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "EmphUl", yy->__buf+yy->__pos-yy->__base));  yyDo(yy, yyPop, 1, 0);
+  return 1;
+  l549:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "EmphUl", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_EmphStar(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;  yyDo(yy, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "EmphStar"));  if (!yy_OneStarOpen(yy)) goto l553;  if (!yy_StartList(yy)) goto l553;  yyDo(yy, yySet, -1, 0);
+  l554:;	
+  {  int yypos555= yy->__pos, yythunkpos555= yy->__thunkpos;
+  {  int yypos556= yy->__pos, yythunkpos556= yy->__thunkpos;  if (!yy_OneStarClose(yy)) goto l556;  goto l555;
+  l556:;	  yy->__pos= yypos556; yy->__thunkpos= yythunkpos556;
+  }  if (!yy_Inline(yy)) goto l555;  yyDo(yy, yy_1_EmphStar, yy->__begin, yy->__end);  goto l554;
+  l555:;	  yy->__pos= yypos555; yy->__thunkpos= yythunkpos555;
+  }  if (!yy_OneStarClose(yy)) goto l553;  yyDo(yy, yy_2_EmphStar, yy->__begin, yy->__end);  yyDo(yy, yy_3_EmphStar, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "EmphStar", yy->__buf+yy->__pos-yy->__base));  yyDo(yy, yyPop, 1, 0);
+  return 1;
+  l553:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "EmphStar", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_StarLine(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "StarLine"));
+  {  int yypos558= yy->__pos, yythunkpos558= yy->__thunkpos;  if (!(YY_BEGIN)) goto l559;  if (!yymatchString(yy, "****")) goto l559;
+  l560:;	
+  {  int yypos561= yy->__pos, yythunkpos561= yy->__thunkpos;  if (!yymatchChar(yy, '*')) goto l561;  goto l560;
+  l561:;	  yy->__pos= yypos561; yy->__thunkpos= yythunkpos561;
+  }  if (!(YY_END)) goto l559;  goto l558;
+  l559:;	  yy->__pos= yypos558; yy->__thunkpos= yythunkpos558;  if (!(YY_BEGIN)) goto l557;  if (!yy_Spacechar(yy)) goto l557;  if (!yymatchChar(yy, '*')) goto l557;
+  l562:;	
+  {  int yypos563= yy->__pos, yythunkpos563= yy->__thunkpos;  if (!yymatchChar(yy, '*')) goto l563;  goto l562;
+  l563:;	  yy->__pos= yypos563; yy->__thunkpos= yythunkpos563;
+  }
+  {  int yypos564= yy->__pos, yythunkpos564= yy->__thunkpos;  if (!yy_Spacechar(yy)) goto l557;  yy->__pos= yypos564; yy->__thunkpos= yythunkpos564;
+  }  if (!(YY_END)) goto l557;
+  }
+  l558:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "StarLine", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l557:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "StarLine", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_UlLine(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "UlLine"));
+  {  int yypos566= yy->__pos, yythunkpos566= yy->__thunkpos;  if (!(YY_BEGIN)) goto l567;  if (!yymatchString(yy, "____")) goto l567;
+  l568:;	
+  {  int yypos569= yy->__pos, yythunkpos569= yy->__thunkpos;  if (!yymatchChar(yy, '_')) goto l569;  goto l568;
+  l569:;	  yy->__pos= yypos569; yy->__thunkpos= yythunkpos569;
+  }  if (!(YY_END)) goto l567;  goto l566;
+  l567:;	  yy->__pos= yypos566; yy->__thunkpos= yythunkpos566;  if (!(YY_BEGIN)) goto l565;  if (!yy_Spacechar(yy)) goto l565;  if (!yymatchChar(yy, '_')) goto l565;
+  l570:;	
+  {  int yypos571= yy->__pos, yythunkpos571= yy->__thunkpos;  if (!yymatchChar(yy, '_')) goto l571;  goto l570;
+  l571:;	  yy->__pos= yypos571; yy->__thunkpos= yythunkpos571;
+  }
+  {  int yypos572= yy->__pos, yythunkpos572= yy->__thunkpos;  if (!yy_Spacechar(yy)) goto l565;  yy->__pos= yypos572; yy->__thunkpos= yythunkpos572;
+  }  if (!(YY_END)) goto l565;
+  }
+  l566:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "UlLine", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l565:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "UlLine", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_SpecialChar(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "SpecialChar"));
+  {  int yypos574= yy->__pos, yythunkpos574= yy->__thunkpos;  if (!yymatchChar(yy, '*')) goto l575;  goto l574;
+  l575:;	  yy->__pos= yypos574; yy->__thunkpos= yythunkpos574;  if (!yymatchChar(yy, '_')) goto l576;  goto l574;
+  l576:;	  yy->__pos= yypos574; yy->__thunkpos= yythunkpos574;  if (!yymatchChar(yy, '`')) goto l577;  goto l574;
+  l577:;	  yy->__pos= yypos574; yy->__thunkpos= yythunkpos574;  if (!yymatchChar(yy, '&')) goto l578;  goto l574;
+  l578:;	  yy->__pos= yypos574; yy->__thunkpos= yythunkpos574;  if (!yymatchChar(yy, '[')) goto l579;  goto l574;
+  l579:;	  yy->__pos= yypos574; yy->__thunkpos= yythunkpos574;  if (!yymatchChar(yy, ']')) goto l580;  goto l574;
+  l580:;	  yy->__pos= yypos574; yy->__thunkpos= yythunkpos574;  if (!yymatchChar(yy, '(')) goto l581;  goto l574;
+  l581:;	  yy->__pos= yypos574; yy->__thunkpos= yythunkpos574;  if (!yymatchChar(yy, ')')) goto l582;  goto l574;
+  l582:;	  yy->__pos= yypos574; yy->__thunkpos= yythunkpos574;  if (!yymatchChar(yy, '<')) goto l583;  goto l574;
+  l583:;	  yy->__pos= yypos574; yy->__thunkpos= yythunkpos574;  if (!yymatchChar(yy, '!')) goto l584;  goto l574;
+  l584:;	  yy->__pos= yypos574; yy->__thunkpos= yythunkpos574;  if (!yymatchChar(yy, '#')) goto l585;  goto l574;
+  l585:;	  yy->__pos= yypos574; yy->__thunkpos= yythunkpos574;  if (!yymatchChar(yy, '\\')) goto l586;  goto l574;
+  l586:;	  yy->__pos= yypos574; yy->__thunkpos= yythunkpos574;  if (!yymatchChar(yy, '\'')) goto l587;  goto l574;
+  l587:;	  yy->__pos= yypos574; yy->__thunkpos= yythunkpos574;  if (!yymatchChar(yy, '"')) goto l588;  goto l574;
+  l588:;	  yy->__pos= yypos574; yy->__thunkpos= yythunkpos574;  if (!yy_ExtendedSpecialChar(yy)) goto l573;
+  }
+  l574:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "SpecialChar", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l573:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "SpecialChar", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_Eof(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "Eof"));
+  {  int yypos590= yy->__pos, yythunkpos590= yy->__thunkpos;  if (!yymatchDot(yy)) goto l590;  goto l589;
+  l590:;	  yy->__pos= yypos590; yy->__thunkpos= yythunkpos590;
+  }
+  yyprintf((stderr, "  ok   %s @ %s\n", "Eof", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l589:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Eof", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_NormalEndline(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "NormalEndline"));  if (!yy_Sp(yy)) goto l591;  if (!yy_Newline(yy)) goto l591;
+  {  int yypos592= yy->__pos, yythunkpos592= yy->__thunkpos;  if (!yy_BlankLine(yy)) goto l592;  goto l591;
+  l592:;	  yy->__pos= yypos592; yy->__thunkpos= yythunkpos592;
+  }
+  {  int yypos593= yy->__pos, yythunkpos593= yy->__thunkpos;  if (!yymatchChar(yy, '>')) goto l593;  goto l591;
+  l593:;	  yy->__pos= yypos593; yy->__thunkpos= yythunkpos593;
+  }
+  {  int yypos594= yy->__pos, yythunkpos594= yy->__thunkpos;  if (!yy_AtxStart(yy)) goto l594;  goto l591;
+  l594:;	  yy->__pos= yypos594; yy->__thunkpos= yythunkpos594;
+  }
+  {  int yypos595= yy->__pos, yythunkpos595= yy->__thunkpos;  if (!yy_Line(yy)) goto l595;
+  {  int yypos596= yy->__pos, yythunkpos596= yy->__thunkpos;  if (!yymatchString(yy, "===")) goto l597;
+  l598:;	
+  {  int yypos599= yy->__pos, yythunkpos599= yy->__thunkpos;  if (!yymatchChar(yy, '=')) goto l599;  goto l598;
+  l599:;	  yy->__pos= yypos599; yy->__thunkpos= yythunkpos599;
+  }  goto l596;
+  l597:;	  yy->__pos= yypos596; yy->__thunkpos= yythunkpos596;  if (!yymatchString(yy, "---")) goto l595;
+  l600:;	
+  {  int yypos601= yy->__pos, yythunkpos601= yy->__thunkpos;  if (!yymatchChar(yy, '-')) goto l601;  goto l600;
+  l601:;	  yy->__pos= yypos601; yy->__thunkpos= yythunkpos601;
+  }
+  }
+  l596:;	  if (!yy_Newline(yy)) goto l595;  goto l591;
+  l595:;	  yy->__pos= yypos595; yy->__thunkpos= yythunkpos595;
+  }  yyDo(yy, yy_1_NormalEndline, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "NormalEndline", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l591:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "NormalEndline", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_TerminalEndline(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "TerminalEndline"));  if (!yy_Sp(yy)) goto l602;  if (!yy_Newline(yy)) goto l602;  if (!yy_Eof(yy)) goto l602;  yyDo(yy, yy_1_TerminalEndline, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "TerminalEndline", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l602:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "TerminalEndline", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_LineBreak(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "LineBreak"));  if (!yymatchString(yy, "  ")) goto l603;  if (!yy_NormalEndline(yy)) goto l603;  yyDo(yy, yy_1_LineBreak, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "LineBreak", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l603:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "LineBreak", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_CharEntity(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "CharEntity"));  if (!(YY_BEGIN)) goto l604;  if (!yymatchChar(yy, '&')) goto l604;  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\000\000\377\003\376\377\377\007\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l604;
+  l605:;	
+  {  int yypos606= yy->__pos, yythunkpos606= yy->__thunkpos;  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\000\000\377\003\376\377\377\007\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l606;  goto l605;
+  l606:;	  yy->__pos= yypos606; yy->__thunkpos= yythunkpos606;
+  }  if (!yymatchChar(yy, ';')) goto l604;  if (!(YY_END)) goto l604;
+  yyprintf((stderr, "  ok   %s @ %s\n", "CharEntity", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l604:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "CharEntity", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_DecEntity(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "DecEntity"));  if (!(YY_BEGIN)) goto l607;  if (!yymatchChar(yy, '&')) goto l607;  if (!yymatchChar(yy, '#')) goto l607;  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\000\000\377\003\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l607;
+  l608:;	
+  {  int yypos609= yy->__pos, yythunkpos609= yy->__thunkpos;  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\000\000\377\003\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l609;  goto l608;
+  l609:;	  yy->__pos= yypos609; yy->__thunkpos= yythunkpos609;
+  }  if (!(YY_END)) goto l607;  if (!yymatchChar(yy, ';')) goto l607;  if (!(YY_END)) goto l607;
+  yyprintf((stderr, "  ok   %s @ %s\n", "DecEntity", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l607:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "DecEntity", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HexEntity(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HexEntity"));  if (!(YY_BEGIN)) goto l610;  if (!yymatchChar(yy, '&')) goto l610;  if (!yymatchChar(yy, '#')) goto l610;  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\000\000\000\000\000\000\000\001\000\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l610;  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\000\000\377\003\176\000\000\000\176\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l610;
+  l611:;	
+  {  int yypos612= yy->__pos, yythunkpos612= yy->__thunkpos;  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\000\000\377\003\176\000\000\000\176\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l612;  goto l611;
+  l612:;	  yy->__pos= yypos612; yy->__thunkpos= yythunkpos612;
+  }  if (!yymatchChar(yy, ';')) goto l610;  if (!(YY_END)) goto l610;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HexEntity", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l610:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HexEntity", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_AposChunk(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "AposChunk"));  if (!( extension(yy->parser, EXT_SMART) )) goto l613;  if (!yymatchChar(yy, '\'')) goto l613;
+  {  int yypos614= yy->__pos, yythunkpos614= yy->__thunkpos;  if (!yy_Alphanumeric(yy)) goto l613;  yy->__pos= yypos614; yy->__thunkpos= yythunkpos614;
+  }  yyDo(yy, yy_1_AposChunk, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "AposChunk", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l613:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "AposChunk", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_Alphanumeric(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "Alphanumeric"));
+  {  int yypos616= yy->__pos, yythunkpos616= yy->__thunkpos;  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\000\000\377\003\376\377\377\007\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l617;  goto l616;
+  l617:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\200")) goto l618;  goto l616;
+  l618:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\201")) goto l619;  goto l616;
+  l619:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\202")) goto l620;  goto l616;
+  l620:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\203")) goto l621;  goto l616;
+  l621:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\204")) goto l622;  goto l616;
+  l622:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\205")) goto l623;  goto l616;
+  l623:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\206")) goto l624;  goto l616;
+  l624:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\207")) goto l625;  goto l616;
+  l625:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\210")) goto l626;  goto l616;
+  l626:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\211")) goto l627;  goto l616;
+  l627:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\212")) goto l628;  goto l616;
+  l628:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\213")) goto l629;  goto l616;
+  l629:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\214")) goto l630;  goto l616;
+  l630:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\215")) goto l631;  goto l616;
+  l631:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\216")) goto l632;  goto l616;
+  l632:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\217")) goto l633;  goto l616;
+  l633:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\220")) goto l634;  goto l616;
+  l634:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\221")) goto l635;  goto l616;
+  l635:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\222")) goto l636;  goto l616;
+  l636:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\223")) goto l637;  goto l616;
+  l637:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\224")) goto l638;  goto l616;
+  l638:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\225")) goto l639;  goto l616;
+  l639:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\226")) goto l640;  goto l616;
+  l640:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\227")) goto l641;  goto l616;
+  l641:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\230")) goto l642;  goto l616;
+  l642:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\231")) goto l643;  goto l616;
+  l643:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\232")) goto l644;  goto l616;
+  l644:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\233")) goto l645;  goto l616;
+  l645:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\234")) goto l646;  goto l616;
+  l646:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\235")) goto l647;  goto l616;
+  l647:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\236")) goto l648;  goto l616;
+  l648:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\237")) goto l649;  goto l616;
+  l649:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\240")) goto l650;  goto l616;
+  l650:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\241")) goto l651;  goto l616;
+  l651:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\242")) goto l652;  goto l616;
+  l652:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\243")) goto l653;  goto l616;
+  l653:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\244")) goto l654;  goto l616;
+  l654:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\245")) goto l655;  goto l616;
+  l655:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\246")) goto l656;  goto l616;
+  l656:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\247")) goto l657;  goto l616;
+  l657:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\250")) goto l658;  goto l616;
+  l658:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\251")) goto l659;  goto l616;
+  l659:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\252")) goto l660;  goto l616;
+  l660:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\253")) goto l661;  goto l616;
+  l661:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\254")) goto l662;  goto l616;
+  l662:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\255")) goto l663;  goto l616;
+  l663:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\256")) goto l664;  goto l616;
+  l664:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\257")) goto l665;  goto l616;
+  l665:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\260")) goto l666;  goto l616;
+  l666:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\261")) goto l667;  goto l616;
+  l667:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\262")) goto l668;  goto l616;
+  l668:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\263")) goto l669;  goto l616;
+  l669:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\264")) goto l670;  goto l616;
+  l670:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\265")) goto l671;  goto l616;
+  l671:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\266")) goto l672;  goto l616;
+  l672:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\267")) goto l673;  goto l616;
+  l673:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\270")) goto l674;  goto l616;
+  l674:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\271")) goto l675;  goto l616;
+  l675:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\272")) goto l676;  goto l616;
+  l676:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\273")) goto l677;  goto l616;
+  l677:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\274")) goto l678;  goto l616;
+  l678:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\275")) goto l679;  goto l616;
+  l679:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\276")) goto l680;  goto l616;
+  l680:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\277")) goto l681;  goto l616;
+  l681:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\300")) goto l682;  goto l616;
+  l682:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\301")) goto l683;  goto l616;
+  l683:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\302")) goto l684;  goto l616;
+  l684:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\303")) goto l685;  goto l616;
+  l685:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\304")) goto l686;  goto l616;
+  l686:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\305")) goto l687;  goto l616;
+  l687:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\306")) goto l688;  goto l616;
+  l688:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\307")) goto l689;  goto l616;
+  l689:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\310")) goto l690;  goto l616;
+  l690:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\311")) goto l691;  goto l616;
+  l691:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\312")) goto l692;  goto l616;
+  l692:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\313")) goto l693;  goto l616;
+  l693:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\314")) goto l694;  goto l616;
+  l694:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\315")) goto l695;  goto l616;
+  l695:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\316")) goto l696;  goto l616;
+  l696:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\317")) goto l697;  goto l616;
+  l697:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\320")) goto l698;  goto l616;
+  l698:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\321")) goto l699;  goto l616;
+  l699:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\322")) goto l700;  goto l616;
+  l700:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\323")) goto l701;  goto l616;
+  l701:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\324")) goto l702;  goto l616;
+  l702:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\325")) goto l703;  goto l616;
+  l703:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\326")) goto l704;  goto l616;
+  l704:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\327")) goto l705;  goto l616;
+  l705:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\330")) goto l706;  goto l616;
+  l706:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\331")) goto l707;  goto l616;
+  l707:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\332")) goto l708;  goto l616;
+  l708:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\333")) goto l709;  goto l616;
+  l709:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\334")) goto l710;  goto l616;
+  l710:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\335")) goto l711;  goto l616;
+  l711:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\336")) goto l712;  goto l616;
+  l712:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\337")) goto l713;  goto l616;
+  l713:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\340")) goto l714;  goto l616;
+  l714:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\341")) goto l715;  goto l616;
+  l715:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\342")) goto l716;  goto l616;
+  l716:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\343")) goto l717;  goto l616;
+  l717:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\344")) goto l718;  goto l616;
+  l718:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\345")) goto l719;  goto l616;
+  l719:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\346")) goto l720;  goto l616;
+  l720:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\347")) goto l721;  goto l616;
+  l721:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\350")) goto l722;  goto l616;
+  l722:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\351")) goto l723;  goto l616;
+  l723:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\352")) goto l724;  goto l616;
+  l724:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\353")) goto l725;  goto l616;
+  l725:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\354")) goto l726;  goto l616;
+  l726:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\355")) goto l727;  goto l616;
+  l727:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\356")) goto l728;  goto l616;
+  l728:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\357")) goto l729;  goto l616;
+  l729:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\360")) goto l730;  goto l616;
+  l730:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\361")) goto l731;  goto l616;
+  l731:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\362")) goto l732;  goto l616;
+  l732:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\363")) goto l733;  goto l616;
+  l733:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\364")) goto l734;  goto l616;
+  l734:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\365")) goto l735;  goto l616;
+  l735:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\366")) goto l736;  goto l616;
+  l736:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\367")) goto l737;  goto l616;
+  l737:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\370")) goto l738;  goto l616;
+  l738:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\371")) goto l739;  goto l616;
+  l739:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\372")) goto l740;  goto l616;
+  l740:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\373")) goto l741;  goto l616;
+  l741:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\374")) goto l742;  goto l616;
+  l742:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\375")) goto l743;  goto l616;
+  l743:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\376")) goto l744;  goto l616;
+  l744:;	  yy->__pos= yypos616; yy->__thunkpos= yythunkpos616;  if (!yymatchString(yy, "\377")) goto l615;
+  }
+  l616:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "Alphanumeric", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l615:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Alphanumeric", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_StrChunk(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "StrChunk"));
+  {  int yypos746= yy->__pos, yythunkpos746= yy->__thunkpos;  if (!(YY_BEGIN)) goto l747;
+  {  int yypos750= yy->__pos, yythunkpos750= yy->__thunkpos;  if (!yy_NormalChar(yy)) goto l751;  goto l750;
+  l751:;	  yy->__pos= yypos750; yy->__thunkpos= yythunkpos750;  if (!yymatchChar(yy, '_')) goto l747;
+  l752:;	
+  {  int yypos753= yy->__pos, yythunkpos753= yy->__thunkpos;  if (!yymatchChar(yy, '_')) goto l753;  goto l752;
+  l753:;	  yy->__pos= yypos753; yy->__thunkpos= yythunkpos753;
+  }
+  {  int yypos754= yy->__pos, yythunkpos754= yy->__thunkpos;  if (!yy_Alphanumeric(yy)) goto l747;  yy->__pos= yypos754; yy->__thunkpos= yythunkpos754;
+  }
+  }
+  l750:;	
+  l748:;	
+  {  int yypos749= yy->__pos, yythunkpos749= yy->__thunkpos;
+  {  int yypos755= yy->__pos, yythunkpos755= yy->__thunkpos;  if (!yy_NormalChar(yy)) goto l756;  goto l755;
+  l756:;	  yy->__pos= yypos755; yy->__thunkpos= yythunkpos755;  if (!yymatchChar(yy, '_')) goto l749;
+  l757:;	
+  {  int yypos758= yy->__pos, yythunkpos758= yy->__thunkpos;  if (!yymatchChar(yy, '_')) goto l758;  goto l757;
+  l758:;	  yy->__pos= yypos758; yy->__thunkpos= yythunkpos758;
+  }
+  {  int yypos759= yy->__pos, yythunkpos759= yy->__thunkpos;  if (!yy_Alphanumeric(yy)) goto l749;  yy->__pos= yypos759; yy->__thunkpos= yythunkpos759;
+  }
+  }
+  l755:;	  goto l748;
+  l749:;	  yy->__pos= yypos749; yy->__thunkpos= yythunkpos749;
+  }  if (!(YY_END)) goto l747;  yyDo(yy, yy_1_StrChunk, yy->__begin, yy->__end);  goto l746;
+  l747:;	  yy->__pos= yypos746; yy->__thunkpos= yythunkpos746;  if (!yy_AposChunk(yy)) goto l745;
+  }
+  l746:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "StrChunk", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l745:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "StrChunk", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_NormalChar(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "NormalChar"));
+  {  int yypos761= yy->__pos, yythunkpos761= yy->__thunkpos;
+  {  int yypos762= yy->__pos, yythunkpos762= yy->__thunkpos;  if (!yy_SpecialChar(yy)) goto l763;  goto l762;
+  l763:;	  yy->__pos= yypos762; yy->__thunkpos= yythunkpos762;  if (!yy_Spacechar(yy)) goto l764;  goto l762;
+  l764:;	  yy->__pos= yypos762; yy->__thunkpos= yythunkpos762;  if (!yy_Newline(yy)) goto l761;
+  }
+  l762:;	  goto l760;
+  l761:;	  yy->__pos= yypos761; yy->__thunkpos= yythunkpos761;
+  }  if (!yymatchDot(yy)) goto l760;
+  yyprintf((stderr, "  ok   %s @ %s\n", "NormalChar", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l760:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "NormalChar", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_Symbol(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "Symbol"));  if (!(YY_BEGIN)) goto l765;  if (!yy_SpecialChar(yy)) goto l765;  if (!(YY_END)) goto l765;  yyDo(yy, yy_1_Symbol, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Symbol", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l765:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Symbol", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_Smart(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "Smart"));  if (!( extension(yy->parser, EXT_SMART) )) goto l766;
+  {  int yypos767= yy->__pos, yythunkpos767= yy->__thunkpos;  if (!yy_Ellipsis(yy)) goto l768;  goto l767;
+  l768:;	  yy->__pos= yypos767; yy->__thunkpos= yythunkpos767;  if (!yy_Dash(yy)) goto l769;  goto l767;
+  l769:;	  yy->__pos= yypos767; yy->__thunkpos= yythunkpos767;  if (!yy_SingleQuoted(yy)) goto l770;  goto l767;
+  l770:;	  yy->__pos= yypos767; yy->__thunkpos= yythunkpos767;  if (!yy_DoubleQuoted(yy)) goto l771;  goto l767;
+  l771:;	  yy->__pos= yypos767; yy->__thunkpos= yythunkpos767;  if (!yy_Apostrophe(yy)) goto l766;
+  }
+  l767:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "Smart", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l766:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Smart", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_EscapedChar(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "EscapedChar"));  if (!yymatchChar(yy, '\\')) goto l772;
+  {  int yypos773= yy->__pos, yythunkpos773= yy->__thunkpos;  if (!yy_Newline(yy)) goto l773;  goto l772;
+  l773:;	  yy->__pos= yypos773; yy->__thunkpos= yythunkpos773;
+  }  if (!(YY_BEGIN)) goto l772;  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\012\157\000\120\000\000\000\270\001\000\000\070\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l772;  if (!(YY_END)) goto l772;  yyDo(yy, yy_1_EscapedChar, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "EscapedChar", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l772:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "EscapedChar", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_Entity(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "Entity"));
+  {  int yypos775= yy->__pos, yythunkpos775= yy->__thunkpos;  if (!yy_HexEntity(yy)) goto l776;  goto l775;
+  l776:;	  yy->__pos= yypos775; yy->__thunkpos= yythunkpos775;  if (!yy_DecEntity(yy)) goto l777;  goto l775;
+  l777:;	  yy->__pos= yypos775; yy->__thunkpos= yythunkpos775;  if (!yy_CharEntity(yy)) goto l774;
+  }
+  l775:;	  yyDo(yy, yy_1_Entity, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Entity", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l774:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Entity", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_RawHtml(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "RawHtml"));  if (!(YY_BEGIN)) goto l778;
+  {  int yypos779= yy->__pos, yythunkpos779= yy->__thunkpos;  if (!yy_HtmlComment(yy)) goto l780;  goto l779;
+  l780:;	  yy->__pos= yypos779; yy->__thunkpos= yythunkpos779;  if (!yy_HtmlBlockScript(yy)) goto l781;  goto l779;
+  l781:;	  yy->__pos= yypos779; yy->__thunkpos= yythunkpos779;  if (!yy_HtmlTag(yy)) goto l778;
+  }
+  l779:;	  if (!(YY_END)) goto l778;  yyDo(yy, yy_1_RawHtml, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "RawHtml", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l778:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "RawHtml", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_Code(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "Code"));
+  {  int yypos783= yy->__pos, yythunkpos783= yy->__thunkpos;  if (!yy_Ticks1(yy)) goto l784;  if (!yy_Sp(yy)) goto l784;  if (!(YY_BEGIN)) goto l784;
+  {  int yypos787= yy->__pos, yythunkpos787= yy->__thunkpos;
+  {  int yypos791= yy->__pos, yythunkpos791= yy->__thunkpos;  if (!yymatchChar(yy, '`')) goto l791;  goto l788;
+  l791:;	  yy->__pos= yypos791; yy->__thunkpos= yythunkpos791;
+  }  if (!yy_Nonspacechar(yy)) goto l788;
+  l789:;	
+  {  int yypos790= yy->__pos, yythunkpos790= yy->__thunkpos;
+  {  int yypos792= yy->__pos, yythunkpos792= yy->__thunkpos;  if (!yymatchChar(yy, '`')) goto l792;  goto l790;
+  l792:;	  yy->__pos= yypos792; yy->__thunkpos= yythunkpos792;
+  }  if (!yy_Nonspacechar(yy)) goto l790;  goto l789;
+  l790:;	  yy->__pos= yypos790; yy->__thunkpos= yythunkpos790;
+  }  goto l787;
+  l788:;	  yy->__pos= yypos787; yy->__thunkpos= yythunkpos787;
+  {  int yypos794= yy->__pos, yythunkpos794= yy->__thunkpos;  if (!yy_Ticks1(yy)) goto l794;  goto l793;
+  l794:;	  yy->__pos= yypos794; yy->__thunkpos= yythunkpos794;
+  }  if (!yymatchChar(yy, '`')) goto l793;
+  l795:;	
+  {  int yypos796= yy->__pos, yythunkpos796= yy->__thunkpos;  if (!yymatchChar(yy, '`')) goto l796;  goto l795;
+  l796:;	  yy->__pos= yypos796; yy->__thunkpos= yythunkpos796;
+  }  goto l787;
+  l793:;	  yy->__pos= yypos787; yy->__thunkpos= yythunkpos787;
+  {  int yypos797= yy->__pos, yythunkpos797= yy->__thunkpos;  if (!yy_Sp(yy)) goto l797;  if (!yy_Ticks1(yy)) goto l797;  goto l784;
+  l797:;	  yy->__pos= yypos797; yy->__thunkpos= yythunkpos797;
+  }
+  {  int yypos798= yy->__pos, yythunkpos798= yy->__thunkpos;  if (!yy_Spacechar(yy)) goto l799;  goto l798;
+  l799:;	  yy->__pos= yypos798; yy->__thunkpos= yythunkpos798;  if (!yy_Newline(yy)) goto l784;
+  {  int yypos800= yy->__pos, yythunkpos800= yy->__thunkpos;  if (!yy_BlankLine(yy)) goto l800;  goto l784;
+  l800:;	  yy->__pos= yypos800; yy->__thunkpos= yythunkpos800;
+  }
+  }
+  l798:;	
+  }
+  l787:;	
+  l785:;	
+  {  int yypos786= yy->__pos, yythunkpos786= yy->__thunkpos;
+  {  int yypos801= yy->__pos, yythunkpos801= yy->__thunkpos;
+  {  int yypos805= yy->__pos, yythunkpos805= yy->__thunkpos;  if (!yymatchChar(yy, '`')) goto l805;  goto l802;
+  l805:;	  yy->__pos= yypos805; yy->__thunkpos= yythunkpos805;
+  }  if (!yy_Nonspacechar(yy)) goto l802;
+  l803:;	
+  {  int yypos804= yy->__pos, yythunkpos804= yy->__thunkpos;
+  {  int yypos806= yy->__pos, yythunkpos806= yy->__thunkpos;  if (!yymatchChar(yy, '`')) goto l806;  goto l804;
+  l806:;	  yy->__pos= yypos806; yy->__thunkpos= yythunkpos806;
+  }  if (!yy_Nonspacechar(yy)) goto l804;  goto l803;
+  l804:;	  yy->__pos= yypos804; yy->__thunkpos= yythunkpos804;
+  }  goto l801;
+  l802:;	  yy->__pos= yypos801; yy->__thunkpos= yythunkpos801;
+  {  int yypos808= yy->__pos, yythunkpos808= yy->__thunkpos;  if (!yy_Ticks1(yy)) goto l808;  goto l807;
+  l808:;	  yy->__pos= yypos808; yy->__thunkpos= yythunkpos808;
+  }  if (!yymatchChar(yy, '`')) goto l807;
+  l809:;	
+  {  int yypos810= yy->__pos, yythunkpos810= yy->__thunkpos;  if (!yymatchChar(yy, '`')) goto l810;  goto l809;
+  l810:;	  yy->__pos= yypos810; yy->__thunkpos= yythunkpos810;
+  }  goto l801;
+  l807:;	  yy->__pos= yypos801; yy->__thunkpos= yythunkpos801;
+  {  int yypos811= yy->__pos, yythunkpos811= yy->__thunkpos;  if (!yy_Sp(yy)) goto l811;  if (!yy_Ticks1(yy)) goto l811;  goto l786;
+  l811:;	  yy->__pos= yypos811; yy->__thunkpos= yythunkpos811;
+  }
+  {  int yypos812= yy->__pos, yythunkpos812= yy->__thunkpos;  if (!yy_Spacechar(yy)) goto l813;  goto l812;
+  l813:;	  yy->__pos= yypos812; yy->__thunkpos= yythunkpos812;  if (!yy_Newline(yy)) goto l786;
+  {  int yypos814= yy->__pos, yythunkpos814= yy->__thunkpos;  if (!yy_BlankLine(yy)) goto l814;  goto l786;
+  l814:;	  yy->__pos= yypos814; yy->__thunkpos= yythunkpos814;
+  }
+  }
+  l812:;	
+  }
+  l801:;	  goto l785;
+  l786:;	  yy->__pos= yypos786; yy->__thunkpos= yythunkpos786;
+  }  if (!(YY_END)) goto l784;  if (!yy_Sp(yy)) goto l784;  if (!yy_Ticks1(yy)) goto l784;  goto l783;
+  l784:;	  yy->__pos= yypos783; yy->__thunkpos= yythunkpos783;  if (!yy_Ticks2(yy)) goto l815;  if (!yy_Sp(yy)) goto l815;  if (!(YY_BEGIN)) goto l815;
+  {  int yypos818= yy->__pos, yythunkpos818= yy->__thunkpos;
+  {  int yypos822= yy->__pos, yythunkpos822= yy->__thunkpos;  if (!yymatchChar(yy, '`')) goto l822;  goto l819;
+  l822:;	  yy->__pos= yypos822; yy->__thunkpos= yythunkpos822;
+  }  if (!yy_Nonspacechar(yy)) goto l819;
+  l820:;	
+  {  int yypos821= yy->__pos, yythunkpos821= yy->__thunkpos;
+  {  int yypos823= yy->__pos, yythunkpos823= yy->__thunkpos;  if (!yymatchChar(yy, '`')) goto l823;  goto l821;
+  l823:;	  yy->__pos= yypos823; yy->__thunkpos= yythunkpos823;
+  }  if (!yy_Nonspacechar(yy)) goto l821;  goto l820;
+  l821:;	  yy->__pos= yypos821; yy->__thunkpos= yythunkpos821;
+  }  goto l818;
+  l819:;	  yy->__pos= yypos818; yy->__thunkpos= yythunkpos818;
+  {  int yypos825= yy->__pos, yythunkpos825= yy->__thunkpos;  if (!yy_Ticks2(yy)) goto l825;  goto l824;
+  l825:;	  yy->__pos= yypos825; yy->__thunkpos= yythunkpos825;
+  }  if (!yymatchChar(yy, '`')) goto l824;
+  l826:;	
+  {  int yypos827= yy->__pos, yythunkpos827= yy->__thunkpos;  if (!yymatchChar(yy, '`')) goto l827;  goto l826;
+  l827:;	  yy->__pos= yypos827; yy->__thunkpos= yythunkpos827;
+  }  goto l818;
+  l824:;	  yy->__pos= yypos818; yy->__thunkpos= yythunkpos818;
+  {  int yypos828= yy->__pos, yythunkpos828= yy->__thunkpos;  if (!yy_Sp(yy)) goto l828;  if (!yy_Ticks2(yy)) goto l828;  goto l815;
+  l828:;	  yy->__pos= yypos828; yy->__thunkpos= yythunkpos828;
+  }
+  {  int yypos829= yy->__pos, yythunkpos829= yy->__thunkpos;  if (!yy_Spacechar(yy)) goto l830;  goto l829;
+  l830:;	  yy->__pos= yypos829; yy->__thunkpos= yythunkpos829;  if (!yy_Newline(yy)) goto l815;
+  {  int yypos831= yy->__pos, yythunkpos831= yy->__thunkpos;  if (!yy_BlankLine(yy)) goto l831;  goto l815;
+  l831:;	  yy->__pos= yypos831; yy->__thunkpos= yythunkpos831;
+  }
+  }
+  l829:;	
+  }
+  l818:;	
+  l816:;	
+  {  int yypos817= yy->__pos, yythunkpos817= yy->__thunkpos;
+  {  int yypos832= yy->__pos, yythunkpos832= yy->__thunkpos;
+  {  int yypos836= yy->__pos, yythunkpos836= yy->__thunkpos;  if (!yymatchChar(yy, '`')) goto l836;  goto l833;
+  l836:;	  yy->__pos= yypos836; yy->__thunkpos= yythunkpos836;
+  }  if (!yy_Nonspacechar(yy)) goto l833;
+  l834:;	
+  {  int yypos835= yy->__pos, yythunkpos835= yy->__thunkpos;
+  {  int yypos837= yy->__pos, yythunkpos837= yy->__thunkpos;  if (!yymatchChar(yy, '`')) goto l837;  goto l835;
+  l837:;	  yy->__pos= yypos837; yy->__thunkpos= yythunkpos837;
+  }  if (!yy_Nonspacechar(yy)) goto l835;  goto l834;
+  l835:;	  yy->__pos= yypos835; yy->__thunkpos= yythunkpos835;
+  }  goto l832;
+  l833:;	  yy->__pos= yypos832; yy->__thunkpos= yythunkpos832;
+  {  int yypos839= yy->__pos, yythunkpos839= yy->__thunkpos;  if (!yy_Ticks2(yy)) goto l839;  goto l838;
+  l839:;	  yy->__pos= yypos839; yy->__thunkpos= yythunkpos839;
+  }  if (!yymatchChar(yy, '`')) goto l838;
+  l840:;	
+  {  int yypos841= yy->__pos, yythunkpos841= yy->__thunkpos;  if (!yymatchChar(yy, '`')) goto l841;  goto l840;
+  l841:;	  yy->__pos= yypos841; yy->__thunkpos= yythunkpos841;
+  }  goto l832;
+  l838:;	  yy->__pos= yypos832; yy->__thunkpos= yythunkpos832;
+  {  int yypos842= yy->__pos, yythunkpos842= yy->__thunkpos;  if (!yy_Sp(yy)) goto l842;  if (!yy_Ticks2(yy)) goto l842;  goto l817;
+  l842:;	  yy->__pos= yypos842; yy->__thunkpos= yythunkpos842;
+  }
+  {  int yypos843= yy->__pos, yythunkpos843= yy->__thunkpos;  if (!yy_Spacechar(yy)) goto l844;  goto l843;
+  l844:;	  yy->__pos= yypos843; yy->__thunkpos= yythunkpos843;  if (!yy_Newline(yy)) goto l817;
+  {  int yypos845= yy->__pos, yythunkpos845= yy->__thunkpos;  if (!yy_BlankLine(yy)) goto l845;  goto l817;
+  l845:;	  yy->__pos= yypos845; yy->__thunkpos= yythunkpos845;
+  }
+  }
+  l843:;	
+  }
+  l832:;	  goto l816;
+  l817:;	  yy->__pos= yypos817; yy->__thunkpos= yythunkpos817;
+  }  if (!(YY_END)) goto l815;  if (!yy_Sp(yy)) goto l815;  if (!yy_Ticks2(yy)) goto l815;  goto l783;
+  l815:;	  yy->__pos= yypos783; yy->__thunkpos= yythunkpos783;  if (!yy_Ticks3(yy)) goto l846;  if (!yy_Sp(yy)) goto l846;  if (!(YY_BEGIN)) goto l846;
+  {  int yypos849= yy->__pos, yythunkpos849= yy->__thunkpos;
+  {  int yypos853= yy->__pos, yythunkpos853= yy->__thunkpos;  if (!yymatchChar(yy, '`')) goto l853;  goto l850;
+  l853:;	  yy->__pos= yypos853; yy->__thunkpos= yythunkpos853;
+  }  if (!yy_Nonspacechar(yy)) goto l850;
+  l851:;	
+  {  int yypos852= yy->__pos, yythunkpos852= yy->__thunkpos;
+  {  int yypos854= yy->__pos, yythunkpos854= yy->__thunkpos;  if (!yymatchChar(yy, '`')) goto l854;  goto l852;
+  l854:;	  yy->__pos= yypos854; yy->__thunkpos= yythunkpos854;
+  }  if (!yy_Nonspacechar(yy)) goto l852;  goto l851;
+  l852:;	  yy->__pos= yypos852; yy->__thunkpos= yythunkpos852;
+  }  goto l849;
+  l850:;	  yy->__pos= yypos849; yy->__thunkpos= yythunkpos849;
+  {  int yypos856= yy->__pos, yythunkpos856= yy->__thunkpos;  if (!yy_Ticks3(yy)) goto l856;  goto l855;
+  l856:;	  yy->__pos= yypos856; yy->__thunkpos= yythunkpos856;
+  }  if (!yymatchChar(yy, '`')) goto l855;
+  l857:;	
+  {  int yypos858= yy->__pos, yythunkpos858= yy->__thunkpos;  if (!yymatchChar(yy, '`')) goto l858;  goto l857;
+  l858:;	  yy->__pos= yypos858; yy->__thunkpos= yythunkpos858;
+  }  goto l849;
+  l855:;	  yy->__pos= yypos849; yy->__thunkpos= yythunkpos849;
+  {  int yypos859= yy->__pos, yythunkpos859= yy->__thunkpos;  if (!yy_Sp(yy)) goto l859;  if (!yy_Ticks3(yy)) goto l859;  goto l846;
+  l859:;	  yy->__pos= yypos859; yy->__thunkpos= yythunkpos859;
+  }
+  {  int yypos860= yy->__pos, yythunkpos860= yy->__thunkpos;  if (!yy_Spacechar(yy)) goto l861;  goto l860;
+  l861:;	  yy->__pos= yypos860; yy->__thunkpos= yythunkpos860;  if (!yy_Newline(yy)) goto l846;
+  {  int yypos862= yy->__pos, yythunkpos862= yy->__thunkpos;  if (!yy_BlankLine(yy)) goto l862;  goto l846;
+  l862:;	  yy->__pos= yypos862; yy->__thunkpos= yythunkpos862;
+  }
+  }
+  l860:;	
+  }
+  l849:;	
+  l847:;	
+  {  int yypos848= yy->__pos, yythunkpos848= yy->__thunkpos;
+  {  int yypos863= yy->__pos, yythunkpos863= yy->__thunkpos;
+  {  int yypos867= yy->__pos, yythunkpos867= yy->__thunkpos;  if (!yymatchChar(yy, '`')) goto l867;  goto l864;
+  l867:;	  yy->__pos= yypos867; yy->__thunkpos= yythunkpos867;
+  }  if (!yy_Nonspacechar(yy)) goto l864;
+  l865:;	
+  {  int yypos866= yy->__pos, yythunkpos866= yy->__thunkpos;
+  {  int yypos868= yy->__pos, yythunkpos868= yy->__thunkpos;  if (!yymatchChar(yy, '`')) goto l868;  goto l866;
+  l868:;	  yy->__pos= yypos868; yy->__thunkpos= yythunkpos868;
+  }  if (!yy_Nonspacechar(yy)) goto l866;  goto l865;
+  l866:;	  yy->__pos= yypos866; yy->__thunkpos= yythunkpos866;
+  }  goto l863;
+  l864:;	  yy->__pos= yypos863; yy->__thunkpos= yythunkpos863;
+  {  int yypos870= yy->__pos, yythunkpos870= yy->__thunkpos;  if (!yy_Ticks3(yy)) goto l870;  goto l869;
+  l870:;	  yy->__pos= yypos870; yy->__thunkpos= yythunkpos870;
+  }  if (!yymatchChar(yy, '`')) goto l869;
+  l871:;	
+  {  int yypos872= yy->__pos, yythunkpos872= yy->__thunkpos;  if (!yymatchChar(yy, '`')) goto l872;  goto l871;
+  l872:;	  yy->__pos= yypos872; yy->__thunkpos= yythunkpos872;
+  }  goto l863;
+  l869:;	  yy->__pos= yypos863; yy->__thunkpos= yythunkpos863;
+  {  int yypos873= yy->__pos, yythunkpos873= yy->__thunkpos;  if (!yy_Sp(yy)) goto l873;  if (!yy_Ticks3(yy)) goto l873;  goto l848;
+  l873:;	  yy->__pos= yypos873; yy->__thunkpos= yythunkpos873;
+  }
+  {  int yypos874= yy->__pos, yythunkpos874= yy->__thunkpos;  if (!yy_Spacechar(yy)) goto l875;  goto l874;
+  l875:;	  yy->__pos= yypos874; yy->__thunkpos= yythunkpos874;  if (!yy_Newline(yy)) goto l848;
+  {  int yypos876= yy->__pos, yythunkpos876= yy->__thunkpos;  if (!yy_BlankLine(yy)) goto l876;  goto l848;
+  l876:;	  yy->__pos= yypos876; yy->__thunkpos= yythunkpos876;
+  }
+  }
+  l874:;	
+  }
+  l863:;	  goto l847;
+  l848:;	  yy->__pos= yypos848; yy->__thunkpos= yythunkpos848;
+  }  if (!(YY_END)) goto l846;  if (!yy_Sp(yy)) goto l846;  if (!yy_Ticks3(yy)) goto l846;  goto l783;
+  l846:;	  yy->__pos= yypos783; yy->__thunkpos= yythunkpos783;  if (!yy_Ticks4(yy)) goto l877;  if (!yy_Sp(yy)) goto l877;  if (!(YY_BEGIN)) goto l877;
+  {  int yypos880= yy->__pos, yythunkpos880= yy->__thunkpos;
+  {  int yypos884= yy->__pos, yythunkpos884= yy->__thunkpos;  if (!yymatchChar(yy, '`')) goto l884;  goto l881;
+  l884:;	  yy->__pos= yypos884; yy->__thunkpos= yythunkpos884;
+  }  if (!yy_Nonspacechar(yy)) goto l881;
+  l882:;	
+  {  int yypos883= yy->__pos, yythunkpos883= yy->__thunkpos;
+  {  int yypos885= yy->__pos, yythunkpos885= yy->__thunkpos;  if (!yymatchChar(yy, '`')) goto l885;  goto l883;
+  l885:;	  yy->__pos= yypos885; yy->__thunkpos= yythunkpos885;
+  }  if (!yy_Nonspacechar(yy)) goto l883;  goto l882;
+  l883:;	  yy->__pos= yypos883; yy->__thunkpos= yythunkpos883;
+  }  goto l880;
+  l881:;	  yy->__pos= yypos880; yy->__thunkpos= yythunkpos880;
+  {  int yypos887= yy->__pos, yythunkpos887= yy->__thunkpos;  if (!yy_Ticks4(yy)) goto l887;  goto l886;
+  l887:;	  yy->__pos= yypos887; yy->__thunkpos= yythunkpos887;
+  }  if (!yymatchChar(yy, '`')) goto l886;
+  l888:;	
+  {  int yypos889= yy->__pos, yythunkpos889= yy->__thunkpos;  if (!yymatchChar(yy, '`')) goto l889;  goto l888;
+  l889:;	  yy->__pos= yypos889; yy->__thunkpos= yythunkpos889;
+  }  goto l880;
+  l886:;	  yy->__pos= yypos880; yy->__thunkpos= yythunkpos880;
+  {  int yypos890= yy->__pos, yythunkpos890= yy->__thunkpos;  if (!yy_Sp(yy)) goto l890;  if (!yy_Ticks4(yy)) goto l890;  goto l877;
+  l890:;	  yy->__pos= yypos890; yy->__thunkpos= yythunkpos890;
+  }
+  {  int yypos891= yy->__pos, yythunkpos891= yy->__thunkpos;  if (!yy_Spacechar(yy)) goto l892;  goto l891;
+  l892:;	  yy->__pos= yypos891; yy->__thunkpos= yythunkpos891;  if (!yy_Newline(yy)) goto l877;
+  {  int yypos893= yy->__pos, yythunkpos893= yy->__thunkpos;  if (!yy_BlankLine(yy)) goto l893;  goto l877;
+  l893:;	  yy->__pos= yypos893; yy->__thunkpos= yythunkpos893;
+  }
+  }
+  l891:;	
+  }
+  l880:;	
+  l878:;	
+  {  int yypos879= yy->__pos, yythunkpos879= yy->__thunkpos;
+  {  int yypos894= yy->__pos, yythunkpos894= yy->__thunkpos;
+  {  int yypos898= yy->__pos, yythunkpos898= yy->__thunkpos;  if (!yymatchChar(yy, '`')) goto l898;  goto l895;
+  l898:;	  yy->__pos= yypos898; yy->__thunkpos= yythunkpos898;
+  }  if (!yy_Nonspacechar(yy)) goto l895;
+  l896:;	
+  {  int yypos897= yy->__pos, yythunkpos897= yy->__thunkpos;
+  {  int yypos899= yy->__pos, yythunkpos899= yy->__thunkpos;  if (!yymatchChar(yy, '`')) goto l899;  goto l897;
+  l899:;	  yy->__pos= yypos899; yy->__thunkpos= yythunkpos899;
+  }  if (!yy_Nonspacechar(yy)) goto l897;  goto l896;
+  l897:;	  yy->__pos= yypos897; yy->__thunkpos= yythunkpos897;
+  }  goto l894;
+  l895:;	  yy->__pos= yypos894; yy->__thunkpos= yythunkpos894;
+  {  int yypos901= yy->__pos, yythunkpos901= yy->__thunkpos;  if (!yy_Ticks4(yy)) goto l901;  goto l900;
+  l901:;	  yy->__pos= yypos901; yy->__thunkpos= yythunkpos901;
+  }  if (!yymatchChar(yy, '`')) goto l900;
+  l902:;	
+  {  int yypos903= yy->__pos, yythunkpos903= yy->__thunkpos;  if (!yymatchChar(yy, '`')) goto l903;  goto l902;
+  l903:;	  yy->__pos= yypos903; yy->__thunkpos= yythunkpos903;
+  }  goto l894;
+  l900:;	  yy->__pos= yypos894; yy->__thunkpos= yythunkpos894;
+  {  int yypos904= yy->__pos, yythunkpos904= yy->__thunkpos;  if (!yy_Sp(yy)) goto l904;  if (!yy_Ticks4(yy)) goto l904;  goto l879;
+  l904:;	  yy->__pos= yypos904; yy->__thunkpos= yythunkpos904;
+  }
+  {  int yypos905= yy->__pos, yythunkpos905= yy->__thunkpos;  if (!yy_Spacechar(yy)) goto l906;  goto l905;
+  l906:;	  yy->__pos= yypos905; yy->__thunkpos= yythunkpos905;  if (!yy_Newline(yy)) goto l879;
+  {  int yypos907= yy->__pos, yythunkpos907= yy->__thunkpos;  if (!yy_BlankLine(yy)) goto l907;  goto l879;
+  l907:;	  yy->__pos= yypos907; yy->__thunkpos= yythunkpos907;
+  }
+  }
+  l905:;	
+  }
+  l894:;	  goto l878;
+  l879:;	  yy->__pos= yypos879; yy->__thunkpos= yythunkpos879;
+  }  if (!(YY_END)) goto l877;  if (!yy_Sp(yy)) goto l877;  if (!yy_Ticks4(yy)) goto l877;  goto l783;
+  l877:;	  yy->__pos= yypos783; yy->__thunkpos= yythunkpos783;  if (!yy_Ticks5(yy)) goto l782;  if (!yy_Sp(yy)) goto l782;  if (!(YY_BEGIN)) goto l782;
+  {  int yypos910= yy->__pos, yythunkpos910= yy->__thunkpos;
+  {  int yypos914= yy->__pos, yythunkpos914= yy->__thunkpos;  if (!yymatchChar(yy, '`')) goto l914;  goto l911;
+  l914:;	  yy->__pos= yypos914; yy->__thunkpos= yythunkpos914;
+  }  if (!yy_Nonspacechar(yy)) goto l911;
+  l912:;	
+  {  int yypos913= yy->__pos, yythunkpos913= yy->__thunkpos;
+  {  int yypos915= yy->__pos, yythunkpos915= yy->__thunkpos;  if (!yymatchChar(yy, '`')) goto l915;  goto l913;
+  l915:;	  yy->__pos= yypos915; yy->__thunkpos= yythunkpos915;
+  }  if (!yy_Nonspacechar(yy)) goto l913;  goto l912;
+  l913:;	  yy->__pos= yypos913; yy->__thunkpos= yythunkpos913;
+  }  goto l910;
+  l911:;	  yy->__pos= yypos910; yy->__thunkpos= yythunkpos910;
+  {  int yypos917= yy->__pos, yythunkpos917= yy->__thunkpos;  if (!yy_Ticks5(yy)) goto l917;  goto l916;
+  l917:;	  yy->__pos= yypos917; yy->__thunkpos= yythunkpos917;
+  }  if (!yymatchChar(yy, '`')) goto l916;
+  l918:;	
+  {  int yypos919= yy->__pos, yythunkpos919= yy->__thunkpos;  if (!yymatchChar(yy, '`')) goto l919;  goto l918;
+  l919:;	  yy->__pos= yypos919; yy->__thunkpos= yythunkpos919;
+  }  goto l910;
+  l916:;	  yy->__pos= yypos910; yy->__thunkpos= yythunkpos910;
+  {  int yypos920= yy->__pos, yythunkpos920= yy->__thunkpos;  if (!yy_Sp(yy)) goto l920;  if (!yy_Ticks5(yy)) goto l920;  goto l782;
+  l920:;	  yy->__pos= yypos920; yy->__thunkpos= yythunkpos920;
+  }
+  {  int yypos921= yy->__pos, yythunkpos921= yy->__thunkpos;  if (!yy_Spacechar(yy)) goto l922;  goto l921;
+  l922:;	  yy->__pos= yypos921; yy->__thunkpos= yythunkpos921;  if (!yy_Newline(yy)) goto l782;
+  {  int yypos923= yy->__pos, yythunkpos923= yy->__thunkpos;  if (!yy_BlankLine(yy)) goto l923;  goto l782;
+  l923:;	  yy->__pos= yypos923; yy->__thunkpos= yythunkpos923;
+  }
+  }
+  l921:;	
+  }
+  l910:;	
+  l908:;	
+  {  int yypos909= yy->__pos, yythunkpos909= yy->__thunkpos;
+  {  int yypos924= yy->__pos, yythunkpos924= yy->__thunkpos;
+  {  int yypos928= yy->__pos, yythunkpos928= yy->__thunkpos;  if (!yymatchChar(yy, '`')) goto l928;  goto l925;
+  l928:;	  yy->__pos= yypos928; yy->__thunkpos= yythunkpos928;
+  }  if (!yy_Nonspacechar(yy)) goto l925;
+  l926:;	
+  {  int yypos927= yy->__pos, yythunkpos927= yy->__thunkpos;
+  {  int yypos929= yy->__pos, yythunkpos929= yy->__thunkpos;  if (!yymatchChar(yy, '`')) goto l929;  goto l927;
+  l929:;	  yy->__pos= yypos929; yy->__thunkpos= yythunkpos929;
+  }  if (!yy_Nonspacechar(yy)) goto l927;  goto l926;
+  l927:;	  yy->__pos= yypos927; yy->__thunkpos= yythunkpos927;
+  }  goto l924;
+  l925:;	  yy->__pos= yypos924; yy->__thunkpos= yythunkpos924;
+  {  int yypos931= yy->__pos, yythunkpos931= yy->__thunkpos;  if (!yy_Ticks5(yy)) goto l931;  goto l930;
+  l931:;	  yy->__pos= yypos931; yy->__thunkpos= yythunkpos931;
+  }  if (!yymatchChar(yy, '`')) goto l930;
+  l932:;	
+  {  int yypos933= yy->__pos, yythunkpos933= yy->__thunkpos;  if (!yymatchChar(yy, '`')) goto l933;  goto l932;
+  l933:;	  yy->__pos= yypos933; yy->__thunkpos= yythunkpos933;
+  }  goto l924;
+  l930:;	  yy->__pos= yypos924; yy->__thunkpos= yythunkpos924;
+  {  int yypos934= yy->__pos, yythunkpos934= yy->__thunkpos;  if (!yy_Sp(yy)) goto l934;  if (!yy_Ticks5(yy)) goto l934;  goto l909;
+  l934:;	  yy->__pos= yypos934; yy->__thunkpos= yythunkpos934;
+  }
+  {  int yypos935= yy->__pos, yythunkpos935= yy->__thunkpos;  if (!yy_Spacechar(yy)) goto l936;  goto l935;
+  l936:;	  yy->__pos= yypos935; yy->__thunkpos= yythunkpos935;  if (!yy_Newline(yy)) goto l909;
+  {  int yypos937= yy->__pos, yythunkpos937= yy->__thunkpos;  if (!yy_BlankLine(yy)) goto l937;  goto l909;
+  l937:;	  yy->__pos= yypos937; yy->__thunkpos= yythunkpos937;
+  }
+  }
+  l935:;	
+  }
+  l924:;	  goto l908;
+  l909:;	  yy->__pos= yypos909; yy->__thunkpos= yythunkpos909;
+  }  if (!(YY_END)) goto l782;  if (!yy_Sp(yy)) goto l782;  if (!yy_Ticks5(yy)) goto l782;
+  }
+  l783:;	  yyDo(yy, yy_1_Code, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Code", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l782:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Code", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_NoteReference(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;  yyDo(yy, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "NoteReference"));  if (!( extension(yy->parser, EXT_NOTES) )) goto l938;  if (!yy_RawNoteReference(yy)) goto l938;  yyDo(yy, yySet, -1, 0);  yyDo(yy, yy_1_NoteReference, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "NoteReference", yy->__buf+yy->__pos-yy->__base));  yyDo(yy, yyPop, 1, 0);
+  return 1;
+  l938:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "NoteReference", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_Link(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "Link"));
+  {  int yypos940= yy->__pos, yythunkpos940= yy->__thunkpos;  if (!yy_ExplicitLink(yy)) goto l941;  goto l940;
+  l941:;	  yy->__pos= yypos940; yy->__thunkpos= yythunkpos940;  if (!yy_ReferenceLink(yy)) goto l942;  goto l940;
+  l942:;	  yy->__pos= yypos940; yy->__thunkpos= yythunkpos940;  if (!yy_AutoLink(yy)) goto l939;
+  }
+  l940:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "Link", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l939:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Link", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_Image(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "Image"));  if (!yymatchChar(yy, '!')) goto l943;
+  {  int yypos944= yy->__pos, yythunkpos944= yy->__thunkpos;  if (!yy_ExplicitLink(yy)) goto l945;  goto l944;
+  l945:;	  yy->__pos= yypos944; yy->__thunkpos= yythunkpos944;  if (!yy_ReferenceLink(yy)) goto l943;
+  }
+  l944:;	  yyDo(yy, yy_1_Image, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Image", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l943:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Image", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_CitationReference(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "CitationReference"));
+  {  int yypos947= yy->__pos, yythunkpos947= yy->__thunkpos;  if (!yy_CitationReferenceDouble(yy)) goto l948;  goto l947;
+  l948:;	  yy->__pos= yypos947; yy->__thunkpos= yythunkpos947;  if (!yy_CitationReferenceSingle(yy)) goto l946;
+  }
+  l947:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "CitationReference", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l946:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "CitationReference", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_Emph(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "Emph"));
+  {  int yypos950= yy->__pos, yythunkpos950= yy->__thunkpos;  if (!yy_EmphStar(yy)) goto l951;  goto l950;
+  l951:;	  yy->__pos= yypos950; yy->__thunkpos= yythunkpos950;  if (!yy_EmphUl(yy)) goto l949;
+  }
+  l950:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "Emph", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l949:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Emph", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_Strong(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "Strong"));
+  {  int yypos953= yy->__pos, yythunkpos953= yy->__thunkpos;  if (!yy_StrongStar(yy)) goto l954;  goto l953;
+  l954:;	  yy->__pos= yypos953; yy->__thunkpos= yythunkpos953;  if (!yy_StrongUl(yy)) goto l952;
+  }
+  l953:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "Strong", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l952:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Strong", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_Space(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "Space"));  if (!yy_Spacechar(yy)) goto l955;
+  l956:;	
+  {  int yypos957= yy->__pos, yythunkpos957= yy->__thunkpos;  if (!yy_Spacechar(yy)) goto l957;  goto l956;
+  l957:;	  yy->__pos= yypos957; yy->__thunkpos= yythunkpos957;
+  }  yyDo(yy, yy_1_Space, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Space", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l955:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Space", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_UlOrStarLine(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "UlOrStarLine"));
+  {  int yypos959= yy->__pos, yythunkpos959= yy->__thunkpos;  if (!yy_UlLine(yy)) goto l960;  goto l959;
+  l960:;	  yy->__pos= yypos959; yy->__thunkpos= yythunkpos959;  if (!yy_StarLine(yy)) goto l958;
+  }
+  l959:;	  yyDo(yy, yy_1_UlOrStarLine, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "UlOrStarLine", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l958:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "UlOrStarLine", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_MathSpan(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "MathSpan"));  if (!yymatchChar(yy, '\\')) goto l961;  if (!(YY_BEGIN)) goto l961;
+  {  int yypos962= yy->__pos, yythunkpos962= yy->__thunkpos;  if (!yymatchString(yy, "\\[")) goto l963;
+  l964:;	
+  {  int yypos965= yy->__pos, yythunkpos965= yy->__thunkpos;
+  {  int yypos966= yy->__pos, yythunkpos966= yy->__thunkpos;  if (!yymatchString(yy, "\\\\]")) goto l966;  goto l965;
+  l966:;	  yy->__pos= yypos966; yy->__thunkpos= yythunkpos966;
+  }  if (!yymatchDot(yy)) goto l965;  goto l964;
+  l965:;	  yy->__pos= yypos965; yy->__thunkpos= yythunkpos965;
+  }  if (!yymatchString(yy, "\\\\]")) goto l963;  goto l962;
+  l963:;	  yy->__pos= yypos962; yy->__thunkpos= yythunkpos962;  if (!yymatchString(yy, "\\(")) goto l961;
+  l967:;	
+  {  int yypos968= yy->__pos, yythunkpos968= yy->__thunkpos;
+  {  int yypos969= yy->__pos, yythunkpos969= yy->__thunkpos;  if (!yymatchString(yy, "\\\\)")) goto l969;  goto l968;
+  l969:;	  yy->__pos= yypos969; yy->__thunkpos= yythunkpos969;
+  }  if (!yymatchDot(yy)) goto l968;  goto l967;
+  l968:;	  yy->__pos= yypos968; yy->__thunkpos= yythunkpos968;
+  }  if (!yymatchString(yy, "\\\\)")) goto l961;
+  }
+  l962:;	  if (!(YY_END)) goto l961;  yyDo(yy, yy_1_MathSpan, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "MathSpan", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l961:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "MathSpan", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_Str(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;  yyDo(yy, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "Str"));  if (!yy_StartList(yy)) goto l970;  yyDo(yy, yySet, -1, 0);  if (!(YY_BEGIN)) goto l970;  if (!yy_NormalChar(yy)) goto l970;
+  l971:;	
+  {  int yypos972= yy->__pos, yythunkpos972= yy->__thunkpos;  if (!yy_NormalChar(yy)) goto l972;  goto l971;
+  l972:;	  yy->__pos= yypos972; yy->__thunkpos= yythunkpos972;
+  }  if (!(YY_END)) goto l970;  yyDo(yy, yy_1_Str, yy->__begin, yy->__end);
+  l973:;	
+  {  int yypos974= yy->__pos, yythunkpos974= yy->__thunkpos;  if (!yy_StrChunk(yy)) goto l974;  yyDo(yy, yy_2_Str, yy->__begin, yy->__end);  goto l973;
+  l974:;	  yy->__pos= yypos974; yy->__thunkpos= yythunkpos974;
+  }  yyDo(yy, yy_3_Str, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Str", yy->__buf+yy->__pos-yy->__base));  yyDo(yy, yyPop, 1, 0);
+  return 1;
+  l970:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Str", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_InStyleTags(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "InStyleTags"));  if (!yy_StyleOpen(yy)) goto l975;
+  l976:;	
+  {  int yypos977= yy->__pos, yythunkpos977= yy->__thunkpos;
+  {  int yypos978= yy->__pos, yythunkpos978= yy->__thunkpos;  if (!yy_StyleClose(yy)) goto l978;  goto l977;
+  l978:;	  yy->__pos= yypos978; yy->__thunkpos= yythunkpos978;
+  }  if (!yymatchDot(yy)) goto l977;  goto l976;
+  l977:;	  yy->__pos= yypos977; yy->__thunkpos= yythunkpos977;
+  }  if (!yy_StyleClose(yy)) goto l975;
+  yyprintf((stderr, "  ok   %s @ %s\n", "InStyleTags", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l975:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "InStyleTags", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_StyleClose(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "StyleClose"));  if (!yymatchChar(yy, '<')) goto l979;  if (!yy_Spnl(yy)) goto l979;  if (!yymatchChar(yy, '/')) goto l979;
+  {  int yypos980= yy->__pos, yythunkpos980= yy->__thunkpos;  if (!yymatchString(yy, "style")) goto l981;  goto l980;
+  l981:;	  yy->__pos= yypos980; yy->__thunkpos= yythunkpos980;  if (!yymatchString(yy, "STYLE")) goto l979;
+  }
+  l980:;	  if (!yy_Spnl(yy)) goto l979;  if (!yymatchChar(yy, '>')) goto l979;
+  yyprintf((stderr, "  ok   %s @ %s\n", "StyleClose", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l979:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "StyleClose", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_StyleOpen(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "StyleOpen"));  if (!yymatchChar(yy, '<')) goto l982;  if (!yy_Spnl(yy)) goto l982;
+  {  int yypos983= yy->__pos, yythunkpos983= yy->__thunkpos;  if (!yymatchString(yy, "style")) goto l984;  goto l983;
+  l984:;	  yy->__pos= yypos983; yy->__thunkpos= yythunkpos983;  if (!yymatchString(yy, "STYLE")) goto l982;
+  }
+  l983:;	  if (!yy_Spnl(yy)) goto l982;
+  l985:;	
+  {  int yypos986= yy->__pos, yythunkpos986= yy->__thunkpos;  if (!yy_HtmlAttribute(yy)) goto l986;  goto l985;
+  l986:;	  yy->__pos= yypos986; yy->__thunkpos= yythunkpos986;
+  }  if (!yymatchChar(yy, '>')) goto l982;
+  yyprintf((stderr, "  ok   %s @ %s\n", "StyleOpen", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l982:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "StyleOpen", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockType(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockType"));
+  {  int yypos988= yy->__pos, yythunkpos988= yy->__thunkpos;  if (!yymatchString(yy, "address")) goto l989;  goto l988;
+  l989:;	  yy->__pos= yypos988; yy->__thunkpos= yythunkpos988;  if (!yymatchString(yy, "blockquote")) goto l990;  goto l988;
+  l990:;	  yy->__pos= yypos988; yy->__thunkpos= yythunkpos988;  if (!yymatchString(yy, "center")) goto l991;  goto l988;
+  l991:;	  yy->__pos= yypos988; yy->__thunkpos= yythunkpos988;  if (!yymatchString(yy, "dir")) goto l992;  goto l988;
+  l992:;	  yy->__pos= yypos988; yy->__thunkpos= yythunkpos988;  if (!yymatchString(yy, "div")) goto l993;  goto l988;
+  l993:;	  yy->__pos= yypos988; yy->__thunkpos= yythunkpos988;  if (!yymatchString(yy, "dl")) goto l994;  goto l988;
+  l994:;	  yy->__pos= yypos988; yy->__thunkpos= yythunkpos988;  if (!yymatchString(yy, "fieldset")) goto l995;  goto l988;
+  l995:;	  yy->__pos= yypos988; yy->__thunkpos= yythunkpos988;  if (!yymatchString(yy, "form")) goto l996;  goto l988;
+  l996:;	  yy->__pos= yypos988; yy->__thunkpos= yythunkpos988;  if (!yymatchString(yy, "h1")) goto l997;  goto l988;
+  l997:;	  yy->__pos= yypos988; yy->__thunkpos= yythunkpos988;  if (!yymatchString(yy, "h2")) goto l998;  goto l988;
+  l998:;	  yy->__pos= yypos988; yy->__thunkpos= yythunkpos988;  if (!yymatchString(yy, "h3")) goto l999;  goto l988;
+  l999:;	  yy->__pos= yypos988; yy->__thunkpos= yythunkpos988;  if (!yymatchString(yy, "h4")) goto l1000;  goto l988;
+  l1000:;	  yy->__pos= yypos988; yy->__thunkpos= yythunkpos988;  if (!yymatchString(yy, "h5")) goto l1001;  goto l988;
+  l1001:;	  yy->__pos= yypos988; yy->__thunkpos= yythunkpos988;  if (!yymatchString(yy, "h6")) goto l1002;  goto l988;
+  l1002:;	  yy->__pos= yypos988; yy->__thunkpos= yythunkpos988;  if (!yymatchString(yy, "hr")) goto l1003;  goto l988;
+  l1003:;	  yy->__pos= yypos988; yy->__thunkpos= yythunkpos988;  if (!yymatchString(yy, "isindex")) goto l1004;  goto l988;
+  l1004:;	  yy->__pos= yypos988; yy->__thunkpos= yythunkpos988;  if (!yymatchString(yy, "menu")) goto l1005;  goto l988;
+  l1005:;	  yy->__pos= yypos988; yy->__thunkpos= yythunkpos988;  if (!yymatchString(yy, "noframes")) goto l1006;  goto l988;
+  l1006:;	  yy->__pos= yypos988; yy->__thunkpos= yythunkpos988;  if (!yymatchString(yy, "noscript")) goto l1007;  goto l988;
+  l1007:;	  yy->__pos= yypos988; yy->__thunkpos= yythunkpos988;  if (!yymatchString(yy, "ol")) goto l1008;  goto l988;
+  l1008:;	  yy->__pos= yypos988; yy->__thunkpos= yythunkpos988;  if (!yymatchChar(yy, 'p')) goto l1009;  goto l988;
+  l1009:;	  yy->__pos= yypos988; yy->__thunkpos= yythunkpos988;  if (!yymatchString(yy, "pre")) goto l1010;  goto l988;
+  l1010:;	  yy->__pos= yypos988; yy->__thunkpos= yythunkpos988;  if (!yymatchString(yy, "table")) goto l1011;  goto l988;
+  l1011:;	  yy->__pos= yypos988; yy->__thunkpos= yythunkpos988;  if (!yymatchString(yy, "ul")) goto l1012;  goto l988;
+  l1012:;	  yy->__pos= yypos988; yy->__thunkpos= yythunkpos988;  if (!yymatchString(yy, "dd")) goto l1013;  goto l988;
+  l1013:;	  yy->__pos= yypos988; yy->__thunkpos= yythunkpos988;  if (!yymatchString(yy, "dt")) goto l1014;  goto l988;
+  l1014:;	  yy->__pos= yypos988; yy->__thunkpos= yythunkpos988;  if (!yymatchString(yy, "frameset")) goto l1015;  goto l988;
+  l1015:;	  yy->__pos= yypos988; yy->__thunkpos= yythunkpos988;  if (!yymatchString(yy, "li")) goto l1016;  goto l988;
+  l1016:;	  yy->__pos= yypos988; yy->__thunkpos= yythunkpos988;  if (!yymatchString(yy, "tbody")) goto l1017;  goto l988;
+  l1017:;	  yy->__pos= yypos988; yy->__thunkpos= yythunkpos988;  if (!yymatchString(yy, "td")) goto l1018;  goto l988;
+  l1018:;	  yy->__pos= yypos988; yy->__thunkpos= yythunkpos988;  if (!yymatchString(yy, "tfoot")) goto l1019;  goto l988;
+  l1019:;	  yy->__pos= yypos988; yy->__thunkpos= yythunkpos988;  if (!yymatchString(yy, "th")) goto l1020;  goto l988;
+  l1020:;	  yy->__pos= yypos988; yy->__thunkpos= yythunkpos988;  if (!yymatchString(yy, "thead")) goto l1021;  goto l988;
+  l1021:;	  yy->__pos= yypos988; yy->__thunkpos= yythunkpos988;  if (!yymatchString(yy, "tr")) goto l1022;  goto l988;
+  l1022:;	  yy->__pos= yypos988; yy->__thunkpos= yythunkpos988;  if (!yymatchString(yy, "script")) goto l1023;  goto l988;
+  l1023:;	  yy->__pos= yypos988; yy->__thunkpos= yythunkpos988;  if (!yymatchString(yy, "ADDRESS")) goto l1024;  goto l988;
+  l1024:;	  yy->__pos= yypos988; yy->__thunkpos= yythunkpos988;  if (!yymatchString(yy, "BLOCKQUOTE")) goto l1025;  goto l988;
+  l1025:;	  yy->__pos= yypos988; yy->__thunkpos= yythunkpos988;  if (!yymatchString(yy, "CENTER")) goto l1026;  goto l988;
+  l1026:;	  yy->__pos= yypos988; yy->__thunkpos= yythunkpos988;  if (!yymatchString(yy, "DIR")) goto l1027;  goto l988;
+  l1027:;	  yy->__pos= yypos988; yy->__thunkpos= yythunkpos988;  if (!yymatchString(yy, "DIV")) goto l1028;  goto l988;
+  l1028:;	  yy->__pos= yypos988; yy->__thunkpos= yythunkpos988;  if (!yymatchString(yy, "DL")) goto l1029;  goto l988;
+  l1029:;	  yy->__pos= yypos988; yy->__thunkpos= yythunkpos988;  if (!yymatchString(yy, "FIELDSET")) goto l1030;  goto l988;
+  l1030:;	  yy->__pos= yypos988; yy->__thunkpos= yythunkpos988;  if (!yymatchString(yy, "FORM")) goto l1031;  goto l988;
+  l1031:;	  yy->__pos= yypos988; yy->__thunkpos= yythunkpos988;  if (!yymatchString(yy, "H1")) goto l1032;  goto l988;
+  l1032:;	  yy->__pos= yypos988; yy->__thunkpos= yythunkpos988;  if (!yymatchString(yy, "H2")) goto l1033;  goto l988;
+  l1033:;	  yy->__pos= yypos988; yy->__thunkpos= yythunkpos988;  if (!yymatchString(yy, "H3")) goto l1034;  goto l988;
+  l1034:;	  yy->__pos= yypos988; yy->__thunkpos= yythunkpos988;  if (!yymatchString(yy, "H4")) goto l1035;  goto l988;
+  l1035:;	  yy->__pos= yypos988; yy->__thunkpos= yythunkpos988;  if (!yymatchString(yy, "H5")) goto l1036;  goto l988;
+  l1036:;	  yy->__pos= yypos988; yy->__thunkpos= yythunkpos988;  if (!yymatchString(yy, "H6")) goto l1037;  goto l988;
+  l1037:;	  yy->__pos= yypos988; yy->__thunkpos= yythunkpos988;  if (!yymatchString(yy, "HR")) goto l1038;  goto l988;
+  l1038:;	  yy->__pos= yypos988; yy->__thunkpos= yythunkpos988;  if (!yymatchString(yy, "ISINDEX")) goto l1039;  goto l988;
+  l1039:;	  yy->__pos= yypos988; yy->__thunkpos= yythunkpos988;  if (!yymatchString(yy, "MENU")) goto l1040;  goto l988;
+  l1040:;	  yy->__pos= yypos988; yy->__thunkpos= yythunkpos988;  if (!yymatchString(yy, "NOFRAMES")) goto l1041;  goto l988;
+  l1041:;	  yy->__pos= yypos988; yy->__thunkpos= yythunkpos988;  if (!yymatchString(yy, "NOSCRIPT")) goto l1042;  goto l988;
+  l1042:;	  yy->__pos= yypos988; yy->__thunkpos= yythunkpos988;  if (!yymatchString(yy, "OL")) goto l1043;  goto l988;
+  l1043:;	  yy->__pos= yypos988; yy->__thunkpos= yythunkpos988;  if (!yymatchChar(yy, 'P')) goto l1044;  goto l988;
+  l1044:;	  yy->__pos= yypos988; yy->__thunkpos= yythunkpos988;  if (!yymatchString(yy, "PRE")) goto l1045;  goto l988;
+  l1045:;	  yy->__pos= yypos988; yy->__thunkpos= yythunkpos988;  if (!yymatchString(yy, "TABLE")) goto l1046;  goto l988;
+  l1046:;	  yy->__pos= yypos988; yy->__thunkpos= yythunkpos988;  if (!yymatchString(yy, "UL")) goto l1047;  goto l988;
+  l1047:;	  yy->__pos= yypos988; yy->__thunkpos= yythunkpos988;  if (!yymatchString(yy, "DD")) goto l1048;  goto l988;
+  l1048:;	  yy->__pos= yypos988; yy->__thunkpos= yythunkpos988;  if (!yymatchString(yy, "DT")) goto l1049;  goto l988;
+  l1049:;	  yy->__pos= yypos988; yy->__thunkpos= yythunkpos988;  if (!yymatchString(yy, "FRAMESET")) goto l1050;  goto l988;
+  l1050:;	  yy->__pos= yypos988; yy->__thunkpos= yythunkpos988;  if (!yymatchString(yy, "LI")) goto l1051;  goto l988;
+  l1051:;	  yy->__pos= yypos988; yy->__thunkpos= yythunkpos988;  if (!yymatchString(yy, "TBODY")) goto l1052;  goto l988;
+  l1052:;	  yy->__pos= yypos988; yy->__thunkpos= yythunkpos988;  if (!yymatchString(yy, "TD")) goto l1053;  goto l988;
+  l1053:;	  yy->__pos= yypos988; yy->__thunkpos= yythunkpos988;  if (!yymatchString(yy, "TFOOT")) goto l1054;  goto l988;
+  l1054:;	  yy->__pos= yypos988; yy->__thunkpos= yythunkpos988;  if (!yymatchString(yy, "TH")) goto l1055;  goto l988;
+  l1055:;	  yy->__pos= yypos988; yy->__thunkpos= yythunkpos988;  if (!yymatchString(yy, "THEAD")) goto l1056;  goto l988;
+  l1056:;	  yy->__pos= yypos988; yy->__thunkpos= yythunkpos988;  if (!yymatchString(yy, "TR")) goto l1057;  goto l988;
+  l1057:;	  yy->__pos= yypos988; yy->__thunkpos= yythunkpos988;  if (!yymatchString(yy, "SCRIPT")) goto l987;
+  }
+  l988:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockType", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l987:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockType", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockSelfClosing(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockSelfClosing"));  if (!yymatchChar(yy, '<')) goto l1058;  if (!yy_Spnl(yy)) goto l1058;  if (!yy_HtmlBlockType(yy)) goto l1058;  if (!yy_Spnl(yy)) goto l1058;
+  l1059:;	
+  {  int yypos1060= yy->__pos, yythunkpos1060= yy->__thunkpos;  if (!yy_HtmlAttribute(yy)) goto l1060;  goto l1059;
+  l1060:;	  yy->__pos= yypos1060; yy->__thunkpos= yythunkpos1060;
+  }  if (!yymatchChar(yy, '/')) goto l1058;  if (!yy_Spnl(yy)) goto l1058;  if (!yymatchChar(yy, '>')) goto l1058;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockSelfClosing", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1058:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockSelfClosing", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlComment(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlComment"));  if (!yymatchString(yy, "<!--")) goto l1061;
+  l1062:;	
+  {  int yypos1063= yy->__pos, yythunkpos1063= yy->__thunkpos;
+  {  int yypos1064= yy->__pos, yythunkpos1064= yy->__thunkpos;  if (!yymatchString(yy, "-->")) goto l1064;  goto l1063;
+  l1064:;	  yy->__pos= yypos1064; yy->__thunkpos= yythunkpos1064;
+  }  if (!yymatchDot(yy)) goto l1063;  goto l1062;
+  l1063:;	  yy->__pos= yypos1063; yy->__thunkpos= yythunkpos1063;
+  }  if (!yymatchString(yy, "-->")) goto l1061;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlComment", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1061:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlComment", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_MarkdownHtmlTagOpen(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;  yyDo(yy, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "MarkdownHtmlTagOpen"));  if (!yy_StartList(yy)) goto l1065;  yyDo(yy, yySet, -1, 0);  if (!yymatchChar(yy, '<')) goto l1065;  yyDo(yy, yy_1_MarkdownHtmlTagOpen, yy->__begin, yy->__end);  if (!yy_Spnl(yy)) goto l1065;  if (!(YY_BEGIN)) goto l1065;  if (!yy_HtmlBlockType(yy)) goto l1065;  if (!(YY_END)) goto l1065;  yyDo(yy, yy_2_MarkdownHtmlTagOpen, yy->__begin, yy->__end);  if (!yy_Spnl(yy)) goto l1065;
+  l1066:;	
+  {  int yypos1067= yy->__pos, yythunkpos1067= yy->__thunkpos;
+  {  int yypos1068= yy->__pos, yythunkpos1068= yy->__thunkpos;  if (!yy_MarkdownHtmlAttribute(yy)) goto l1068;  goto l1067;
+  l1068:;	  yy->__pos= yypos1068; yy->__thunkpos= yythunkpos1068;
+  }  if (!(YY_BEGIN)) goto l1067;  if (!yy_HtmlAttribute(yy)) goto l1067;  if (!(YY_END)) goto l1067;  yyDo(yy, yy_3_MarkdownHtmlTagOpen, yy->__begin, yy->__end);  goto l1066;
+  l1067:;	  yy->__pos= yypos1067; yy->__thunkpos= yythunkpos1067;
+  }  if (!yy_MarkdownHtmlAttribute(yy)) goto l1065;
+  l1069:;	
+  {  int yypos1070= yy->__pos, yythunkpos1070= yy->__thunkpos;  if (!(YY_BEGIN)) goto l1070;  if (!yy_HtmlAttribute(yy)) goto l1070;  if (!(YY_END)) goto l1070;  yyDo(yy, yy_4_MarkdownHtmlTagOpen, yy->__begin, yy->__end);  goto l1069;
+  l1070:;	  yy->__pos= yypos1070; yy->__thunkpos= yythunkpos1070;
+  }  if (!yymatchChar(yy, '>')) goto l1065;  yyDo(yy, yy_5_MarkdownHtmlTagOpen, yy->__begin, yy->__end);  yyDo(yy, yy_6_MarkdownHtmlTagOpen, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "MarkdownHtmlTagOpen", yy->__buf+yy->__pos-yy->__base));  yyDo(yy, yyPop, 1, 0);
+  return 1;
+  l1065:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "MarkdownHtmlTagOpen", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockScript(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockScript"));  if (!yy_HtmlBlockOpenScript(yy)) goto l1071;
+  l1072:;	
+  {  int yypos1073= yy->__pos, yythunkpos1073= yy->__thunkpos;
+  {  int yypos1074= yy->__pos, yythunkpos1074= yy->__thunkpos;  if (!yy_HtmlBlockCloseScript(yy)) goto l1074;  goto l1073;
+  l1074:;	  yy->__pos= yypos1074; yy->__thunkpos= yythunkpos1074;
+  }  if (!yymatchDot(yy)) goto l1073;  goto l1072;
+  l1073:;	  yy->__pos= yypos1073; yy->__thunkpos= yythunkpos1073;
+  }  if (!yy_HtmlBlockCloseScript(yy)) goto l1071;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockScript", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1071:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockScript", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockCloseScript(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockCloseScript"));  if (!yymatchChar(yy, '<')) goto l1075;  if (!yy_Spnl(yy)) goto l1075;  if (!yymatchChar(yy, '/')) goto l1075;
+  {  int yypos1076= yy->__pos, yythunkpos1076= yy->__thunkpos;  if (!yymatchString(yy, "script")) goto l1077;  goto l1076;
+  l1077:;	  yy->__pos= yypos1076; yy->__thunkpos= yythunkpos1076;  if (!yymatchString(yy, "SCRIPT")) goto l1075;
+  }
+  l1076:;	  if (!yy_Spnl(yy)) goto l1075;  if (!yymatchChar(yy, '>')) goto l1075;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockCloseScript", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1075:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockCloseScript", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockOpenScript(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockOpenScript"));  if (!yymatchChar(yy, '<')) goto l1078;  if (!yy_Spnl(yy)) goto l1078;
+  {  int yypos1079= yy->__pos, yythunkpos1079= yy->__thunkpos;  if (!yymatchString(yy, "script")) goto l1080;  goto l1079;
+  l1080:;	  yy->__pos= yypos1079; yy->__thunkpos= yythunkpos1079;  if (!yymatchString(yy, "SCRIPT")) goto l1078;
+  }
+  l1079:;	  if (!yy_Spnl(yy)) goto l1078;
+  l1081:;	
+  {  int yypos1082= yy->__pos, yythunkpos1082= yy->__thunkpos;  if (!yy_HtmlAttribute(yy)) goto l1082;  goto l1081;
+  l1082:;	  yy->__pos= yypos1082; yy->__thunkpos= yythunkpos1082;
+  }  if (!yymatchChar(yy, '>')) goto l1078;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockOpenScript", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1078:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockOpenScript", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockTr(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockTr"));  if (!yy_HtmlBlockOpenTr(yy)) goto l1083;
+  l1084:;	
+  {  int yypos1085= yy->__pos, yythunkpos1085= yy->__thunkpos;
+  {  int yypos1086= yy->__pos, yythunkpos1086= yy->__thunkpos;  if (!yy_HtmlBlockTr(yy)) goto l1087;  goto l1086;
+  l1087:;	  yy->__pos= yypos1086; yy->__thunkpos= yythunkpos1086;
+  {  int yypos1088= yy->__pos, yythunkpos1088= yy->__thunkpos;  if (!yy_HtmlBlockCloseTr(yy)) goto l1088;  goto l1085;
+  l1088:;	  yy->__pos= yypos1088; yy->__thunkpos= yythunkpos1088;
+  }  if (!yymatchDot(yy)) goto l1085;
+  }
+  l1086:;	  goto l1084;
+  l1085:;	  yy->__pos= yypos1085; yy->__thunkpos= yythunkpos1085;
+  }  if (!yy_HtmlBlockCloseTr(yy)) goto l1083;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockTr", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1083:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockTr", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockCloseTr(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockCloseTr"));  if (!yymatchChar(yy, '<')) goto l1089;  if (!yy_Spnl(yy)) goto l1089;  if (!yymatchChar(yy, '/')) goto l1089;
+  {  int yypos1090= yy->__pos, yythunkpos1090= yy->__thunkpos;  if (!yymatchString(yy, "tr")) goto l1091;  goto l1090;
+  l1091:;	  yy->__pos= yypos1090; yy->__thunkpos= yythunkpos1090;  if (!yymatchString(yy, "TR")) goto l1089;
+  }
+  l1090:;	  if (!yy_Spnl(yy)) goto l1089;  if (!yymatchChar(yy, '>')) goto l1089;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockCloseTr", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1089:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockCloseTr", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockOpenTr(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockOpenTr"));  if (!yymatchChar(yy, '<')) goto l1092;  if (!yy_Spnl(yy)) goto l1092;
+  {  int yypos1093= yy->__pos, yythunkpos1093= yy->__thunkpos;  if (!yymatchString(yy, "tr")) goto l1094;  goto l1093;
+  l1094:;	  yy->__pos= yypos1093; yy->__thunkpos= yythunkpos1093;  if (!yymatchString(yy, "TR")) goto l1092;
+  }
+  l1093:;	  if (!yy_Spnl(yy)) goto l1092;
+  l1095:;	
+  {  int yypos1096= yy->__pos, yythunkpos1096= yy->__thunkpos;  if (!yy_HtmlAttribute(yy)) goto l1096;  goto l1095;
+  l1096:;	  yy->__pos= yypos1096; yy->__thunkpos= yythunkpos1096;
+  }  if (!yymatchChar(yy, '>')) goto l1092;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockOpenTr", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1092:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockOpenTr", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockThead(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockThead"));  if (!yy_HtmlBlockOpenThead(yy)) goto l1097;
+  l1098:;	
+  {  int yypos1099= yy->__pos, yythunkpos1099= yy->__thunkpos;
+  {  int yypos1100= yy->__pos, yythunkpos1100= yy->__thunkpos;  if (!yy_HtmlBlockThead(yy)) goto l1101;  goto l1100;
+  l1101:;	  yy->__pos= yypos1100; yy->__thunkpos= yythunkpos1100;
+  {  int yypos1102= yy->__pos, yythunkpos1102= yy->__thunkpos;  if (!yy_HtmlBlockCloseThead(yy)) goto l1102;  goto l1099;
+  l1102:;	  yy->__pos= yypos1102; yy->__thunkpos= yythunkpos1102;
+  }  if (!yymatchDot(yy)) goto l1099;
+  }
+  l1100:;	  goto l1098;
+  l1099:;	  yy->__pos= yypos1099; yy->__thunkpos= yythunkpos1099;
+  }  if (!yy_HtmlBlockCloseThead(yy)) goto l1097;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockThead", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1097:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockThead", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockCloseThead(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockCloseThead"));  if (!yymatchChar(yy, '<')) goto l1103;  if (!yy_Spnl(yy)) goto l1103;  if (!yymatchChar(yy, '/')) goto l1103;
+  {  int yypos1104= yy->__pos, yythunkpos1104= yy->__thunkpos;  if (!yymatchString(yy, "thead")) goto l1105;  goto l1104;
+  l1105:;	  yy->__pos= yypos1104; yy->__thunkpos= yythunkpos1104;  if (!yymatchString(yy, "THEAD")) goto l1103;
+  }
+  l1104:;	  if (!yy_Spnl(yy)) goto l1103;  if (!yymatchChar(yy, '>')) goto l1103;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockCloseThead", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1103:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockCloseThead", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockOpenThead(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockOpenThead"));  if (!yymatchChar(yy, '<')) goto l1106;  if (!yy_Spnl(yy)) goto l1106;
+  {  int yypos1107= yy->__pos, yythunkpos1107= yy->__thunkpos;  if (!yymatchString(yy, "thead")) goto l1108;  goto l1107;
+  l1108:;	  yy->__pos= yypos1107; yy->__thunkpos= yythunkpos1107;  if (!yymatchString(yy, "THEAD")) goto l1106;
+  }
+  l1107:;	  if (!yy_Spnl(yy)) goto l1106;
+  l1109:;	
+  {  int yypos1110= yy->__pos, yythunkpos1110= yy->__thunkpos;  if (!yy_HtmlAttribute(yy)) goto l1110;  goto l1109;
+  l1110:;	  yy->__pos= yypos1110; yy->__thunkpos= yythunkpos1110;
+  }  if (!yymatchChar(yy, '>')) goto l1106;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockOpenThead", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1106:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockOpenThead", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockTh(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockTh"));  if (!yy_HtmlBlockOpenTh(yy)) goto l1111;
+  l1112:;	
+  {  int yypos1113= yy->__pos, yythunkpos1113= yy->__thunkpos;
+  {  int yypos1114= yy->__pos, yythunkpos1114= yy->__thunkpos;  if (!yy_HtmlBlockTh(yy)) goto l1115;  goto l1114;
+  l1115:;	  yy->__pos= yypos1114; yy->__thunkpos= yythunkpos1114;
+  {  int yypos1116= yy->__pos, yythunkpos1116= yy->__thunkpos;  if (!yy_HtmlBlockCloseTh(yy)) goto l1116;  goto l1113;
+  l1116:;	  yy->__pos= yypos1116; yy->__thunkpos= yythunkpos1116;
+  }  if (!yymatchDot(yy)) goto l1113;
+  }
+  l1114:;	  goto l1112;
+  l1113:;	  yy->__pos= yypos1113; yy->__thunkpos= yythunkpos1113;
+  }  if (!yy_HtmlBlockCloseTh(yy)) goto l1111;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockTh", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1111:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockTh", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockCloseTh(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockCloseTh"));  if (!yymatchChar(yy, '<')) goto l1117;  if (!yy_Spnl(yy)) goto l1117;  if (!yymatchChar(yy, '/')) goto l1117;
+  {  int yypos1118= yy->__pos, yythunkpos1118= yy->__thunkpos;  if (!yymatchString(yy, "th")) goto l1119;  goto l1118;
+  l1119:;	  yy->__pos= yypos1118; yy->__thunkpos= yythunkpos1118;  if (!yymatchString(yy, "TH")) goto l1117;
+  }
+  l1118:;	  if (!yy_Spnl(yy)) goto l1117;  if (!yymatchChar(yy, '>')) goto l1117;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockCloseTh", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1117:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockCloseTh", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockOpenTh(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockOpenTh"));  if (!yymatchChar(yy, '<')) goto l1120;  if (!yy_Spnl(yy)) goto l1120;
+  {  int yypos1121= yy->__pos, yythunkpos1121= yy->__thunkpos;  if (!yymatchString(yy, "th")) goto l1122;  goto l1121;
+  l1122:;	  yy->__pos= yypos1121; yy->__thunkpos= yythunkpos1121;  if (!yymatchString(yy, "TH")) goto l1120;
+  }
+  l1121:;	  if (!yy_Spnl(yy)) goto l1120;
+  l1123:;	
+  {  int yypos1124= yy->__pos, yythunkpos1124= yy->__thunkpos;  if (!yy_HtmlAttribute(yy)) goto l1124;  goto l1123;
+  l1124:;	  yy->__pos= yypos1124; yy->__thunkpos= yythunkpos1124;
+  }  if (!yymatchChar(yy, '>')) goto l1120;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockOpenTh", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1120:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockOpenTh", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockTfoot(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockTfoot"));  if (!yy_HtmlBlockOpenTfoot(yy)) goto l1125;
+  l1126:;	
+  {  int yypos1127= yy->__pos, yythunkpos1127= yy->__thunkpos;
+  {  int yypos1128= yy->__pos, yythunkpos1128= yy->__thunkpos;  if (!yy_HtmlBlockTfoot(yy)) goto l1129;  goto l1128;
+  l1129:;	  yy->__pos= yypos1128; yy->__thunkpos= yythunkpos1128;
+  {  int yypos1130= yy->__pos, yythunkpos1130= yy->__thunkpos;  if (!yy_HtmlBlockCloseTfoot(yy)) goto l1130;  goto l1127;
+  l1130:;	  yy->__pos= yypos1130; yy->__thunkpos= yythunkpos1130;
+  }  if (!yymatchDot(yy)) goto l1127;
+  }
+  l1128:;	  goto l1126;
+  l1127:;	  yy->__pos= yypos1127; yy->__thunkpos= yythunkpos1127;
+  }  if (!yy_HtmlBlockCloseTfoot(yy)) goto l1125;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockTfoot", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1125:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockTfoot", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockCloseTfoot(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockCloseTfoot"));  if (!yymatchChar(yy, '<')) goto l1131;  if (!yy_Spnl(yy)) goto l1131;  if (!yymatchChar(yy, '/')) goto l1131;
+  {  int yypos1132= yy->__pos, yythunkpos1132= yy->__thunkpos;  if (!yymatchString(yy, "tfoot")) goto l1133;  goto l1132;
+  l1133:;	  yy->__pos= yypos1132; yy->__thunkpos= yythunkpos1132;  if (!yymatchString(yy, "TFOOT")) goto l1131;
+  }
+  l1132:;	  if (!yy_Spnl(yy)) goto l1131;  if (!yymatchChar(yy, '>')) goto l1131;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockCloseTfoot", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1131:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockCloseTfoot", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockOpenTfoot(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockOpenTfoot"));  if (!yymatchChar(yy, '<')) goto l1134;  if (!yy_Spnl(yy)) goto l1134;
+  {  int yypos1135= yy->__pos, yythunkpos1135= yy->__thunkpos;  if (!yymatchString(yy, "tfoot")) goto l1136;  goto l1135;
+  l1136:;	  yy->__pos= yypos1135; yy->__thunkpos= yythunkpos1135;  if (!yymatchString(yy, "TFOOT")) goto l1134;
+  }
+  l1135:;	  if (!yy_Spnl(yy)) goto l1134;
+  l1137:;	
+  {  int yypos1138= yy->__pos, yythunkpos1138= yy->__thunkpos;  if (!yy_HtmlAttribute(yy)) goto l1138;  goto l1137;
+  l1138:;	  yy->__pos= yypos1138; yy->__thunkpos= yythunkpos1138;
+  }  if (!yymatchChar(yy, '>')) goto l1134;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockOpenTfoot", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1134:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockOpenTfoot", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockTd(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockTd"));  if (!yy_HtmlBlockOpenTd(yy)) goto l1139;
+  l1140:;	
+  {  int yypos1141= yy->__pos, yythunkpos1141= yy->__thunkpos;
+  {  int yypos1142= yy->__pos, yythunkpos1142= yy->__thunkpos;  if (!yy_HtmlBlockTd(yy)) goto l1143;  goto l1142;
+  l1143:;	  yy->__pos= yypos1142; yy->__thunkpos= yythunkpos1142;
+  {  int yypos1144= yy->__pos, yythunkpos1144= yy->__thunkpos;  if (!yy_HtmlBlockCloseTd(yy)) goto l1144;  goto l1141;
+  l1144:;	  yy->__pos= yypos1144; yy->__thunkpos= yythunkpos1144;
+  }  if (!yymatchDot(yy)) goto l1141;
+  }
+  l1142:;	  goto l1140;
+  l1141:;	  yy->__pos= yypos1141; yy->__thunkpos= yythunkpos1141;
+  }  if (!yy_HtmlBlockCloseTd(yy)) goto l1139;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockTd", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1139:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockTd", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockCloseTd(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockCloseTd"));  if (!yymatchChar(yy, '<')) goto l1145;  if (!yy_Spnl(yy)) goto l1145;  if (!yymatchChar(yy, '/')) goto l1145;
+  {  int yypos1146= yy->__pos, yythunkpos1146= yy->__thunkpos;  if (!yymatchString(yy, "td")) goto l1147;  goto l1146;
+  l1147:;	  yy->__pos= yypos1146; yy->__thunkpos= yythunkpos1146;  if (!yymatchString(yy, "TD")) goto l1145;
+  }
+  l1146:;	  if (!yy_Spnl(yy)) goto l1145;  if (!yymatchChar(yy, '>')) goto l1145;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockCloseTd", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1145:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockCloseTd", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockOpenTd(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockOpenTd"));  if (!yymatchChar(yy, '<')) goto l1148;  if (!yy_Spnl(yy)) goto l1148;
+  {  int yypos1149= yy->__pos, yythunkpos1149= yy->__thunkpos;  if (!yymatchString(yy, "td")) goto l1150;  goto l1149;
+  l1150:;	  yy->__pos= yypos1149; yy->__thunkpos= yythunkpos1149;  if (!yymatchString(yy, "TD")) goto l1148;
+  }
+  l1149:;	  if (!yy_Spnl(yy)) goto l1148;
+  l1151:;	
+  {  int yypos1152= yy->__pos, yythunkpos1152= yy->__thunkpos;  if (!yy_HtmlAttribute(yy)) goto l1152;  goto l1151;
+  l1152:;	  yy->__pos= yypos1152; yy->__thunkpos= yythunkpos1152;
+  }  if (!yymatchChar(yy, '>')) goto l1148;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockOpenTd", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1148:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockOpenTd", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockTbody(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockTbody"));  if (!yy_HtmlBlockOpenTbody(yy)) goto l1153;
+  l1154:;	
+  {  int yypos1155= yy->__pos, yythunkpos1155= yy->__thunkpos;
+  {  int yypos1156= yy->__pos, yythunkpos1156= yy->__thunkpos;  if (!yy_HtmlBlockTbody(yy)) goto l1157;  goto l1156;
+  l1157:;	  yy->__pos= yypos1156; yy->__thunkpos= yythunkpos1156;
+  {  int yypos1158= yy->__pos, yythunkpos1158= yy->__thunkpos;  if (!yy_HtmlBlockCloseTbody(yy)) goto l1158;  goto l1155;
+  l1158:;	  yy->__pos= yypos1158; yy->__thunkpos= yythunkpos1158;
+  }  if (!yymatchDot(yy)) goto l1155;
+  }
+  l1156:;	  goto l1154;
+  l1155:;	  yy->__pos= yypos1155; yy->__thunkpos= yythunkpos1155;
+  }  if (!yy_HtmlBlockCloseTbody(yy)) goto l1153;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockTbody", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1153:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockTbody", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockCloseTbody(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockCloseTbody"));  if (!yymatchChar(yy, '<')) goto l1159;  if (!yy_Spnl(yy)) goto l1159;  if (!yymatchChar(yy, '/')) goto l1159;
+  {  int yypos1160= yy->__pos, yythunkpos1160= yy->__thunkpos;  if (!yymatchString(yy, "tbody")) goto l1161;  goto l1160;
+  l1161:;	  yy->__pos= yypos1160; yy->__thunkpos= yythunkpos1160;  if (!yymatchString(yy, "TBODY")) goto l1159;
+  }
+  l1160:;	  if (!yy_Spnl(yy)) goto l1159;  if (!yymatchChar(yy, '>')) goto l1159;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockCloseTbody", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1159:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockCloseTbody", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockOpenTbody(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockOpenTbody"));  if (!yymatchChar(yy, '<')) goto l1162;  if (!yy_Spnl(yy)) goto l1162;
+  {  int yypos1163= yy->__pos, yythunkpos1163= yy->__thunkpos;  if (!yymatchString(yy, "tbody")) goto l1164;  goto l1163;
+  l1164:;	  yy->__pos= yypos1163; yy->__thunkpos= yythunkpos1163;  if (!yymatchString(yy, "TBODY")) goto l1162;
+  }
+  l1163:;	  if (!yy_Spnl(yy)) goto l1162;
+  l1165:;	
+  {  int yypos1166= yy->__pos, yythunkpos1166= yy->__thunkpos;  if (!yy_HtmlAttribute(yy)) goto l1166;  goto l1165;
+  l1166:;	  yy->__pos= yypos1166; yy->__thunkpos= yythunkpos1166;
+  }  if (!yymatchChar(yy, '>')) goto l1162;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockOpenTbody", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1162:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockOpenTbody", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockLi(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockLi"));  if (!yy_HtmlBlockOpenLi(yy)) goto l1167;
+  l1168:;	
+  {  int yypos1169= yy->__pos, yythunkpos1169= yy->__thunkpos;
+  {  int yypos1170= yy->__pos, yythunkpos1170= yy->__thunkpos;  if (!yy_HtmlBlockLi(yy)) goto l1171;  goto l1170;
+  l1171:;	  yy->__pos= yypos1170; yy->__thunkpos= yythunkpos1170;
+  {  int yypos1172= yy->__pos, yythunkpos1172= yy->__thunkpos;  if (!yy_HtmlBlockCloseLi(yy)) goto l1172;  goto l1169;
+  l1172:;	  yy->__pos= yypos1172; yy->__thunkpos= yythunkpos1172;
+  }  if (!yymatchDot(yy)) goto l1169;
+  }
+  l1170:;	  goto l1168;
+  l1169:;	  yy->__pos= yypos1169; yy->__thunkpos= yythunkpos1169;
+  }  if (!yy_HtmlBlockCloseLi(yy)) goto l1167;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockLi", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1167:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockLi", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockCloseLi(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockCloseLi"));  if (!yymatchChar(yy, '<')) goto l1173;  if (!yy_Spnl(yy)) goto l1173;  if (!yymatchChar(yy, '/')) goto l1173;
+  {  int yypos1174= yy->__pos, yythunkpos1174= yy->__thunkpos;  if (!yymatchString(yy, "li")) goto l1175;  goto l1174;
+  l1175:;	  yy->__pos= yypos1174; yy->__thunkpos= yythunkpos1174;  if (!yymatchString(yy, "LI")) goto l1173;
+  }
+  l1174:;	  if (!yy_Spnl(yy)) goto l1173;  if (!yymatchChar(yy, '>')) goto l1173;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockCloseLi", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1173:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockCloseLi", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockOpenLi(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockOpenLi"));  if (!yymatchChar(yy, '<')) goto l1176;  if (!yy_Spnl(yy)) goto l1176;
+  {  int yypos1177= yy->__pos, yythunkpos1177= yy->__thunkpos;  if (!yymatchString(yy, "li")) goto l1178;  goto l1177;
+  l1178:;	  yy->__pos= yypos1177; yy->__thunkpos= yythunkpos1177;  if (!yymatchString(yy, "LI")) goto l1176;
+  }
+  l1177:;	  if (!yy_Spnl(yy)) goto l1176;
+  l1179:;	
+  {  int yypos1180= yy->__pos, yythunkpos1180= yy->__thunkpos;  if (!yy_HtmlAttribute(yy)) goto l1180;  goto l1179;
+  l1180:;	  yy->__pos= yypos1180; yy->__thunkpos= yythunkpos1180;
+  }  if (!yymatchChar(yy, '>')) goto l1176;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockOpenLi", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1176:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockOpenLi", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockFrameset(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockFrameset"));  if (!yy_HtmlBlockOpenFrameset(yy)) goto l1181;
+  l1182:;	
+  {  int yypos1183= yy->__pos, yythunkpos1183= yy->__thunkpos;
+  {  int yypos1184= yy->__pos, yythunkpos1184= yy->__thunkpos;  if (!yy_HtmlBlockFrameset(yy)) goto l1185;  goto l1184;
+  l1185:;	  yy->__pos= yypos1184; yy->__thunkpos= yythunkpos1184;
+  {  int yypos1186= yy->__pos, yythunkpos1186= yy->__thunkpos;  if (!yy_HtmlBlockCloseFrameset(yy)) goto l1186;  goto l1183;
+  l1186:;	  yy->__pos= yypos1186; yy->__thunkpos= yythunkpos1186;
+  }  if (!yymatchDot(yy)) goto l1183;
+  }
+  l1184:;	  goto l1182;
+  l1183:;	  yy->__pos= yypos1183; yy->__thunkpos= yythunkpos1183;
+  }  if (!yy_HtmlBlockCloseFrameset(yy)) goto l1181;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockFrameset", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1181:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockFrameset", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockCloseFrameset(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockCloseFrameset"));  if (!yymatchChar(yy, '<')) goto l1187;  if (!yy_Spnl(yy)) goto l1187;  if (!yymatchChar(yy, '/')) goto l1187;
+  {  int yypos1188= yy->__pos, yythunkpos1188= yy->__thunkpos;  if (!yymatchString(yy, "frameset")) goto l1189;  goto l1188;
+  l1189:;	  yy->__pos= yypos1188; yy->__thunkpos= yythunkpos1188;  if (!yymatchString(yy, "FRAMESET")) goto l1187;
+  }
+  l1188:;	  if (!yy_Spnl(yy)) goto l1187;  if (!yymatchChar(yy, '>')) goto l1187;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockCloseFrameset", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1187:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockCloseFrameset", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockOpenFrameset(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockOpenFrameset"));  if (!yymatchChar(yy, '<')) goto l1190;  if (!yy_Spnl(yy)) goto l1190;
+  {  int yypos1191= yy->__pos, yythunkpos1191= yy->__thunkpos;  if (!yymatchString(yy, "frameset")) goto l1192;  goto l1191;
+  l1192:;	  yy->__pos= yypos1191; yy->__thunkpos= yythunkpos1191;  if (!yymatchString(yy, "FRAMESET")) goto l1190;
+  }
+  l1191:;	  if (!yy_Spnl(yy)) goto l1190;
+  l1193:;	
+  {  int yypos1194= yy->__pos, yythunkpos1194= yy->__thunkpos;  if (!yy_HtmlAttribute(yy)) goto l1194;  goto l1193;
+  l1194:;	  yy->__pos= yypos1194; yy->__thunkpos= yythunkpos1194;
+  }  if (!yymatchChar(yy, '>')) goto l1190;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockOpenFrameset", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1190:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockOpenFrameset", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockDt(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockDt"));  if (!yy_HtmlBlockOpenDt(yy)) goto l1195;
+  l1196:;	
+  {  int yypos1197= yy->__pos, yythunkpos1197= yy->__thunkpos;
+  {  int yypos1198= yy->__pos, yythunkpos1198= yy->__thunkpos;  if (!yy_HtmlBlockDt(yy)) goto l1199;  goto l1198;
+  l1199:;	  yy->__pos= yypos1198; yy->__thunkpos= yythunkpos1198;
+  {  int yypos1200= yy->__pos, yythunkpos1200= yy->__thunkpos;  if (!yy_HtmlBlockCloseDt(yy)) goto l1200;  goto l1197;
+  l1200:;	  yy->__pos= yypos1200; yy->__thunkpos= yythunkpos1200;
+  }  if (!yymatchDot(yy)) goto l1197;
+  }
+  l1198:;	  goto l1196;
+  l1197:;	  yy->__pos= yypos1197; yy->__thunkpos= yythunkpos1197;
+  }  if (!yy_HtmlBlockCloseDt(yy)) goto l1195;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockDt", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1195:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockDt", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockCloseDt(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockCloseDt"));  if (!yymatchChar(yy, '<')) goto l1201;  if (!yy_Spnl(yy)) goto l1201;  if (!yymatchChar(yy, '/')) goto l1201;
+  {  int yypos1202= yy->__pos, yythunkpos1202= yy->__thunkpos;  if (!yymatchString(yy, "dt")) goto l1203;  goto l1202;
+  l1203:;	  yy->__pos= yypos1202; yy->__thunkpos= yythunkpos1202;  if (!yymatchString(yy, "DT")) goto l1201;
+  }
+  l1202:;	  if (!yy_Spnl(yy)) goto l1201;  if (!yymatchChar(yy, '>')) goto l1201;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockCloseDt", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1201:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockCloseDt", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockOpenDt(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockOpenDt"));  if (!yymatchChar(yy, '<')) goto l1204;  if (!yy_Spnl(yy)) goto l1204;
+  {  int yypos1205= yy->__pos, yythunkpos1205= yy->__thunkpos;  if (!yymatchString(yy, "dt")) goto l1206;  goto l1205;
+  l1206:;	  yy->__pos= yypos1205; yy->__thunkpos= yythunkpos1205;  if (!yymatchString(yy, "DT")) goto l1204;
+  }
+  l1205:;	  if (!yy_Spnl(yy)) goto l1204;
+  l1207:;	
+  {  int yypos1208= yy->__pos, yythunkpos1208= yy->__thunkpos;  if (!yy_HtmlAttribute(yy)) goto l1208;  goto l1207;
+  l1208:;	  yy->__pos= yypos1208; yy->__thunkpos= yythunkpos1208;
+  }  if (!yymatchChar(yy, '>')) goto l1204;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockOpenDt", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1204:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockOpenDt", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockDd(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockDd"));  if (!yy_HtmlBlockOpenDd(yy)) goto l1209;
+  l1210:;	
+  {  int yypos1211= yy->__pos, yythunkpos1211= yy->__thunkpos;
+  {  int yypos1212= yy->__pos, yythunkpos1212= yy->__thunkpos;  if (!yy_HtmlBlockDd(yy)) goto l1213;  goto l1212;
+  l1213:;	  yy->__pos= yypos1212; yy->__thunkpos= yythunkpos1212;
+  {  int yypos1214= yy->__pos, yythunkpos1214= yy->__thunkpos;  if (!yy_HtmlBlockCloseDd(yy)) goto l1214;  goto l1211;
+  l1214:;	  yy->__pos= yypos1214; yy->__thunkpos= yythunkpos1214;
+  }  if (!yymatchDot(yy)) goto l1211;
+  }
+  l1212:;	  goto l1210;
+  l1211:;	  yy->__pos= yypos1211; yy->__thunkpos= yythunkpos1211;
+  }  if (!yy_HtmlBlockCloseDd(yy)) goto l1209;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockDd", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1209:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockDd", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockCloseDd(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockCloseDd"));  if (!yymatchChar(yy, '<')) goto l1215;  if (!yy_Spnl(yy)) goto l1215;  if (!yymatchChar(yy, '/')) goto l1215;
+  {  int yypos1216= yy->__pos, yythunkpos1216= yy->__thunkpos;  if (!yymatchString(yy, "dd")) goto l1217;  goto l1216;
+  l1217:;	  yy->__pos= yypos1216; yy->__thunkpos= yythunkpos1216;  if (!yymatchString(yy, "DD")) goto l1215;
+  }
+  l1216:;	  if (!yy_Spnl(yy)) goto l1215;  if (!yymatchChar(yy, '>')) goto l1215;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockCloseDd", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1215:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockCloseDd", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockOpenDd(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockOpenDd"));  if (!yymatchChar(yy, '<')) goto l1218;  if (!yy_Spnl(yy)) goto l1218;
+  {  int yypos1219= yy->__pos, yythunkpos1219= yy->__thunkpos;  if (!yymatchString(yy, "dd")) goto l1220;  goto l1219;
+  l1220:;	  yy->__pos= yypos1219; yy->__thunkpos= yythunkpos1219;  if (!yymatchString(yy, "DD")) goto l1218;
+  }
+  l1219:;	  if (!yy_Spnl(yy)) goto l1218;
+  l1221:;	
+  {  int yypos1222= yy->__pos, yythunkpos1222= yy->__thunkpos;  if (!yy_HtmlAttribute(yy)) goto l1222;  goto l1221;
+  l1222:;	  yy->__pos= yypos1222; yy->__thunkpos= yythunkpos1222;
+  }  if (!yymatchChar(yy, '>')) goto l1218;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockOpenDd", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1218:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockOpenDd", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockUl(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockUl"));  if (!yy_HtmlBlockOpenUl(yy)) goto l1223;
+  l1224:;	
+  {  int yypos1225= yy->__pos, yythunkpos1225= yy->__thunkpos;
+  {  int yypos1226= yy->__pos, yythunkpos1226= yy->__thunkpos;  if (!yy_HtmlBlockUl(yy)) goto l1227;  goto l1226;
+  l1227:;	  yy->__pos= yypos1226; yy->__thunkpos= yythunkpos1226;
+  {  int yypos1228= yy->__pos, yythunkpos1228= yy->__thunkpos;  if (!yy_HtmlBlockCloseUl(yy)) goto l1228;  goto l1225;
+  l1228:;	  yy->__pos= yypos1228; yy->__thunkpos= yythunkpos1228;
+  }  if (!yymatchDot(yy)) goto l1225;
+  }
+  l1226:;	  goto l1224;
+  l1225:;	  yy->__pos= yypos1225; yy->__thunkpos= yythunkpos1225;
+  }  if (!yy_HtmlBlockCloseUl(yy)) goto l1223;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockUl", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1223:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockUl", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockCloseUl(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockCloseUl"));  if (!yymatchChar(yy, '<')) goto l1229;  if (!yy_Spnl(yy)) goto l1229;  if (!yymatchChar(yy, '/')) goto l1229;
+  {  int yypos1230= yy->__pos, yythunkpos1230= yy->__thunkpos;  if (!yymatchString(yy, "ul")) goto l1231;  goto l1230;
+  l1231:;	  yy->__pos= yypos1230; yy->__thunkpos= yythunkpos1230;  if (!yymatchString(yy, "UL")) goto l1229;
+  }
+  l1230:;	  if (!yy_Spnl(yy)) goto l1229;  if (!yymatchChar(yy, '>')) goto l1229;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockCloseUl", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1229:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockCloseUl", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockOpenUl(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockOpenUl"));  if (!yymatchChar(yy, '<')) goto l1232;  if (!yy_Spnl(yy)) goto l1232;
+  {  int yypos1233= yy->__pos, yythunkpos1233= yy->__thunkpos;  if (!yymatchString(yy, "ul")) goto l1234;  goto l1233;
+  l1234:;	  yy->__pos= yypos1233; yy->__thunkpos= yythunkpos1233;  if (!yymatchString(yy, "UL")) goto l1232;
+  }
+  l1233:;	  if (!yy_Spnl(yy)) goto l1232;
+  l1235:;	
+  {  int yypos1236= yy->__pos, yythunkpos1236= yy->__thunkpos;  if (!yy_HtmlAttribute(yy)) goto l1236;  goto l1235;
+  l1236:;	  yy->__pos= yypos1236; yy->__thunkpos= yythunkpos1236;
+  }  if (!yymatchChar(yy, '>')) goto l1232;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockOpenUl", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1232:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockOpenUl", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockTable(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockTable"));  if (!yy_HtmlBlockOpenTable(yy)) goto l1237;
+  l1238:;	
+  {  int yypos1239= yy->__pos, yythunkpos1239= yy->__thunkpos;
+  {  int yypos1240= yy->__pos, yythunkpos1240= yy->__thunkpos;  if (!yy_HtmlBlockTable(yy)) goto l1241;  goto l1240;
+  l1241:;	  yy->__pos= yypos1240; yy->__thunkpos= yythunkpos1240;
+  {  int yypos1242= yy->__pos, yythunkpos1242= yy->__thunkpos;  if (!yy_HtmlBlockCloseTable(yy)) goto l1242;  goto l1239;
+  l1242:;	  yy->__pos= yypos1242; yy->__thunkpos= yythunkpos1242;
+  }  if (!yymatchDot(yy)) goto l1239;
+  }
+  l1240:;	  goto l1238;
+  l1239:;	  yy->__pos= yypos1239; yy->__thunkpos= yythunkpos1239;
+  }  if (!yy_HtmlBlockCloseTable(yy)) goto l1237;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockTable", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1237:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockTable", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockCloseTable(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockCloseTable"));  if (!yymatchChar(yy, '<')) goto l1243;  if (!yy_Spnl(yy)) goto l1243;  if (!yymatchChar(yy, '/')) goto l1243;
+  {  int yypos1244= yy->__pos, yythunkpos1244= yy->__thunkpos;  if (!yymatchString(yy, "table")) goto l1245;  goto l1244;
+  l1245:;	  yy->__pos= yypos1244; yy->__thunkpos= yythunkpos1244;  if (!yymatchString(yy, "TABLE")) goto l1243;
+  }
+  l1244:;	  if (!yy_Spnl(yy)) goto l1243;  if (!yymatchChar(yy, '>')) goto l1243;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockCloseTable", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1243:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockCloseTable", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockOpenTable(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockOpenTable"));  if (!yymatchChar(yy, '<')) goto l1246;  if (!yy_Spnl(yy)) goto l1246;
+  {  int yypos1247= yy->__pos, yythunkpos1247= yy->__thunkpos;  if (!yymatchString(yy, "table")) goto l1248;  goto l1247;
+  l1248:;	  yy->__pos= yypos1247; yy->__thunkpos= yythunkpos1247;  if (!yymatchString(yy, "TABLE")) goto l1246;
+  }
+  l1247:;	  if (!yy_Spnl(yy)) goto l1246;
+  l1249:;	
+  {  int yypos1250= yy->__pos, yythunkpos1250= yy->__thunkpos;  if (!yy_HtmlAttribute(yy)) goto l1250;  goto l1249;
+  l1250:;	  yy->__pos= yypos1250; yy->__thunkpos= yythunkpos1250;
+  }  if (!yymatchChar(yy, '>')) goto l1246;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockOpenTable", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1246:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockOpenTable", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockPre(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockPre"));  if (!yy_HtmlBlockOpenPre(yy)) goto l1251;
+  l1252:;	
+  {  int yypos1253= yy->__pos, yythunkpos1253= yy->__thunkpos;
+  {  int yypos1254= yy->__pos, yythunkpos1254= yy->__thunkpos;  if (!yy_HtmlBlockPre(yy)) goto l1255;  goto l1254;
+  l1255:;	  yy->__pos= yypos1254; yy->__thunkpos= yythunkpos1254;
+  {  int yypos1256= yy->__pos, yythunkpos1256= yy->__thunkpos;  if (!yy_HtmlBlockClosePre(yy)) goto l1256;  goto l1253;
+  l1256:;	  yy->__pos= yypos1256; yy->__thunkpos= yythunkpos1256;
+  }  if (!yymatchDot(yy)) goto l1253;
+  }
+  l1254:;	  goto l1252;
+  l1253:;	  yy->__pos= yypos1253; yy->__thunkpos= yythunkpos1253;
+  }  if (!yy_HtmlBlockClosePre(yy)) goto l1251;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockPre", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1251:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockPre", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockClosePre(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockClosePre"));  if (!yymatchChar(yy, '<')) goto l1257;  if (!yy_Spnl(yy)) goto l1257;  if (!yymatchChar(yy, '/')) goto l1257;
+  {  int yypos1258= yy->__pos, yythunkpos1258= yy->__thunkpos;  if (!yymatchString(yy, "pre")) goto l1259;  goto l1258;
+  l1259:;	  yy->__pos= yypos1258; yy->__thunkpos= yythunkpos1258;  if (!yymatchString(yy, "PRE")) goto l1257;
+  }
+  l1258:;	  if (!yy_Spnl(yy)) goto l1257;  if (!yymatchChar(yy, '>')) goto l1257;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockClosePre", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1257:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockClosePre", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockOpenPre(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockOpenPre"));  if (!yymatchChar(yy, '<')) goto l1260;  if (!yy_Spnl(yy)) goto l1260;
+  {  int yypos1261= yy->__pos, yythunkpos1261= yy->__thunkpos;  if (!yymatchString(yy, "pre")) goto l1262;  goto l1261;
+  l1262:;	  yy->__pos= yypos1261; yy->__thunkpos= yythunkpos1261;  if (!yymatchString(yy, "PRE")) goto l1260;
+  }
+  l1261:;	  if (!yy_Spnl(yy)) goto l1260;
+  l1263:;	
+  {  int yypos1264= yy->__pos, yythunkpos1264= yy->__thunkpos;  if (!yy_HtmlAttribute(yy)) goto l1264;  goto l1263;
+  l1264:;	  yy->__pos= yypos1264; yy->__thunkpos= yythunkpos1264;
+  }  if (!yymatchChar(yy, '>')) goto l1260;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockOpenPre", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1260:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockOpenPre", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockP(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockP"));  if (!yy_HtmlBlockOpenP(yy)) goto l1265;
+  l1266:;	
+  {  int yypos1267= yy->__pos, yythunkpos1267= yy->__thunkpos;
+  {  int yypos1268= yy->__pos, yythunkpos1268= yy->__thunkpos;  if (!yy_HtmlBlockP(yy)) goto l1269;  goto l1268;
+  l1269:;	  yy->__pos= yypos1268; yy->__thunkpos= yythunkpos1268;
+  {  int yypos1270= yy->__pos, yythunkpos1270= yy->__thunkpos;  if (!yy_HtmlBlockCloseP(yy)) goto l1270;  goto l1267;
+  l1270:;	  yy->__pos= yypos1270; yy->__thunkpos= yythunkpos1270;
+  }  if (!yymatchDot(yy)) goto l1267;
+  }
+  l1268:;	  goto l1266;
+  l1267:;	  yy->__pos= yypos1267; yy->__thunkpos= yythunkpos1267;
+  }  if (!yy_HtmlBlockCloseP(yy)) goto l1265;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockP", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1265:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockP", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockCloseP(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockCloseP"));  if (!yymatchChar(yy, '<')) goto l1271;  if (!yy_Spnl(yy)) goto l1271;  if (!yymatchChar(yy, '/')) goto l1271;
+  {  int yypos1272= yy->__pos, yythunkpos1272= yy->__thunkpos;  if (!yymatchChar(yy, 'p')) goto l1273;  goto l1272;
+  l1273:;	  yy->__pos= yypos1272; yy->__thunkpos= yythunkpos1272;  if (!yymatchChar(yy, 'P')) goto l1271;
+  }
+  l1272:;	  if (!yy_Spnl(yy)) goto l1271;  if (!yymatchChar(yy, '>')) goto l1271;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockCloseP", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1271:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockCloseP", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockOpenP(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockOpenP"));  if (!yymatchChar(yy, '<')) goto l1274;  if (!yy_Spnl(yy)) goto l1274;
+  {  int yypos1275= yy->__pos, yythunkpos1275= yy->__thunkpos;  if (!yymatchChar(yy, 'p')) goto l1276;  goto l1275;
+  l1276:;	  yy->__pos= yypos1275; yy->__thunkpos= yythunkpos1275;  if (!yymatchChar(yy, 'P')) goto l1274;
+  }
+  l1275:;	  if (!yy_Spnl(yy)) goto l1274;
+  l1277:;	
+  {  int yypos1278= yy->__pos, yythunkpos1278= yy->__thunkpos;  if (!yy_HtmlAttribute(yy)) goto l1278;  goto l1277;
+  l1278:;	  yy->__pos= yypos1278; yy->__thunkpos= yythunkpos1278;
+  }  if (!yymatchChar(yy, '>')) goto l1274;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockOpenP", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1274:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockOpenP", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockOl(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockOl"));  if (!yy_HtmlBlockOpenOl(yy)) goto l1279;
+  l1280:;	
+  {  int yypos1281= yy->__pos, yythunkpos1281= yy->__thunkpos;
+  {  int yypos1282= yy->__pos, yythunkpos1282= yy->__thunkpos;  if (!yy_HtmlBlockOl(yy)) goto l1283;  goto l1282;
+  l1283:;	  yy->__pos= yypos1282; yy->__thunkpos= yythunkpos1282;
+  {  int yypos1284= yy->__pos, yythunkpos1284= yy->__thunkpos;  if (!yy_HtmlBlockCloseOl(yy)) goto l1284;  goto l1281;
+  l1284:;	  yy->__pos= yypos1284; yy->__thunkpos= yythunkpos1284;
+  }  if (!yymatchDot(yy)) goto l1281;
+  }
+  l1282:;	  goto l1280;
+  l1281:;	  yy->__pos= yypos1281; yy->__thunkpos= yythunkpos1281;
+  }  if (!yy_HtmlBlockCloseOl(yy)) goto l1279;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockOl", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1279:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockOl", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockCloseOl(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockCloseOl"));  if (!yymatchChar(yy, '<')) goto l1285;  if (!yy_Spnl(yy)) goto l1285;  if (!yymatchChar(yy, '/')) goto l1285;
+  {  int yypos1286= yy->__pos, yythunkpos1286= yy->__thunkpos;  if (!yymatchString(yy, "ol")) goto l1287;  goto l1286;
+  l1287:;	  yy->__pos= yypos1286; yy->__thunkpos= yythunkpos1286;  if (!yymatchString(yy, "OL")) goto l1285;
+  }
+  l1286:;	  if (!yy_Spnl(yy)) goto l1285;  if (!yymatchChar(yy, '>')) goto l1285;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockCloseOl", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1285:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockCloseOl", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockOpenOl(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockOpenOl"));  if (!yymatchChar(yy, '<')) goto l1288;  if (!yy_Spnl(yy)) goto l1288;
+  {  int yypos1289= yy->__pos, yythunkpos1289= yy->__thunkpos;  if (!yymatchString(yy, "ol")) goto l1290;  goto l1289;
+  l1290:;	  yy->__pos= yypos1289; yy->__thunkpos= yythunkpos1289;  if (!yymatchString(yy, "OL")) goto l1288;
+  }
+  l1289:;	  if (!yy_Spnl(yy)) goto l1288;
+  l1291:;	
+  {  int yypos1292= yy->__pos, yythunkpos1292= yy->__thunkpos;  if (!yy_HtmlAttribute(yy)) goto l1292;  goto l1291;
+  l1292:;	  yy->__pos= yypos1292; yy->__thunkpos= yythunkpos1292;
+  }  if (!yymatchChar(yy, '>')) goto l1288;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockOpenOl", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1288:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockOpenOl", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockNoscript(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockNoscript"));  if (!yy_HtmlBlockOpenNoscript(yy)) goto l1293;
+  l1294:;	
+  {  int yypos1295= yy->__pos, yythunkpos1295= yy->__thunkpos;
+  {  int yypos1296= yy->__pos, yythunkpos1296= yy->__thunkpos;  if (!yy_HtmlBlockNoscript(yy)) goto l1297;  goto l1296;
+  l1297:;	  yy->__pos= yypos1296; yy->__thunkpos= yythunkpos1296;
+  {  int yypos1298= yy->__pos, yythunkpos1298= yy->__thunkpos;  if (!yy_HtmlBlockCloseNoscript(yy)) goto l1298;  goto l1295;
+  l1298:;	  yy->__pos= yypos1298; yy->__thunkpos= yythunkpos1298;
+  }  if (!yymatchDot(yy)) goto l1295;
+  }
+  l1296:;	  goto l1294;
+  l1295:;	  yy->__pos= yypos1295; yy->__thunkpos= yythunkpos1295;
+  }  if (!yy_HtmlBlockCloseNoscript(yy)) goto l1293;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockNoscript", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1293:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockNoscript", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockCloseNoscript(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockCloseNoscript"));  if (!yymatchChar(yy, '<')) goto l1299;  if (!yy_Spnl(yy)) goto l1299;  if (!yymatchChar(yy, '/')) goto l1299;
+  {  int yypos1300= yy->__pos, yythunkpos1300= yy->__thunkpos;  if (!yymatchString(yy, "noscript")) goto l1301;  goto l1300;
+  l1301:;	  yy->__pos= yypos1300; yy->__thunkpos= yythunkpos1300;  if (!yymatchString(yy, "NOSCRIPT")) goto l1299;
+  }
+  l1300:;	  if (!yy_Spnl(yy)) goto l1299;  if (!yymatchChar(yy, '>')) goto l1299;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockCloseNoscript", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1299:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockCloseNoscript", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockOpenNoscript(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockOpenNoscript"));  if (!yymatchChar(yy, '<')) goto l1302;  if (!yy_Spnl(yy)) goto l1302;
+  {  int yypos1303= yy->__pos, yythunkpos1303= yy->__thunkpos;  if (!yymatchString(yy, "noscript")) goto l1304;  goto l1303;
+  l1304:;	  yy->__pos= yypos1303; yy->__thunkpos= yythunkpos1303;  if (!yymatchString(yy, "NOSCRIPT")) goto l1302;
+  }
+  l1303:;	  if (!yy_Spnl(yy)) goto l1302;
+  l1305:;	
+  {  int yypos1306= yy->__pos, yythunkpos1306= yy->__thunkpos;  if (!yy_HtmlAttribute(yy)) goto l1306;  goto l1305;
+  l1306:;	  yy->__pos= yypos1306; yy->__thunkpos= yythunkpos1306;
+  }  if (!yymatchChar(yy, '>')) goto l1302;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockOpenNoscript", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1302:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockOpenNoscript", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockNoframes(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockNoframes"));  if (!yy_HtmlBlockOpenNoframes(yy)) goto l1307;
+  l1308:;	
+  {  int yypos1309= yy->__pos, yythunkpos1309= yy->__thunkpos;
+  {  int yypos1310= yy->__pos, yythunkpos1310= yy->__thunkpos;  if (!yy_HtmlBlockNoframes(yy)) goto l1311;  goto l1310;
+  l1311:;	  yy->__pos= yypos1310; yy->__thunkpos= yythunkpos1310;
+  {  int yypos1312= yy->__pos, yythunkpos1312= yy->__thunkpos;  if (!yy_HtmlBlockCloseNoframes(yy)) goto l1312;  goto l1309;
+  l1312:;	  yy->__pos= yypos1312; yy->__thunkpos= yythunkpos1312;
+  }  if (!yymatchDot(yy)) goto l1309;
+  }
+  l1310:;	  goto l1308;
+  l1309:;	  yy->__pos= yypos1309; yy->__thunkpos= yythunkpos1309;
+  }  if (!yy_HtmlBlockCloseNoframes(yy)) goto l1307;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockNoframes", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1307:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockNoframes", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockCloseNoframes(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockCloseNoframes"));  if (!yymatchChar(yy, '<')) goto l1313;  if (!yy_Spnl(yy)) goto l1313;  if (!yymatchChar(yy, '/')) goto l1313;
+  {  int yypos1314= yy->__pos, yythunkpos1314= yy->__thunkpos;  if (!yymatchString(yy, "noframes")) goto l1315;  goto l1314;
+  l1315:;	  yy->__pos= yypos1314; yy->__thunkpos= yythunkpos1314;  if (!yymatchString(yy, "NOFRAMES")) goto l1313;
+  }
+  l1314:;	  if (!yy_Spnl(yy)) goto l1313;  if (!yymatchChar(yy, '>')) goto l1313;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockCloseNoframes", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1313:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockCloseNoframes", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockOpenNoframes(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockOpenNoframes"));  if (!yymatchChar(yy, '<')) goto l1316;  if (!yy_Spnl(yy)) goto l1316;
+  {  int yypos1317= yy->__pos, yythunkpos1317= yy->__thunkpos;  if (!yymatchString(yy, "noframes")) goto l1318;  goto l1317;
+  l1318:;	  yy->__pos= yypos1317; yy->__thunkpos= yythunkpos1317;  if (!yymatchString(yy, "NOFRAMES")) goto l1316;
+  }
+  l1317:;	  if (!yy_Spnl(yy)) goto l1316;
+  l1319:;	
+  {  int yypos1320= yy->__pos, yythunkpos1320= yy->__thunkpos;  if (!yy_HtmlAttribute(yy)) goto l1320;  goto l1319;
+  l1320:;	  yy->__pos= yypos1320; yy->__thunkpos= yythunkpos1320;
+  }  if (!yymatchChar(yy, '>')) goto l1316;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockOpenNoframes", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1316:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockOpenNoframes", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockMenu(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockMenu"));  if (!yy_HtmlBlockOpenMenu(yy)) goto l1321;
+  l1322:;	
+  {  int yypos1323= yy->__pos, yythunkpos1323= yy->__thunkpos;
+  {  int yypos1324= yy->__pos, yythunkpos1324= yy->__thunkpos;  if (!yy_HtmlBlockMenu(yy)) goto l1325;  goto l1324;
+  l1325:;	  yy->__pos= yypos1324; yy->__thunkpos= yythunkpos1324;
+  {  int yypos1326= yy->__pos, yythunkpos1326= yy->__thunkpos;  if (!yy_HtmlBlockCloseMenu(yy)) goto l1326;  goto l1323;
+  l1326:;	  yy->__pos= yypos1326; yy->__thunkpos= yythunkpos1326;
+  }  if (!yymatchDot(yy)) goto l1323;
+  }
+  l1324:;	  goto l1322;
+  l1323:;	  yy->__pos= yypos1323; yy->__thunkpos= yythunkpos1323;
+  }  if (!yy_HtmlBlockCloseMenu(yy)) goto l1321;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockMenu", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1321:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockMenu", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockCloseMenu(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockCloseMenu"));  if (!yymatchChar(yy, '<')) goto l1327;  if (!yy_Spnl(yy)) goto l1327;  if (!yymatchChar(yy, '/')) goto l1327;
+  {  int yypos1328= yy->__pos, yythunkpos1328= yy->__thunkpos;  if (!yymatchString(yy, "menu")) goto l1329;  goto l1328;
+  l1329:;	  yy->__pos= yypos1328; yy->__thunkpos= yythunkpos1328;  if (!yymatchString(yy, "MENU")) goto l1327;
+  }
+  l1328:;	  if (!yy_Spnl(yy)) goto l1327;  if (!yymatchChar(yy, '>')) goto l1327;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockCloseMenu", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1327:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockCloseMenu", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockOpenMenu(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockOpenMenu"));  if (!yymatchChar(yy, '<')) goto l1330;  if (!yy_Spnl(yy)) goto l1330;
+  {  int yypos1331= yy->__pos, yythunkpos1331= yy->__thunkpos;  if (!yymatchString(yy, "menu")) goto l1332;  goto l1331;
+  l1332:;	  yy->__pos= yypos1331; yy->__thunkpos= yythunkpos1331;  if (!yymatchString(yy, "MENU")) goto l1330;
+  }
+  l1331:;	  if (!yy_Spnl(yy)) goto l1330;
+  l1333:;	
+  {  int yypos1334= yy->__pos, yythunkpos1334= yy->__thunkpos;  if (!yy_HtmlAttribute(yy)) goto l1334;  goto l1333;
+  l1334:;	  yy->__pos= yypos1334; yy->__thunkpos= yythunkpos1334;
+  }  if (!yymatchChar(yy, '>')) goto l1330;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockOpenMenu", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1330:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockOpenMenu", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockH6(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockH6"));  if (!yy_HtmlBlockOpenH6(yy)) goto l1335;
+  l1336:;	
+  {  int yypos1337= yy->__pos, yythunkpos1337= yy->__thunkpos;
+  {  int yypos1338= yy->__pos, yythunkpos1338= yy->__thunkpos;  if (!yy_HtmlBlockH6(yy)) goto l1339;  goto l1338;
+  l1339:;	  yy->__pos= yypos1338; yy->__thunkpos= yythunkpos1338;
+  {  int yypos1340= yy->__pos, yythunkpos1340= yy->__thunkpos;  if (!yy_HtmlBlockCloseH6(yy)) goto l1340;  goto l1337;
+  l1340:;	  yy->__pos= yypos1340; yy->__thunkpos= yythunkpos1340;
+  }  if (!yymatchDot(yy)) goto l1337;
+  }
+  l1338:;	  goto l1336;
+  l1337:;	  yy->__pos= yypos1337; yy->__thunkpos= yythunkpos1337;
+  }  if (!yy_HtmlBlockCloseH6(yy)) goto l1335;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockH6", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1335:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockH6", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockCloseH6(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockCloseH6"));  if (!yymatchChar(yy, '<')) goto l1341;  if (!yy_Spnl(yy)) goto l1341;  if (!yymatchChar(yy, '/')) goto l1341;
+  {  int yypos1342= yy->__pos, yythunkpos1342= yy->__thunkpos;  if (!yymatchString(yy, "h6")) goto l1343;  goto l1342;
+  l1343:;	  yy->__pos= yypos1342; yy->__thunkpos= yythunkpos1342;  if (!yymatchString(yy, "H6")) goto l1341;
+  }
+  l1342:;	  if (!yy_Spnl(yy)) goto l1341;  if (!yymatchChar(yy, '>')) goto l1341;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockCloseH6", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1341:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockCloseH6", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockOpenH6(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockOpenH6"));  if (!yymatchChar(yy, '<')) goto l1344;  if (!yy_Spnl(yy)) goto l1344;
+  {  int yypos1345= yy->__pos, yythunkpos1345= yy->__thunkpos;  if (!yymatchString(yy, "h6")) goto l1346;  goto l1345;
+  l1346:;	  yy->__pos= yypos1345; yy->__thunkpos= yythunkpos1345;  if (!yymatchString(yy, "H6")) goto l1344;
+  }
+  l1345:;	  if (!yy_Spnl(yy)) goto l1344;
+  l1347:;	
+  {  int yypos1348= yy->__pos, yythunkpos1348= yy->__thunkpos;  if (!yy_HtmlAttribute(yy)) goto l1348;  goto l1347;
+  l1348:;	  yy->__pos= yypos1348; yy->__thunkpos= yythunkpos1348;
+  }  if (!yymatchChar(yy, '>')) goto l1344;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockOpenH6", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1344:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockOpenH6", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockH5(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockH5"));  if (!yy_HtmlBlockOpenH5(yy)) goto l1349;
+  l1350:;	
+  {  int yypos1351= yy->__pos, yythunkpos1351= yy->__thunkpos;
+  {  int yypos1352= yy->__pos, yythunkpos1352= yy->__thunkpos;  if (!yy_HtmlBlockH5(yy)) goto l1353;  goto l1352;
+  l1353:;	  yy->__pos= yypos1352; yy->__thunkpos= yythunkpos1352;
+  {  int yypos1354= yy->__pos, yythunkpos1354= yy->__thunkpos;  if (!yy_HtmlBlockCloseH5(yy)) goto l1354;  goto l1351;
+  l1354:;	  yy->__pos= yypos1354; yy->__thunkpos= yythunkpos1354;
+  }  if (!yymatchDot(yy)) goto l1351;
+  }
+  l1352:;	  goto l1350;
+  l1351:;	  yy->__pos= yypos1351; yy->__thunkpos= yythunkpos1351;
+  }  if (!yy_HtmlBlockCloseH5(yy)) goto l1349;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockH5", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1349:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockH5", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockCloseH5(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockCloseH5"));  if (!yymatchChar(yy, '<')) goto l1355;  if (!yy_Spnl(yy)) goto l1355;  if (!yymatchChar(yy, '/')) goto l1355;
+  {  int yypos1356= yy->__pos, yythunkpos1356= yy->__thunkpos;  if (!yymatchString(yy, "h5")) goto l1357;  goto l1356;
+  l1357:;	  yy->__pos= yypos1356; yy->__thunkpos= yythunkpos1356;  if (!yymatchString(yy, "H5")) goto l1355;
+  }
+  l1356:;	  if (!yy_Spnl(yy)) goto l1355;  if (!yymatchChar(yy, '>')) goto l1355;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockCloseH5", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1355:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockCloseH5", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockOpenH5(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockOpenH5"));  if (!yymatchChar(yy, '<')) goto l1358;  if (!yy_Spnl(yy)) goto l1358;
+  {  int yypos1359= yy->__pos, yythunkpos1359= yy->__thunkpos;  if (!yymatchString(yy, "h5")) goto l1360;  goto l1359;
+  l1360:;	  yy->__pos= yypos1359; yy->__thunkpos= yythunkpos1359;  if (!yymatchString(yy, "H5")) goto l1358;
+  }
+  l1359:;	  if (!yy_Spnl(yy)) goto l1358;
+  l1361:;	
+  {  int yypos1362= yy->__pos, yythunkpos1362= yy->__thunkpos;  if (!yy_HtmlAttribute(yy)) goto l1362;  goto l1361;
+  l1362:;	  yy->__pos= yypos1362; yy->__thunkpos= yythunkpos1362;
+  }  if (!yymatchChar(yy, '>')) goto l1358;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockOpenH5", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1358:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockOpenH5", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockH4(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockH4"));  if (!yy_HtmlBlockOpenH4(yy)) goto l1363;
+  l1364:;	
+  {  int yypos1365= yy->__pos, yythunkpos1365= yy->__thunkpos;
+  {  int yypos1366= yy->__pos, yythunkpos1366= yy->__thunkpos;  if (!yy_HtmlBlockH4(yy)) goto l1367;  goto l1366;
+  l1367:;	  yy->__pos= yypos1366; yy->__thunkpos= yythunkpos1366;
+  {  int yypos1368= yy->__pos, yythunkpos1368= yy->__thunkpos;  if (!yy_HtmlBlockCloseH4(yy)) goto l1368;  goto l1365;
+  l1368:;	  yy->__pos= yypos1368; yy->__thunkpos= yythunkpos1368;
+  }  if (!yymatchDot(yy)) goto l1365;
+  }
+  l1366:;	  goto l1364;
+  l1365:;	  yy->__pos= yypos1365; yy->__thunkpos= yythunkpos1365;
+  }  if (!yy_HtmlBlockCloseH4(yy)) goto l1363;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockH4", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1363:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockH4", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockCloseH4(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockCloseH4"));  if (!yymatchChar(yy, '<')) goto l1369;  if (!yy_Spnl(yy)) goto l1369;  if (!yymatchChar(yy, '/')) goto l1369;
+  {  int yypos1370= yy->__pos, yythunkpos1370= yy->__thunkpos;  if (!yymatchString(yy, "h4")) goto l1371;  goto l1370;
+  l1371:;	  yy->__pos= yypos1370; yy->__thunkpos= yythunkpos1370;  if (!yymatchString(yy, "H4")) goto l1369;
+  }
+  l1370:;	  if (!yy_Spnl(yy)) goto l1369;  if (!yymatchChar(yy, '>')) goto l1369;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockCloseH4", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1369:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockCloseH4", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockOpenH4(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockOpenH4"));  if (!yymatchChar(yy, '<')) goto l1372;  if (!yy_Spnl(yy)) goto l1372;
+  {  int yypos1373= yy->__pos, yythunkpos1373= yy->__thunkpos;  if (!yymatchString(yy, "h4")) goto l1374;  goto l1373;
+  l1374:;	  yy->__pos= yypos1373; yy->__thunkpos= yythunkpos1373;  if (!yymatchString(yy, "H4")) goto l1372;
+  }
+  l1373:;	  if (!yy_Spnl(yy)) goto l1372;
+  l1375:;	
+  {  int yypos1376= yy->__pos, yythunkpos1376= yy->__thunkpos;  if (!yy_HtmlAttribute(yy)) goto l1376;  goto l1375;
+  l1376:;	  yy->__pos= yypos1376; yy->__thunkpos= yythunkpos1376;
+  }  if (!yymatchChar(yy, '>')) goto l1372;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockOpenH4", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1372:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockOpenH4", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockH3(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockH3"));  if (!yy_HtmlBlockOpenH3(yy)) goto l1377;
+  l1378:;	
+  {  int yypos1379= yy->__pos, yythunkpos1379= yy->__thunkpos;
+  {  int yypos1380= yy->__pos, yythunkpos1380= yy->__thunkpos;  if (!yy_HtmlBlockH3(yy)) goto l1381;  goto l1380;
+  l1381:;	  yy->__pos= yypos1380; yy->__thunkpos= yythunkpos1380;
+  {  int yypos1382= yy->__pos, yythunkpos1382= yy->__thunkpos;  if (!yy_HtmlBlockCloseH3(yy)) goto l1382;  goto l1379;
+  l1382:;	  yy->__pos= yypos1382; yy->__thunkpos= yythunkpos1382;
+  }  if (!yymatchDot(yy)) goto l1379;
+  }
+  l1380:;	  goto l1378;
+  l1379:;	  yy->__pos= yypos1379; yy->__thunkpos= yythunkpos1379;
+  }  if (!yy_HtmlBlockCloseH3(yy)) goto l1377;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockH3", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1377:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockH3", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockCloseH3(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockCloseH3"));  if (!yymatchChar(yy, '<')) goto l1383;  if (!yy_Spnl(yy)) goto l1383;  if (!yymatchChar(yy, '/')) goto l1383;
+  {  int yypos1384= yy->__pos, yythunkpos1384= yy->__thunkpos;  if (!yymatchString(yy, "h3")) goto l1385;  goto l1384;
+  l1385:;	  yy->__pos= yypos1384; yy->__thunkpos= yythunkpos1384;  if (!yymatchString(yy, "H3")) goto l1383;
+  }
+  l1384:;	  if (!yy_Spnl(yy)) goto l1383;  if (!yymatchChar(yy, '>')) goto l1383;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockCloseH3", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1383:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockCloseH3", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockOpenH3(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockOpenH3"));  if (!yymatchChar(yy, '<')) goto l1386;  if (!yy_Spnl(yy)) goto l1386;
+  {  int yypos1387= yy->__pos, yythunkpos1387= yy->__thunkpos;  if (!yymatchString(yy, "h3")) goto l1388;  goto l1387;
+  l1388:;	  yy->__pos= yypos1387; yy->__thunkpos= yythunkpos1387;  if (!yymatchString(yy, "H3")) goto l1386;
+  }
+  l1387:;	  if (!yy_Spnl(yy)) goto l1386;
+  l1389:;	
+  {  int yypos1390= yy->__pos, yythunkpos1390= yy->__thunkpos;  if (!yy_HtmlAttribute(yy)) goto l1390;  goto l1389;
+  l1390:;	  yy->__pos= yypos1390; yy->__thunkpos= yythunkpos1390;
+  }  if (!yymatchChar(yy, '>')) goto l1386;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockOpenH3", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1386:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockOpenH3", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockH2(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockH2"));  if (!yy_HtmlBlockOpenH2(yy)) goto l1391;
+  l1392:;	
+  {  int yypos1393= yy->__pos, yythunkpos1393= yy->__thunkpos;
+  {  int yypos1394= yy->__pos, yythunkpos1394= yy->__thunkpos;  if (!yy_HtmlBlockH2(yy)) goto l1395;  goto l1394;
+  l1395:;	  yy->__pos= yypos1394; yy->__thunkpos= yythunkpos1394;
+  {  int yypos1396= yy->__pos, yythunkpos1396= yy->__thunkpos;  if (!yy_HtmlBlockCloseH2(yy)) goto l1396;  goto l1393;
+  l1396:;	  yy->__pos= yypos1396; yy->__thunkpos= yythunkpos1396;
+  }  if (!yymatchDot(yy)) goto l1393;
+  }
+  l1394:;	  goto l1392;
+  l1393:;	  yy->__pos= yypos1393; yy->__thunkpos= yythunkpos1393;
+  }  if (!yy_HtmlBlockCloseH2(yy)) goto l1391;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockH2", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1391:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockH2", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockCloseH2(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockCloseH2"));  if (!yymatchChar(yy, '<')) goto l1397;  if (!yy_Spnl(yy)) goto l1397;  if (!yymatchChar(yy, '/')) goto l1397;
+  {  int yypos1398= yy->__pos, yythunkpos1398= yy->__thunkpos;  if (!yymatchString(yy, "h2")) goto l1399;  goto l1398;
+  l1399:;	  yy->__pos= yypos1398; yy->__thunkpos= yythunkpos1398;  if (!yymatchString(yy, "H2")) goto l1397;
+  }
+  l1398:;	  if (!yy_Spnl(yy)) goto l1397;  if (!yymatchChar(yy, '>')) goto l1397;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockCloseH2", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1397:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockCloseH2", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockOpenH2(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockOpenH2"));  if (!yymatchChar(yy, '<')) goto l1400;  if (!yy_Spnl(yy)) goto l1400;
+  {  int yypos1401= yy->__pos, yythunkpos1401= yy->__thunkpos;  if (!yymatchString(yy, "h2")) goto l1402;  goto l1401;
+  l1402:;	  yy->__pos= yypos1401; yy->__thunkpos= yythunkpos1401;  if (!yymatchString(yy, "H2")) goto l1400;
+  }
+  l1401:;	  if (!yy_Spnl(yy)) goto l1400;
+  l1403:;	
+  {  int yypos1404= yy->__pos, yythunkpos1404= yy->__thunkpos;  if (!yy_HtmlAttribute(yy)) goto l1404;  goto l1403;
+  l1404:;	  yy->__pos= yypos1404; yy->__thunkpos= yythunkpos1404;
+  }  if (!yymatchChar(yy, '>')) goto l1400;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockOpenH2", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1400:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockOpenH2", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockH1(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockH1"));  if (!yy_HtmlBlockOpenH1(yy)) goto l1405;
+  l1406:;	
+  {  int yypos1407= yy->__pos, yythunkpos1407= yy->__thunkpos;
+  {  int yypos1408= yy->__pos, yythunkpos1408= yy->__thunkpos;  if (!yy_HtmlBlockH1(yy)) goto l1409;  goto l1408;
+  l1409:;	  yy->__pos= yypos1408; yy->__thunkpos= yythunkpos1408;
+  {  int yypos1410= yy->__pos, yythunkpos1410= yy->__thunkpos;  if (!yy_HtmlBlockCloseH1(yy)) goto l1410;  goto l1407;
+  l1410:;	  yy->__pos= yypos1410; yy->__thunkpos= yythunkpos1410;
+  }  if (!yymatchDot(yy)) goto l1407;
+  }
+  l1408:;	  goto l1406;
+  l1407:;	  yy->__pos= yypos1407; yy->__thunkpos= yythunkpos1407;
+  }  if (!yy_HtmlBlockCloseH1(yy)) goto l1405;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockH1", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1405:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockH1", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockCloseH1(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockCloseH1"));  if (!yymatchChar(yy, '<')) goto l1411;  if (!yy_Spnl(yy)) goto l1411;  if (!yymatchChar(yy, '/')) goto l1411;
+  {  int yypos1412= yy->__pos, yythunkpos1412= yy->__thunkpos;  if (!yymatchString(yy, "h1")) goto l1413;  goto l1412;
+  l1413:;	  yy->__pos= yypos1412; yy->__thunkpos= yythunkpos1412;  if (!yymatchString(yy, "H1")) goto l1411;
+  }
+  l1412:;	  if (!yy_Spnl(yy)) goto l1411;  if (!yymatchChar(yy, '>')) goto l1411;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockCloseH1", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1411:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockCloseH1", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockOpenH1(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockOpenH1"));  if (!yymatchChar(yy, '<')) goto l1414;  if (!yy_Spnl(yy)) goto l1414;
+  {  int yypos1415= yy->__pos, yythunkpos1415= yy->__thunkpos;  if (!yymatchString(yy, "h1")) goto l1416;  goto l1415;
+  l1416:;	  yy->__pos= yypos1415; yy->__thunkpos= yythunkpos1415;  if (!yymatchString(yy, "H1")) goto l1414;
+  }
+  l1415:;	  if (!yy_Spnl(yy)) goto l1414;
+  l1417:;	
+  {  int yypos1418= yy->__pos, yythunkpos1418= yy->__thunkpos;  if (!yy_HtmlAttribute(yy)) goto l1418;  goto l1417;
+  l1418:;	  yy->__pos= yypos1418; yy->__thunkpos= yythunkpos1418;
+  }  if (!yymatchChar(yy, '>')) goto l1414;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockOpenH1", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1414:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockOpenH1", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockForm(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockForm"));  if (!yy_HtmlBlockOpenForm(yy)) goto l1419;
+  l1420:;	
+  {  int yypos1421= yy->__pos, yythunkpos1421= yy->__thunkpos;
+  {  int yypos1422= yy->__pos, yythunkpos1422= yy->__thunkpos;  if (!yy_HtmlBlockForm(yy)) goto l1423;  goto l1422;
+  l1423:;	  yy->__pos= yypos1422; yy->__thunkpos= yythunkpos1422;
+  {  int yypos1424= yy->__pos, yythunkpos1424= yy->__thunkpos;  if (!yy_HtmlBlockCloseForm(yy)) goto l1424;  goto l1421;
+  l1424:;	  yy->__pos= yypos1424; yy->__thunkpos= yythunkpos1424;
+  }  if (!yymatchDot(yy)) goto l1421;
+  }
+  l1422:;	  goto l1420;
+  l1421:;	  yy->__pos= yypos1421; yy->__thunkpos= yythunkpos1421;
+  }  if (!yy_HtmlBlockCloseForm(yy)) goto l1419;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockForm", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1419:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockForm", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockCloseForm(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockCloseForm"));  if (!yymatchChar(yy, '<')) goto l1425;  if (!yy_Spnl(yy)) goto l1425;  if (!yymatchChar(yy, '/')) goto l1425;
+  {  int yypos1426= yy->__pos, yythunkpos1426= yy->__thunkpos;  if (!yymatchString(yy, "form")) goto l1427;  goto l1426;
+  l1427:;	  yy->__pos= yypos1426; yy->__thunkpos= yythunkpos1426;  if (!yymatchString(yy, "FORM")) goto l1425;
+  }
+  l1426:;	  if (!yy_Spnl(yy)) goto l1425;  if (!yymatchChar(yy, '>')) goto l1425;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockCloseForm", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1425:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockCloseForm", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockOpenForm(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockOpenForm"));  if (!yymatchChar(yy, '<')) goto l1428;  if (!yy_Spnl(yy)) goto l1428;
+  {  int yypos1429= yy->__pos, yythunkpos1429= yy->__thunkpos;  if (!yymatchString(yy, "form")) goto l1430;  goto l1429;
+  l1430:;	  yy->__pos= yypos1429; yy->__thunkpos= yythunkpos1429;  if (!yymatchString(yy, "FORM")) goto l1428;
+  }
+  l1429:;	  if (!yy_Spnl(yy)) goto l1428;
+  l1431:;	
+  {  int yypos1432= yy->__pos, yythunkpos1432= yy->__thunkpos;  if (!yy_HtmlAttribute(yy)) goto l1432;  goto l1431;
+  l1432:;	  yy->__pos= yypos1432; yy->__thunkpos= yythunkpos1432;
+  }  if (!yymatchChar(yy, '>')) goto l1428;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockOpenForm", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1428:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockOpenForm", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockFieldset(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockFieldset"));  if (!yy_HtmlBlockOpenFieldset(yy)) goto l1433;
+  l1434:;	
+  {  int yypos1435= yy->__pos, yythunkpos1435= yy->__thunkpos;
+  {  int yypos1436= yy->__pos, yythunkpos1436= yy->__thunkpos;  if (!yy_HtmlBlockFieldset(yy)) goto l1437;  goto l1436;
+  l1437:;	  yy->__pos= yypos1436; yy->__thunkpos= yythunkpos1436;
+  {  int yypos1438= yy->__pos, yythunkpos1438= yy->__thunkpos;  if (!yy_HtmlBlockCloseFieldset(yy)) goto l1438;  goto l1435;
+  l1438:;	  yy->__pos= yypos1438; yy->__thunkpos= yythunkpos1438;
+  }  if (!yymatchDot(yy)) goto l1435;
+  }
+  l1436:;	  goto l1434;
+  l1435:;	  yy->__pos= yypos1435; yy->__thunkpos= yythunkpos1435;
+  }  if (!yy_HtmlBlockCloseFieldset(yy)) goto l1433;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockFieldset", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1433:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockFieldset", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockCloseFieldset(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockCloseFieldset"));  if (!yymatchChar(yy, '<')) goto l1439;  if (!yy_Spnl(yy)) goto l1439;  if (!yymatchChar(yy, '/')) goto l1439;
+  {  int yypos1440= yy->__pos, yythunkpos1440= yy->__thunkpos;  if (!yymatchString(yy, "fieldset")) goto l1441;  goto l1440;
+  l1441:;	  yy->__pos= yypos1440; yy->__thunkpos= yythunkpos1440;  if (!yymatchString(yy, "FIELDSET")) goto l1439;
+  }
+  l1440:;	  if (!yy_Spnl(yy)) goto l1439;  if (!yymatchChar(yy, '>')) goto l1439;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockCloseFieldset", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1439:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockCloseFieldset", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockOpenFieldset(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockOpenFieldset"));  if (!yymatchChar(yy, '<')) goto l1442;  if (!yy_Spnl(yy)) goto l1442;
+  {  int yypos1443= yy->__pos, yythunkpos1443= yy->__thunkpos;  if (!yymatchString(yy, "fieldset")) goto l1444;  goto l1443;
+  l1444:;	  yy->__pos= yypos1443; yy->__thunkpos= yythunkpos1443;  if (!yymatchString(yy, "FIELDSET")) goto l1442;
+  }
+  l1443:;	  if (!yy_Spnl(yy)) goto l1442;
+  l1445:;	
+  {  int yypos1446= yy->__pos, yythunkpos1446= yy->__thunkpos;  if (!yy_HtmlAttribute(yy)) goto l1446;  goto l1445;
+  l1446:;	  yy->__pos= yypos1446; yy->__thunkpos= yythunkpos1446;
+  }  if (!yymatchChar(yy, '>')) goto l1442;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockOpenFieldset", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1442:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockOpenFieldset", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockDl(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockDl"));  if (!yy_HtmlBlockOpenDl(yy)) goto l1447;
+  l1448:;	
+  {  int yypos1449= yy->__pos, yythunkpos1449= yy->__thunkpos;
+  {  int yypos1450= yy->__pos, yythunkpos1450= yy->__thunkpos;  if (!yy_HtmlBlockDl(yy)) goto l1451;  goto l1450;
+  l1451:;	  yy->__pos= yypos1450; yy->__thunkpos= yythunkpos1450;
+  {  int yypos1452= yy->__pos, yythunkpos1452= yy->__thunkpos;  if (!yy_HtmlBlockCloseDl(yy)) goto l1452;  goto l1449;
+  l1452:;	  yy->__pos= yypos1452; yy->__thunkpos= yythunkpos1452;
+  }  if (!yymatchDot(yy)) goto l1449;
+  }
+  l1450:;	  goto l1448;
+  l1449:;	  yy->__pos= yypos1449; yy->__thunkpos= yythunkpos1449;
+  }  if (!yy_HtmlBlockCloseDl(yy)) goto l1447;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockDl", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1447:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockDl", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockCloseDl(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockCloseDl"));  if (!yymatchChar(yy, '<')) goto l1453;  if (!yy_Spnl(yy)) goto l1453;  if (!yymatchChar(yy, '/')) goto l1453;
+  {  int yypos1454= yy->__pos, yythunkpos1454= yy->__thunkpos;  if (!yymatchString(yy, "dl")) goto l1455;  goto l1454;
+  l1455:;	  yy->__pos= yypos1454; yy->__thunkpos= yythunkpos1454;  if (!yymatchString(yy, "DL")) goto l1453;
+  }
+  l1454:;	  if (!yy_Spnl(yy)) goto l1453;  if (!yymatchChar(yy, '>')) goto l1453;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockCloseDl", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1453:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockCloseDl", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockOpenDl(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockOpenDl"));  if (!yymatchChar(yy, '<')) goto l1456;  if (!yy_Spnl(yy)) goto l1456;
+  {  int yypos1457= yy->__pos, yythunkpos1457= yy->__thunkpos;  if (!yymatchString(yy, "dl")) goto l1458;  goto l1457;
+  l1458:;	  yy->__pos= yypos1457; yy->__thunkpos= yythunkpos1457;  if (!yymatchString(yy, "DL")) goto l1456;
+  }
+  l1457:;	  if (!yy_Spnl(yy)) goto l1456;
+  l1459:;	
+  {  int yypos1460= yy->__pos, yythunkpos1460= yy->__thunkpos;  if (!yy_HtmlAttribute(yy)) goto l1460;  goto l1459;
+  l1460:;	  yy->__pos= yypos1460; yy->__thunkpos= yythunkpos1460;
+  }  if (!yymatchChar(yy, '>')) goto l1456;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockOpenDl", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1456:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockOpenDl", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockDiv(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockDiv"));  if (!yy_HtmlBlockOpenDiv(yy)) goto l1461;
+  l1462:;	
+  {  int yypos1463= yy->__pos, yythunkpos1463= yy->__thunkpos;
+  {  int yypos1464= yy->__pos, yythunkpos1464= yy->__thunkpos;  if (!yy_HtmlBlockDiv(yy)) goto l1465;  goto l1464;
+  l1465:;	  yy->__pos= yypos1464; yy->__thunkpos= yythunkpos1464;
+  {  int yypos1466= yy->__pos, yythunkpos1466= yy->__thunkpos;  if (!yy_HtmlBlockCloseDiv(yy)) goto l1466;  goto l1463;
+  l1466:;	  yy->__pos= yypos1466; yy->__thunkpos= yythunkpos1466;
+  }  if (!yymatchDot(yy)) goto l1463;
+  }
+  l1464:;	  goto l1462;
+  l1463:;	  yy->__pos= yypos1463; yy->__thunkpos= yythunkpos1463;
+  }  if (!yy_HtmlBlockCloseDiv(yy)) goto l1461;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockDiv", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1461:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockDiv", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockCloseDiv(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockCloseDiv"));  if (!yymatchChar(yy, '<')) goto l1467;  if (!yy_Spnl(yy)) goto l1467;  if (!yymatchChar(yy, '/')) goto l1467;
+  {  int yypos1468= yy->__pos, yythunkpos1468= yy->__thunkpos;  if (!yymatchString(yy, "div")) goto l1469;  goto l1468;
+  l1469:;	  yy->__pos= yypos1468; yy->__thunkpos= yythunkpos1468;  if (!yymatchString(yy, "DIV")) goto l1467;
+  }
+  l1468:;	  if (!yy_Spnl(yy)) goto l1467;  if (!yymatchChar(yy, '>')) goto l1467;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockCloseDiv", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1467:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockCloseDiv", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockDir(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockDir"));  if (!yy_HtmlBlockOpenDir(yy)) goto l1470;
+  l1471:;	
+  {  int yypos1472= yy->__pos, yythunkpos1472= yy->__thunkpos;
+  {  int yypos1473= yy->__pos, yythunkpos1473= yy->__thunkpos;  if (!yy_HtmlBlockDir(yy)) goto l1474;  goto l1473;
+  l1474:;	  yy->__pos= yypos1473; yy->__thunkpos= yythunkpos1473;
+  {  int yypos1475= yy->__pos, yythunkpos1475= yy->__thunkpos;  if (!yy_HtmlBlockCloseDir(yy)) goto l1475;  goto l1472;
+  l1475:;	  yy->__pos= yypos1475; yy->__thunkpos= yythunkpos1475;
+  }  if (!yymatchDot(yy)) goto l1472;
+  }
+  l1473:;	  goto l1471;
+  l1472:;	  yy->__pos= yypos1472; yy->__thunkpos= yythunkpos1472;
+  }  if (!yy_HtmlBlockCloseDir(yy)) goto l1470;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockDir", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1470:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockDir", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockCloseDir(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockCloseDir"));  if (!yymatchChar(yy, '<')) goto l1476;  if (!yy_Spnl(yy)) goto l1476;  if (!yymatchChar(yy, '/')) goto l1476;
+  {  int yypos1477= yy->__pos, yythunkpos1477= yy->__thunkpos;  if (!yymatchString(yy, "dir")) goto l1478;  goto l1477;
+  l1478:;	  yy->__pos= yypos1477; yy->__thunkpos= yythunkpos1477;  if (!yymatchString(yy, "DIR")) goto l1476;
+  }
+  l1477:;	  if (!yy_Spnl(yy)) goto l1476;  if (!yymatchChar(yy, '>')) goto l1476;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockCloseDir", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1476:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockCloseDir", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockOpenDir(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockOpenDir"));  if (!yymatchChar(yy, '<')) goto l1479;  if (!yy_Spnl(yy)) goto l1479;
+  {  int yypos1480= yy->__pos, yythunkpos1480= yy->__thunkpos;  if (!yymatchString(yy, "dir")) goto l1481;  goto l1480;
+  l1481:;	  yy->__pos= yypos1480; yy->__thunkpos= yythunkpos1480;  if (!yymatchString(yy, "DIR")) goto l1479;
+  }
+  l1480:;	  if (!yy_Spnl(yy)) goto l1479;
+  l1482:;	
+  {  int yypos1483= yy->__pos, yythunkpos1483= yy->__thunkpos;  if (!yy_HtmlAttribute(yy)) goto l1483;  goto l1482;
+  l1483:;	  yy->__pos= yypos1483; yy->__thunkpos= yythunkpos1483;
+  }  if (!yymatchChar(yy, '>')) goto l1479;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockOpenDir", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1479:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockOpenDir", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockCenter(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockCenter"));  if (!yy_HtmlBlockOpenCenter(yy)) goto l1484;
+  l1485:;	
+  {  int yypos1486= yy->__pos, yythunkpos1486= yy->__thunkpos;
+  {  int yypos1487= yy->__pos, yythunkpos1487= yy->__thunkpos;  if (!yy_HtmlBlockCenter(yy)) goto l1488;  goto l1487;
+  l1488:;	  yy->__pos= yypos1487; yy->__thunkpos= yythunkpos1487;
+  {  int yypos1489= yy->__pos, yythunkpos1489= yy->__thunkpos;  if (!yy_HtmlBlockCloseCenter(yy)) goto l1489;  goto l1486;
+  l1489:;	  yy->__pos= yypos1489; yy->__thunkpos= yythunkpos1489;
+  }  if (!yymatchDot(yy)) goto l1486;
+  }
+  l1487:;	  goto l1485;
+  l1486:;	  yy->__pos= yypos1486; yy->__thunkpos= yythunkpos1486;
+  }  if (!yy_HtmlBlockCloseCenter(yy)) goto l1484;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockCenter", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1484:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockCenter", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockCloseCenter(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockCloseCenter"));  if (!yymatchChar(yy, '<')) goto l1490;  if (!yy_Spnl(yy)) goto l1490;  if (!yymatchChar(yy, '/')) goto l1490;
+  {  int yypos1491= yy->__pos, yythunkpos1491= yy->__thunkpos;  if (!yymatchString(yy, "center")) goto l1492;  goto l1491;
+  l1492:;	  yy->__pos= yypos1491; yy->__thunkpos= yythunkpos1491;  if (!yymatchString(yy, "CENTER")) goto l1490;
+  }
+  l1491:;	  if (!yy_Spnl(yy)) goto l1490;  if (!yymatchChar(yy, '>')) goto l1490;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockCloseCenter", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1490:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockCloseCenter", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockOpenCenter(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockOpenCenter"));  if (!yymatchChar(yy, '<')) goto l1493;  if (!yy_Spnl(yy)) goto l1493;
+  {  int yypos1494= yy->__pos, yythunkpos1494= yy->__thunkpos;  if (!yymatchString(yy, "center")) goto l1495;  goto l1494;
+  l1495:;	  yy->__pos= yypos1494; yy->__thunkpos= yythunkpos1494;  if (!yymatchString(yy, "CENTER")) goto l1493;
+  }
+  l1494:;	  if (!yy_Spnl(yy)) goto l1493;
+  l1496:;	
+  {  int yypos1497= yy->__pos, yythunkpos1497= yy->__thunkpos;  if (!yy_HtmlAttribute(yy)) goto l1497;  goto l1496;
+  l1497:;	  yy->__pos= yypos1497; yy->__thunkpos= yythunkpos1497;
+  }  if (!yymatchChar(yy, '>')) goto l1493;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockOpenCenter", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1493:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockOpenCenter", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockBlockquote(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockBlockquote"));  if (!yy_HtmlBlockOpenBlockquote(yy)) goto l1498;
+  l1499:;	
+  {  int yypos1500= yy->__pos, yythunkpos1500= yy->__thunkpos;
+  {  int yypos1501= yy->__pos, yythunkpos1501= yy->__thunkpos;  if (!yy_HtmlBlockBlockquote(yy)) goto l1502;  goto l1501;
+  l1502:;	  yy->__pos= yypos1501; yy->__thunkpos= yythunkpos1501;
+  {  int yypos1503= yy->__pos, yythunkpos1503= yy->__thunkpos;  if (!yy_HtmlBlockCloseBlockquote(yy)) goto l1503;  goto l1500;
+  l1503:;	  yy->__pos= yypos1503; yy->__thunkpos= yythunkpos1503;
+  }  if (!yymatchDot(yy)) goto l1500;
+  }
+  l1501:;	  goto l1499;
+  l1500:;	  yy->__pos= yypos1500; yy->__thunkpos= yythunkpos1500;
+  }  if (!yy_HtmlBlockCloseBlockquote(yy)) goto l1498;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockBlockquote", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1498:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockBlockquote", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockCloseBlockquote(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockCloseBlockquote"));  if (!yymatchChar(yy, '<')) goto l1504;  if (!yy_Spnl(yy)) goto l1504;  if (!yymatchChar(yy, '/')) goto l1504;
+  {  int yypos1505= yy->__pos, yythunkpos1505= yy->__thunkpos;  if (!yymatchString(yy, "blockquote")) goto l1506;  goto l1505;
+  l1506:;	  yy->__pos= yypos1505; yy->__thunkpos= yythunkpos1505;  if (!yymatchString(yy, "BLOCKQUOTE")) goto l1504;
+  }
+  l1505:;	  if (!yy_Spnl(yy)) goto l1504;  if (!yymatchChar(yy, '>')) goto l1504;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockCloseBlockquote", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1504:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockCloseBlockquote", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockOpenBlockquote(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockOpenBlockquote"));  if (!yymatchChar(yy, '<')) goto l1507;  if (!yy_Spnl(yy)) goto l1507;
+  {  int yypos1508= yy->__pos, yythunkpos1508= yy->__thunkpos;  if (!yymatchString(yy, "blockquote")) goto l1509;  goto l1508;
+  l1509:;	  yy->__pos= yypos1508; yy->__thunkpos= yythunkpos1508;  if (!yymatchString(yy, "BLOCKQUOTE")) goto l1507;
+  }
+  l1508:;	  if (!yy_Spnl(yy)) goto l1507;
+  l1510:;	
+  {  int yypos1511= yy->__pos, yythunkpos1511= yy->__thunkpos;  if (!yy_HtmlAttribute(yy)) goto l1511;  goto l1510;
+  l1511:;	  yy->__pos= yypos1511; yy->__thunkpos= yythunkpos1511;
+  }  if (!yymatchChar(yy, '>')) goto l1507;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockOpenBlockquote", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1507:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockOpenBlockquote", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockAddress(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockAddress"));  if (!yy_HtmlBlockOpenAddress(yy)) goto l1512;
+  l1513:;	
+  {  int yypos1514= yy->__pos, yythunkpos1514= yy->__thunkpos;
+  {  int yypos1515= yy->__pos, yythunkpos1515= yy->__thunkpos;  if (!yy_HtmlBlockAddress(yy)) goto l1516;  goto l1515;
+  l1516:;	  yy->__pos= yypos1515; yy->__thunkpos= yythunkpos1515;
+  {  int yypos1517= yy->__pos, yythunkpos1517= yy->__thunkpos;  if (!yy_HtmlBlockCloseAddress(yy)) goto l1517;  goto l1514;
+  l1517:;	  yy->__pos= yypos1517; yy->__thunkpos= yythunkpos1517;
+  }  if (!yymatchDot(yy)) goto l1514;
+  }
+  l1515:;	  goto l1513;
+  l1514:;	  yy->__pos= yypos1514; yy->__thunkpos= yythunkpos1514;
+  }  if (!yy_HtmlBlockCloseAddress(yy)) goto l1512;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockAddress", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1512:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockAddress", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockCloseAddress(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockCloseAddress"));  if (!yymatchChar(yy, '<')) goto l1518;  if (!yy_Spnl(yy)) goto l1518;  if (!yymatchChar(yy, '/')) goto l1518;
+  {  int yypos1519= yy->__pos, yythunkpos1519= yy->__thunkpos;  if (!yymatchString(yy, "address")) goto l1520;  goto l1519;
+  l1520:;	  yy->__pos= yypos1519; yy->__thunkpos= yythunkpos1519;  if (!yymatchString(yy, "ADDRESS")) goto l1518;
+  }
+  l1519:;	  if (!yy_Spnl(yy)) goto l1518;  if (!yymatchChar(yy, '>')) goto l1518;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockCloseAddress", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1518:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockCloseAddress", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlAttribute(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlAttribute"));
+  {  int yypos1524= yy->__pos, yythunkpos1524= yy->__thunkpos;  if (!yy_AlphanumericAscii(yy)) goto l1525;  goto l1524;
+  l1525:;	  yy->__pos= yypos1524; yy->__thunkpos= yythunkpos1524;  if (!yymatchChar(yy, '-')) goto l1521;
+  }
+  l1524:;	
+  l1522:;	
+  {  int yypos1523= yy->__pos, yythunkpos1523= yy->__thunkpos;
+  {  int yypos1526= yy->__pos, yythunkpos1526= yy->__thunkpos;  if (!yy_AlphanumericAscii(yy)) goto l1527;  goto l1526;
+  l1527:;	  yy->__pos= yypos1526; yy->__thunkpos= yythunkpos1526;  if (!yymatchChar(yy, '-')) goto l1523;
+  }
+  l1526:;	  goto l1522;
+  l1523:;	  yy->__pos= yypos1523; yy->__thunkpos= yythunkpos1523;
+  }  if (!yy_Spnl(yy)) goto l1521;
+  {  int yypos1528= yy->__pos, yythunkpos1528= yy->__thunkpos;  if (!yymatchChar(yy, '=')) goto l1528;  if (!yy_Spnl(yy)) goto l1528;
+  {  int yypos1530= yy->__pos, yythunkpos1530= yy->__thunkpos;  if (!yy_Quoted(yy)) goto l1531;  goto l1530;
+  l1531:;	  yy->__pos= yypos1530; yy->__thunkpos= yythunkpos1530;
+  {  int yypos1534= yy->__pos, yythunkpos1534= yy->__thunkpos;  if (!yymatchChar(yy, '>')) goto l1534;  goto l1528;
+  l1534:;	  yy->__pos= yypos1534; yy->__thunkpos= yythunkpos1534;
+  }  if (!yy_Nonspacechar(yy)) goto l1528;
+  l1532:;	
+  {  int yypos1533= yy->__pos, yythunkpos1533= yy->__thunkpos;
+  {  int yypos1535= yy->__pos, yythunkpos1535= yy->__thunkpos;  if (!yymatchChar(yy, '>')) goto l1535;  goto l1533;
+  l1535:;	  yy->__pos= yypos1535; yy->__thunkpos= yythunkpos1535;
+  }  if (!yy_Nonspacechar(yy)) goto l1533;  goto l1532;
+  l1533:;	  yy->__pos= yypos1533; yy->__thunkpos= yythunkpos1533;
+  }
+  }
+  l1530:;	  goto l1529;
+  l1528:;	  yy->__pos= yypos1528; yy->__thunkpos= yythunkpos1528;
+  }
+  l1529:;	  if (!yy_Spnl(yy)) goto l1521;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlAttribute", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1521:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlAttribute", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_Spnl(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "Spnl"));  if (!yy_Sp(yy)) goto l1536;
+  {  int yypos1537= yy->__pos, yythunkpos1537= yy->__thunkpos;  if (!yy_Newline(yy)) goto l1537;  if (!yy_Sp(yy)) goto l1537;  goto l1538;
+  l1537:;	  yy->__pos= yypos1537; yy->__thunkpos= yythunkpos1537;
+  }
+  l1538:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "Spnl", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1536:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Spnl", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockOpenAddress(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockOpenAddress"));  if (!yymatchChar(yy, '<')) goto l1539;  if (!yy_Spnl(yy)) goto l1539;
+  {  int yypos1540= yy->__pos, yythunkpos1540= yy->__thunkpos;  if (!yymatchString(yy, "address")) goto l1541;  goto l1540;
+  l1541:;	  yy->__pos= yypos1540; yy->__thunkpos= yythunkpos1540;  if (!yymatchString(yy, "ADDRESS")) goto l1539;
+  }
+  l1540:;	  if (!yy_Spnl(yy)) goto l1539;
+  l1542:;	
+  {  int yypos1543= yy->__pos, yythunkpos1543= yy->__thunkpos;  if (!yy_HtmlAttribute(yy)) goto l1543;  goto l1542;
+  l1543:;	  yy->__pos= yypos1543; yy->__thunkpos= yythunkpos1543;
+  }  if (!yymatchChar(yy, '>')) goto l1539;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockOpenAddress", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1539:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockOpenAddress", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_OptionallyIndentedLine(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "OptionallyIndentedLine"));
+  {  int yypos1545= yy->__pos, yythunkpos1545= yy->__thunkpos;  if (!yy_Indent(yy)) goto l1545;  goto l1546;
+  l1545:;	  yy->__pos= yypos1545; yy->__thunkpos= yythunkpos1545;
+  }
+  l1546:;	  if (!yy_Line(yy)) goto l1544;
+  yyprintf((stderr, "  ok   %s @ %s\n", "OptionallyIndentedLine", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1544:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "OptionallyIndentedLine", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_Indent(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "Indent"));
+  {  int yypos1548= yy->__pos, yythunkpos1548= yy->__thunkpos;  if (!yymatchChar(yy, '\t')) goto l1549;  goto l1548;
+  l1549:;	  yy->__pos= yypos1548; yy->__thunkpos= yythunkpos1548;  if (!yymatchString(yy, "    ")) goto l1547;
+  }
+  l1548:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "Indent", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1547:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Indent", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_ListBlockLine(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "ListBlockLine"));
+  {  int yypos1551= yy->__pos, yythunkpos1551= yy->__thunkpos;  if (!yy_BlankLine(yy)) goto l1551;  goto l1550;
+  l1551:;	  yy->__pos= yypos1551; yy->__thunkpos= yythunkpos1551;
+  }
+  {  int yypos1552= yy->__pos, yythunkpos1552= yy->__thunkpos;
+  {  int yypos1553= yy->__pos, yythunkpos1553= yy->__thunkpos;  if (!yy_Indent(yy)) goto l1553;  goto l1554;
+  l1553:;	  yy->__pos= yypos1553; yy->__thunkpos= yythunkpos1553;
+  }
+  l1554:;	
+  {  int yypos1555= yy->__pos, yythunkpos1555= yy->__thunkpos;  if (!yy_Bullet(yy)) goto l1556;  goto l1555;
+  l1556:;	  yy->__pos= yypos1555; yy->__thunkpos= yythunkpos1555;  if (!yy_Enumerator(yy)) goto l1552;
+  }
+  l1555:;	  goto l1550;
+  l1552:;	  yy->__pos= yypos1552; yy->__thunkpos= yythunkpos1552;
+  }
+  {  int yypos1557= yy->__pos, yythunkpos1557= yy->__thunkpos;  if (!yy_HorizontalRule(yy)) goto l1557;  goto l1550;
+  l1557:;	  yy->__pos= yypos1557; yy->__thunkpos= yythunkpos1557;
+  }  if (!yy_OptionallyIndentedLine(yy)) goto l1550;
+  yyprintf((stderr, "  ok   %s @ %s\n", "ListBlockLine", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1550:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "ListBlockLine", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_ListContinuationBlock(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;  yyDo(yy, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "ListContinuationBlock"));  if (!yy_StartList(yy)) goto l1558;  yyDo(yy, yySet, -1, 0);  if (!(YY_BEGIN)) goto l1558;
+  l1559:;	
+  {  int yypos1560= yy->__pos, yythunkpos1560= yy->__thunkpos;  if (!yy_BlankLine(yy)) goto l1560;  goto l1559;
+  l1560:;	  yy->__pos= yypos1560; yy->__thunkpos= yythunkpos1560;
+  }  if (!(YY_END)) goto l1558;  yyDo(yy, yy_1_ListContinuationBlock, yy->__begin, yy->__end);  if (!yy_Indent(yy)) goto l1558;  if (!yy_ListBlock(yy)) goto l1558;  yyDo(yy, yy_2_ListContinuationBlock, yy->__begin, yy->__end);
+  l1561:;	
+  {  int yypos1562= yy->__pos, yythunkpos1562= yy->__thunkpos;  if (!yy_Indent(yy)) goto l1562;  if (!yy_ListBlock(yy)) goto l1562;  yyDo(yy, yy_2_ListContinuationBlock, yy->__begin, yy->__end);  goto l1561;
+  l1562:;	  yy->__pos= yypos1562; yy->__thunkpos= yythunkpos1562;
+  }  yyDo(yy, yy_3_ListContinuationBlock, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "ListContinuationBlock", yy->__buf+yy->__pos-yy->__base));  yyDo(yy, yyPop, 1, 0);
+  return 1;
+  l1558:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "ListContinuationBlock", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_ListBlock(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;  yyDo(yy, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "ListBlock"));  if (!yy_StartList(yy)) goto l1563;  yyDo(yy, yySet, -1, 0);
+  {  int yypos1564= yy->__pos, yythunkpos1564= yy->__thunkpos;  if (!yy_BlankLine(yy)) goto l1564;  goto l1563;
+  l1564:;	  yy->__pos= yypos1564; yy->__thunkpos= yythunkpos1564;
+  }  if (!yy_Line(yy)) goto l1563;  yyDo(yy, yy_1_ListBlock, yy->__begin, yy->__end);
+  l1565:;	
+  {  int yypos1566= yy->__pos, yythunkpos1566= yy->__thunkpos;  if (!yy_ListBlockLine(yy)) goto l1566;  yyDo(yy, yy_2_ListBlock, yy->__begin, yy->__end);  goto l1565;
+  l1566:;	  yy->__pos= yypos1566; yy->__thunkpos= yythunkpos1566;
+  }  yyDo(yy, yy_3_ListBlock, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "ListBlock", yy->__buf+yy->__pos-yy->__base));  yyDo(yy, yyPop, 1, 0);
+  return 1;
+  l1563:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "ListBlock", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_Enumerator(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "Enumerator"));  if (!yy_NonindentSpace(yy)) goto l1567;  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\000\000\377\003\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l1567;
+  l1568:;	
+  {  int yypos1569= yy->__pos, yythunkpos1569= yy->__thunkpos;  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\000\000\377\003\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l1569;  goto l1568;
+  l1569:;	  yy->__pos= yypos1569; yy->__thunkpos= yythunkpos1569;
+  }  if (!yymatchChar(yy, '.')) goto l1567;  if (!yy_Spacechar(yy)) goto l1567;
+  l1570:;	
+  {  int yypos1571= yy->__pos, yythunkpos1571= yy->__thunkpos;  if (!yy_Spacechar(yy)) goto l1571;  goto l1570;
+  l1571:;	  yy->__pos= yypos1571; yy->__thunkpos= yythunkpos1571;
+  }
+  yyprintf((stderr, "  ok   %s @ %s\n", "Enumerator", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1567:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Enumerator", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_ListItemTight(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;  yyDo(yy, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "ListItemTight"));
+  {  int yypos1573= yy->__pos, yythunkpos1573= yy->__thunkpos;  if (!yy_Bullet(yy)) goto l1574;  goto l1573;
+  l1574:;	  yy->__pos= yypos1573; yy->__thunkpos= yythunkpos1573;  if (!yy_Enumerator(yy)) goto l1572;
+  }
+  l1573:;	  if (!yy_StartList(yy)) goto l1572;  yyDo(yy, yySet, -1, 0);  if (!yy_ListBlock(yy)) goto l1572;  yyDo(yy, yy_1_ListItemTight, yy->__begin, yy->__end);
+  l1575:;	
+  {  int yypos1576= yy->__pos, yythunkpos1576= yy->__thunkpos;
+  {  int yypos1577= yy->__pos, yythunkpos1577= yy->__thunkpos;  if (!yy_BlankLine(yy)) goto l1577;  goto l1576;
+  l1577:;	  yy->__pos= yypos1577; yy->__thunkpos= yythunkpos1577;
+  }  if (!yy_ListContinuationBlock(yy)) goto l1576;  yyDo(yy, yy_2_ListItemTight, yy->__begin, yy->__end);  goto l1575;
+  l1576:;	  yy->__pos= yypos1576; yy->__thunkpos= yythunkpos1576;
+  }
+  {  int yypos1578= yy->__pos, yythunkpos1578= yy->__thunkpos;  if (!yy_ListContinuationBlock(yy)) goto l1578;  goto l1572;
+  l1578:;	  yy->__pos= yypos1578; yy->__thunkpos= yythunkpos1578;
+  }  yyDo(yy, yy_3_ListItemTight, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "ListItemTight", yy->__buf+yy->__pos-yy->__base));  yyDo(yy, yyPop, 1, 0);
+  return 1;
+  l1572:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "ListItemTight", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_ListLoose(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;  yyDo(yy, yyPush, 2, 0);
+  yyprintf((stderr, "%s\n", "ListLoose"));  if (!yy_StartList(yy)) goto l1579;  yyDo(yy, yySet, -2, 0);  if (!yy_ListItem(yy)) goto l1579;  yyDo(yy, yySet, -1, 0);
+  l1582:;	
+  {  int yypos1583= yy->__pos, yythunkpos1583= yy->__thunkpos;  if (!yy_BlankLine(yy)) goto l1583;  goto l1582;
+  l1583:;	  yy->__pos= yypos1583; yy->__thunkpos= yythunkpos1583;
+  }  yyDo(yy, yy_1_ListLoose, yy->__begin, yy->__end);
+  l1580:;	
+  {  int yypos1581= yy->__pos, yythunkpos1581= yy->__thunkpos;  if (!yy_ListItem(yy)) goto l1581;  yyDo(yy, yySet, -1, 0);
+  l1584:;	
+  {  int yypos1585= yy->__pos, yythunkpos1585= yy->__thunkpos;  if (!yy_BlankLine(yy)) goto l1585;  goto l1584;
+  l1585:;	  yy->__pos= yypos1585; yy->__thunkpos= yythunkpos1585;
+  }  yyDo(yy, yy_1_ListLoose, yy->__begin, yy->__end);  goto l1580;
+  l1581:;	  yy->__pos= yypos1581; yy->__thunkpos= yythunkpos1581;
+  }  yyDo(yy, yy_2_ListLoose, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "ListLoose", yy->__buf+yy->__pos-yy->__base));  yyDo(yy, yyPop, 2, 0);
+  return 1;
+  l1579:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "ListLoose", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_ListTight(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;  yyDo(yy, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "ListTight"));  if (!yy_StartList(yy)) goto l1586;  yyDo(yy, yySet, -1, 0);  if (!yy_ListItemTight(yy)) goto l1586;  yyDo(yy, yy_1_ListTight, yy->__begin, yy->__end);
+  l1587:;	
+  {  int yypos1588= yy->__pos, yythunkpos1588= yy->__thunkpos;  if (!yy_ListItemTight(yy)) goto l1588;  yyDo(yy, yy_1_ListTight, yy->__begin, yy->__end);  goto l1587;
+  l1588:;	  yy->__pos= yypos1588; yy->__thunkpos= yythunkpos1588;
+  }
+  l1589:;	
+  {  int yypos1590= yy->__pos, yythunkpos1590= yy->__thunkpos;  if (!yy_BlankLine(yy)) goto l1590;  goto l1589;
+  l1590:;	  yy->__pos= yypos1590; yy->__thunkpos= yythunkpos1590;
+  }
+  {  int yypos1591= yy->__pos, yythunkpos1591= yy->__thunkpos;
+  {  int yypos1592= yy->__pos, yythunkpos1592= yy->__thunkpos;  if (!yy_Bullet(yy)) goto l1593;  goto l1592;
+  l1593:;	  yy->__pos= yypos1592; yy->__thunkpos= yythunkpos1592;  if (!yy_Enumerator(yy)) goto l1591;
+  }
+  l1592:;	  goto l1586;
+  l1591:;	  yy->__pos= yypos1591; yy->__thunkpos= yythunkpos1591;
+  }  yyDo(yy, yy_2_ListTight, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "ListTight", yy->__buf+yy->__pos-yy->__base));  yyDo(yy, yyPop, 1, 0);
+  return 1;
+  l1586:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "ListTight", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_Spacechar(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "Spacechar"));
+  {  int yypos1595= yy->__pos, yythunkpos1595= yy->__thunkpos;  if (!yymatchChar(yy, ' ')) goto l1596;  goto l1595;
+  l1596:;	  yy->__pos= yypos1595; yy->__thunkpos= yythunkpos1595;  if (!yymatchChar(yy, '\t')) goto l1594;
+  }
+  l1595:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "Spacechar", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1594:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Spacechar", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_Bullet(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "Bullet"));
+  {  int yypos1598= yy->__pos, yythunkpos1598= yy->__thunkpos;  if (!yy_HorizontalRule(yy)) goto l1598;  goto l1597;
+  l1598:;	  yy->__pos= yypos1598; yy->__thunkpos= yythunkpos1598;
+  }  if (!yy_NonindentSpace(yy)) goto l1597;
+  {  int yypos1599= yy->__pos, yythunkpos1599= yy->__thunkpos;  if (!yymatchChar(yy, '+')) goto l1600;  goto l1599;
+  l1600:;	  yy->__pos= yypos1599; yy->__thunkpos= yythunkpos1599;  if (!yymatchChar(yy, '*')) goto l1601;  goto l1599;
+  l1601:;	  yy->__pos= yypos1599; yy->__thunkpos= yythunkpos1599;  if (!yymatchChar(yy, '-')) goto l1597;
+  }
+  l1599:;	  if (!yy_Spacechar(yy)) goto l1597;
+  l1602:;	
+  {  int yypos1603= yy->__pos, yythunkpos1603= yy->__thunkpos;  if (!yy_Spacechar(yy)) goto l1603;  goto l1602;
+  l1603:;	  yy->__pos= yypos1603; yy->__thunkpos= yythunkpos1603;
+  }
+  yyprintf((stderr, "  ok   %s @ %s\n", "Bullet", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1597:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Bullet", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_VerbatimChunk(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;  yyDo(yy, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "VerbatimChunk"));  if (!yy_StartList(yy)) goto l1604;  yyDo(yy, yySet, -1, 0);
+  l1605:;	
+  {  int yypos1606= yy->__pos, yythunkpos1606= yy->__thunkpos;  if (!yy_BlankLine(yy)) goto l1606;  yyDo(yy, yy_1_VerbatimChunk, yy->__begin, yy->__end);  goto l1605;
+  l1606:;	  yy->__pos= yypos1606; yy->__thunkpos= yythunkpos1606;
+  }  if (!yy_NonblankIndentedLine(yy)) goto l1604;  yyDo(yy, yy_2_VerbatimChunk, yy->__begin, yy->__end);
+  l1607:;	
+  {  int yypos1608= yy->__pos, yythunkpos1608= yy->__thunkpos;  if (!yy_NonblankIndentedLine(yy)) goto l1608;  yyDo(yy, yy_2_VerbatimChunk, yy->__begin, yy->__end);  goto l1607;
+  l1608:;	  yy->__pos= yypos1608; yy->__thunkpos= yythunkpos1608;
+  }  yyDo(yy, yy_3_VerbatimChunk, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "VerbatimChunk", yy->__buf+yy->__pos-yy->__base));  yyDo(yy, yyPop, 1, 0);
+  return 1;
+  l1604:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "VerbatimChunk", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_IndentedLine(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "IndentedLine"));  if (!yy_Indent(yy)) goto l1609;  if (!yy_Line(yy)) goto l1609;
+  yyprintf((stderr, "  ok   %s @ %s\n", "IndentedLine", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1609:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "IndentedLine", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_NonblankIndentedLine(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "NonblankIndentedLine"));
+  {  int yypos1611= yy->__pos, yythunkpos1611= yy->__thunkpos;  if (!yy_BlankLine(yy)) goto l1611;  goto l1610;
+  l1611:;	  yy->__pos= yypos1611; yy->__thunkpos= yythunkpos1611;
+  }  if (!yy_IndentedLine(yy)) goto l1610;
+  yyprintf((stderr, "  ok   %s @ %s\n", "NonblankIndentedLine", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1610:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "NonblankIndentedLine", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_Line(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "Line"));  if (!yy_RawLine(yy)) goto l1612;  yyDo(yy, yy_1_Line, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Line", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1612:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Line", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_BlockQuoteRaw(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;  yyDo(yy, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "BlockQuoteRaw"));  if (!yy_StartList(yy)) goto l1613;  yyDo(yy, yySet, -1, 0);  if (!yymatchChar(yy, '>')) goto l1613;
+  {  int yypos1616= yy->__pos, yythunkpos1616= yy->__thunkpos;  if (!yymatchChar(yy, ' ')) goto l1616;  goto l1617;
+  l1616:;	  yy->__pos= yypos1616; yy->__thunkpos= yythunkpos1616;
+  }
+  l1617:;	  if (!yy_Line(yy)) goto l1613;  yyDo(yy, yy_1_BlockQuoteRaw, yy->__begin, yy->__end);
+  l1618:;	
+  {  int yypos1619= yy->__pos, yythunkpos1619= yy->__thunkpos;
+  {  int yypos1620= yy->__pos, yythunkpos1620= yy->__thunkpos;  if (!yymatchChar(yy, '>')) goto l1620;  goto l1619;
+  l1620:;	  yy->__pos= yypos1620; yy->__thunkpos= yythunkpos1620;
+  }
+  {  int yypos1621= yy->__pos, yythunkpos1621= yy->__thunkpos;  if (!yy_BlankLine(yy)) goto l1621;  goto l1619;
+  l1621:;	  yy->__pos= yypos1621; yy->__thunkpos= yythunkpos1621;
+  }  if (!yy_Line(yy)) goto l1619;  yyDo(yy, yy_2_BlockQuoteRaw, yy->__begin, yy->__end);  goto l1618;
+  l1619:;	  yy->__pos= yypos1619; yy->__thunkpos= yythunkpos1619;
+  }
+  l1622:;	
+  {  int yypos1623= yy->__pos, yythunkpos1623= yy->__thunkpos;  if (!yy_BlankLine(yy)) goto l1623;  yyDo(yy, yy_3_BlockQuoteRaw, yy->__begin, yy->__end);  goto l1622;
+  l1623:;	  yy->__pos= yypos1623; yy->__thunkpos= yythunkpos1623;
+  }
+  l1614:;	
+  {  int yypos1615= yy->__pos, yythunkpos1615= yy->__thunkpos;  if (!yymatchChar(yy, '>')) goto l1615;
+  {  int yypos1624= yy->__pos, yythunkpos1624= yy->__thunkpos;  if (!yymatchChar(yy, ' ')) goto l1624;  goto l1625;
+  l1624:;	  yy->__pos= yypos1624; yy->__thunkpos= yythunkpos1624;
+  }
+  l1625:;	  if (!yy_Line(yy)) goto l1615;  yyDo(yy, yy_1_BlockQuoteRaw, yy->__begin, yy->__end);
+  l1626:;	
+  {  int yypos1627= yy->__pos, yythunkpos1627= yy->__thunkpos;
+  {  int yypos1628= yy->__pos, yythunkpos1628= yy->__thunkpos;  if (!yymatchChar(yy, '>')) goto l1628;  goto l1627;
+  l1628:;	  yy->__pos= yypos1628; yy->__thunkpos= yythunkpos1628;
+  }
+  {  int yypos1629= yy->__pos, yythunkpos1629= yy->__thunkpos;  if (!yy_BlankLine(yy)) goto l1629;  goto l1627;
+  l1629:;	  yy->__pos= yypos1629; yy->__thunkpos= yythunkpos1629;
+  }  if (!yy_Line(yy)) goto l1627;  yyDo(yy, yy_2_BlockQuoteRaw, yy->__begin, yy->__end);  goto l1626;
+  l1627:;	  yy->__pos= yypos1627; yy->__thunkpos= yythunkpos1627;
+  }
+  l1630:;	
+  {  int yypos1631= yy->__pos, yythunkpos1631= yy->__thunkpos;  if (!yy_BlankLine(yy)) goto l1631;  yyDo(yy, yy_3_BlockQuoteRaw, yy->__begin, yy->__end);  goto l1630;
+  l1631:;	  yy->__pos= yypos1631; yy->__thunkpos= yythunkpos1631;
+  }  goto l1614;
+  l1615:;	  yy->__pos= yypos1615; yy->__thunkpos= yythunkpos1615;
+  }  yyDo(yy, yy_4_BlockQuoteRaw, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "BlockQuoteRaw", yy->__buf+yy->__pos-yy->__base));  yyDo(yy, yyPop, 1, 0);
+  return 1;
+  l1613:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "BlockQuoteRaw", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_Endline(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "Endline"));
+  {  int yypos1633= yy->__pos, yythunkpos1633= yy->__thunkpos;  if (!yy_LineBreak(yy)) goto l1634;  goto l1633;
+  l1634:;	  yy->__pos= yypos1633; yy->__thunkpos= yythunkpos1633;  if (!yy_TerminalEndline(yy)) goto l1635;  goto l1633;
+  l1635:;	  yy->__pos= yypos1633; yy->__thunkpos= yythunkpos1633;  if (!yy_NormalEndline(yy)) goto l1632;
+  }
+  l1633:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "Endline", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1632:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Endline", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_SetextBottom2(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "SetextBottom2"));  if (!yymatchString(yy, "---")) goto l1636;
+  l1637:;	
+  {  int yypos1638= yy->__pos, yythunkpos1638= yy->__thunkpos;  if (!yymatchChar(yy, '-')) goto l1638;  goto l1637;
+  l1638:;	  yy->__pos= yypos1638; yy->__thunkpos= yythunkpos1638;
+  }  if (!yy_Newline(yy)) goto l1636;
+  yyprintf((stderr, "  ok   %s @ %s\n", "SetextBottom2", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1636:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "SetextBottom2", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_SetextBottom1(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "SetextBottom1"));  if (!yymatchString(yy, "===")) goto l1639;
+  l1640:;	
+  {  int yypos1641= yy->__pos, yythunkpos1641= yy->__thunkpos;  if (!yymatchChar(yy, '=')) goto l1641;  goto l1640;
+  l1641:;	  yy->__pos= yypos1641; yy->__thunkpos= yythunkpos1641;
+  }  if (!yy_Newline(yy)) goto l1639;
+  yyprintf((stderr, "  ok   %s @ %s\n", "SetextBottom1", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1639:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "SetextBottom1", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_SetextHeading2(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;  yyDo(yy, yyPush, 2, 0);
+  yyprintf((stderr, "%s\n", "SetextHeading2"));
+  {  int yypos1643= yy->__pos, yythunkpos1643= yy->__thunkpos;  if (!yy_RawLine(yy)) goto l1642;  if (!yy_SetextBottom2(yy)) goto l1642;  yy->__pos= yypos1643; yy->__thunkpos= yythunkpos1643;
+  }  if (!yy_StartList(yy)) goto l1642;  yyDo(yy, yySet, -2, 0);
+  {  int yypos1646= yy->__pos, yythunkpos1646= yy->__thunkpos;  if (!yy_Endline(yy)) goto l1646;  goto l1642;
+  l1646:;	  yy->__pos= yypos1646; yy->__thunkpos= yythunkpos1646;
+  }
+  {  int yypos1647= yy->__pos, yythunkpos1647= yy->__thunkpos;  if (!( !extension(yy->parser, EXT_COMPATIBILITY) )) goto l1647;  if (!yy_Sp(yy)) goto l1647;  if (!yy_AutoLabel(yy)) goto l1647;  goto l1642;
+  l1647:;	  yy->__pos= yypos1647; yy->__thunkpos= yythunkpos1647;
+  }  if (!yy_Inline(yy)) goto l1642;  yyDo(yy, yy_1_SetextHeading2, yy->__begin, yy->__end);
+  l1644:;	
+  {  int yypos1645= yy->__pos, yythunkpos1645= yy->__thunkpos;
+  {  int yypos1648= yy->__pos, yythunkpos1648= yy->__thunkpos;  if (!yy_Endline(yy)) goto l1648;  goto l1645;
+  l1648:;	  yy->__pos= yypos1648; yy->__thunkpos= yythunkpos1648;
+  }
+  {  int yypos1649= yy->__pos, yythunkpos1649= yy->__thunkpos;  if (!( !extension(yy->parser, EXT_COMPATIBILITY) )) goto l1649;  if (!yy_Sp(yy)) goto l1649;  if (!yy_AutoLabel(yy)) goto l1649;  goto l1645;
+  l1649:;	  yy->__pos= yypos1649; yy->__thunkpos= yythunkpos1649;
+  }  if (!yy_Inline(yy)) goto l1645;  yyDo(yy, yy_1_SetextHeading2, yy->__begin, yy->__end);  goto l1644;
+  l1645:;	  yy->__pos= yypos1645; yy->__thunkpos= yythunkpos1645;
+  }
+  {  int yypos1650= yy->__pos, yythunkpos1650= yy->__thunkpos;  if (!yy_Sp(yy)) goto l1650;  if (!yy_AutoLabel(yy)) goto l1650;  yyDo(yy, yySet, -1, 0);  yyDo(yy, yy_2_SetextHeading2, yy->__begin, yy->__end);
+  {  int yypos1652= yy->__pos, yythunkpos1652= yy->__thunkpos;  if (!yy_Sp(yy)) goto l1652;  goto l1653;
+  l1652:;	  yy->__pos= yypos1652; yy->__thunkpos= yythunkpos1652;
+  }
+  l1653:;	  goto l1651;
+  l1650:;	  yy->__pos= yypos1650; yy->__thunkpos= yythunkpos1650;
+  }
+  l1651:;	
+  {  int yypos1654= yy->__pos, yythunkpos1654= yy->__thunkpos;  if (!yy_Sp(yy)) goto l1654;  goto l1655;
+  l1654:;	  yy->__pos= yypos1654; yy->__thunkpos= yythunkpos1654;
+  }
+  l1655:;	  if (!yy_Newline(yy)) goto l1642;  if (!yy_SetextBottom2(yy)) goto l1642;  yyDo(yy, yy_3_SetextHeading2, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "SetextHeading2", yy->__buf+yy->__pos-yy->__base));  yyDo(yy, yyPop, 2, 0);
+  return 1;
+  l1642:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "SetextHeading2", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_SetextHeading1(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;  yyDo(yy, yyPush, 2, 0);
+  yyprintf((stderr, "%s\n", "SetextHeading1"));
+  {  int yypos1657= yy->__pos, yythunkpos1657= yy->__thunkpos;  if (!yy_RawLine(yy)) goto l1656;  if (!yy_SetextBottom1(yy)) goto l1656;  yy->__pos= yypos1657; yy->__thunkpos= yythunkpos1657;
+  }  if (!yy_StartList(yy)) goto l1656;  yyDo(yy, yySet, -2, 0);
+  {  int yypos1660= yy->__pos, yythunkpos1660= yy->__thunkpos;  if (!yy_Endline(yy)) goto l1660;  goto l1656;
+  l1660:;	  yy->__pos= yypos1660; yy->__thunkpos= yythunkpos1660;
+  }
+  {  int yypos1661= yy->__pos, yythunkpos1661= yy->__thunkpos;  if (!( !extension(yy->parser, EXT_COMPATIBILITY) )) goto l1661;  if (!yy_Sp(yy)) goto l1661;  if (!yy_AutoLabel(yy)) goto l1661;  goto l1656;
+  l1661:;	  yy->__pos= yypos1661; yy->__thunkpos= yythunkpos1661;
+  }  if (!yy_Inline(yy)) goto l1656;  yyDo(yy, yy_1_SetextHeading1, yy->__begin, yy->__end);
+  l1658:;	
+  {  int yypos1659= yy->__pos, yythunkpos1659= yy->__thunkpos;
+  {  int yypos1662= yy->__pos, yythunkpos1662= yy->__thunkpos;  if (!yy_Endline(yy)) goto l1662;  goto l1659;
+  l1662:;	  yy->__pos= yypos1662; yy->__thunkpos= yythunkpos1662;
+  }
+  {  int yypos1663= yy->__pos, yythunkpos1663= yy->__thunkpos;  if (!( !extension(yy->parser, EXT_COMPATIBILITY) )) goto l1663;  if (!yy_Sp(yy)) goto l1663;  if (!yy_AutoLabel(yy)) goto l1663;  goto l1659;
+  l1663:;	  yy->__pos= yypos1663; yy->__thunkpos= yythunkpos1663;
+  }  if (!yy_Inline(yy)) goto l1659;  yyDo(yy, yy_1_SetextHeading1, yy->__begin, yy->__end);  goto l1658;
+  l1659:;	  yy->__pos= yypos1659; yy->__thunkpos= yythunkpos1659;
+  }
+  {  int yypos1664= yy->__pos, yythunkpos1664= yy->__thunkpos;  if (!yy_Sp(yy)) goto l1664;  if (!yy_AutoLabel(yy)) goto l1664;  yyDo(yy, yySet, -1, 0);  yyDo(yy, yy_2_SetextHeading1, yy->__begin, yy->__end);
+  {  int yypos1666= yy->__pos, yythunkpos1666= yy->__thunkpos;  if (!yy_Sp(yy)) goto l1666;  goto l1667;
+  l1666:;	  yy->__pos= yypos1666; yy->__thunkpos= yythunkpos1666;
+  }
+  l1667:;	  goto l1665;
+  l1664:;	  yy->__pos= yypos1664; yy->__thunkpos= yythunkpos1664;
+  }
+  l1665:;	
+  {  int yypos1668= yy->__pos, yythunkpos1668= yy->__thunkpos;  if (!yy_Sp(yy)) goto l1668;  goto l1669;
+  l1668:;	  yy->__pos= yypos1668; yy->__thunkpos= yythunkpos1668;
+  }
+  l1669:;	  if (!yy_Newline(yy)) goto l1656;  if (!yy_SetextBottom1(yy)) goto l1656;  yyDo(yy, yy_3_SetextHeading1, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "SetextHeading1", yy->__buf+yy->__pos-yy->__base));  yyDo(yy, yyPop, 2, 0);
+  return 1;
+  l1656:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "SetextHeading1", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_SetextHeading(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "SetextHeading"));
+  {  int yypos1671= yy->__pos, yythunkpos1671= yy->__thunkpos;  if (!yy_SetextHeading1(yy)) goto l1672;  goto l1671;
+  l1672:;	  yy->__pos= yypos1671; yy->__thunkpos= yythunkpos1671;  if (!yy_SetextHeading2(yy)) goto l1670;
+  }
+  l1671:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "SetextHeading", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1670:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "SetextHeading", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_AtxHeading(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;  yyDo(yy, yyPush, 3, 0);
+  yyprintf((stderr, "%s\n", "AtxHeading"));  if (!yy_AtxStart(yy)) goto l1673;  yyDo(yy, yySet, -3, 0);
+  {  int yypos1674= yy->__pos, yythunkpos1674= yy->__thunkpos;  if (!yy_Sp(yy)) goto l1674;  goto l1675;
+  l1674:;	  yy->__pos= yypos1674; yy->__thunkpos= yythunkpos1674;
+  }
+  l1675:;	  if (!yy_StartList(yy)) goto l1673;  yyDo(yy, yySet, -2, 0);  if (!yy_AtxInline(yy)) goto l1673;  yyDo(yy, yy_1_AtxHeading, yy->__begin, yy->__end);
+  l1676:;	
+  {  int yypos1677= yy->__pos, yythunkpos1677= yy->__thunkpos;  if (!yy_AtxInline(yy)) goto l1677;  yyDo(yy, yy_1_AtxHeading, yy->__begin, yy->__end);  goto l1676;
+  l1677:;	  yy->__pos= yypos1677; yy->__thunkpos= yythunkpos1677;
+  }
+  {  int yypos1678= yy->__pos, yythunkpos1678= yy->__thunkpos;
+  {  int yypos1680= yy->__pos, yythunkpos1680= yy->__thunkpos;  if (!yy_Sp(yy)) goto l1680;  goto l1681;
+  l1680:;	  yy->__pos= yypos1680; yy->__thunkpos= yythunkpos1680;
+  }
+  l1681:;	  if (!yy_AutoLabel(yy)) goto l1678;  yyDo(yy, yySet, -1, 0);  yyDo(yy, yy_2_AtxHeading, yy->__begin, yy->__end);  goto l1679;
+  l1678:;	  yy->__pos= yypos1678; yy->__thunkpos= yythunkpos1678;
+  }
+  l1679:;	
+  {  int yypos1682= yy->__pos, yythunkpos1682= yy->__thunkpos;
+  {  int yypos1684= yy->__pos, yythunkpos1684= yy->__thunkpos;  if (!yy_Sp(yy)) goto l1684;  goto l1685;
+  l1684:;	  yy->__pos= yypos1684; yy->__thunkpos= yythunkpos1684;
+  }
+  l1685:;	
+  l1686:;	
+  {  int yypos1687= yy->__pos, yythunkpos1687= yy->__thunkpos;  if (!yymatchChar(yy, '#')) goto l1687;  goto l1686;
+  l1687:;	  yy->__pos= yypos1687; yy->__thunkpos= yythunkpos1687;
+  }  if (!yy_Sp(yy)) goto l1682;  goto l1683;
+  l1682:;	  yy->__pos= yypos1682; yy->__thunkpos= yythunkpos1682;
+  }
+  l1683:;	  if (!yy_Newline(yy)) goto l1673;  yyDo(yy, yy_3_AtxHeading, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "AtxHeading", yy->__buf+yy->__pos-yy->__base));  yyDo(yy, yyPop, 3, 0);
+  return 1;
+  l1673:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "AtxHeading", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_AtxStart(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "AtxStart"));  if (!(YY_BEGIN)) goto l1688;
+  {  int yypos1689= yy->__pos, yythunkpos1689= yy->__thunkpos;  if (!yymatchString(yy, "######")) goto l1690;  goto l1689;
+  l1690:;	  yy->__pos= yypos1689; yy->__thunkpos= yythunkpos1689;  if (!yymatchString(yy, "#####")) goto l1691;  goto l1689;
+  l1691:;	  yy->__pos= yypos1689; yy->__thunkpos= yythunkpos1689;  if (!yymatchString(yy, "####")) goto l1692;  goto l1689;
+  l1692:;	  yy->__pos= yypos1689; yy->__thunkpos= yythunkpos1689;  if (!yymatchString(yy, "###")) goto l1693;  goto l1689;
+  l1693:;	  yy->__pos= yypos1689; yy->__thunkpos= yythunkpos1689;  if (!yymatchString(yy, "##")) goto l1694;  goto l1689;
+  l1694:;	  yy->__pos= yypos1689; yy->__thunkpos= yythunkpos1689;  if (!yymatchChar(yy, '#')) goto l1688;
+  }
+  l1689:;	  if (!(YY_END)) goto l1688;  yyDo(yy, yy_1_AtxStart, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "AtxStart", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1688:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "AtxStart", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_AutoLabel(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "AutoLabel"));  if (!yymatchChar(yy, '[')) goto l1695;  if (!(YY_BEGIN)) goto l1695;
+  {  int yypos1698= yy->__pos, yythunkpos1698= yy->__thunkpos;  if (!yy_Newline(yy)) goto l1698;  goto l1695;
+  l1698:;	  yy->__pos= yypos1698; yy->__thunkpos= yythunkpos1698;
+  }
+  {  int yypos1699= yy->__pos, yythunkpos1699= yy->__thunkpos;  if (!yymatchChar(yy, ']')) goto l1699;  goto l1695;
+  l1699:;	  yy->__pos= yypos1699; yy->__thunkpos= yythunkpos1699;
+  }  if (!yymatchDot(yy)) goto l1695;
+  l1696:;	
+  {  int yypos1697= yy->__pos, yythunkpos1697= yy->__thunkpos;
+  {  int yypos1700= yy->__pos, yythunkpos1700= yy->__thunkpos;  if (!yy_Newline(yy)) goto l1700;  goto l1697;
+  l1700:;	  yy->__pos= yypos1700; yy->__thunkpos= yythunkpos1700;
+  }
+  {  int yypos1701= yy->__pos, yythunkpos1701= yy->__thunkpos;  if (!yymatchChar(yy, ']')) goto l1701;  goto l1697;
+  l1701:;	  yy->__pos= yypos1701; yy->__thunkpos= yythunkpos1701;
+  }  if (!yymatchDot(yy)) goto l1697;  goto l1696;
+  l1697:;	  yy->__pos= yypos1697; yy->__thunkpos= yythunkpos1697;
+  }  if (!(YY_END)) goto l1695;  if (!yymatchChar(yy, ']')) goto l1695;
+  {  int yypos1702= yy->__pos, yythunkpos1702= yy->__thunkpos;
+  {  int yypos1703= yy->__pos, yythunkpos1703= yy->__thunkpos;
+  {  int yypos1704= yy->__pos, yythunkpos1704= yy->__thunkpos;  if (!yy_Sp(yy)) goto l1704;  goto l1705;
+  l1704:;	  yy->__pos= yypos1704; yy->__thunkpos= yythunkpos1704;
+  }
+  l1705:;	
+  {  int yypos1706= yy->__pos, yythunkpos1706= yy->__thunkpos;  if (!yymatchChar(yy, '(')) goto l1707;  goto l1706;
+  l1707:;	  yy->__pos= yypos1706; yy->__thunkpos= yythunkpos1706;  if (!yymatchChar(yy, '[')) goto l1703;
+  }
+  l1706:;	  goto l1695;
+  l1703:;	  yy->__pos= yypos1703; yy->__thunkpos= yythunkpos1703;
+  }  yy->__pos= yypos1702; yy->__thunkpos= yythunkpos1702;
+  }  yyDo(yy, yy_1_AutoLabel, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "AutoLabel", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1695:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "AutoLabel", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_AtxInline(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "AtxInline"));
+  {  int yypos1709= yy->__pos, yythunkpos1709= yy->__thunkpos;  if (!yy_Newline(yy)) goto l1709;  goto l1708;
+  l1709:;	  yy->__pos= yypos1709; yy->__thunkpos= yythunkpos1709;
+  }
+  {  int yypos1710= yy->__pos, yythunkpos1710= yy->__thunkpos;  if (!( !extension(yy->parser, EXT_COMPATIBILITY) )) goto l1710;  if (!yy_Sp(yy)) goto l1710;  if (!yy_AutoLabel(yy)) goto l1710;
+  {  int yypos1711= yy->__pos, yythunkpos1711= yy->__thunkpos;  if (!yy_Sp(yy)) goto l1711;  goto l1712;
+  l1711:;	  yy->__pos= yypos1711; yy->__thunkpos= yythunkpos1711;
+  }
+  l1712:;	
+  l1713:;	
+  {  int yypos1714= yy->__pos, yythunkpos1714= yy->__thunkpos;  if (!yymatchChar(yy, '#')) goto l1714;  goto l1713;
+  l1714:;	  yy->__pos= yypos1714; yy->__thunkpos= yythunkpos1714;
+  }  if (!yy_Sp(yy)) goto l1710;  if (!yy_Newline(yy)) goto l1710;  goto l1708;
+  l1710:;	  yy->__pos= yypos1710; yy->__thunkpos= yythunkpos1710;
+  }
+  {  int yypos1715= yy->__pos, yythunkpos1715= yy->__thunkpos;
+  {  int yypos1716= yy->__pos, yythunkpos1716= yy->__thunkpos;  if (!yy_Sp(yy)) goto l1716;  goto l1717;
+  l1716:;	  yy->__pos= yypos1716; yy->__thunkpos= yythunkpos1716;
+  }
+  l1717:;	
+  l1718:;	
+  {  int yypos1719= yy->__pos, yythunkpos1719= yy->__thunkpos;  if (!yymatchChar(yy, '#')) goto l1719;  goto l1718;
+  l1719:;	  yy->__pos= yypos1719; yy->__thunkpos= yythunkpos1719;
+  }  if (!yy_Sp(yy)) goto l1715;  if (!yy_Newline(yy)) goto l1715;  goto l1708;
+  l1715:;	  yy->__pos= yypos1715; yy->__thunkpos= yythunkpos1715;
+  }  if (!yy_Inline(yy)) goto l1708;
+  yyprintf((stderr, "  ok   %s @ %s\n", "AtxInline", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1708:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "AtxInline", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_Inlines(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;  yyDo(yy, yyPush, 2, 0);
+  yyprintf((stderr, "%s\n", "Inlines"));  if (!yy_StartList(yy)) goto l1720;  yyDo(yy, yySet, -2, 0);
+  {  int yypos1723= yy->__pos, yythunkpos1723= yy->__thunkpos;
+  {  int yypos1725= yy->__pos, yythunkpos1725= yy->__thunkpos;  if (!yy_Endline(yy)) goto l1725;  goto l1724;
+  l1725:;	  yy->__pos= yypos1725; yy->__thunkpos= yythunkpos1725;
+  }  if (!yy_Inline(yy)) goto l1724;  yyDo(yy, yy_1_Inlines, yy->__begin, yy->__end);  goto l1723;
+  l1724:;	  yy->__pos= yypos1723; yy->__thunkpos= yythunkpos1723;  if (!yy_Endline(yy)) goto l1720;  yyDo(yy, yySet, -1, 0);
+  {  int yypos1726= yy->__pos, yythunkpos1726= yy->__thunkpos;  if (!yy_Inline(yy)) goto l1720;  yy->__pos= yypos1726; yy->__thunkpos= yythunkpos1726;
+  }  yyDo(yy, yy_2_Inlines, yy->__begin, yy->__end);
+  }
+  l1723:;	
+  l1721:;	
+  {  int yypos1722= yy->__pos, yythunkpos1722= yy->__thunkpos;
+  {  int yypos1727= yy->__pos, yythunkpos1727= yy->__thunkpos;
+  {  int yypos1729= yy->__pos, yythunkpos1729= yy->__thunkpos;  if (!yy_Endline(yy)) goto l1729;  goto l1728;
+  l1729:;	  yy->__pos= yypos1729; yy->__thunkpos= yythunkpos1729;
+  }  if (!yy_Inline(yy)) goto l1728;  yyDo(yy, yy_1_Inlines, yy->__begin, yy->__end);  goto l1727;
+  l1728:;	  yy->__pos= yypos1727; yy->__thunkpos= yythunkpos1727;  if (!yy_Endline(yy)) goto l1722;  yyDo(yy, yySet, -1, 0);
+  {  int yypos1730= yy->__pos, yythunkpos1730= yy->__thunkpos;  if (!yy_Inline(yy)) goto l1722;  yy->__pos= yypos1730; yy->__thunkpos= yythunkpos1730;
+  }  yyDo(yy, yy_2_Inlines, yy->__begin, yy->__end);
+  }
+  l1727:;	  goto l1721;
+  l1722:;	  yy->__pos= yypos1722; yy->__thunkpos= yythunkpos1722;
+  }
+  {  int yypos1731= yy->__pos, yythunkpos1731= yy->__thunkpos;  if (!yy_Endline(yy)) goto l1731;  goto l1732;
+  l1731:;	  yy->__pos= yypos1731; yy->__thunkpos= yythunkpos1731;
+  }
+  l1732:;	  yyDo(yy, yy_3_Inlines, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Inlines", yy->__buf+yy->__pos-yy->__base));  yyDo(yy, yyPop, 2, 0);
+  return 1;
+  l1720:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Inlines", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_NonindentSpace(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "NonindentSpace"));
+  {  int yypos1734= yy->__pos, yythunkpos1734= yy->__thunkpos;  if (!yymatchString(yy, "   ")) goto l1735;  goto l1734;
+  l1735:;	  yy->__pos= yypos1734; yy->__thunkpos= yythunkpos1734;  if (!yymatchString(yy, "  ")) goto l1736;  goto l1734;
+  l1736:;	  yy->__pos= yypos1734; yy->__thunkpos= yythunkpos1734;  if (!yymatchChar(yy, ' ')) goto l1737;  goto l1734;
+  l1737:;	  yy->__pos= yypos1734; yy->__thunkpos= yythunkpos1734;  if (!yymatchString(yy, "")) goto l1733;
+  }
+  l1734:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "NonindentSpace", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1733:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "NonindentSpace", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HeadingSectionBlock(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HeadingSectionBlock"));
+  l1739:;	
+  {  int yypos1740= yy->__pos, yythunkpos1740= yy->__thunkpos;  if (!yy_BlankLine(yy)) goto l1740;  goto l1739;
+  l1740:;	  yy->__pos= yypos1740; yy->__thunkpos= yythunkpos1740;
+  }
+  {  int yypos1741= yy->__pos, yythunkpos1741= yy->__thunkpos;  if (!yy_Heading(yy)) goto l1741;  goto l1738;
+  l1741:;	  yy->__pos= yypos1741; yy->__thunkpos= yythunkpos1741;
+  }
+  {  int yypos1742= yy->__pos, yythunkpos1742= yy->__thunkpos;  if (!yy_BlockQuote(yy)) goto l1743;  goto l1742;
+  l1743:;	  yy->__pos= yypos1742; yy->__thunkpos= yythunkpos1742;  if (!yy_Verbatim(yy)) goto l1744;  goto l1742;
+  l1744:;	  yy->__pos= yypos1742; yy->__thunkpos= yythunkpos1742;  if (!( !extension(yy->parser, EXT_COMPATIBILITY) )) goto l1745;  if (!yy_DefinitionList(yy)) goto l1745;  goto l1742;
+  l1745:;	  yy->__pos= yypos1742; yy->__thunkpos= yythunkpos1742;  if (!( !extension(yy->parser, EXT_COMPATIBILITY) )) goto l1746;  if (!yy_Glossary(yy)) goto l1746;  goto l1742;
+  l1746:;	  yy->__pos= yypos1742; yy->__thunkpos= yythunkpos1742;  if (!yy_Note(yy)) goto l1747;  goto l1742;
+  l1747:;	  yy->__pos= yypos1742; yy->__thunkpos= yythunkpos1742;  if (!yy_Reference(yy)) goto l1748;  goto l1742;
+  l1748:;	  yy->__pos= yypos1742; yy->__thunkpos= yythunkpos1742;  if (!yy_HorizontalRule(yy)) goto l1749;  goto l1742;
+  l1749:;	  yy->__pos= yypos1742; yy->__thunkpos= yythunkpos1742;  if (!yy_OrderedList(yy)) goto l1750;  goto l1742;
+  l1750:;	  yy->__pos= yypos1742; yy->__thunkpos= yythunkpos1742;  if (!yy_BulletList(yy)) goto l1751;  goto l1742;
+  l1751:;	  yy->__pos= yypos1742; yy->__thunkpos= yythunkpos1742;  if (!yy_HtmlBlock(yy)) goto l1752;  goto l1742;
+  l1752:;	  yy->__pos= yypos1742; yy->__thunkpos= yythunkpos1742;  if (!yy_StyleBlock(yy)) goto l1753;  goto l1742;
+  l1753:;	  yy->__pos= yypos1742; yy->__thunkpos= yythunkpos1742;  if (!( !extension(yy->parser, EXT_COMPATIBILITY) )) goto l1754;  if (!yy_Table(yy)) goto l1754;  goto l1742;
+  l1754:;	  yy->__pos= yypos1742; yy->__thunkpos= yythunkpos1742;  if (!( !extension(yy->parser, EXT_COMPATIBILITY) )) goto l1755;  if (!yy_ImageBlock(yy)) goto l1755;  goto l1742;
+  l1755:;	  yy->__pos= yypos1742; yy->__thunkpos= yythunkpos1742;
+  {  int yypos1757= yy->__pos, yythunkpos1757= yy->__thunkpos;
+  {  int yypos1758= yy->__pos, yythunkpos1758= yy->__thunkpos;  if (!yy_Sp(yy)) goto l1758;  goto l1759;
+  l1758:;	  yy->__pos= yypos1758; yy->__thunkpos= yythunkpos1758;
+  }
+  l1759:;	  if (!yy_HtmlBlockOpenDiv(yy)) goto l1757;  goto l1756;
+  l1757:;	  yy->__pos= yypos1757; yy->__thunkpos= yythunkpos1757;
+  }  if (!yy_Para(yy)) goto l1756;  goto l1742;
+  l1756:;	  yy->__pos= yypos1742; yy->__thunkpos= yythunkpos1742;  if (!yy_Plain(yy)) goto l1738;
+  }
+  l1742:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "HeadingSectionBlock", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1738:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HeadingSectionBlock", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_Plain(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;  yyDo(yy, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "Plain"));  if (!yy_Inlines(yy)) goto l1760;  yyDo(yy, yySet, -1, 0);  yyDo(yy, yy_1_Plain, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Plain", yy->__buf+yy->__pos-yy->__base));  yyDo(yy, yyPop, 1, 0);
+  return 1;
+  l1760:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Plain", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_Para(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;  yyDo(yy, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "Para"));  if (!yy_NonindentSpace(yy)) goto l1761;  if (!yy_Inlines(yy)) goto l1761;  yyDo(yy, yySet, -1, 0);  if (!yy_BlankLine(yy)) goto l1761;
+  l1762:;	
+  {  int yypos1763= yy->__pos, yythunkpos1763= yy->__thunkpos;  if (!yy_BlankLine(yy)) goto l1763;  goto l1762;
+  l1763:;	  yy->__pos= yypos1763; yy->__thunkpos= yythunkpos1763;
+  }  yyDo(yy, yy_1_Para, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Para", yy->__buf+yy->__pos-yy->__base));  yyDo(yy, yyPop, 1, 0);
+  return 1;
+  l1761:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Para", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockOpenDiv(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockOpenDiv"));  if (!yymatchChar(yy, '<')) goto l1764;  if (!yy_Spnl(yy)) goto l1764;
+  {  int yypos1765= yy->__pos, yythunkpos1765= yy->__thunkpos;  if (!yymatchString(yy, "div")) goto l1766;  goto l1765;
+  l1766:;	  yy->__pos= yypos1765; yy->__thunkpos= yythunkpos1765;  if (!yymatchString(yy, "DIV")) goto l1764;
+  }
+  l1765:;	  if (!yy_Spnl(yy)) goto l1764;
+  l1767:;	
+  {  int yypos1768= yy->__pos, yythunkpos1768= yy->__thunkpos;  if (!yy_HtmlAttribute(yy)) goto l1768;  goto l1767;
+  l1768:;	  yy->__pos= yypos1768; yy->__thunkpos= yythunkpos1768;
+  }  if (!yymatchChar(yy, '>')) goto l1764;
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockOpenDiv", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1764:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockOpenDiv", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_ImageBlock(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "ImageBlock"));  if (!yy_Image(yy)) goto l1769;  if (!yy_Sp(yy)) goto l1769;  if (!yy_Newline(yy)) goto l1769;  if (!yy_BlankLine(yy)) goto l1769;
+  l1770:;	
+  {  int yypos1771= yy->__pos, yythunkpos1771= yy->__thunkpos;  if (!yy_BlankLine(yy)) goto l1771;  goto l1770;
+  l1771:;	  yy->__pos= yypos1771; yy->__thunkpos= yythunkpos1771;
+  }  yyDo(yy, yy_1_ImageBlock, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "ImageBlock", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1769:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "ImageBlock", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_Table(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;  yyDo(yy, yyPush, 2, 0);
+  yyprintf((stderr, "%s\n", "Table"));  if (!yy_StartList(yy)) goto l1772;  yyDo(yy, yySet, -2, 0);  if (!yy_StartList(yy)) goto l1772;  yyDo(yy, yySet, -1, 0);
+  {  int yypos1773= yy->__pos, yythunkpos1773= yy->__thunkpos;  if (!yy_TableCaption(yy)) goto l1773;  yyDo(yy, yy_1_Table, yy->__begin, yy->__end);  goto l1774;
+  l1773:;	  yy->__pos= yypos1773; yy->__thunkpos= yythunkpos1773;
+  }
+  l1774:;	  if (!yy_TableBody(yy)) goto l1772;  yyDo(yy, yy_2_Table, yy->__begin, yy->__end);  if (!yy_SeparatorLine(yy)) goto l1772;  yyDo(yy, yy_3_Table, yy->__begin, yy->__end);  if (!yy_TableBody(yy)) goto l1772;  yyDo(yy, yy_4_Table, yy->__begin, yy->__end);
+  l1775:;	
+  {  int yypos1776= yy->__pos, yythunkpos1776= yy->__thunkpos;  if (!yy_BlankLine(yy)) goto l1776;
+  {  int yypos1777= yy->__pos, yythunkpos1777= yy->__thunkpos;  if (!yy_TableCaption(yy)) goto l1777;  goto l1776;
+  l1777:;	  yy->__pos= yypos1777; yy->__thunkpos= yythunkpos1777;
+  }  if (!yy_TableBody(yy)) goto l1776;  yyDo(yy, yy_5_Table, yy->__begin, yy->__end);
+  {  int yypos1778= yy->__pos, yythunkpos1778= yy->__thunkpos;
+  {  int yypos1779= yy->__pos, yythunkpos1779= yy->__thunkpos;  if (!yy_TableCaption(yy)) goto l1780;  goto l1779;
+  l1780:;	  yy->__pos= yypos1779; yy->__thunkpos= yythunkpos1779;  if (!yy_BlankLine(yy)) goto l1776;
+  }
+  l1779:;	  yy->__pos= yypos1778; yy->__thunkpos= yythunkpos1778;
+  }  goto l1775;
+  l1776:;	  yy->__pos= yypos1776; yy->__thunkpos= yythunkpos1776;
+  }
+  {  int yypos1781= yy->__pos, yythunkpos1781= yy->__thunkpos;  if (!yy_TableCaption(yy)) goto l1782;  yyDo(yy, yy_6_Table, yy->__begin, yy->__end);
+  {  int yypos1783= yy->__pos, yythunkpos1783= yy->__thunkpos;  if (!yy_BlankLine(yy)) goto l1782;  yy->__pos= yypos1783; yy->__thunkpos= yythunkpos1783;
+  }  goto l1781;
+  l1782:;	  yy->__pos= yypos1781; yy->__thunkpos= yythunkpos1781;
+  {  int yypos1784= yy->__pos, yythunkpos1784= yy->__thunkpos;  if (!yy_BlankLine(yy)) goto l1772;  yy->__pos= yypos1784; yy->__thunkpos= yythunkpos1784;
+  }
+  }
+  l1781:;	  yyDo(yy, yy_7_Table, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Table", yy->__buf+yy->__pos-yy->__base));  yyDo(yy, yyPop, 2, 0);
+  return 1;
+  l1772:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Table", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_StyleBlock(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "StyleBlock"));  if (!(YY_BEGIN)) goto l1785;  if (!yy_InStyleTags(yy)) goto l1785;  if (!(YY_END)) goto l1785;
+  l1786:;	
+  {  int yypos1787= yy->__pos, yythunkpos1787= yy->__thunkpos;  if (!yy_BlankLine(yy)) goto l1787;  goto l1786;
+  l1787:;	  yy->__pos= yypos1787; yy->__thunkpos= yythunkpos1787;
+  }  yyDo(yy, yy_1_StyleBlock, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "StyleBlock", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1785:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "StyleBlock", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlock(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlock"));
+  {  int yypos1789= yy->__pos, yythunkpos1789= yy->__thunkpos;  if (!yy_MarkdownHtmlTagOpen(yy)) goto l1789;  goto l1788;
+  l1789:;	  yy->__pos= yypos1789; yy->__thunkpos= yythunkpos1789;
+  }  if (!(YY_BEGIN)) goto l1788;
+  {  int yypos1790= yy->__pos, yythunkpos1790= yy->__thunkpos;  if (!yy_HtmlBlockInTags(yy)) goto l1791;  goto l1790;
+  l1791:;	  yy->__pos= yypos1790; yy->__thunkpos= yythunkpos1790;  if (!yy_HtmlComment(yy)) goto l1792;  goto l1790;
+  l1792:;	  yy->__pos= yypos1790; yy->__thunkpos= yythunkpos1790;  if (!yy_HtmlBlockSelfClosing(yy)) goto l1788;
+  }
+  l1790:;	  if (!(YY_END)) goto l1788;  if (!yy_BlankLine(yy)) goto l1788;
+  l1793:;	
+  {  int yypos1794= yy->__pos, yythunkpos1794= yy->__thunkpos;  if (!yy_BlankLine(yy)) goto l1794;  goto l1793;
+  l1794:;	  yy->__pos= yypos1794; yy->__thunkpos= yythunkpos1794;
+  }  yyDo(yy, yy_1_HtmlBlock, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlock", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1788:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlock", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_BulletList(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "BulletList"));
+  {  int yypos1796= yy->__pos, yythunkpos1796= yy->__thunkpos;  if (!yy_Bullet(yy)) goto l1795;  yy->__pos= yypos1796; yy->__thunkpos= yythunkpos1796;
+  }
+  {  int yypos1797= yy->__pos, yythunkpos1797= yy->__thunkpos;  if (!yy_ListTight(yy)) goto l1798;  goto l1797;
+  l1798:;	  yy->__pos= yypos1797; yy->__thunkpos= yythunkpos1797;  if (!yy_ListLoose(yy)) goto l1795;
+  }
+  l1797:;	  yyDo(yy, yy_1_BulletList, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "BulletList", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1795:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "BulletList", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_OrderedList(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "OrderedList"));
+  {  int yypos1800= yy->__pos, yythunkpos1800= yy->__thunkpos;  if (!yy_Enumerator(yy)) goto l1799;  yy->__pos= yypos1800; yy->__thunkpos= yythunkpos1800;
+  }
+  {  int yypos1801= yy->__pos, yythunkpos1801= yy->__thunkpos;  if (!yy_ListTight(yy)) goto l1802;  goto l1801;
+  l1802:;	  yy->__pos= yypos1801; yy->__thunkpos= yythunkpos1801;  if (!yy_ListLoose(yy)) goto l1799;
+  }
+  l1801:;	  yyDo(yy, yy_1_OrderedList, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "OrderedList", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1799:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "OrderedList", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HeadingSection(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;  yyDo(yy, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "HeadingSection"));  if (!yy_StartList(yy)) goto l1803;  yyDo(yy, yySet, -1, 0);  if (!yy_Heading(yy)) goto l1803;  yyDo(yy, yy_1_HeadingSection, yy->__begin, yy->__end);
+  l1804:;	
+  {  int yypos1805= yy->__pos, yythunkpos1805= yy->__thunkpos;  if (!yy_HeadingSectionBlock(yy)) goto l1805;  yyDo(yy, yy_2_HeadingSection, yy->__begin, yy->__end);  goto l1804;
+  l1805:;	  yy->__pos= yypos1805; yy->__thunkpos= yythunkpos1805;
+  }  yyDo(yy, yy_3_HeadingSection, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "HeadingSection", yy->__buf+yy->__pos-yy->__base));  yyDo(yy, yyPop, 1, 0);
+  return 1;
+  l1803:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HeadingSection", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HorizontalRule(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HorizontalRule"));  if (!yy_NonindentSpace(yy)) goto l1806;
+  {  int yypos1807= yy->__pos, yythunkpos1807= yy->__thunkpos;  if (!yymatchChar(yy, '*')) goto l1808;  if (!yy_Sp(yy)) goto l1808;  if (!yymatchChar(yy, '*')) goto l1808;  if (!yy_Sp(yy)) goto l1808;  if (!yymatchChar(yy, '*')) goto l1808;
+  l1809:;	
+  {  int yypos1810= yy->__pos, yythunkpos1810= yy->__thunkpos;  if (!yy_Sp(yy)) goto l1810;  if (!yymatchChar(yy, '*')) goto l1810;  goto l1809;
+  l1810:;	  yy->__pos= yypos1810; yy->__thunkpos= yythunkpos1810;
+  }  goto l1807;
+  l1808:;	  yy->__pos= yypos1807; yy->__thunkpos= yythunkpos1807;  if (!yymatchChar(yy, '-')) goto l1811;  if (!yy_Sp(yy)) goto l1811;  if (!yymatchChar(yy, '-')) goto l1811;  if (!yy_Sp(yy)) goto l1811;  if (!yymatchChar(yy, '-')) goto l1811;
+  l1812:;	
+  {  int yypos1813= yy->__pos, yythunkpos1813= yy->__thunkpos;  if (!yy_Sp(yy)) goto l1813;  if (!yymatchChar(yy, '-')) goto l1813;  goto l1812;
+  l1813:;	  yy->__pos= yypos1813; yy->__thunkpos= yythunkpos1813;
+  }  goto l1807;
+  l1811:;	  yy->__pos= yypos1807; yy->__thunkpos= yythunkpos1807;  if (!yymatchChar(yy, '_')) goto l1806;  if (!yy_Sp(yy)) goto l1806;  if (!yymatchChar(yy, '_')) goto l1806;  if (!yy_Sp(yy)) goto l1806;  if (!yymatchChar(yy, '_')) goto l1806;
+  l1814:;	
+  {  int yypos1815= yy->__pos, yythunkpos1815= yy->__thunkpos;  if (!yy_Sp(yy)) goto l1815;  if (!yymatchChar(yy, '_')) goto l1815;  goto l1814;
+  l1815:;	  yy->__pos= yypos1815; yy->__thunkpos= yythunkpos1815;
+  }
+  }
+  l1807:;	  if (!yy_Sp(yy)) goto l1806;  if (!yy_Newline(yy)) goto l1806;  if (!yy_BlankLine(yy)) goto l1806;
+  l1816:;	
+  {  int yypos1817= yy->__pos, yythunkpos1817= yy->__thunkpos;  if (!yy_BlankLine(yy)) goto l1817;  goto l1816;
+  l1817:;	  yy->__pos= yypos1817; yy->__thunkpos= yythunkpos1817;
+  }  yyDo(yy, yy_1_HorizontalRule, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "HorizontalRule", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1806:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HorizontalRule", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_Reference(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;  yyDo(yy, yyPush, 4, 0);
+  yyprintf((stderr, "%s\n", "Reference"));  if (!yy_StartList(yy)) goto l1818;  yyDo(yy, yySet, -4, 0);  if (!yy_NonindentSpace(yy)) goto l1818;
+  {  int yypos1819= yy->__pos, yythunkpos1819= yy->__thunkpos;  if (!yymatchString(yy, "[]")) goto l1819;  goto l1818;
+  l1819:;	  yy->__pos= yypos1819; yy->__thunkpos= yythunkpos1819;
+  }  if (!yy_Label(yy)) goto l1818;  yyDo(yy, yySet, -3, 0);  if (!yymatchChar(yy, ':')) goto l1818;  if (!yy_Spnl(yy)) goto l1818;  if (!yy_RefSrc(yy)) goto l1818;  yyDo(yy, yySet, -2, 0);  if (!yy_RefTitle(yy)) goto l1818;  yyDo(yy, yySet, -1, 0);
+  {  int yypos1820= yy->__pos, yythunkpos1820= yy->__thunkpos;  if (!( !extension(yy->parser, EXT_COMPATIBILITY) )) goto l1820;
+  {  int yypos1822= yy->__pos, yythunkpos1822= yy->__thunkpos;  if (!yy_Attributes(yy)) goto l1822;  yyDo(yy, yy_1_Reference, yy->__begin, yy->__end);  goto l1823;
+  l1822:;	  yy->__pos= yypos1822; yy->__thunkpos= yythunkpos1822;
+  }
+  l1823:;	  goto l1821;
+  l1820:;	  yy->__pos= yypos1820; yy->__thunkpos= yythunkpos1820;
+  }
+  l1821:;	  if (!yy_BlankLine(yy)) goto l1818;
+  l1824:;	
+  {  int yypos1825= yy->__pos, yythunkpos1825= yy->__thunkpos;  if (!yy_BlankLine(yy)) goto l1825;  goto l1824;
+  l1825:;	  yy->__pos= yypos1825; yy->__thunkpos= yythunkpos1825;
+  }  yyDo(yy, yy_2_Reference, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Reference", yy->__buf+yy->__pos-yy->__base));  yyDo(yy, yyPop, 4, 0);
+  return 1;
+  l1818:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Reference", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_Note(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;  yyDo(yy, yyPush, 2, 0);
+  yyprintf((stderr, "%s\n", "Note"));  if (!( extension(yy->parser, EXT_NOTES) )) goto l1826;  if (!yy_NonindentSpace(yy)) goto l1826;  if (!yy_RawNoteReference(yy)) goto l1826;  yyDo(yy, yySet, -2, 0);  if (!yymatchChar(yy, ':')) goto l1826;  if (!yy_Sp(yy)) goto l1826;  if (!yy_StartList(yy)) goto l1826;  yyDo(yy, yySet, -1, 0);  if (!yy_RawNoteBlock(yy)) goto l1826;  yyDo(yy, yy_1_Note, yy->__begin, yy->__end);
+  l1827:;	
+  {  int yypos1828= yy->__pos, yythunkpos1828= yy->__thunkpos;
+  {  int yypos1829= yy->__pos, yythunkpos1829= yy->__thunkpos;  if (!yy_Indent(yy)) goto l1828;  yy->__pos= yypos1829; yy->__thunkpos= yythunkpos1829;
+  }  if (!yy_RawNoteBlock(yy)) goto l1828;  yyDo(yy, yy_2_Note, yy->__begin, yy->__end);  goto l1827;
+  l1828:;	  yy->__pos= yypos1828; yy->__thunkpos= yythunkpos1828;
+  }  yyDo(yy, yy_3_Note, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Note", yy->__buf+yy->__pos-yy->__base));  yyDo(yy, yyPop, 2, 0);
+  return 1;
+  l1826:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Note", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_Glossary(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;  yyDo(yy, yyPush, 2, 0);
+  yyprintf((stderr, "%s\n", "Glossary"));  if (!( extension(yy->parser, EXT_NOTES) )) goto l1830;  if (!yy_StartList(yy)) goto l1830;  yyDo(yy, yySet, -2, 0);  if (!yy_NonindentSpace(yy)) goto l1830;  if (!yy_RawNoteReference(yy)) goto l1830;  yyDo(yy, yySet, -1, 0);  if (!yymatchChar(yy, ':')) goto l1830;  if (!yy_Sp(yy)) goto l1830;  if (!yymatchString(yy, "glossary:")) goto l1830;  if (!yy_Sp(yy)) goto l1830;  if (!yy_GlossaryTerm(yy)) goto l1830;  yyDo(yy, yy_1_Glossary, yy->__begin, yy->__end);
+  {  int yypos1831= yy->__pos, yythunkpos1831= yy->__thunkpos;  if (!yy_GlossarySortKey(yy)) goto l1831;  yyDo(yy, yy_2_Glossary, yy->__begin, yy->__end);  goto l1832;
+  l1831:;	  yy->__pos= yypos1831; yy->__thunkpos= yythunkpos1831;
+  }
+  l1832:;	  if (!yy_Newline(yy)) goto l1830;  if (!yy_RawNoteBlock(yy)) goto l1830;  yyDo(yy, yy_3_Glossary, yy->__begin, yy->__end);
+  l1833:;	
+  {  int yypos1834= yy->__pos, yythunkpos1834= yy->__thunkpos;
+  {  int yypos1835= yy->__pos, yythunkpos1835= yy->__thunkpos;  if (!yy_Indent(yy)) goto l1834;  yy->__pos= yypos1835; yy->__thunkpos= yythunkpos1835;
+  }  if (!yy_RawNoteBlock(yy)) goto l1834;  yyDo(yy, yy_4_Glossary, yy->__begin, yy->__end);  goto l1833;
+  l1834:;	  yy->__pos= yypos1834; yy->__thunkpos= yythunkpos1834;
+  }  yyDo(yy, yy_5_Glossary, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Glossary", yy->__buf+yy->__pos-yy->__base));  yyDo(yy, yyPop, 2, 0);
+  return 1;
+  l1830:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Glossary", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_DefinitionList(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;  yyDo(yy, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "DefinitionList"));  if (!yy_StartList(yy)) goto l1836;  yyDo(yy, yySet, -1, 0);
+  {  int yypos1837= yy->__pos, yythunkpos1837= yy->__thunkpos;  if (!yy_TermLine(yy)) goto l1836;
+  l1838:;	
+  {  int yypos1839= yy->__pos, yythunkpos1839= yy->__thunkpos;  if (!yy_TermLine(yy)) goto l1839;  goto l1838;
+  l1839:;	  yy->__pos= yypos1839; yy->__thunkpos= yythunkpos1839;
+  }  if (!yymatchChar(yy, ':')) goto l1836;  yy->__pos= yypos1837; yy->__thunkpos= yythunkpos1837;
+  }  if (!yy_Term(yy)) goto l1836;  yyDo(yy, yy_1_DefinitionList, yy->__begin, yy->__end);
+  l1842:;	
+  {  int yypos1843= yy->__pos, yythunkpos1843= yy->__thunkpos;  if (!yy_Term(yy)) goto l1843;  yyDo(yy, yy_1_DefinitionList, yy->__begin, yy->__end);  goto l1842;
+  l1843:;	  yy->__pos= yypos1843; yy->__thunkpos= yythunkpos1843;
+  }  if (!yy_Definition(yy)) goto l1836;  yyDo(yy, yy_2_DefinitionList, yy->__begin, yy->__end);
+  l1844:;	
+  {  int yypos1845= yy->__pos, yythunkpos1845= yy->__thunkpos;  if (!yy_Definition(yy)) goto l1845;  yyDo(yy, yy_2_DefinitionList, yy->__begin, yy->__end);  goto l1844;
+  l1845:;	  yy->__pos= yypos1845; yy->__thunkpos= yythunkpos1845;
+  }
+  l1846:;	
+  {  int yypos1847= yy->__pos, yythunkpos1847= yy->__thunkpos;  if (!yy_BlankLine(yy)) goto l1847;  goto l1846;
+  l1847:;	  yy->__pos= yypos1847; yy->__thunkpos= yythunkpos1847;
+  }
+  l1840:;	
+  {  int yypos1841= yy->__pos, yythunkpos1841= yy->__thunkpos;  if (!yy_Term(yy)) goto l1841;  yyDo(yy, yy_1_DefinitionList, yy->__begin, yy->__end);
+  l1848:;	
+  {  int yypos1849= yy->__pos, yythunkpos1849= yy->__thunkpos;  if (!yy_Term(yy)) goto l1849;  yyDo(yy, yy_1_DefinitionList, yy->__begin, yy->__end);  goto l1848;
+  l1849:;	  yy->__pos= yypos1849; yy->__thunkpos= yythunkpos1849;
+  }  if (!yy_Definition(yy)) goto l1841;  yyDo(yy, yy_2_DefinitionList, yy->__begin, yy->__end);
+  l1850:;	
+  {  int yypos1851= yy->__pos, yythunkpos1851= yy->__thunkpos;  if (!yy_Definition(yy)) goto l1851;  yyDo(yy, yy_2_DefinitionList, yy->__begin, yy->__end);  goto l1850;
+  l1851:;	  yy->__pos= yypos1851; yy->__thunkpos= yythunkpos1851;
+  }
+  l1852:;	
+  {  int yypos1853= yy->__pos, yythunkpos1853= yy->__thunkpos;  if (!yy_BlankLine(yy)) goto l1853;  goto l1852;
+  l1853:;	  yy->__pos= yypos1853; yy->__thunkpos= yythunkpos1853;
+  }  goto l1840;
+  l1841:;	  yy->__pos= yypos1841; yy->__thunkpos= yythunkpos1841;
+  }  yyDo(yy, yy_3_DefinitionList, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "DefinitionList", yy->__buf+yy->__pos-yy->__base));  yyDo(yy, yyPop, 1, 0);
+  return 1;
+  l1836:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "DefinitionList", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_Verbatim(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;  yyDo(yy, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "Verbatim"));  if (!yy_StartList(yy)) goto l1854;  yyDo(yy, yySet, -1, 0);  if (!yy_VerbatimChunk(yy)) goto l1854;  yyDo(yy, yy_1_Verbatim, yy->__begin, yy->__end);
+  l1855:;	
+  {  int yypos1856= yy->__pos, yythunkpos1856= yy->__thunkpos;  if (!yy_VerbatimChunk(yy)) goto l1856;  yyDo(yy, yy_1_Verbatim, yy->__begin, yy->__end);  goto l1855;
+  l1856:;	  yy->__pos= yypos1856; yy->__thunkpos= yythunkpos1856;
+  }
+  l1857:;	
+  {  int yypos1858= yy->__pos, yythunkpos1858= yy->__thunkpos;  if (!yy_BlankLine(yy)) goto l1858;  goto l1857;
+  l1858:;	  yy->__pos= yypos1858; yy->__thunkpos= yythunkpos1858;
+  }  yyDo(yy, yy_2_Verbatim, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Verbatim", yy->__buf+yy->__pos-yy->__base));  yyDo(yy, yyPop, 1, 0);
+  return 1;
+  l1854:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Verbatim", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_BlockQuote(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;  yyDo(yy, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "BlockQuote"));  if (!yy_BlockQuoteRaw(yy)) goto l1859;  yyDo(yy, yySet, -1, 0);  yyDo(yy, yy_1_BlockQuote, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "BlockQuote", yy->__buf+yy->__pos-yy->__base));  yyDo(yy, yyPop, 1, 0);
+  return 1;
+  l1859:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "BlockQuote", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_RawLine(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "RawLine"));
+  {  int yypos1861= yy->__pos, yythunkpos1861= yy->__thunkpos;  if (!(YY_BEGIN)) goto l1862;
+  l1863:;	
+  {  int yypos1864= yy->__pos, yythunkpos1864= yy->__thunkpos;
+  {  int yypos1865= yy->__pos, yythunkpos1865= yy->__thunkpos;  if (!yymatchChar(yy, '\r')) goto l1865;  goto l1864;
+  l1865:;	  yy->__pos= yypos1865; yy->__thunkpos= yythunkpos1865;
+  }
+  {  int yypos1866= yy->__pos, yythunkpos1866= yy->__thunkpos;  if (!yymatchChar(yy, '\n')) goto l1866;  goto l1864;
+  l1866:;	  yy->__pos= yypos1866; yy->__thunkpos= yythunkpos1866;
+  }  if (!yymatchDot(yy)) goto l1864;  goto l1863;
+  l1864:;	  yy->__pos= yypos1864; yy->__thunkpos= yythunkpos1864;
+  }  if (!yy_Newline(yy)) goto l1862;  if (!(YY_END)) goto l1862;  goto l1861;
+  l1862:;	  yy->__pos= yypos1861; yy->__thunkpos= yythunkpos1861;  if (!(YY_BEGIN)) goto l1860;  if (!yymatchDot(yy)) goto l1860;
+  l1867:;	
+  {  int yypos1868= yy->__pos, yythunkpos1868= yy->__thunkpos;  if (!yymatchDot(yy)) goto l1868;  goto l1867;
+  l1868:;	  yy->__pos= yypos1868; yy->__thunkpos= yythunkpos1868;
+  }  if (!(YY_END)) goto l1860;  if (!yy_Eof(yy)) goto l1860;
+  }
+  l1861:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "RawLine", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1860:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "RawLine", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_BlankLine(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "BlankLine"));  if (!yy_Sp(yy)) goto l1869;  if (!yy_Newline(yy)) goto l1869;
+  yyprintf((stderr, "  ok   %s @ %s\n", "BlankLine", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1869:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "BlankLine", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_SingleLineMetaKeyValue(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "SingleLineMetaKeyValue"));  if (!yy_MetaDataKey(yy)) goto l1870;  if (!yy_Sp(yy)) goto l1870;  if (!yymatchChar(yy, ':')) goto l1870;  if (!yy_Sp(yy)) goto l1870;
+  l1871:;	
+  {  int yypos1872= yy->__pos, yythunkpos1872= yy->__thunkpos;
+  {  int yypos1873= yy->__pos, yythunkpos1873= yy->__thunkpos;  if (!yy_Newline(yy)) goto l1873;  goto l1872;
+  l1873:;	  yy->__pos= yypos1873; yy->__thunkpos= yythunkpos1873;
+  }  if (!yymatchDot(yy)) goto l1872;  goto l1871;
+  l1872:;	  yy->__pos= yypos1872; yy->__thunkpos= yythunkpos1872;
+  }
+  yyprintf((stderr, "  ok   %s @ %s\n", "SingleLineMetaKeyValue", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1870:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "SingleLineMetaKeyValue", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_AlphanumericAscii(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "AlphanumericAscii"));  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\000\000\377\003\376\377\377\007\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l1874;
+  yyprintf((stderr, "  ok   %s @ %s\n", "AlphanumericAscii", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1874:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "AlphanumericAscii", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_MetaDataValue(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;  yyDo(yy, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "MetaDataValue"));  if (!yy_StartList(yy)) goto l1875;  yyDo(yy, yySet, -1, 0);  if (!(YY_BEGIN)) goto l1875;
+  l1876:;	
+  {  int yypos1877= yy->__pos, yythunkpos1877= yy->__thunkpos;
+  {  int yypos1878= yy->__pos, yythunkpos1878= yy->__thunkpos;  if (!yy_Newline(yy)) goto l1878;  goto l1877;
+  l1878:;	  yy->__pos= yypos1878; yy->__thunkpos= yythunkpos1878;
+  }  if (!yymatchDot(yy)) goto l1877;  goto l1876;
+  l1877:;	  yy->__pos= yypos1877; yy->__thunkpos= yythunkpos1877;
+  }  if (!(YY_END)) goto l1875;  yyDo(yy, yy_1_MetaDataValue, yy->__begin, yy->__end);
+  {  int yypos1879= yy->__pos, yythunkpos1879= yy->__thunkpos;  if (!yy_Newline(yy)) goto l1880;
+  {  int yypos1881= yy->__pos, yythunkpos1881= yy->__thunkpos;
+  {  int yypos1882= yy->__pos, yythunkpos1882= yy->__thunkpos;  if (!yy_BlankLine(yy)) goto l1882;  goto l1880;
+  l1882:;	  yy->__pos= yypos1882; yy->__thunkpos= yythunkpos1882;
+  }
+  {  int yypos1883= yy->__pos, yythunkpos1883= yy->__thunkpos;  if (!yy_SingleLineMetaKeyValue(yy)) goto l1883;  goto l1880;
+  l1883:;	  yy->__pos= yypos1883; yy->__thunkpos= yythunkpos1883;
+  }  if (!yy_Sp(yy)) goto l1880;  if (!yy_RawLine(yy)) goto l1880;  yy->__pos= yypos1881; yy->__thunkpos= yythunkpos1881;
+  }  yyDo(yy, yy_2_MetaDataValue, yy->__begin, yy->__end);  goto l1879;
+  l1880:;	  yy->__pos= yypos1879; yy->__thunkpos= yythunkpos1879;  if (!yy_Newline(yy)) goto l1875;
+  }
+  l1879:;	
+  l1884:;	
+  {  int yypos1885= yy->__pos, yythunkpos1885= yy->__thunkpos;
+  {  int yypos1886= yy->__pos, yythunkpos1886= yy->__thunkpos;  if (!yy_BlankLine(yy)) goto l1886;  goto l1885;
+  l1886:;	  yy->__pos= yypos1886; yy->__thunkpos= yythunkpos1886;
+  }
+  {  int yypos1887= yy->__pos, yythunkpos1887= yy->__thunkpos;  if (!yy_SingleLineMetaKeyValue(yy)) goto l1887;  goto l1885;
+  l1887:;	  yy->__pos= yypos1887; yy->__thunkpos= yythunkpos1887;
+  }  if (!yy_Sp(yy)) goto l1885;  if (!yy_RawLine(yy)) goto l1885;  yyDo(yy, yy_3_MetaDataValue, yy->__begin, yy->__end);  goto l1884;
+  l1885:;	  yy->__pos= yypos1885; yy->__thunkpos= yythunkpos1885;
+  }  yyDo(yy, yy_4_MetaDataValue, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "MetaDataValue", yy->__buf+yy->__pos-yy->__base));  yyDo(yy, yyPop, 1, 0);
+  return 1;
+  l1875:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "MetaDataValue", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_SkipBlock(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "SkipBlock"));
+  {  int yypos1889= yy->__pos, yythunkpos1889= yy->__thunkpos;
+  {  int yypos1893= yy->__pos, yythunkpos1893= yy->__thunkpos;  if (!yy_BlankLine(yy)) goto l1893;  goto l1890;
+  l1893:;	  yy->__pos= yypos1893; yy->__thunkpos= yythunkpos1893;
+  }  if (!yy_RawLine(yy)) goto l1890;
+  l1891:;	
+  {  int yypos1892= yy->__pos, yythunkpos1892= yy->__thunkpos;
+  {  int yypos1894= yy->__pos, yythunkpos1894= yy->__thunkpos;  if (!yy_BlankLine(yy)) goto l1894;  goto l1892;
+  l1894:;	  yy->__pos= yypos1894; yy->__thunkpos= yythunkpos1894;
+  }  if (!yy_RawLine(yy)) goto l1892;  goto l1891;
+  l1892:;	  yy->__pos= yypos1892; yy->__thunkpos= yythunkpos1892;
+  }
+  l1895:;	
+  {  int yypos1896= yy->__pos, yythunkpos1896= yy->__thunkpos;  if (!yy_BlankLine(yy)) goto l1896;  goto l1895;
+  l1896:;	  yy->__pos= yypos1896; yy->__thunkpos= yythunkpos1896;
+  }  goto l1889;
+  l1890:;	  yy->__pos= yypos1889; yy->__thunkpos= yythunkpos1889;  if (!yy_BlankLine(yy)) goto l1888;
+  l1897:;	
+  {  int yypos1898= yy->__pos, yythunkpos1898= yy->__thunkpos;  if (!yy_BlankLine(yy)) goto l1898;  goto l1897;
+  l1898:;	  yy->__pos= yypos1898; yy->__thunkpos= yythunkpos1898;
+  }
+  }
+  l1889:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "SkipBlock", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1888:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "SkipBlock", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_MetaDataOnly(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;  yyDo(yy, yyPush, 2, 0);
+  yyprintf((stderr, "%s\n", "MetaDataOnly"));  if (!yy_StartList(yy)) goto l1899;  yyDo(yy, yySet, -2, 0);
+  l1900:;	
+  {  int yypos1901= yy->__pos, yythunkpos1901= yy->__thunkpos;
+  {  int yypos1902= yy->__pos, yythunkpos1902= yy->__thunkpos;  if (!yy_MetaData(yy)) goto l1903;  yyDo(yy, yySet, -1, 0);  yyDo(yy, yy_1_MetaDataOnly, yy->__begin, yy->__end);  goto l1902;
+  l1903:;	  yy->__pos= yypos1902; yy->__thunkpos= yythunkpos1902;  if (!yy_SkipBlock(yy)) goto l1901;
+  }
+  l1902:;	  goto l1900;
+  l1901:;	  yy->__pos= yypos1901; yy->__thunkpos= yythunkpos1901;
+  }  yyDo(yy, yy_2_MetaDataOnly, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "MetaDataOnly", yy->__buf+yy->__pos-yy->__base));  yyDo(yy, yyPop, 2, 0);
+  return 1;
+  l1899:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "MetaDataOnly", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_MetaDataKeyValue(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;  yyDo(yy, yyPush, 2, 0);
+  yyprintf((stderr, "%s\n", "MetaDataKeyValue"));  if (!yy_MetaDataKey(yy)) goto l1904;  yyDo(yy, yySet, -2, 0);  if (!yy_Sp(yy)) goto l1904;  if (!yymatchChar(yy, ':')) goto l1904;  if (!yy_Sp(yy)) goto l1904;  if (!yy_MetaDataValue(yy)) goto l1904;  yyDo(yy, yySet, -1, 0);  yyDo(yy, yy_1_MetaDataKeyValue, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "MetaDataKeyValue", yy->__buf+yy->__pos-yy->__base));  yyDo(yy, yyPop, 2, 0);
+  return 1;
+  l1904:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "MetaDataKeyValue", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_DocSection(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;  yyDo(yy, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "DocSection"));  if (!yy_StartList(yy)) goto l1905;  yyDo(yy, yySet, -1, 0);
+  l1906:;	
+  {  int yypos1907= yy->__pos, yythunkpos1907= yy->__thunkpos;  if (!( yy->__pos < yy->parser->section_end )) goto l1907;  if (!yy_Block(yy)) goto l1907;  yyDo(yy, yy_1_DocSection, yy->__begin, yy->__end);  if (!( YYACCEPT )) goto l1907;  goto l1906;
+  l1907:;	  yy->__pos= yypos1907; yy->__thunkpos= yythunkpos1907;
+  }  yyDo(yy, yy_2_DocSection, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "DocSection", yy->__buf+yy->__pos-yy->__base));  yyDo(yy, yyPop, 1, 0);
+  return 1;
+  l1905:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "DocSection", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_MetaData(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;  yyDo(yy, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "MetaData"));  if (!yy_StartList(yy)) goto l1908;  yyDo(yy, yySet, -1, 0);
+  {  int yypos1909= yy->__pos, yythunkpos1909= yy->__thunkpos;  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\000\000\000\000\376\377\377\007\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l1909;
+  l1910:;	
+  {  int yypos1911= yy->__pos, yythunkpos1911= yy->__thunkpos;  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\000\000\000\000\376\377\377\007\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l1911;  goto l1910;
+  l1911:;	  yy->__pos= yypos1911; yy->__thunkpos= yythunkpos1911;
+  }  if (!yymatchString(yy, "://")) goto l1909;  goto l1908;
+  l1909:;	  yy->__pos= yypos1909; yy->__thunkpos= yythunkpos1909;
+  }  if (!yy_MetaDataKeyValue(yy)) goto l1908;  yyDo(yy, yy_1_MetaData, yy->__begin, yy->__end);
+  l1912:;	
+  {  int yypos1913= yy->__pos, yythunkpos1913= yy->__thunkpos;  if (!yy_MetaDataKeyValue(yy)) goto l1913;  yyDo(yy, yy_1_MetaData, yy->__begin, yy->__end);  goto l1912;
+  l1913:;	  yy->__pos= yypos1913; yy->__thunkpos= yythunkpos1913;
+  }  yyDo(yy, yy_2_MetaData, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "MetaData", yy->__buf+yy->__pos-yy->__base));  yyDo(yy, yyPop, 1, 0);
+  return 1;
+  l1908:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "MetaData", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_Newline(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "Newline"));
+  {  int yypos1915= yy->__pos, yythunkpos1915= yy->__thunkpos;  if (!yymatchChar(yy, '\n')) goto l1916;  goto l1915;
+  l1916:;	  yy->__pos= yypos1915; yy->__thunkpos= yythunkpos1915;  if (!yymatchChar(yy, '\r')) goto l1914;
+  {  int yypos1917= yy->__pos, yythunkpos1917= yy->__thunkpos;  if (!yymatchChar(yy, '\n')) goto l1917;  goto l1918;
+  l1917:;	  yy->__pos= yypos1917; yy->__thunkpos= yythunkpos1917;
+  }
+  l1918:;	
+  }
+  l1915:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "Newline", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1914:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Newline", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_Sp(yycontext *yy)
+{
+  yyprintf((stderr, "%s\n", "Sp"));
+  l1920:;	
+  {  int yypos1921= yy->__pos, yythunkpos1921= yy->__thunkpos;  if (!yy_Spacechar(yy)) goto l1921;  goto l1920;
+  l1921:;	  yy->__pos= yypos1921; yy->__thunkpos= yythunkpos1921;
+  }
+  yyprintf((stderr, "  ok   %s @ %s\n", "Sp", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+}
+YY_RULE(int) yy_MetaDataKey(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "MetaDataKey"));  if (!(YY_BEGIN)) goto l1922;
+  {  int yypos1923= yy->__pos, yythunkpos1923= yy->__thunkpos;  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\000\000\000\000\376\377\377\007\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l1923;
+  l1924:;	
+  {  int yypos1925= yy->__pos, yythunkpos1925= yy->__thunkpos;  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\000\000\000\000\376\377\377\007\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l1925;  goto l1924;
+  l1925:;	  yy->__pos= yypos1925; yy->__thunkpos= yythunkpos1925;
+  }  if (!yymatchString(yy, "://")) goto l1923;  goto l1922;
+  l1923:;	  yy->__pos= yypos1923; yy->__thunkpos= yythunkpos1923;
+  }  if (!yy_AlphanumericAscii(yy)) goto l1922;
+  l1926:;	
+  {  int yypos1927= yy->__pos, yythunkpos1927= yy->__thunkpos;  if (!yy_Sp(yy)) goto l1927;
+  {  int yypos1930= yy->__pos, yythunkpos1930= yy->__thunkpos;  if (!yy_AlphanumericAscii(yy)) goto l1931;  goto l1930;
+  l1931:;	  yy->__pos= yypos1930; yy->__thunkpos= yythunkpos1930;  if (!yymatchChar(yy, '_')) goto l1932;  goto l1930;
+  l1932:;	  yy->__pos= yypos1930; yy->__thunkpos= yythunkpos1930;  if (!yymatchChar(yy, ' ')) goto l1933;  goto l1930;
+  l1933:;	  yy->__pos= yypos1930; yy->__thunkpos= yythunkpos1930;  if (!yymatchChar(yy, '-')) goto l1927;
+  }
+  l1930:;	
+  l1928:;	
+  {  int yypos1929= yy->__pos, yythunkpos1929= yy->__thunkpos;
+  {  int yypos1934= yy->__pos, yythunkpos1934= yy->__thunkpos;  if (!yy_AlphanumericAscii(yy)) goto l1935;  goto l1934;
+  l1935:;	  yy->__pos= yypos1934; yy->__thunkpos= yythunkpos1934;  if (!yymatchChar(yy, '_')) goto l1936;  goto l1934;
+  l1936:;	  yy->__pos= yypos1934; yy->__thunkpos= yythunkpos1934;  if (!yymatchChar(yy, ' ')) goto l1937;  goto l1934;
+  l1937:;	  yy->__pos= yypos1934; yy->__thunkpos= yythunkpos1934;  if (!yymatchChar(yy, '-')) goto l1929;
+  }
+  l1934:;	  goto l1928;
+  l1929:;	  yy->__pos= yypos1929; yy->__thunkpos= yythunkpos1929;
+  }  goto l1926;
+  l1927:;	  yy->__pos= yypos1927; yy->__thunkpos= yythunkpos1927;
+  }  if (!(YY_END)) goto l1922;  yyDo(yy, yy_1_MetaDataKey, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "MetaDataKey", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1922:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "MetaDataKey", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_DocWithMetaData(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;  yyDo(yy, yyPush, 2, 0);
+  yyprintf((stderr, "%s\n", "DocWithMetaData"));
+  {  int yypos1939= yy->__pos, yythunkpos1939= yy->__thunkpos;  if (!yy_BOM(yy)) goto l1939;  goto l1940;
+  l1939:;	  yy->__pos= yypos1939; yy->__thunkpos= yythunkpos1939;
+  }
+  l1940:;	  if (!yy_StartList(yy)) goto l1938;  yyDo(yy, yySet, -2, 0);  if (!yy_StartList(yy)) goto l1938;  yyDo(yy, yySet, -1, 0);
+  {  int yypos1941= yy->__pos, yythunkpos1941= yy->__thunkpos;  if (!( !extension(yy->parser, EXT_COMPATIBILITY) )) goto l1941;
+  {  int yypos1943= yy->__pos, yythunkpos1943= yy->__thunkpos;  if (!yy_MetaDataKey(yy)) goto l1941;  if (!yy_Sp(yy)) goto l1941;  if (!yymatchChar(yy, ':')) goto l1941;  if (!yy_Sp(yy)) goto l1941;
+  {  int yypos1944= yy->__pos, yythunkpos1944= yy->__thunkpos;  if (!yy_Newline(yy)) goto l1944;  goto l1941;
+  l1944:;	  yy->__pos= yypos1944; yy->__thunkpos= yythunkpos1944;
+  }  yy->__pos= yypos1943; yy->__thunkpos= yythunkpos1943;
+  }  if (!yy_MetaData(yy)) goto l1941;  yyDo(yy, yy_1_DocWithMetaData, yy->__begin, yy->__end);  goto l1942;
+  l1941:;	  yy->__pos= yypos1941; yy->__thunkpos= yythunkpos1941;
+  }
+  l1942:;	
+  l1945:;	
+  {  int yypos1946= yy->__pos, yythunkpos1946= yy->__thunkpos;  if (!( yy->__pos < yy->parser->section_end )) goto l1946;  if (!yy_Block(yy)) goto l1946;  yyDo(yy, yy_2_DocWithMetaData, yy->__begin, yy->__end);  if (!( YYACCEPT )) goto l1946;  goto l1945;
+  l1946:;	  yy->__pos= yypos1946; yy->__thunkpos= yythunkpos1946;
+  }  yyDo(yy, yy_3_DocWithMetaData, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "DocWithMetaData", yy->__buf+yy->__pos-yy->__base));  yyDo(yy, yyPop, 2, 0);
+  return 1;
+  l1938:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "DocWithMetaData", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_Block(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "Block"));
+  l1948:;	
+  {  int yypos1949= yy->__pos, yythunkpos1949= yy->__thunkpos;  if (!yy_BlankLine(yy)) goto l1949;  goto l1948;
+  l1949:;	  yy->__pos= yypos1949; yy->__thunkpos= yythunkpos1949;
+  }
+  {  int yypos1950= yy->__pos, yythunkpos1950= yy->__thunkpos;  if (!yy_BlockQuote(yy)) goto l1951;  goto l1950;
+  l1951:;	  yy->__pos= yypos1950; yy->__thunkpos= yythunkpos1950;  if (!yy_Verbatim(yy)) goto l1952;  goto l1950;
+  l1952:;	  yy->__pos= yypos1950; yy->__thunkpos= yythunkpos1950;  if (!( !extension(yy->parser, EXT_COMPATIBILITY) )) goto l1953;  if (!yy_DefinitionList(yy)) goto l1953;  goto l1950;
+  l1953:;	  yy->__pos= yypos1950; yy->__thunkpos= yythunkpos1950;  if (!( !extension(yy->parser, EXT_COMPATIBILITY) )) goto l1954;  if (!yy_Glossary(yy)) goto l1954;  goto l1950;
+  l1954:;	  yy->__pos= yypos1950; yy->__thunkpos= yythunkpos1950;  if (!yy_Note(yy)) goto l1955;  goto l1950;
+  l1955:;	  yy->__pos= yypos1950; yy->__thunkpos= yythunkpos1950;  if (!yy_Reference(yy)) goto l1956;  goto l1950;
+  l1956:;	  yy->__pos= yypos1950; yy->__thunkpos= yythunkpos1950;  if (!yy_HorizontalRule(yy)) goto l1957;  goto l1950;
+  l1957:;	  yy->__pos= yypos1950; yy->__thunkpos= yythunkpos1950;  if (!yy_HeadingSection(yy)) goto l1958;  goto l1950;
+  l1958:;	  yy->__pos= yypos1950; yy->__thunkpos= yythunkpos1950;  if (!yy_OrderedList(yy)) goto l1959;  goto l1950;
+  l1959:;	  yy->__pos= yypos1950; yy->__thunkpos= yythunkpos1950;  if (!yy_BulletList(yy)) goto l1960;  goto l1950;
+  l1960:;	  yy->__pos= yypos1950; yy->__thunkpos= yythunkpos1950;  if (!yy_HtmlBlock(yy)) goto l1961;  goto l1950;
+  l1961:;	  yy->__pos= yypos1950; yy->__thunkpos= yythunkpos1950;  if (!yy_StyleBlock(yy)) goto l1962;  goto l1950;
+  l1962:;	  yy->__pos= yypos1950; yy->__thunkpos= yythunkpos1950;  if (!( !extension(yy->parser, EXT_COMPATIBILITY) )) goto l1963;  if (!yy_Table(yy)) goto l1963;  goto l1950;
+  l1963:;	  yy->__pos= yypos1950; yy->__thunkpos= yythunkpos1950;  if (!( !extension(yy->parser, EXT_COMPATIBILITY) )) goto l1964;  if (!yy_ImageBlock(yy)) goto l1964;  goto l1950;
+  l1964:;	  yy->__pos= yypos1950; yy->__thunkpos= yythunkpos1950;
+  {  int yypos1966= yy->__pos, yythunkpos1966= yy->__thunkpos;
+  {  int yypos1967= yy->__pos, yythunkpos1967= yy->__thunkpos;  if (!yy_Sp(yy)) goto l1967;  goto l1968;
+  l1967:;	  yy->__pos= yypos1967; yy->__thunkpos= yythunkpos1967;
+  }
+  l1968:;	  if (!yy_HtmlBlockOpenDiv(yy)) goto l1966;  goto l1965;
+  l1966:;	  yy->__pos= yypos1966; yy->__thunkpos= yythunkpos1966;
+  }  if (!yy_Para(yy)) goto l1965;  goto l1950;
+  l1965:;	  yy->__pos= yypos1950; yy->__thunkpos= yythunkpos1950;  if (!yy_Plain(yy)) goto l1947;
+  }
+  l1950:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "Block", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1947:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Block", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_StartList(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "StartList"));
+  {  int yypos1970= yy->__pos, yythunkpos1970= yy->__thunkpos;  if (!yymatchDot(yy)) goto l1969;  yy->__pos= yypos1970; yy->__thunkpos= yythunkpos1970;
+  }  yyDo(yy, yy_1_StartList, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "StartList", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1969:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "StartList", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_BOM(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "BOM"));  if (!yymatchString(yy, "\357\273\277")) goto l1971;
+  yyprintf((stderr, "  ok   %s @ %s\n", "BOM", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1971:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "BOM", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_Doc(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;  yyDo(yy, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "Doc"));
+  {  int yypos1973= yy->__pos, yythunkpos1973= yy->__thunkpos;  if (!yy_BOM(yy)) goto l1973;  goto l1974;
+  l1973:;	  yy->__pos= yypos1973; yy->__thunkpos= yythunkpos1973;
+  }
+  l1974:;	  if (!yy_StartList(yy)) goto l1972;  yyDo(yy, yySet, -1, 0);
+  l1975:;	
+  {  int yypos1976= yy->__pos, yythunkpos1976= yy->__thunkpos;  if (!yy_Block(yy)) goto l1976;  yyDo(yy, yy_1_Doc, yy->__begin, yy->__end);  if (!( YYACCEPT )) goto l1976;  goto l1975;
+  l1976:;	  yy->__pos= yypos1976; yy->__thunkpos= yythunkpos1976;
+  }  yyDo(yy, yy_2_Doc, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Doc", yy->__buf+yy->__pos-yy->__base));  yyDo(yy, yyPop, 1, 0);
+  return 1;
+  l1972:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Doc", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yyMemo_HtmlBlockInTags(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "HtmlBlockInTags"));
+  {  int yypos1978= yy->__pos, yythunkpos1978= yy->__thunkpos;  if (!yy_HtmlBlockAddress(yy)) goto l1979;  goto l1978;
+  l1979:;	  yy->__pos= yypos1978; yy->__thunkpos= yythunkpos1978;  if (!yy_HtmlBlockBlockquote(yy)) goto l1980;  goto l1978;
+  l1980:;	  yy->__pos= yypos1978; yy->__thunkpos= yythunkpos1978;  if (!yy_HtmlBlockCenter(yy)) goto l1981;  goto l1978;
+  l1981:;	  yy->__pos= yypos1978; yy->__thunkpos= yythunkpos1978;  if (!yy_HtmlBlockDir(yy)) goto l1982;  goto l1978;
+  l1982:;	  yy->__pos= yypos1978; yy->__thunkpos= yythunkpos1978;  if (!yy_HtmlBlockDiv(yy)) goto l1983;  goto l1978;
+  l1983:;	  yy->__pos= yypos1978; yy->__thunkpos= yythunkpos1978;  if (!yy_HtmlBlockDl(yy)) goto l1984;  goto l1978;
+  l1984:;	  yy->__pos= yypos1978; yy->__thunkpos= yythunkpos1978;  if (!yy_HtmlBlockFieldset(yy)) goto l1985;  goto l1978;
+  l1985:;	  yy->__pos= yypos1978; yy->__thunkpos= yythunkpos1978;  if (!yy_HtmlBlockForm(yy)) goto l1986;  goto l1978;
+  l1986:;	  yy->__pos= yypos1978; yy->__thunkpos= yythunkpos1978;  if (!yy_HtmlBlockH1(yy)) goto l1987;  goto l1978;
+  l1987:;	  yy->__pos= yypos1978; yy->__thunkpos= yythunkpos1978;  if (!yy_HtmlBlockH2(yy)) goto l1988;  goto l1978;
+  l1988:;	  yy->__pos= yypos1978; yy->__thunkpos= yythunkpos1978;  if (!yy_HtmlBlockH3(yy)) goto l1989;  goto l1978;
+  l1989:;	  yy->__pos= yypos1978; yy->__thunkpos= yythunkpos1978;  if (!yy_HtmlBlockH4(yy)) goto l1990;  goto l1978;
+  l1990:;	  yy->__pos= yypos1978; yy->__thunkpos= yythunkpos1978;  if (!yy_HtmlBlockH5(yy)) goto l1991;  goto l1978;
+  l1991:;	  yy->__pos= yypos1978; yy->__thunkpos= yythunkpos1978;  if (!yy_HtmlBlockH6(yy)) goto l1992;  goto l1978;
+  l1992:;	  yy->__pos= yypos1978; yy->__thunkpos= yythunkpos1978;  if (!yy_HtmlBlockMenu(yy)) goto l1993;  goto l1978;
+  l1993:;	  yy->__pos= yypos1978; yy->__thunkpos= yythunkpos1978;  if (!yy_HtmlBlockNoframes(yy)) goto l1994;  goto l1978;
+  l1994:;	  yy->__pos= yypos1978; yy->__thunkpos= yythunkpos1978;  if (!yy_HtmlBlockNoscript(yy)) goto l1995;  goto l1978;
+  l1995:;	  yy->__pos= yypos1978; yy->__thunkpos= yythunkpos1978;  if (!yy_HtmlBlockOl(yy)) goto l1996;  goto l1978;
+  l1996:;	  yy->__pos= yypos1978; yy->__thunkpos= yythunkpos1978;  if (!yy_HtmlBlockP(yy)) goto l1997;  goto l1978;
+  l1997:;	  yy->__pos= yypos1978; yy->__thunkpos= yythunkpos1978;  if (!yy_HtmlBlockPre(yy)) goto l1998;  goto l1978;
+  l1998:;	  yy->__pos= yypos1978; yy->__thunkpos= yythunkpos1978;  if (!yy_HtmlBlockTable(yy)) goto l1999;  goto l1978;
+  l1999:;	  yy->__pos= yypos1978; yy->__thunkpos= yythunkpos1978;  if (!yy_HtmlBlockUl(yy)) goto l2000;  goto l1978;
+  l2000:;	  yy->__pos= yypos1978; yy->__thunkpos= yythunkpos1978;  if (!yy_HtmlBlockDd(yy)) goto l2001;  goto l1978;
+  l2001:;	  yy->__pos= yypos1978; yy->__thunkpos= yythunkpos1978;  if (!yy_HtmlBlockDt(yy)) goto l2002;  goto l1978;
+  l2002:;	  yy->__pos= yypos1978; yy->__thunkpos= yythunkpos1978;  if (!yy_HtmlBlockFrameset(yy)) goto l2003;  goto l1978;
+  l2003:;	  yy->__pos= yypos1978; yy->__thunkpos= yythunkpos1978;  if (!yy_HtmlBlockLi(yy)) goto l2004;  goto l1978;
+  l2004:;	  yy->__pos= yypos1978; yy->__thunkpos= yythunkpos1978;  if (!yy_HtmlBlockTbody(yy)) goto l2005;  goto l1978;
+  l2005:;	  yy->__pos= yypos1978; yy->__thunkpos= yythunkpos1978;  if (!yy_HtmlBlockTd(yy)) goto l2006;  goto l1978;
+  l2006:;	  yy->__pos= yypos1978; yy->__thunkpos= yythunkpos1978;  if (!yy_HtmlBlockTfoot(yy)) goto l2007;  goto l1978;
+  l2007:;	  yy->__pos= yypos1978; yy->__thunkpos= yythunkpos1978;  if (!yy_HtmlBlockTh(yy)) goto l2008;  goto l1978;
+  l2008:;	  yy->__pos= yypos1978; yy->__thunkpos= yythunkpos1978;  if (!yy_HtmlBlockThead(yy)) goto l2009;  goto l1978;
+  l2009:;	  yy->__pos= yypos1978; yy->__thunkpos= yythunkpos1978;  if (!yy_HtmlBlockTr(yy)) goto l2010;  goto l1978;
+  l2010:;	  yy->__pos= yypos1978; yy->__thunkpos= yythunkpos1978;  if (!yy_HtmlBlockScript(yy)) goto l1977;
+  }
+  l1978:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "HtmlBlockInTags", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l1977:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "HtmlBlockInTags", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_HtmlBlockInTags(yycontext *yy)
+{  yymemoframe yyframe;  int yyok= yyMemoLookup(yy, 5);
+  if (yyok < 0)
+    {
+      yyMemoEnter(yy, &yyframe);
+      yyok= yyMemoLeave(yy, &yyframe, 5, yyMemo_HtmlBlockInTags(yy));
+    }
+  return yyok;
+}
+YY_RULE(int) yyMemo_ListItem(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;  yyDo(yy, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "ListItem"));
+  {  int yypos2012= yy->__pos, yythunkpos2012= yy->__thunkpos;  if (!yy_Bullet(yy)) goto l2013;  goto l2012;
+  l2013:;	  yy->__pos= yypos2012; yy->__thunkpos= yythunkpos2012;  if (!yy_Enumerator(yy)) goto l2011;
+  }
+  l2012:;	  if (!yy_StartList(yy)) goto l2011;  yyDo(yy, yySet, -1, 0);  if (!yy_ListBlock(yy)) goto l2011;  yyDo(yy, yy_1_ListItem, yy->__begin, yy->__end);
+  l2014:;	
+  {  int yypos2015= yy->__pos, yythunkpos2015= yy->__thunkpos;  if (!yy_ListContinuationBlock(yy)) goto l2015;  yyDo(yy, yy_2_ListItem, yy->__begin, yy->__end);  goto l2014;
+  l2015:;	  yy->__pos= yypos2015; yy->__thunkpos= yythunkpos2015;
+  }  yyDo(yy, yy_3_ListItem, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "ListItem", yy->__buf+yy->__pos-yy->__base));  yyDo(yy, yyPop, 1, 0);
+  return 1;
+  l2011:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "ListItem", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_ListItem(yycontext *yy)
+{  yymemoframe yyframe;  int yyok= yyMemoLookup(yy, 4);
+  if (yyok < 0)
+    {
+      yyMemoEnter(yy, &yyframe);
+      yyok= yyMemoLeave(yy, &yyframe, 4, yyMemo_ListItem(yy));
+    }
+  return yyok;
+}
+YY_RULE(int) yyMemo_Heading(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "Heading"));
+  {  int yypos2017= yy->__pos, yythunkpos2017= yy->__thunkpos;  if (!yy_SetextHeading(yy)) goto l2018;  goto l2017;
+  l2018:;	  yy->__pos= yypos2017; yy->__thunkpos= yythunkpos2017;  if (!yy_AtxHeading(yy)) goto l2016;
+  }
+  l2017:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "Heading", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l2016:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Heading", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_Heading(yycontext *yy)
+{  yymemoframe yyframe;  int yyok= yyMemoLookup(yy, 3);
+  if (yyok < 0)
+    {
+      yyMemoEnter(yy, &yyframe);
+      yyok= yyMemoLeave(yy, &yyframe, 3, yyMemo_Heading(yy));
+    }
+  return yyok;
+}
+YY_RULE(int) yyMemo_Label(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;  yyDo(yy, yyPush, 1, 0);
+  yyprintf((stderr, "%s\n", "Label"));  if (!yymatchChar(yy, '[')) goto l2019;
+  {  int yypos2020= yy->__pos, yythunkpos2020= yy->__thunkpos;  if (!yymatchChar(yy, '[')) goto l2020;  goto l2019;
+  l2020:;	  yy->__pos= yypos2020; yy->__thunkpos= yythunkpos2020;
+  }
+  {  int yypos2021= yy->__pos, yythunkpos2021= yy->__thunkpos;
+  {  int yypos2023= yy->__pos, yythunkpos2023= yy->__thunkpos;  if (!yymatchChar(yy, '^')) goto l2023;  goto l2022;
+  l2023:;	  yy->__pos= yypos2023; yy->__thunkpos= yythunkpos2023;
+  }
+  {  int yypos2024= yy->__pos, yythunkpos2024= yy->__thunkpos;  if (!yymatchChar(yy, '#')) goto l2024;  goto l2022;
+  l2024:;	  yy->__pos= yypos2024; yy->__thunkpos= yythunkpos2024;
+  }  if (!( extension(yy->parser, EXT_NOTES) )) goto l2022;  goto l2021;
+  l2022:;	  yy->__pos= yypos2021; yy->__thunkpos= yythunkpos2021;
+  {  int yypos2025= yy->__pos, yythunkpos2025= yy->__thunkpos;  if (!yymatchDot(yy)) goto l2019;  yy->__pos= yypos2025; yy->__thunkpos= yythunkpos2025;
+  }  if (!( !extension(yy->parser, EXT_NOTES) )) goto l2019;
+  }
+  l2021:;	  if (!yy_StartList(yy)) goto l2019;  yyDo(yy, yySet, -1, 0);
+  l2026:;	
+  {  int yypos2027= yy->__pos, yythunkpos2027= yy->__thunkpos;
+  {  int yypos2028= yy->__pos, yythunkpos2028= yy->__thunkpos;  if (!yymatchChar(yy, ']')) goto l2028;  goto l2027;
+  l2028:;	  yy->__pos= yypos2028; yy->__thunkpos= yythunkpos2028;
+  }  if (!yy_Inline(yy)) goto l2027;  yyDo(yy, yy_1_Label, yy->__begin, yy->__end);  goto l2026;
+  l2027:;	  yy->__pos= yypos2027; yy->__thunkpos= yythunkpos2027;
+  }  if (!yymatchChar(yy, ']')) goto l2019;  yyDo(yy, yy_2_Label, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "Label", yy->__buf+yy->__pos-yy->__base));  yyDo(yy, yyPop, 1, 0);
+  return 1;
+  l2019:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Label", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_Label(yycontext *yy)
+{  yymemoframe yyframe;  int yyok= yyMemoLookup(yy, 2);
+  if (yyok < 0)
+    {
+      yyMemoEnter(yy, &yyframe);
+      yyok= yyMemoLeave(yy, &yyframe, 2, yyMemo_Label(yy));
+    }
+  return yyok;
+}
+YY_RULE(int) yyMemo_Inline(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "Inline"));
+  {  int yypos2030= yy->__pos, yythunkpos2030= yy->__thunkpos;  if (!yy_Str(yy)) goto l2031;  goto l2030;
+  l2031:;	  yy->__pos= yypos2030; yy->__thunkpos= yythunkpos2030;  if (!( !extension(yy->parser, EXT_COMPATIBILITY) )) goto l2032;  if (!yy_MathSpan(yy)) goto l2032;  goto l2030;
+  l2032:;	  yy->__pos= yypos2030; yy->__thunkpos= yythunkpos2030;  if (!yy_Endline(yy)) goto l2033;  goto l2030;
+  l2033:;	  yy->__pos= yypos2030; yy->__thunkpos= yythunkpos2030;  if (!yy_UlOrStarLine(yy)) goto l2034;  goto l2030;
+  l2034:;	  yy->__pos= yypos2030; yy->__thunkpos= yythunkpos2030;  if (!yy_Space(yy)) goto l2035;  goto l2030;
+  l2035:;	  yy->__pos= yypos2030; yy->__thunkpos= yythunkpos2030;  if (!yy_Strong(yy)) goto l2036;  goto l2030;
+  l2036:;	  yy->__pos= yypos2030; yy->__thunkpos= yythunkpos2030;  if (!yy_Emph(yy)) goto l2037;  goto l2030;
+  l2037:;	  yy->__pos= yypos2030; yy->__thunkpos= yythunkpos2030;  if (!( !extension(yy->parser, EXT_COMPATIBILITY) )) goto l2038;  if (!yy_CitationReference(yy)) goto l2038;  goto l2030;
+  l2038:;	  yy->__pos= yypos2030; yy->__thunkpos= yythunkpos2030;  if (!yy_Image(yy)) goto l2039;  goto l2030;
+  l2039:;	  yy->__pos= yypos2030; yy->__thunkpos= yythunkpos2030;  if (!yy_Link(yy)) goto l2040;  goto l2030;
+  l2040:;	  yy->__pos= yypos2030; yy->__thunkpos= yythunkpos2030;  if (!yy_NoteReference(yy)) goto l2041;  goto l2030;
+  l2041:;	  yy->__pos= yypos2030; yy->__thunkpos= yythunkpos2030;  if (!yy_Code(yy)) goto l2042;  goto l2030;
+  l2042:;	  yy->__pos= yypos2030; yy->__thunkpos= yythunkpos2030;  if (!yy_MarkdownHtmlTagOpen(yy)) goto l2043;  goto l2030;
+  l2043:;	  yy->__pos= yypos2030; yy->__thunkpos= yythunkpos2030;  if (!yy_RawHtml(yy)) goto l2044;  goto l2030;
+  l2044:;	  yy->__pos= yypos2030; yy->__thunkpos= yythunkpos2030;  if (!yy_Entity(yy)) goto l2045;  goto l2030;
+  l2045:;	  yy->__pos= yypos2030; yy->__thunkpos= yythunkpos2030;  if (!yy_EscapedChar(yy)) goto l2046;  goto l2030;
+  l2046:;	  yy->__pos= yypos2030; yy->__thunkpos= yythunkpos2030;  if (!yy_Smart(yy)) goto l2047;  goto l2030;
+  l2047:;	  yy->__pos= yypos2030; yy->__thunkpos= yythunkpos2030;  if (!yy_Symbol(yy)) goto l2029;
+  }
+  l2030:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "Inline", yy->__buf+yy->__pos-yy->__base));
+  return 1;
+  l2029:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "Inline", yy->__buf+yy->__pos-yy->__base));
+  return 0;
+}
+YY_RULE(int) yy_Inline(yycontext *yy)
+{  yymemoframe yyframe;  int yyok= yyMemoLookup(yy, 1);
+  if (yyok < 0)
+    {
+      yyMemoEnter(yy, &yyframe);
+      yyok= yyMemoLeave(yy, &yyframe, 1, yyMemo_Inline(yy));
+    }
+  return yyok;
+}
+
+#ifndef YY_PART
+
+typedef int (*yyrule)(yycontext *yy);
+
+#ifdef YY_CTX_LOCAL
+#define YY_CTX_PARAM_	yycontext *yyctx,
+#define YY_CTX_PARAM	yycontext *yyctx
+#define YY_CTX_ARG_	yyctx,
+#define YY_CTX_ARG	yyctx
+#else
+#define YY_CTX_PARAM_
+#define YY_CTX_PARAM	void
+#define YY_CTX_ARG_
+#define YY_CTX_ARG
+static yycontext  yyctx0;
+static yycontext *yyctx= &yyctx0;
+#endif
+
+YY_PARSE(int) YYPARSEFROM(YY_CTX_PARAM_ yyrule yystart)
+{
+  int yyok;
+  if (!yyctx->__textlen)
+    {
+#ifndef YY_BUFFER
+      yyctx->__buflen= 1024;
+      yyctx->__buf= malloc(yyctx->__buflen);
+#endif
+      yyctx->__textlen= 1024;
+      yyctx->__text= malloc(yyctx->__textlen);
+      yyctx->__thunkslen= 32;
+      yyctx->__thunks= malloc(sizeof(yythunk) * yyctx->__thunkslen);
+      yyctx->__valslen= 32;
+      yyctx->__vals= malloc(sizeof(YYSTYPE) * yyctx->__valslen);
+      yyctx->__begin= yyctx->__end= yyctx->__base= yyctx->__pos= yyctx->__limit= yyctx->__thunkpos= 0;
+    }
+#ifdef YY_BUFFER
+  yyctx->__buf= YY_BUFFER;
+  yyctx->__base= 0;
+  yyctx->__limit= strlen(yyctx->__buf);
+  yyctx->__pos= 0;
+#endif
+  yyctx->__begin= yyctx->__end= yyctx->__pos;
+  yyctx->__thunkpos= 0;
+#ifdef YY_MEMO
+  yyMemoClear(yyctx);
+#endif
+  yyctx->__val= yyctx->__vals;
+  yyok= yystart(yyctx);
+  if (yyok) yyDone(yyctx);
+  yyCommit(yyctx);
+  return yyok;
+  (void)yyrefill;
+  (void)yymatchDot;
+  (void)yymatchChar;
+  (void)yymatchString;
+  (void)yymatchClass;
+  (void)yyDo;
+  (void)yyText;
+  (void)yyDone;
+  (void)yyCommit;
+  (void)yyAccept;
+  (void)yyPush;
+  (void)yyPop;
+  (void)yySet;
+}
+
+YY_PARSE(int) YYPARSE(YY_CTX_PARAM)
+{
+  return YYPARSEFROM(YY_CTX_ARG_ yy_Doc);
+}
+
+#ifdef YY_CTX_LOCAL
+
+YY_PARSE(void) YYRELEASE(yycontext *yyctx)
+{
+#ifndef YY_BUFFER
+  free(yyctx->__buf);
+#endif
+  free(yyctx->__text);
+  free(yyctx->__thunks);
+  free(yyctx->__vals);
+#ifdef YY_MEMO
+  free(yyctx->__memos);
+  free(yyctx->__memothunks);
+#endif
+  memset(yyctx, 0, sizeof(yycontext));
+}
+
+#endif
+
+#endif
+
+
+#include "parsing_functions.c"
+
+
@@ -82,9 +82,19 @@ enum keys { LIST,   /* A generic list of values.  For ordered and bullet lists,
             GLOSSARY,
             GLOSSARYTERM,
             GLOSSARYSORTKEY,
-            MATHSPAN
+            MATHSPAN,
+            SLICE   /* Unterminated view of the text being parsed.  Used only
+                       for fragments that the parser joins into a STR. */
           };
 
+/* key_set - which keys of enum keys occur in a document, one bit each */
+typedef struct {
+    unsigned int bits[SLICE / 32 + 1];
+} key_set;
+
+#define key_set_add(set, key) ((set)->bits[(key) / 32] |= 1u << ((key) % 32))
+#define key_set_has(set, key) (((set)->bits[(key) / 32] >> ((key) % 32)) & 1u)
+
 /* constants for managing Smart Typography */
 enum smartelements {
     LSQUOTE,
@@ -100,6 +110,8 @@ enum smartelements {
 enum smartoutput {
     HTMLOUT,
     LATEXOUT,
+    ODFOUT,
+    GROFFOUT,
 };
 
 enum language {
@@ -114,6 +126,7 @@ enum language {
 /* Semantic value of a parsing action. */
 struct Element {
     int               key;
+    int               len;          /* Length of a SLICE's contents.str. */
     union Contents    contents;
     struct Element    *children;
     struct Element    *next;
@@ -123,20 +136,46 @@ struct Element {
 
 typedef struct Element element;
 
-element * parse_references(char *string, int extensions);
-element * parse_notes(char *string, int extensions, element *reference_list);
-element * parse_labels(char *string, int extensions, element *reference_list, element *note_list);
-
-element * parse_markdown(char *string, int extensions, element *reference_list, element *note_list, element *label_list);
-element * parse_markdown_with_metadata(char *string, int extensions, element *reference_list, element *note_list, element *label_list);
-void free_element_list(element * elt);
-void free_element(element *elt);
-void print_element_list(GString *out, element *elt, int format, int exts);
-
-
-element * parse_metadata_only(char *string, int extensions);
+/* lookup_table - open-addressed hash table from string keys to elements,
+ * used to find references, notes, labels and metadata by name.  A table
+ * indexes one list ('source') and is rebuilt when asked to look in a
+ * different one.  It does not own the elements, so the lists stay valid
+ * as they are. */
+typedef struct {
+    char    **keys;
+    element **values;
+    int       size;             /* Number of slots; a power of two, or 0. */
+    int       count;            /* Number of keys indexed. */
+    element  *source;           /* List the table was built from. */
+} lookup_table;
+
+/* document_index - what is known about a parsed document as a whole,
+ * gathered once after it is parsed so that printing it need not search
+ * the tree.  Built by document_index_build(). */
+typedef struct {
+    key_set keys;               /* Keys that occur in the tree. */
+    element *metadata;          /* The METADATA block, or NULL. */
+    lookup_table metadata_table;    /* Its METAKEYs, by normalized key. */
+} document_index;
+
+void parse_collect(mmd_parser_t *parser, char *string, int extensions, element **reference_list, element **note_list, element **label_list);
+
+element * parse_markdown(mmd_parser_t *parser, char *string, int extensions, element *reference_list, element *note_list, element *label_list);
+element * parse_markdown_with_metadata(mmd_parser_t *parser, char *string, int extensions, element *reference_list, element *note_list, element *label_list);
+element * parse_markdown_section(mmd_parser_t *parser, char *string, int extensions, element *reference_list, element *note_list, element *label_list, bool first, int limit, int *end);
+void mmd_parser_release_elements(mmd_parser_t *parser);
+void assign_anchor_ids(mmd_parser_t *parser, element *tree);
+void document_index_build(document_index *index, element *tree);
+element * document_index_metadata(const document_index *index, char *key);
+void document_index_free(document_index *index);
+int mmd_parser_jobs(mmd_parser_t *parser);
+void print_element_list(GString *out, element *elt, const document_index *index, int format, int exts, int base_header_level);
+void write_element_list(mmd_write_fn write, void *data, element *elt, const document_index *index, int format, int exts, int base_header_level);
+
+
+element * parse_metadata_only(mmd_parser_t *parser, char *string, int extensions);
 char * extract_metadata_value(char *text, int extensions, char *key);
 
 char * metavalue_for_key(char *key, element *list);
 
-element * parse_markdown_for_opml(char *string, int extensions);
+element * parse_markdown_for_opml(mmd_parser_t *parser, char *string, int extensions);
@@ -0,0 +1,398 @@
+/**********************************************************************
+
+  output_cache.c - on-disk cache of converted documents.
+
+  Each entry holds the output of one conversion, in a file named after
+  the SHA-256 of everything the output depends on: the program version,
+  the syntax extensions, the output format and the input text.  An
+  unchanged input is then copied from the cache instead of being parsed
+  and printed again.  Entries are written to a temporary file and renamed
+  into place, so a reader never sees a partial entry.  When the cache is
+  closed, the least recently used entries are removed until the cache
+  fits in its size limit.
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License or the MIT
+  license.  See LICENSE for details.
+
+ ***********************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <stdint.h>
+#include <fcntl.h>
+#include <dirent.h>
+#include <utime.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#ifndef _WIN32
+#include <pthread.h>
+#endif
+#include "glib.h"
+#include "output_cache.h"
+
+#define ENTRY_SUFFIX ".out"
+
+extern char *strdup(const char *string);
+
+struct output_cache {
+    char *dir;
+    long long max_size;         /* Size limit in bytes, or 0 for none. */
+    char *salt;                 /* Hashed into every key. */
+    int hits;
+    int misses;
+    int stores;
+    int temp_count;             /* Number of temporary files named so far. */
+#ifndef _WIN32
+    pthread_mutex_t lock;
+#endif
+};
+
+/**********************************************************************
+
+  SHA-256 (FIPS 180-4)
+
+ ***********************************************************************/
+
+typedef struct {
+    uint32_t state[8];
+    uint64_t length;            /* Bytes hashed so far. */
+    unsigned char block[64];
+    size_t used;                /* Bytes waiting in 'block'. */
+} sha256_context;
+
+static const uint32_t sha256_k[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+#define ROTR(x, n) (((x) >> (n)) | ((x) << (32 - (n))))
+
+static void sha256_init(sha256_context *ctx) {
+    ctx->state[0] = 0x6a09e667; ctx->state[1] = 0xbb67ae85;
+    ctx->state[2] = 0x3c6ef372; ctx->state[3] = 0xa54ff53a;
+    ctx->state[4] = 0x510e527f; ctx->state[5] = 0x9b05688c;
+    ctx->state[6] = 0x1f83d9ab; ctx->state[7] = 0x5be0cd19;
+    ctx->length = 0;
+    ctx->used = 0;
+}
+
+/* sha256_block - mix one 64 byte block into the state */
+static void sha256_block(sha256_context *ctx, const unsigned char *p) {
+    uint32_t w[64];
+    uint32_t a, b, c, d, e, f, g, h, t1, t2;
+    int i;
+
+    for (i = 0; i < 16; i++)
+        w[i] = (uint32_t)p[4 * i] << 24 | (uint32_t)p[4 * i + 1] << 16
+            | (uint32_t)p[4 * i + 2] << 8 | (uint32_t)p[4 * i + 3];
+    for (i = 16; i < 64; i++)
+        w[i] = (ROTR(w[i - 2], 17) ^ ROTR(w[i - 2], 19) ^ (w[i - 2] >> 10)) + w[i - 7]
+            + (ROTR(w[i - 15], 7) ^ ROTR(w[i - 15], 18) ^ (w[i - 15] >> 3)) + w[i - 16];
+
+    a = ctx->state[0]; b = ctx->state[1]; c = ctx->state[2]; d = ctx->state[3];
+    e = ctx->state[4]; f = ctx->state[5]; g = ctx->state[6]; h = ctx->state[7];
+    for (i = 0; i < 64; i++) {
+        t1 = h + (ROTR(e, 6) ^ ROTR(e, 11) ^ ROTR(e, 25)) + ((e & f) ^ (~e & g)) + sha256_k[i] + w[i];
+        t2 = (ROTR(a, 2) ^ ROTR(a, 13) ^ ROTR(a, 22)) + ((a & b) ^ (a & c) ^ (b & c));
+        h = g; g = f; f = e; e = d + t1;
+        d = c; c = b; b = a; a = t1 + t2;
+    }
+    ctx->state[0] += a; ctx->state[1] += b; ctx->state[2] += c; ctx->state[3] += d;
+    ctx->state[4] += e; ctx->state[5] += f; ctx->state[6] += g; ctx->state[7] += h;
+}
+
+static void sha256_update(sha256_context *ctx, const void *data, size_t len) {
+    const unsigned char *p = data;
+    size_t n;
+
+    ctx->length += len;
+    if (ctx->used > 0) {
+        n = 64 - ctx->used;
+        if (n > len)
+            n = len;
+        memcpy(ctx->block + ctx->used, p, n);
+        ctx->used += n;
+        p += n;
+        len -= n;
+        if (ctx->used < 64)
+            return;
+        sha256_block(ctx, ctx->block);
+        ctx->used = 0;
+    }
+    for (; len >= 64; p += 64, len -= 64)
+        sha256_block(ctx, p);
+    memcpy(ctx->block, p, len);
+    ctx->used = len;
+}
+
+/* sha256_hex - finish the hash and write it to 'hex' as 64 hex digits
+ * and a NUL */
+static void sha256_hex(sha256_context *ctx, char *hex) {
+    static const char digits[] = "0123456789abcdef";
+    uint64_t bits = ctx->length * 8;
+    unsigned char tail[8];
+    int i;
+
+    for (i = 0; i < 8; i++)
+        tail[i] = (unsigned char)(bits >> (56 - 8 * i));
+    sha256_update(ctx, "\x80", 1);
+    while (ctx->used != 56)
+        sha256_update(ctx, "", 1);
+    sha256_update(ctx, tail, 8);
+
+    for (i = 0; i < 32; i++) {
+        hex[2 * i] = digits[(ctx->state[i / 4] >> (24 - 8 * (i % 4)) >> 4) & 0xf];
+        hex[2 * i + 1] = digits[(ctx->state[i / 4] >> (24 - 8 * (i % 4))) & 0xf];
+    }
+    hex[64] = '\0';
+}
+
+/**********************************************************************
+
+  Cache entries
+
+ ***********************************************************************/
+
+/* cache_path - path of the file 'name' followed by 'suffix' in the cache
+ * directory */
+static char *cache_path(output_cache *cache, char *name, char *suffix) {
+    GString *path = g_string_new(cache->dir);
+    g_string_append_c(path, '/');
+    g_string_append(path, name);
+    g_string_append(path, suffix);
+    return g_string_free(path, false);
+}
+
+/* is_entry_name - true if 'name' is the file name of a cache entry */
+static bool is_entry_name(char *name) {
+    int i;
+
+    for (i = 0; i < OUTPUT_CACHE_KEY_SIZE - 1; i++)
+        if (!isxdigit((unsigned char)name[i]))
+            return false;
+    return strcmp(name + i, ENTRY_SUFFIX) == 0;
+}
+
+/* output_cache_open - use the directory 'dir' as a cache, creating it if
+ * need be.  'max_size' is the number of bytes the entries may take up
+ * when the cache is closed (0 for no limit), and 'salt' is hashed into
+ * every key, so that a different version of the program does not reuse
+ * the output of another.  Returns NULL, after reporting the error, if
+ * the directory cannot be used. */
+output_cache * output_cache_open(char *dir, long long max_size, char *salt) {
+    output_cache *cache;
+    struct stat info;
+
+    if (mkdir(dir, 0777) != 0 && errno != EEXIST) {
+        perror(dir);
+        return NULL;
+    }
+    if (stat(dir, &info) != 0 || !S_ISDIR(info.st_mode)) {
+        fprintf(stderr, "%s: Not a directory\n", dir);
+        return NULL;
+    }
+
+    cache = calloc(1, sizeof(output_cache));
+    cache->dir = strdup(dir);
+    cache->max_size = max_size;
+    cache->salt = strdup(salt);
+#ifndef _WIN32
+    pthread_mutex_init(&cache->lock, NULL);
+#endif
+    return cache;
+}
+
+/* output_cache_keys - write to each of 'keys' (OUTPUT_CACHE_KEY_SIZE
+ * bytes apiece) the key of the conversion of the 'len' bytes of 'text'
+ * with 'extensions' to the corresponding one of the 'count' formats in
+ * 'formats'.  The text is hashed only once. */
+void output_cache_keys(output_cache *cache, char **keys, char *text, size_t len, int extensions, int *formats, int count) {
+    sha256_context ctx;
+    char digest[OUTPUT_CACHE_KEY_SIZE];
+    GString *options;
+    int i;
+
+    sha256_init(&ctx);
+    sha256_update(&ctx, text, len);
+    sha256_hex(&ctx, digest);
+
+    for (i = 0; i < count; i++) {
+        options = g_string_new("");
+        g_string_append_printf(options, "%s\n%d\n%d\n%s\n", cache->salt, extensions, formats[i], digest);
+        sha256_init(&ctx);
+        sha256_update(&ctx, options->str, options->currentStringLength);
+        sha256_hex(&ctx, keys[i]);
+        g_string_free(options, true);
+    }
+}
+
+/* output_cache_get - the output cached under 'key', or NULL if there is
+ * none.  A hit marks the entry as recently used.  The output is
+ * NUL-terminated and must be freed after use. */
+char * output_cache_get(output_cache *cache, char *key) {
+    char *path = cache_path(cache, key, ENTRY_SUFFIX);
+    char *out = NULL;
+    struct stat info;
+    size_t len = 0;
+    size_t count;
+    FILE *entry;
+
+    if (stat(path, &info) == 0 && (entry = fopen(path, "rb")) != NULL) {
+        len = info.st_size;
+        out = malloc(len + 1);
+        count = fread(out, 1, len, entry);
+        if (count != len || ferror(entry)) {
+            free(out);
+            out = NULL;
+        } else {
+            out[len] = '\0';
+        }
+        fclose(entry);
+        if (out != NULL)
+            utime(path, NULL);
+    }
+    free(path);
+
+#ifndef _WIN32
+    pthread_mutex_lock(&cache->lock);
+#endif
+    if (out != NULL)
+        cache->hits++;
+    else
+        cache->misses++;
+#ifndef _WIN32
+    pthread_mutex_unlock(&cache->lock);
+#endif
+    return out;
+}
+
+/* output_cache_put - store the 'len' bytes of 'out' under 'key'.  A cache
+ * that cannot be written to is not an error; the output simply is not
+ * cached. */
+void output_cache_put(output_cache *cache, char *key, char *out, size_t len) {
+    char *path = cache_path(cache, key, ENTRY_SUFFIX);
+    GString *temp = g_string_new(path);
+    FILE *entry;
+    bool ok;
+
+#ifndef _WIN32
+    pthread_mutex_lock(&cache->lock);
+#endif
+    g_string_append_printf(temp, ".%ld.%d", (long)getpid(), cache->temp_count++);
+#ifndef _WIN32
+    pthread_mutex_unlock(&cache->lock);
+#endif
+
+    if ((entry = fopen(temp->str, "wb")) != NULL) {
+        ok = fwrite(out, 1, len, entry) == len;
+        ok = (fclose(entry) == 0) && ok;
+        if (ok && rename(temp->str, path) == 0) {
+#ifndef _WIN32
+            pthread_mutex_lock(&cache->lock);
+#endif
+            cache->stores++;
+#ifndef _WIN32
+            pthread_mutex_unlock(&cache->lock);
+#endif
+        } else {
+            remove(temp->str);
+        }
+    }
+    g_string_free(temp, true);
+    free(path);
+}
+
+/* cache_file - an entry found while trimming the cache */
+typedef struct {
+    char *name;
+    long long size;
+    time_t used;
+} cache_file;
+
+static int compare_cache_file(const void *a, const void *b) {
+    const cache_file *x = a;
+    const cache_file *y = b;
+    if (x->used != y->used)
+        return (x->used < y->used) ? -1 : 1;
+    return strcmp(x->name, y->name);
+}
+
+/* trim_cache - remove the least recently used entries until the rest fit
+ * in the size limit.  Returns the number of entries removed, and the
+ * size of the ones kept through 'kept'. */
+static int trim_cache(output_cache *cache, long long *kept) {
+    cache_file *files = NULL;
+    int count = 0;
+    int size = 0;
+    int removed = 0;
+    long long total = 0;
+    struct dirent *dent;
+    struct stat info;
+    char *path;
+    DIR *dir;
+    int i;
+
+    *kept = 0;
+    if ((dir = opendir(cache->dir)) == NULL)
+        return 0;
+    while ((dent = readdir(dir)) != NULL) {
+        if (!is_entry_name(dent->d_name))
+            continue;
+        path = cache_path(cache, dent->d_name, "");
+        if (stat(path, &info) == 0) {
+            if (count == size) {
+                size = size ? 2 * size : 256;
+                files = realloc(files, size * sizeof(cache_file));
+            }
+            files[count].name = path;
+            files[count].size = info.st_size;
+            files[count].used = info.st_mtime;
+            total += info.st_size;
+            count++;
+        } else {
+            free(path);
+        }
+    }
+    closedir(dir);
+
+    qsort(files, count, sizeof(cache_file), compare_cache_file);
+    for (i = 0; i < count; i++) {
+        if (cache->max_size > 0 && total > cache->max_size && remove(files[i].name) == 0) {
+            total -= files[i].size;
+            removed++;
+        }
+        free(files[i].name);
+    }
+    free(files);
+    *kept = total;
+    return removed;
+}
+
+/* output_cache_close - trim the cache to its size limit, print its
+ * statistics to stderr if asked to, and free it */
+void output_cache_close(output_cache *cache, bool print_stats) {
+    long long kept;
+    int removed;
+
+    if (cache == NULL)
+        return;
+    removed = trim_cache(cache, &kept);
+    if (print_stats)
+        fprintf(stderr, "cache %s: %d hits, %d misses, %d stored, %d evicted, %lld bytes kept\n",
+            cache->dir, cache->hits, cache->misses, cache->stores, removed, kept);
+#ifndef _WIN32
+    pthread_mutex_destroy(&cache->lock);
+#endif
+    free(cache->dir);
+    free(cache->salt);
+    free(cache);
+}
@@ -0,0 +1,26 @@
+/*
+ *  output_cache.h
+ *  MultiMarkdown
+ *
+ *  On-disk cache of converted documents, so that unchanged inputs are
+ *  neither parsed nor printed again.
+ */
+
+#ifndef __MARKDOWN_OUTPUT_CACHE__
+#define __MARKDOWN_OUTPUT_CACHE__
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#define OUTPUT_CACHE_KEY_SIZE 65    /* 64 hex digits of SHA-256, and a NUL */
+
+/* Opaque cache handle.  One cache may be used from several threads. */
+typedef struct output_cache output_cache;
+
+output_cache * output_cache_open(char *dir, long long max_size, char *salt);
+void output_cache_keys(output_cache *cache, char **keys, char *text, size_t len, int extensions, int *formats, int count);
+char * output_cache_get(output_cache *cache, char *key);
+void output_cache_put(output_cache *cache, char *key, char *out, size_t len);
+void output_cache_close(output_cache *cache, bool print_stats);
+
+#endif
@@ -1,182 +1,326 @@
 /* parsing_functions.c - Functions for parsing markdown and
- * freeing element lists. */
+ * releasing the element lists built by a parser. */
+
+/* mmd_parser_new - allocate a parser with its own leg context.
+ * Free with mmd_parser_free(). */
+mmd_parser_t * mmd_parser_new(void) {
+    mmd_parser_t *parser = calloc(1, sizeof(mmd_parser_t));
+    parser->charbuf = "";
+    parser->section_end = INT_MAX;
+    parser->jobs = 1;
+    parser->yy = calloc(1, sizeof(yycontext));
+    parser->yy->parser = parser;
+    return parser;
+}
 
-int yyparse(void);
+/* mmd_parser_set_jobs - let the parser split a document into sections
+ * and parse up to 'jobs' of them at a time. */
+void mmd_parser_set_jobs(mmd_parser_t *parser, int jobs) {
+    parser->jobs = (jobs > 1) ? jobs : 1;
+}
 
-static void free_element_contents(element elt);
+/* mmd_parser_jobs - number of threads the parser may use */
+int mmd_parser_jobs(mmd_parser_t *parser) {
+    return parser->jobs;
+}
 
-/* free_element_list - free list of elements recursively */
-void free_element_list(element * elt) {
-    element * next = NULL;
-    while (elt != NULL) {
-        next = elt->next;
-        free_element_contents(*elt);
-        if (elt->children != NULL) {
-            free_element_list(elt->children);
-            elt->children = NULL;
-        }
-        free(elt);
-        elt = next;
-    }
+/* reset_lookup_tables - forget the lookup tables of a previous document */
+static void reset_lookup_tables(mmd_parser_t *parser) {
+    lookup_table_free(&parser->reference_table);
+    lookup_table_free(&parser->note_table);
+    lookup_table_free(&parser->label_table);
 }
 
-/* free_element_contents - free element contents depending on type */
-static void free_element_contents(element elt) {
-    switch (elt.key) {
-      case STR:
-      case SPACE:
-      case RAW:
-      case HTMLBLOCK:
-      case HTML:
-      case VERBATIM:
-      case CODE:
-      case NOTE:
-      case AUTOLABEL:
-      case CITATION:
-      case TERM:
-      case METAKEY:
-      case METAVALUE:
-      case TABLESEPARATOR:
-      case ATTRKEY:
-      case GLOSSARY:
-      case GLOSSARYTERM:
-      case NOTELABEL:
-        free(elt.contents.str);
-        elt.contents.str = NULL;
-        break;
-      case LINK:
-      case IMAGE:
-      case REFERENCE:
-        free(elt.contents.link->url);
-        elt.contents.link->url = NULL;
-        free(elt.contents.link->title);
-        elt.contents.link->title = NULL;
-        free_element_list(elt.contents.link->label);
-        free(elt.contents.link->identifier);
-        elt.contents.link->identifier = NULL;
-/*        free_element_list(elt.contents.link->attr);*/
-        free(elt.contents.link);
-        elt.contents.link = NULL;
-        break;
-      default:
-        ;
+/* arena_release - free every block of the arena, leaving it empty */
+static void arena_release(arena *a) {
+    arena_block *next;
+    while (a->blocks != NULL) {
+        next = a->blocks->next;
+        free(a->blocks);
+        a->blocks = next;
     }
 }
 
-/* free_element - free element and contents */
-void free_element(element *elt) {
-    free_element_contents(*elt);
-    free(elt);
+/* mmd_parser_release_elements - free every element list the parser has
+ * returned so far.  Elements are allocated from the parser's arena, so
+ * they are never freed one by one; this is the only way to free them. */
+void mmd_parser_release_elements(mmd_parser_t *parser) {
+    reset_lookup_tables(parser);
+    parser->references = NULL;
+    parser->notes = NULL;
+    parser->labels = NULL;
+    parser->parse_result = NULL;
+    arena_release(&parser->elements);
 }
 
-element * parse_references(char *string, int extensions) {
+/* mmd_parser_free - free a parser, the buffers of its leg context and
+ * all elements it has returned. */
+void mmd_parser_free(mmd_parser_t *parser) {
+    if (parser == NULL)
+        return;
+    mmd_parser_release_elements(parser);
+    yyrelease(parser->yy);
+    free(parser->yy);
+    free(parser);
+}
 
+/* run_parser - parse 'string' starting at rule 'start', restoring the
+ * parser's previous buffer afterwards so that parses may nest. */
+static void run_parser(mmd_parser_t *parser, char *string, yyrule start) {
     char *oldcharbuf;
-    syntax_extensions = extensions;
-
-    oldcharbuf = charbuf;
-    charbuf = string;
-    yyparsefrom(yy_References);    /* first pass, just to collect references */
-    charbuf = oldcharbuf;
 
-    return references;
+    oldcharbuf = parser->charbuf;
+    parser->charbuf = string;
+    yyparsefrom(parser->yy, start);
+    parser->charbuf = oldcharbuf;   /* restore charbuf to original value */
 }
 
-element * parse_notes(char *string, int extensions, element *reference_list) {
-
-    char *oldcharbuf;
-    notes = NULL;
-    syntax_extensions = extensions;
-
-    if (extension(EXT_NOTES)) {
-        references = reference_list;
-        oldcharbuf = charbuf;
-        charbuf = string;
-        yyparsefrom(yy_Notes);     /* second pass for notes */
-        charbuf = oldcharbuf;
+/* parse_collect - collect references, notes and labels in one pass over
+ * 'string'.  The lists are returned through 'reference_list', 'note_list'
+ * and 'label_list'. */
+void parse_collect(mmd_parser_t *parser, char *string, int extensions,
+    element **reference_list, element **note_list, element **label_list) {
+
+    element *sources;
+    element *next;
+
+    parser->syntax_extensions = extensions;
+    parser->references = NULL;
+    parser->notes = NULL;
+    parser->labels = NULL;
+    reset_lookup_tables(parser);
+
+    run_parser(parser, string, yy_Collect);
+
+    /* Turn the remaining label sources into labels, now that all references
+     * and notes are known.  As before, no labels are visible while doing so. */
+    sources = parser->labels;
+    parser->labels = NULL;
+    *label_list = NULL;
+    while (sources != NULL) {
+        next = sources->next;
+        if (sources->key == RAW) {
+            parser->parse_result = NULL;
+            run_parser(parser, sources->contents.str, yy_LabelFromSource);
+            if (parser->parse_result != NULL)
+                *label_list = cons(parser->parse_result, *label_list);
+        } else {
+            *label_list = cons(sources, *label_list);
+        }
+        sources = next;
     }
 
-    return notes;
+    *reference_list = parser->references;
+    *note_list = parser->notes;
 }
 
-element * parse_labels(char *string, int extensions, element *reference_list, element *note_list) {
+element * parse_markdown(mmd_parser_t *parser, char *string, int extensions, element *reference_list, element *note_list, element *label_list) {
 
-    char *oldcharbuf;
-    syntax_extensions = extensions;
-    references = reference_list;
-    notes = note_list;
-    labels = NULL;
+    parser->syntax_extensions = extensions;
+    parser->references = reference_list;
+    parser->notes = note_list;
+    parser->labels = label_list;
 
-    oldcharbuf = charbuf;
-    charbuf = string;
-    yyparsefrom(yy_AutoLabels);    /* third pass, to collect labels */
-    charbuf = oldcharbuf;
+    run_parser(parser, string, yy_Doc);
 
-    return labels;
+    return parser->parse_result;
 }
 
-element * parse_markdown(char *string, int extensions, element *reference_list, element *note_list, element *label_list) {
-
-    char *oldcharbuf;
-    syntax_extensions = extensions;
-    references = reference_list;
-    notes = note_list;
-    labels = label_list;
-
-    oldcharbuf = charbuf;
-    charbuf = string;
+element * parse_markdown_with_metadata(mmd_parser_t *parser, char *string, int extensions, element *reference_list, element *note_list, element *label_list) {
 
-    yyparsefrom(yy_Doc);
+    parser->syntax_extensions = extensions;
+    parser->references = reference_list;
+    parser->notes = note_list;
+    parser->labels = label_list;
 
-    charbuf = oldcharbuf;          /* restore charbuf to original value */
-    return parse_result;
+    run_parser(parser, string, yy_DocWithMetaData);
 
+    return parser->parse_result;
 }
 
-element * parse_markdown_with_metadata(char *string, int extensions, element *reference_list, element *note_list, element *label_list) {
-
-    char *oldcharbuf;
-    syntax_extensions = extensions;
-    references = reference_list;
-    notes = note_list;
-    labels = label_list;
+/* parse_markdown_section - parse top-level blocks from the start of
+ * 'string' until one ends at or after offset 'limit', or no more blocks
+ * can be parsed.  Blocks may look ahead past 'limit', so the result is
+ * the same as the blocks a whole-document parse finds in that stretch,
+ * provided a block of it starts at 'string'.  The first section of a
+ * document ('first') may begin with metadata.  The offset at which the
+ * parse stopped is returned through 'end'. */
+element * parse_markdown_section(mmd_parser_t *parser, char *string, int extensions, element *reference_list, element *note_list, element *label_list, bool first, int limit, int *end) {
+
+    parser->syntax_extensions = extensions;
+    parser->references = reference_list;
+    parser->notes = note_list;
+    parser->labels = label_list;
+    parser->parse_result = NULL;
+    parser->section_end = limit;
+
+    run_parser(parser, string, first ? yy_DocWithMetaData : yy_DocSection);
+
+    *end = parser->yy->__pos;
+    parser->section_end = INT_MAX;
+    return parser->parse_result;
+}
 
-    oldcharbuf = charbuf;
-    charbuf = string;
+element * parse_metadata_only(mmd_parser_t *parser, char *string, int extensions) {
 
-    yyparsefrom(yy_DocWithMetaData);
+    parser->syntax_extensions = extensions;
 
-    charbuf = oldcharbuf;          /* restore charbuf to original value */
-    return parse_result;
+    run_parser(parser, string, yy_MetaDataOnly);
 
+    return parser->parse_result;
 }
 
-element * parse_metadata_only(char *string, int extensions) {
+element * parse_markdown_for_opml(mmd_parser_t *parser, char *string, int extensions) {
 
-    char *oldcharbuf;
-    syntax_extensions = extensions;
+    parser->syntax_extensions = extensions;
 
-    oldcharbuf = charbuf;
-    charbuf = string;
+    run_parser(parser, string, yy_DocForOPML);
 
-    yyparsefrom(yy_MetaDataOnly);
+    return parser->parse_result;
+}
 
-    charbuf = oldcharbuf;          /* restore charbuf to original value */
-    return parse_result;
+/* anchor_set - open-addressed set of the anchor ids of a document */
+typedef struct {
+    char **ids;
+    unsigned int size;          /* A power of two. */
+} anchor_set;
+
+/* anchor_slot - the slot of 'id' in the set, or the empty slot where it
+ * would go */
+static unsigned int anchor_slot(anchor_set *set, char *id) {
+    unsigned int slot = hash_string(id) & (set->size - 1);
+    while (set->ids[slot] != NULL && strcmp(set->ids[slot], id) != 0)
+        slot = (slot + 1) & (set->size - 1);
+    return slot;
+}
 
+/* anchor_set_add - add 'id' to the set, unless it is there already.
+ * Returns true if it was added. */
+static bool anchor_set_add(anchor_set *set, char *id) {
+    unsigned int slot = anchor_slot(set, id);
+    if (set->ids[slot] != NULL)
+        return false;
+    set->ids[slot] = id;
+    return true;
 }
 
-element * parse_markdown_for_opml(char *string, int extensions) {
+/* collect_anchors - append to 'anchors' the headings and table captions of
+ * 'list', and of the blocks nested in it, in document order.  Notes are
+ * not searched; their elements may be shared with citations of them.
+ * Empty ids, of headings without letters, are left as they are. */
+static void collect_anchors(element *list, element ***anchors, int *count, int *size) {
+    for (; list != NULL; list = list->next) {
+        switch (list->key) {
+        case H1: case H2: case H3: case H4: case H5: case H6:
+        case TABLECAPTION:
+            if (list->contents.str == NULL || list->contents.str[0] == '\0')
+                break;
+            if (*count == *size) {
+                *size = (*size == 0) ? 64 : 2 * *size;
+                *anchors = realloc(*anchors, *size * sizeof(element *));
+            }
+            (*anchors)[(*count)++] = list;
+            break;
+        case LIST: case LISTITEM: case BULLETLIST: case ORDEREDLIST:
+        case BLOCKQUOTE: case HEADINGSECTION: case TABLE:
+        case DEFLIST: case DEFINITION:
+            collect_anchors(list->children, anchors, count, size);
+            break;
+        default:
+            break;
+        }
+    }
+}
 
-    char *oldcharbuf;
-    syntax_extensions = extensions;
+/* has_explicit_id - true if the id of a heading or table caption was
+ * given in the document rather than made from its text */
+static bool has_explicit_id(element *elt) {
+    return elt->children != NULL
+        && (elt->children->key == AUTOLABEL || elt->children->key == TABLELABEL);
+}
 
-    oldcharbuf = charbuf;
-    charbuf = string;
+/* assign_anchor_ids - make the anchor ids of the headings and table
+ * captions of a document unique.  Ids given in the document are kept as
+ * they are; a generated id that is already taken gets the first free
+ * suffix of "-1", "-2", ... */
+void assign_anchor_ids(mmd_parser_t *parser, element *tree) {
+    element **anchors = NULL;
+    anchor_set set;
+    char *id;
+    int count = 0;
+    int size = 0;
+    int i, n;
+
+    collect_anchors(tree, &anchors, &count, &size);
+    if (count == 0)
+        return;
+    set.size = 8;
+    while (set.size < 2 * (unsigned int) count)
+        set.size *= 2;
+    set.ids = calloc(set.size, sizeof(char *));
+
+    for (i = 0; i < count; i++)
+        if (has_explicit_id(anchors[i]))
+            anchor_set_add(&set, anchors[i]->contents.str);
+    for (i = 0; i < count; i++) {
+        if (has_explicit_id(anchors[i]) || anchor_set_add(&set, anchors[i]->contents.str))
+            continue;
+        id = malloc(strlen(anchors[i]->contents.str) + 16);
+        n = 0;
+        do
+            sprintf(id, "%s-%d", anchors[i]->contents.str, ++n);
+        while (set.ids[anchor_slot(&set, id)] != NULL);
+        anchors[i]->contents.str = parser_strdup(parser, id);
+        anchor_set_add(&set, anchors[i]->contents.str);
+        free(id);
+    }
+    free(set.ids);
+    free(anchors);
+}
+
+/* collect_keys - add to 'keys' the key of every element of 'list' and of
+ * everything under it, including the contents of the notes it cites */
+static void collect_keys(element *list, key_set *keys) {
+    for (; list != NULL; list = list->next) {
+        key_set_add(keys, list->key);
+        if (list->children != NULL)
+            collect_keys(list->children, keys);
+    }
+}
 
-    yyparsefrom(yy_DocForOPML);
+/* document_index_build - index the document 'tree': the keys that occur
+ * in it, and its metadata by key.  Metadata keys are normalized by the
+ * parser, so they are looked up as label_from_string() would make them.
+ * Where a key is given twice the first wins, as in a linear search.
+ * Free with document_index_free(). */
+void document_index_build(document_index *index, element *tree) {
+    element *step;
+
+    memset(index, 0, sizeof(document_index));
+    collect_keys(tree, &index->keys);
+    for (step = tree; step != NULL; step = step->next) {
+        if (step->key == METADATA) {
+            index->metadata = step;
+            lookup_table_build(&index->metadata_table, step->children, string_key);
+            break;
+        }
+    }
+}
 
-    charbuf = oldcharbuf;          /* restore charbuf to original value */
-    return parse_result;
+/* document_index_metadata - the METAKEY for 'key' in the metadata of an
+ * indexed document, or NULL.  'key' is normalized first, so "LaTeX Mode"
+ * finds latexmode. */
+element * document_index_metadata(const document_index *index, char *key) {
+    element *entry;
+    char *label;
+
+    label = label_from_string(key, 0);
+    entry = lookup_table_find(&index->metadata_table, label);
+    free(label);
+    return entry;
+}
 
+/* document_index_free - free what document_index_build() allocated */
+void document_index_free(document_index *index) {
+    lookup_table_free(&index->metadata_table);
 }
@@ -93,8 +93,8 @@ static void begin(void)		{ fprintf(output, "\n  {"); }
 static void end(void)		{ fprintf(output, "\n  }"); }
 static void label(int n)	{ fprintf(output, "\n  l%d:;\t", n); }
 static void jump(int n)		{ fprintf(output, "  goto l%d;", n); }
-static void save(int n)		{ fprintf(output, "  int yypos%d= yypos, yythunkpos%d= yythunkpos;", n, n); }
-static void restore(int n)	{ fprintf(output,     "  yypos= yypos%d; yythunkpos= yythunkpos%d;", n, n); }
+static void save(int n)		{ fprintf(output, "  int yypos%d= yy->__pos, yythunkpos%d= yy->__thunkpos;", n, n); }
+static void restore(int n)	{ fprintf(output,     "  yy->__pos= yypos%d; yy->__thunkpos= yythunkpos%d;", n, n); }
 
 static void Node_compile_c_ko(Node *node, int ko)
 {
@@ -107,13 +107,13 @@ static void Node_compile_c_ko(Node *node, int ko)
       break;
 
     case Dot:
-      fprintf(output, "  if (!yymatchDot()) goto l%d;", ko);
+      fprintf(output, "  if (!yymatchDot(yy)) goto l%d;", ko);
       break;
 
     case Name:
-      fprintf(output, "  if (!yy_%s()) goto l%d;", node->name.rule->rule.name, ko);
+      fprintf(output, "  if (!yy_%s(yy)) goto l%d;", node->name.rule->rule.name, ko);
       if (node->name.variable)
-	fprintf(output, "  yyDo(yySet, %d, 0);", node->name.variable->variable.offset);
+	fprintf(output, "  yyDo(yy, yySet, %d, 0);", node->name.variable->variable.offset);
       break;
 
     case Character:
@@ -121,22 +121,25 @@ static void Node_compile_c_ko(Node *node, int ko)
       {
 	int len= strlen(node->string.value);
 	if (1 == len || (2 == len && '\\' == node->string.value[0]))
-	  fprintf(output, "  if (!yymatchChar('%s')) goto l%d;", node->string.value, ko);
+	  fprintf(output, "  if (!yymatchChar(yy, '%s')) goto l%d;", node->string.value, ko);
 	else
-	  fprintf(output, "  if (!yymatchString(\"%s\")) goto l%d;", node->string.value, ko);
+	  fprintf(output, "  if (!yymatchString(yy, \"%s\")) goto l%d;", node->string.value, ko);
       }
       break;
 
     case Class:
-      fprintf(output, "  if (!yymatchClass((unsigned char *)\"%s\")) goto l%d;", makeCharClass(node->cclass.value), ko);
+      fprintf(output, "  if (!yymatchClass(yy, (unsigned char *)\"%s\")) goto l%d;", makeCharClass(node->cclass.value), ko);
       break;
 
     case Action:
-      fprintf(output, "  yyDo(yy%s, yybegin, yyend);", node->action.name);
+      fprintf(output, "  yyDo(yy, yy%s, yy->__begin, yy->__end);", node->action.name);
       break;
 
     case Predicate:
-      fprintf(output, "  yyText(yybegin, yyend);  if (!(%s)) goto l%d;", node->action.text, ko);
+      if (strstr(node->action.text, "yytext"))
+	fprintf(output, "  yyText(yy, yy->__begin, yy->__end);  {\n#define yytext yy->__text\n  if (!(%s)) goto l%d;\n#undef yytext\n  }", node->action.text, ko);
+      else
+	fprintf(output, "  if (!(%s)) goto l%d;", node->action.text, ko);
       break;
 
     case Alternate:
@@ -255,7 +258,7 @@ static void defineVariables(Node *node)
   int count= 0;
   while (node)
     {
-      fprintf(output, "#define %s yyval[%d]\n", node->variable.name, --count);
+      fprintf(output, "#define %s yy->__val[%d]\n", node->variable.name, --count);
       node->variable.offset= count;
       node= node->variable.next;
     }
@@ -287,24 +290,38 @@ static void Rule_compile_c2(Node *node)
 
       safe= ((Query == node->rule.expression->type) || (Star == node->rule.expression->type));
 
-      fprintf(output, "\nYY_RULE(int) yy_%s()\n{", node->rule.name);
+      if (RuleMemo & node->rule.flags)
+	fprintf(output, "\nYY_RULE(int) yyMemo_%s(yycontext *yy)\n{", node->rule.name);
+      else
+	fprintf(output, "\nYY_RULE(int) yy_%s(yycontext *yy)\n{", node->rule.name);
       if (!safe) save(0);
       if (node->rule.variables)
-	fprintf(output, "  yyDo(yyPush, %d, 0);", countVariables(node->rule.variables));
+	fprintf(output, "  yyDo(yy, yyPush, %d, 0);", countVariables(node->rule.variables));
       fprintf(output, "\n  yyprintf((stderr, \"%%s\\n\", \"%s\"));", node->rule.name);
       Node_compile_c_ko(node->rule.expression, ko);
-      fprintf(output, "\n  yyprintf((stderr, \"  ok   %%s @ %%s\\n\", \"%s\", yybuf+yypos));", node->rule.name);
+      fprintf(output, "\n  yyprintf((stderr, \"  ok   %%s @ %%s\\n\", \"%s\", yy->__buf+yy->__pos));", node->rule.name);
       if (node->rule.variables)
-	fprintf(output, "  yyDo(yyPop, %d, 0);", countVariables(node->rule.variables));
+	fprintf(output, "  yyDo(yy, yyPop, %d, 0);", countVariables(node->rule.variables));
       fprintf(output, "\n  return 1;");
       if (!safe)
 	{
 	  label(ko);
 	  restore(0);
-	  fprintf(output, "\n  yyprintf((stderr, \"  fail %%s @ %%s\\n\", \"%s\", yybuf+yypos));", node->rule.name);
+	  fprintf(output, "\n  yyprintf((stderr, \"  fail %%s @ %%s\\n\", \"%s\", yy->__buf+yy->__pos));", node->rule.name);
 	  fprintf(output, "\n  return 0;");
 	}
       fprintf(output, "\n}");
+      if (RuleMemo & node->rule.flags)
+	{
+	  fprintf(output, "\nYY_RULE(int) yy_%s(yycontext *yy)\n{", node->rule.name);
+	  fprintf(output, "  yymemoframe yyframe;  int yyok= yyMemoLookup(yy, %d);", node->rule.id);
+	  fprintf(output, "\n  if (yyok < 0)\n    {");
+	  fprintf(output, "\n      yyMemoEnter(yy, &yyframe);");
+	  fprintf(output, "\n      yyok= yyMemoLeave(yy, &yyframe, %d, yyMemo_%s(yy));", node->rule.id, node->rule.name);
+	  fprintf(output, "\n    }");
+	  fprintf(output, "\n  return yyok;");
+	  fprintf(output, "\n}");
+	}
     }
 
   if (node->rule.next)
@@ -318,9 +335,6 @@ static char *header= "\
 ";
 
 static char *preamble= "\
-#ifndef YY_VARIABLE\n\
-#define YY_VARIABLE(T)	static T\n\
-#endif\n\
 #ifndef YY_LOCAL\n\
 #define YY_LOCAL(T)	static T\n\
 #endif\n\
@@ -339,6 +353,9 @@ static char *preamble= "\
 #ifndef YYPARSEFROM\n\
 #define YYPARSEFROM	yyparsefrom\n\
 #endif\n\
+#ifndef YYRELEASE\n\
+#define YYRELEASE	yyrelease\n\
+#endif\n\
 #ifndef YY_INPUT\n\
 #define YY_INPUT(buf, result, max_size)			\\\n\
   {							\\\n\
@@ -348,10 +365,10 @@ static char *preamble= "\
   }\n\
 #endif\n\
 #ifndef YY_BEGIN\n\
-#define YY_BEGIN	( yybegin= yypos, 1)\n\
+#define YY_BEGIN	( yy->__begin= yy->__pos, 1)\n\
 #endif\n\
 #ifndef YY_END\n\
-#define YY_END		( yyend= yypos, 1)\n\
+#define YY_END		( yy->__end= yy->__pos, 1)\n\
 #endif\n\
 #ifdef YY_DEBUG\n\
 # define yyprintf(args)	fprintf args\n\
@@ -361,151 +378,313 @@ static char *preamble= "\
 #ifndef YYSTYPE\n\
 #define YYSTYPE	int\n\
 #endif\n\
+#ifdef YY_MEMO\n\
+#define YY_OUTER	(-0x7fffffff)\n\
+#endif\n\
 \n\
-#ifndef YY_PART\n\
-\n\
-typedef void (*yyaction)(char *yytext, int yyleng);\n\
+typedef struct _yycontext yycontext;\n\
+typedef void (*yyaction)(yycontext *yy, char *yytext, int yyleng);\n\
 typedef struct _yythunk { int begin, end;  yyaction  action;  struct _yythunk *next; } yythunk;\n\
 \n\
-YY_VARIABLE(char *   ) yybuf= 0;\n\
-YY_VARIABLE(int	     ) yybuflen= 0;\n\
-YY_VARIABLE(int	     ) yypos= 0;\n\
-YY_VARIABLE(int	     ) yylimit= 0;\n\
-YY_VARIABLE(char *   ) yytext= 0;\n\
-YY_VARIABLE(int	     ) yytextlen= 0;\n\
-YY_VARIABLE(int	     ) yybegin= 0;\n\
-YY_VARIABLE(int	     ) yyend= 0;\n\
-YY_VARIABLE(int	     ) yytextmax= 0;\n\
-YY_VARIABLE(yythunk *) yythunks= 0;\n\
-YY_VARIABLE(int	     ) yythunkslen= 0;\n\
-YY_VARIABLE(int      ) yythunkpos= 0;\n\
-YY_VARIABLE(YYSTYPE  ) yy;\n\
-YY_VARIABLE(YYSTYPE *) yyval= 0;\n\
-YY_VARIABLE(YYSTYPE *) yyvals= 0;\n\
-YY_VARIABLE(int      ) yyvalslen= 0;\n\
-\n\
-YY_LOCAL(int) yyrefill(void)\n\
+#ifdef YY_MEMO\n\
+typedef struct _yymemo {\n\
+  int rule, pos, generation, ok, endpos, begin, end, thunks, thunkcount;\n\
+} yymemo;\n\
+\n\
+typedef struct _yymemoframe {\n\
+  int pos, thunkpos, begin, end, outerbegin, outerend, outer;\n\
+} yymemoframe;\n\
+#endif\n\
+\n\
+struct _yycontext {\n\
+  char     *__buf;\n\
+  int       __buflen;\n\
+  int       __pos;\n\
+  int       __limit;\n\
+  char     *__text;\n\
+  int       __textlen;\n\
+  int       __textpos;\n\
+  int       __begin;\n\
+  int       __end;\n\
+  int       __textmax;\n\
+  yythunk  *__thunks;\n\
+  int       __thunkslen;\n\
+  int       __thunkpos;\n\
+  YYSTYPE   __;\n\
+  YYSTYPE  *__val;\n\
+  YYSTYPE  *__vals;\n\
+  int       __valslen;\n\
+#ifdef YY_MEMO\n\
+  int       __outerbegin;\n\
+  int       __outerend;\n\
+  int       __outer;\n\
+  yymemo   *__memos;\n\
+  int       __memoslen;\n\
+  int       __memocount;\n\
+  int       __memogeneration;\n\
+  yythunk  *__memothunks;\n\
+  int       __memothunkslen;\n\
+  int       __memothunkpos;\n\
+#endif\n\
+#ifdef YY_CTX_MEMBERS\n\
+  YY_CTX_MEMBERS\n\
+#endif\n\
+};\n\
+\n\
+#ifndef YY_PART\n\
+\n\
+YY_LOCAL(int) yyrefill(yycontext *yy)\n\
 {\n\
+#ifdef YY_BUFFER\n\
+  return 0;\n\
+#else\n\
   int yyn;\n\
-  while (yybuflen - yypos < 512)\n\
+  while (yy->__buflen - yy->__pos < 512)\n\
     {\n\
-      yybuflen *= 2;\n\
-      yybuf= realloc(yybuf, yybuflen);\n\
+      yy->__buflen *= 2;\n\
+      yy->__buf= realloc(yy->__buf, yy->__buflen);\n\
     }\n\
-  YY_INPUT((yybuf + yypos), yyn, (yybuflen - yypos));\n\
+  YY_INPUT((yy->__buf + yy->__pos), yyn, (yy->__buflen - yy->__pos));\n\
   if (!yyn) return 0;\n\
-  yylimit += yyn;\n\
+  yy->__limit += yyn;\n\
   return 1;\n\
+#endif\n\
 }\n\
 \n\
-YY_LOCAL(int) yymatchDot(void)\n\
+YY_LOCAL(int) yymatchDot(yycontext *yy)\n\
 {\n\
-  if (yypos >= yylimit && !yyrefill()) return 0;\n\
-  ++yypos;\n\
+  if (yy->__pos >= yy->__limit && !yyrefill(yy)) return 0;\n\
+  ++yy->__pos;\n\
   return 1;\n\
 }\n\
 \n\
-YY_LOCAL(int) yymatchChar(int c)\n\
+YY_LOCAL(int) yymatchChar(yycontext *yy, int c)\n\
 {\n\
-  if (yypos >= yylimit && !yyrefill()) return 0;\n\
-  if (yybuf[yypos] == c)\n\
+  if (yy->__pos >= yy->__limit && !yyrefill(yy)) return 0;\n\
+  if (yy->__buf[yy->__pos] == c)\n\
     {\n\
-      ++yypos;\n\
-      yyprintf((stderr, \"  ok   yymatchChar(%c) @ %s\\n\", c, yybuf+yypos));\n\
+      ++yy->__pos;\n\
+      yyprintf((stderr, \"  ok   yymatchChar(%c) @ %s\\n\", c, yy->__buf+yy->__pos));\n\
       return 1;\n\
     }\n\
-  yyprintf((stderr, \"  fail yymatchChar(%c) @ %s\\n\", c, yybuf+yypos));\n\
+  yyprintf((stderr, \"  fail yymatchChar(%c) @ %s\\n\", c, yy->__buf+yy->__pos));\n\
   return 0;\n\
 }\n\
 \n\
-YY_LOCAL(int) yymatchString(char *s)\n\
+YY_LOCAL(int) yymatchString(yycontext *yy, char *s)\n\
 {\n\
-  int yysav= yypos;\n\
+  int yysav= yy->__pos;\n\
   while (*s)\n\
     {\n\
-      if (yypos >= yylimit && !yyrefill()) return 0;\n\
-      if (yybuf[yypos] != *s)\n\
+      if (yy->__pos >= yy->__limit && !yyrefill(yy)) return 0;\n\
+      if (yy->__buf[yy->__pos] != *s)\n\
         {\n\
-          yypos= yysav;\n\
+          yy->__pos= yysav;\n\
           return 0;\n\
         }\n\
       ++s;\n\
-      ++yypos;\n\
+      ++yy->__pos;\n\
     }\n\
   return 1;\n\
 }\n\
 \n\
-YY_LOCAL(int) yymatchClass(unsigned char *bits)\n\
+YY_LOCAL(int) yymatchClass(yycontext *yy, unsigned char *bits)\n\
 {\n\
   int c;\n\
-  if (yypos >= yylimit && !yyrefill()) return 0;\n\
-  c= yybuf[yypos];\n\
+  if (yy->__pos >= yy->__limit && !yyrefill(yy)) return 0;\n\
+  c= yy->__buf[yy->__pos];\n\
   if (bits[c >> 3] & (1 << (c & 7)))\n\
     {\n\
-      ++yypos;\n\
-      yyprintf((stderr, \"  ok   yymatchClass @ %s\\n\", yybuf+yypos));\n\
+      ++yy->__pos;\n\
+      yyprintf((stderr, \"  ok   yymatchClass @ %s\\n\", yy->__buf+yy->__pos));\n\
       return 1;\n\
     }\n\
-  yyprintf((stderr, \"  fail yymatchClass @ %s\\n\", yybuf+yypos));\n\
+  yyprintf((stderr, \"  fail yymatchClass @ %s\\n\", yy->__buf+yy->__pos));\n\
   return 0;\n\
 }\n\
 \n\
-YY_LOCAL(void) yyDo(yyaction action, int begin, int end)\n\
+YY_LOCAL(void) yyDo(yycontext *yy, yyaction action, int begin, int end)\n\
 {\n\
-  while (yythunkpos >= yythunkslen)\n\
+  while (yy->__thunkpos >= yy->__thunkslen)\n\
     {\n\
-      yythunkslen *= 2;\n\
-      yythunks= realloc(yythunks, sizeof(yythunk) * yythunkslen);\n\
+      yy->__thunkslen *= 2;\n\
+      yy->__thunks= realloc(yy->__thunks, sizeof(yythunk) * yy->__thunkslen);\n\
     }\n\
-  yythunks[yythunkpos].begin=  begin;\n\
-  yythunks[yythunkpos].end=    end;\n\
-  yythunks[yythunkpos].action= action;\n\
-  ++yythunkpos;\n\
+  yy->__thunks[yy->__thunkpos].begin=  begin;\n\
+  yy->__thunks[yy->__thunkpos].end=    end;\n\
+  yy->__thunks[yy->__thunkpos].action= action;\n\
+  ++yy->__thunkpos;\n\
 }\n\
 \n\
-YY_LOCAL(int) yyText(int begin, int end)\n\
+YY_LOCAL(int) yyText(yycontext *yy, int begin, int end)\n\
 {\n\
-  int yyleng= end - begin;\n\
+  int yyleng;\n\
+#ifdef YY_MEMO\n\
+  if (YY_OUTER == begin) begin= yy->__outerbegin, yy->__outer= 1;\n\
+  if (YY_OUTER == end)   end=   yy->__outerend,   yy->__outer= 1;\n\
+#endif\n\
+  yy->__textpos= begin;\n\
+  yyleng= end - begin;\n\
   if (yyleng <= 0)\n\
     yyleng= 0;\n\
   else\n\
     {\n\
-      while (yytextlen < (yyleng - 1))\n\
+      while (yy->__textlen < (yyleng - 1))\n\
 	{\n\
-	  yytextlen *= 2;\n\
-	  yytext= realloc(yytext, yytextlen);\n\
+	  yy->__textlen *= 2;\n\
+	  yy->__text= realloc(yy->__text, yy->__textlen);\n\
 	}\n\
-      memcpy(yytext, yybuf + begin, yyleng);\n\
+      memcpy(yy->__text, yy->__buf + begin, yyleng);\n\
     }\n\
-  yytext[yyleng]= '\\0';\n\
+  yy->__text[yyleng]= '\\0';\n\
   return yyleng;\n\
 }\n\
 \n\
-YY_LOCAL(void) yyDone(void)\n\
+YY_LOCAL(void) yyDone(yycontext *yy)\n\
 {\n\
   int pos;\n\
-  for (pos= 0;  pos < yythunkpos;  ++pos)\n\
+  for (pos= 0;  pos < yy->__thunkpos;  ++pos)\n\
     {\n\
-      yythunk *thunk= &yythunks[pos];\n\
-      int yyleng= thunk->end ? yyText(thunk->begin, thunk->end) : thunk->begin;\n\
-      yyprintf((stderr, \"DO [%d] %p %s\\n\", pos, thunk->action, yytext));\n\
-      thunk->action(yytext, yyleng);\n\
+      yythunk *thunk= &yy->__thunks[pos];\n\
+      int yyleng= thunk->end ? yyText(yy, thunk->begin, thunk->end) : thunk->begin;\n\
+      yyprintf((stderr, \"DO [%d] %p %s\\n\", pos, thunk->action, yy->__text));\n\
+      thunk->action(yy, yy->__text, yyleng);\n\
     }\n\
-  yythunkpos= 0;\n\
+  yy->__thunkpos= 0;\n\
+}\n\
+\n\
+#ifdef YY_MEMO\n\
+\n\
+YY_LOCAL(void) yyMemoClear(yycontext *yy)\n\
+{\n\
+  ++yy->__memogeneration;\n\
+  yy->__memocount= yy->__memothunkpos= 0;\n\
 }\n\
 \n\
-YY_LOCAL(void) yyCommit()\n\
+YY_LOCAL(yymemo *) yyMemoSlot(yycontext *yy, yymemo *memos, int len, int rule, int pos)\n\
 {\n\
-  if ((yylimit -= yypos))\n\
+  unsigned int hash= ((unsigned int)pos * 2654435761u) ^ ((unsigned int)rule * 40503u);\n\
+  yymemo *memo;\n\
+  for (;;)\n\
     {\n\
-      memmove(yybuf, yybuf + yypos, yylimit);\n\
+      memo= &memos[hash & (len - 1)];\n\
+      if (memo->generation != yy->__memogeneration || (memo->rule == rule && memo->pos == pos))\n\
+	return memo;\n\
+      ++hash;\n\
     }\n\
-  yybegin -= yypos;\n\
-  yyend -= yypos;\n\
-  yypos= yythunkpos= 0;\n\
 }\n\
 \n\
-YY_LOCAL(int) yyAccept(int tp0)\n\
+YY_LOCAL(int) yyMemoLookup(yycontext *yy, int rule)\n\
+{\n\
+  yymemo *memo;\n\
+  int i;\n\
+  if (!yy->__memoslen) return -1;\n\
+  memo= yyMemoSlot(yy, yy->__memos, yy->__memoslen, rule, yy->__pos);\n\
+  if (memo->generation != yy->__memogeneration) return -1;\n\
+  yyprintf((stderr, \"  memo %d @ %d -> %d\\n\", rule, yy->__pos, memo->ok));\n\
+  while (yy->__thunkpos + memo->thunkcount >= yy->__thunkslen)\n\
+    {\n\
+      yy->__thunkslen *= 2;\n\
+      yy->__thunks= realloc(yy->__thunks, sizeof(yythunk) * yy->__thunkslen);\n\
+    }\n\
+  for (i= 0;  i < memo->thunkcount;  ++i)\n\
+    {\n\
+      yythunk *thunk= &yy->__thunks[yy->__thunkpos++];\n\
+      *thunk= yy->__memothunks[memo->thunks + i];\n\
+      if (YY_OUTER == thunk->begin) thunk->begin= yy->__begin;\n\
+      if (YY_OUTER == thunk->end)   thunk->end=   yy->__end;\n\
+    }\n\
+  if (YY_OUTER != memo->begin) yy->__begin= memo->begin;\n\
+  if (YY_OUTER != memo->end)   yy->__end=   memo->end;\n\
+  if (memo->ok) yy->__pos= memo->endpos;\n\
+  return memo->ok;\n\
+}\n\
+\n\
+YY_LOCAL(void) yyMemoEnter(yycontext *yy, yymemoframe *frame)\n\
+{\n\
+  frame->pos= yy->__pos;\n\
+  frame->thunkpos= yy->__thunkpos;\n\
+  frame->begin= yy->__begin;\n\
+  frame->end= yy->__end;\n\
+  frame->outerbegin= yy->__outerbegin;\n\
+  frame->outerend= yy->__outerend;\n\
+  frame->outer= yy->__outer;\n\
+  if (YY_OUTER != yy->__begin) yy->__outerbegin= yy->__begin;\n\
+  if (YY_OUTER != yy->__end)   yy->__outerend=   yy->__end;\n\
+  yy->__begin= yy->__end= YY_OUTER;\n\
+  yy->__outer= 0;\n\
+}\n\
+\n\
+YY_LOCAL(int) yyMemoLeave(yycontext *yy, yymemoframe *frame, int rule, int ok)\n\
+{\n\
+  yymemo *memo;\n\
+  int i;\n\
+  if (!yy->__outer)\n\
+    {\n\
+      if (2 * (yy->__memocount + 1) > yy->__memoslen)\n\
+	{\n\
+	  yymemo *memos= yy->__memos;\n\
+	  int len= yy->__memoslen;\n\
+	  yy->__memoslen= len ? 2 * len : 1024;\n\
+	  yy->__memos= calloc(yy->__memoslen, sizeof(yymemo));\n\
+	  for (i= 0;  i < len;  ++i)\n\
+	    if (memos[i].generation == yy->__memogeneration)\n\
+	      *yyMemoSlot(yy, yy->__memos, yy->__memoslen, memos[i].rule, memos[i].pos)= memos[i];\n\
+	  free(memos);\n\
+	}\n\
+      memo= yyMemoSlot(yy, yy->__memos, yy->__memoslen, rule, frame->pos);\n\
+      if (memo->generation != yy->__memogeneration) ++yy->__memocount;\n\
+      memo->rule= rule;\n\
+      memo->pos= frame->pos;\n\
+      memo->generation= yy->__memogeneration;\n\
+      memo->ok= ok;\n\
+      memo->endpos= yy->__pos;\n\
+      memo->begin= yy->__begin;\n\
+      memo->end= yy->__end;\n\
+      memo->thunks= yy->__memothunkpos;\n\
+      memo->thunkcount= yy->__thunkpos - frame->thunkpos;\n\
+      while (yy->__memothunkpos + memo->thunkcount >= yy->__memothunkslen)\n\
+	{\n\
+	  yy->__memothunkslen= yy->__memothunkslen ? 2 * yy->__memothunkslen : 1024;\n\
+	  yy->__memothunks= realloc(yy->__memothunks, sizeof(yythunk) * yy->__memothunkslen);\n\
+	}\n\
+      memcpy(yy->__memothunks + yy->__memothunkpos, yy->__thunks + frame->thunkpos, sizeof(yythunk) * memo->thunkcount);\n\
+      yy->__memothunkpos += memo->thunkcount;\n\
+    }\n\
+  for (i= frame->thunkpos;  i < yy->__thunkpos;  ++i)\n\
+    {\n\
+      if (YY_OUTER == yy->__thunks[i].begin) yy->__thunks[i].begin= frame->begin;\n\
+      if (YY_OUTER == yy->__thunks[i].end)   yy->__thunks[i].end=   frame->end;\n\
+    }\n\
+  if (YY_OUTER == yy->__begin) yy->__begin= frame->begin;\n\
+  if (YY_OUTER == yy->__end)   yy->__end=   frame->end;\n\
+  yy->__outer= frame->outer || (yy->__outer && (YY_OUTER == frame->begin || YY_OUTER == frame->end));\n\
+  yy->__outerbegin= frame->outerbegin;\n\
+  yy->__outerend= frame->outerend;\n\
+  return ok;\n\
+}\n\
+\n\
+#endif\n\
+\n\
+YY_LOCAL(void) yyCommit(yycontext *yy)\n\
+{\n\
+#ifdef YY_MEMO\n\
+  yyMemoClear(yy);\n\
+#endif\n\
+#ifdef YY_BUFFER\n\
+  yy->__thunkpos= 0;\n\
+#else\n\
+  if ((yy->__limit -= yy->__pos))\n\
+    {\n\
+      memmove(yy->__buf, yy->__buf + yy->__pos, yy->__limit);\n\
+    }\n\
+  yy->__begin -= yy->__pos;\n\
+  yy->__end -= yy->__pos;\n\
+  yy->__pos= yy->__thunkpos= 0;\n\
+#endif\n\
+}\n\
+\n\
+YY_LOCAL(int) yyAccept(yycontext *yy, int tp0)\n\
 {\n\
   if (tp0)\n\
     {\n\
@@ -514,19 +693,29 @@ YY_LOCAL(int) yyAccept(int tp0)\n\
     }\n\
   else\n\
     {\n\
-      yyDone();\n\
-      yyCommit();\n\
+      yyDone(yy);\n\
+      yyCommit(yy);\n\
     }\n\
   return 1;\n\
 }\n\
 \n\
-YY_LOCAL(void) yyPush(char *text, int count)	{ yyval += count; }\n\
-YY_LOCAL(void) yyPop(char *text, int count)	{ yyval -= count; }\n\
-YY_LOCAL(void) yySet(char *text, int count)	{ yyval[count]= yy; }\n\
+YY_LOCAL(void) yyPush(yycontext *yy, char *text, int count)\n\
+{\n\
+  yy->__val += count;\n\
+  while (yy->__valslen <= yy->__val - yy->__vals)\n\
+    {\n\
+      long offset= yy->__val - yy->__vals;\n\
+      yy->__valslen *= 2;\n\
+      yy->__vals= realloc(yy->__vals, sizeof(YYSTYPE) * yy->__valslen);\n\
+      yy->__val= yy->__vals + offset;\n\
+    }\n\
+}\n\
+YY_LOCAL(void) yyPop(yycontext *yy, char *text, int count)	{ yy->__val -= count; }\n\
+YY_LOCAL(void) yySet(yycontext *yy, char *text, int count)	{ yy->__val[count]= yy->__; }\n\
 \n\
 #endif /* YY_PART */\n\
 \n\
-#define	YYACCEPT	yyAccept(yythunkpos0)\n\
+#define	YYACCEPT	yyAccept(yy, yythunkpos0)\n\
 \n\
 ";
 
@@ -534,29 +723,53 @@ static char *footer= "\n\
 \n\
 #ifndef YY_PART\n\
 \n\
-typedef int (*yyrule)();\n\
+typedef int (*yyrule)(yycontext *yy);\n\
+\n\
+#ifdef YY_CTX_LOCAL\n\
+#define YY_CTX_PARAM_	yycontext *yyctx,\n\
+#define YY_CTX_PARAM	yycontext *yyctx\n\
+#define YY_CTX_ARG_	yyctx,\n\
+#define YY_CTX_ARG	yyctx\n\
+#else\n\
+#define YY_CTX_PARAM_\n\
+#define YY_CTX_PARAM	void\n\
+#define YY_CTX_ARG_\n\
+#define YY_CTX_ARG\n\
+static yycontext  yyctx0;\n\
+static yycontext *yyctx= &yyctx0;\n\
+#endif\n\
 \n\
-YY_PARSE(int) YYPARSEFROM(yyrule yystart)\n\
+YY_PARSE(int) YYPARSEFROM(YY_CTX_PARAM_ yyrule yystart)\n\
 {\n\
   int yyok;\n\
-  if (!yybuflen)\n\
+  if (!yyctx->__textlen)\n\
     {\n\
-      yybuflen= 1024;\n\
-      yybuf= malloc(yybuflen);\n\
-      yytextlen= 1024;\n\
-      yytext= malloc(yytextlen);\n\
-      yythunkslen= 32;\n\
-      yythunks= malloc(sizeof(yythunk) * yythunkslen);\n\
-      yyvalslen= 32;\n\
-      yyvals= malloc(sizeof(YYSTYPE) * yyvalslen);\n\
-      yybegin= yyend= yypos= yylimit= yythunkpos= 0;\n\
+#ifndef YY_BUFFER\n\
+      yyctx->__buflen= 1024;\n\
+      yyctx->__buf= malloc(yyctx->__buflen);\n\
+#endif\n\
+      yyctx->__textlen= 1024;\n\
+      yyctx->__text= malloc(yyctx->__textlen);\n\
+      yyctx->__thunkslen= 32;\n\
+      yyctx->__thunks= malloc(sizeof(yythunk) * yyctx->__thunkslen);\n\
+      yyctx->__valslen= 32;\n\
+      yyctx->__vals= malloc(sizeof(YYSTYPE) * yyctx->__valslen);\n\
+      yyctx->__begin= yyctx->__end= yyctx->__pos= yyctx->__limit= yyctx->__thunkpos= 0;\n\
     }\n\
-  yybegin= yyend= yypos;\n\
-  yythunkpos= 0;\n\
-  yyval= yyvals;\n\
-  yyok= yystart();\n\
-  if (yyok) yyDone();\n\
-  yyCommit();\n\
+#ifdef YY_BUFFER\n\
+  yyctx->__buf= YY_BUFFER;\n\
+  yyctx->__limit= strlen(yyctx->__buf);\n\
+  yyctx->__pos= 0;\n\
+#endif\n\
+  yyctx->__begin= yyctx->__end= yyctx->__pos;\n\
+  yyctx->__thunkpos= 0;\n\
+#ifdef YY_MEMO\n\
+  yyMemoClear(yyctx);\n\
+#endif\n\
+  yyctx->__val= yyctx->__vals;\n\
+  yyok= yystart(yyctx);\n\
+  if (yyok) yyDone(yyctx);\n\
+  yyCommit(yyctx);\n\
   return yyok;\n\
   (void)yyrefill;\n\
   (void)yymatchDot;\n\
@@ -571,14 +784,32 @@ YY_PARSE(int) YYPARSEFROM(yyrule yystart)\n\
   (void)yyPush;\n\
   (void)yyPop;\n\
   (void)yySet;\n\
-  (void)yytextmax;\n\
 }\n\
 \n\
-YY_PARSE(int) YYPARSE(void)\n\
+YY_PARSE(int) YYPARSE(YY_CTX_PARAM)\n\
 {\n\
-  return YYPARSEFROM(yy_%s);\n\
+  return YYPARSEFROM(YY_CTX_ARG_ yy_%s);\n\
 }\n\
 \n\
+#ifdef YY_CTX_LOCAL\n\
+\n\
+YY_PARSE(void) YYRELEASE(yycontext *yyctx)\n\
+{\n\
+#ifndef YY_BUFFER\n\
+  free(yyctx->__buf);\n\
+#endif\n\
+  free(yyctx->__text);\n\
+  free(yyctx->__thunks);\n\
+  free(yyctx->__vals);\n\
+#ifdef YY_MEMO\n\
+  free(yyctx->__memos);\n\
+  free(yyctx->__memothunks);\n\
+#endif\n\
+  memset(yyctx, 0, sizeof(yycontext));\n\
+}\n\
+\n\
+#endif\n\
+\n\
 #endif\n\
 ";
 
@@ -658,17 +889,31 @@ void Rule_compile_c(Node *node)
   for (n= rules;  n;  n= n->rule.next)
     consumesInput(n);
 
+  for (n= rules;  n;  n= n->rule.next)
+    if (RuleMemo & n->rule.flags)
+      {
+	fprintf(output, "#define YY_MEMO\n");
+	break;
+      }
   fprintf(output, "%s", preamble);
   for (n= node;  n;  n= n->rule.next)
-    fprintf(output, "YY_RULE(int) yy_%s(); /* %d */\n", n->rule.name, n->rule.id);
+    fprintf(output, "YY_RULE(int) yy_%s(yycontext *yy); /* %d */\n", n->rule.name, n->rule.id);
   fprintf(output, "\n");
   for (n= actions;  n;  n= n->action.list)
     {
-      fprintf(output, "YY_ACTION(void) yy%s(char *yytext, int yyleng)\n{\n", n->action.name);
+      fprintf(output, "YY_ACTION(void) yy%s(yycontext *yy, char *yytext, int yyleng)\n{\n", n->action.name);
+      fprintf(output, "#define __ yy->__\n");
+      fprintf(output, "#define yypos yy->__pos\n");
+      fprintf(output, "#define yytextpos yy->__textpos\n");
+      fprintf(output, "#define yythunkpos yy->__thunkpos\n");
       defineVariables(n->action.rule->rule.variables);
       fprintf(output, "  yyprintf((stderr, \"do yy%s\\n\"));\n", n->action.name);
       fprintf(output, "  %s;\n", n->action.text);
       undefineVariables(n->action.rule->rule.variables);
+      fprintf(output, "#undef yythunkpos\n");
+      fprintf(output, "#undef yytextpos\n");
+      fprintf(output, "#undef yypos\n");
+      fprintf(output, "#undef __\n");
       fprintf(output, "}\n");
     }
   Rule_compile_c2(node);
@@ -1,9 +1,9 @@
-/* A recursive-descent parser generated by peg 0.1.1 */
+/* A recursive-descent parser generated by peg 0.1.2 */
 
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
-#define YYRULECOUNT 36
+#define YYRULECOUNT 38
 
 # include "tree.h"
 # include "version.h"
@@ -46,9 +46,6 @@
 # define YY_LOCAL(T)	static T
 # define YY_RULE(T)	static T
 
-#ifndef YY_VARIABLE
-#define YY_VARIABLE(T)	static T
-#endif
 #ifndef YY_LOCAL
 #define YY_LOCAL(T)	static T
 #endif
@@ -67,6 +64,9 @@
 #ifndef YYPARSEFROM
 #define YYPARSEFROM	yyparsefrom
 #endif
+#ifndef YYRELEASE
+#define YYRELEASE	yyrelease
+#endif
 #ifndef YY_INPUT
 #define YY_INPUT(buf, result, max_size)			\
   {							\
@@ -76,10 +76,10 @@
   }
 #endif
 #ifndef YY_BEGIN
-#define YY_BEGIN	( yybegin= yypos, 1)
+#define YY_BEGIN	( yy->__begin= yy->__pos, 1)
 #endif
 #ifndef YY_END
-#define YY_END		( yyend= yypos, 1)
+#define YY_END		( yy->__end= yy->__pos, 1)
 #endif
 #ifdef YY_DEBUG
 # define yyprintf(args)	fprintf args
@@ -89,151 +89,313 @@
 #ifndef YYSTYPE
 #define YYSTYPE	int
 #endif
+#ifdef YY_MEMO
+#define YY_OUTER	(-0x7fffffff)
+#endif
 
-#ifndef YY_PART
-
-typedef void (*yyaction)(char *yytext, int yyleng);
+typedef struct _yycontext yycontext;
+typedef void (*yyaction)(yycontext *yy, char *yytext, int yyleng);
 typedef struct _yythunk { int begin, end;  yyaction  action;  struct _yythunk *next; } yythunk;
 
-YY_VARIABLE(char *   ) yybuf= 0;
-YY_VARIABLE(int	     ) yybuflen= 0;
-YY_VARIABLE(int	     ) yypos= 0;
-YY_VARIABLE(int	     ) yylimit= 0;
-YY_VARIABLE(char *   ) yytext= 0;
-YY_VARIABLE(int	     ) yytextlen= 0;
-YY_VARIABLE(int	     ) yybegin= 0;
-YY_VARIABLE(int	     ) yyend= 0;
-YY_VARIABLE(int	     ) yytextmax= 0;
-YY_VARIABLE(yythunk *) yythunks= 0;
-YY_VARIABLE(int	     ) yythunkslen= 0;
-YY_VARIABLE(int      ) yythunkpos= 0;
-YY_VARIABLE(YYSTYPE  ) yy;
-YY_VARIABLE(YYSTYPE *) yyval= 0;
-YY_VARIABLE(YYSTYPE *) yyvals= 0;
-YY_VARIABLE(int      ) yyvalslen= 0;
-
-YY_LOCAL(int) yyrefill(void)
+#ifdef YY_MEMO
+typedef struct _yymemo {
+  int rule, pos, generation, ok, endpos, begin, end, thunks, thunkcount;
+} yymemo;
+
+typedef struct _yymemoframe {
+  int pos, thunkpos, begin, end, outerbegin, outerend, outer;
+} yymemoframe;
+#endif
+
+struct _yycontext {
+  char     *__buf;
+  int       __buflen;
+  int       __pos;
+  int       __limit;
+  char     *__text;
+  int       __textlen;
+  int       __textpos;
+  int       __begin;
+  int       __end;
+  int       __textmax;
+  yythunk  *__thunks;
+  int       __thunkslen;
+  int       __thunkpos;
+  YYSTYPE   __;
+  YYSTYPE  *__val;
+  YYSTYPE  *__vals;
+  int       __valslen;
+#ifdef YY_MEMO
+  int       __outerbegin;
+  int       __outerend;
+  int       __outer;
+  yymemo   *__memos;
+  int       __memoslen;
+  int       __memocount;
+  int       __memogeneration;
+  yythunk  *__memothunks;
+  int       __memothunkslen;
+  int       __memothunkpos;
+#endif
+#ifdef YY_CTX_MEMBERS
+  YY_CTX_MEMBERS
+#endif
+};
+
+#ifndef YY_PART
+
+YY_LOCAL(int) yyrefill(yycontext *yy)
 {
+#ifdef YY_BUFFER
+  return 0;
+#else
   int yyn;
-  while (yybuflen - yypos < 512)
+  while (yy->__buflen - yy->__pos < 512)
     {
-      yybuflen *= 2;
-      yybuf= realloc(yybuf, yybuflen);
+      yy->__buflen *= 2;
+      yy->__buf= realloc(yy->__buf, yy->__buflen);
     }
-  YY_INPUT((yybuf + yypos), yyn, (yybuflen - yypos));
+  YY_INPUT((yy->__buf + yy->__pos), yyn, (yy->__buflen - yy->__pos));
   if (!yyn) return 0;
-  yylimit += yyn;
+  yy->__limit += yyn;
   return 1;
+#endif
 }
 
-YY_LOCAL(int) yymatchDot(void)
+YY_LOCAL(int) yymatchDot(yycontext *yy)
 {
-  if (yypos >= yylimit && !yyrefill()) return 0;
-  ++yypos;
+  if (yy->__pos >= yy->__limit && !yyrefill(yy)) return 0;
+  ++yy->__pos;
   return 1;
 }
 
-YY_LOCAL(int) yymatchChar(int c)
+YY_LOCAL(int) yymatchChar(yycontext *yy, int c)
 {
-  if (yypos >= yylimit && !yyrefill()) return 0;
-  if (yybuf[yypos] == c)
+  if (yy->__pos >= yy->__limit && !yyrefill(yy)) return 0;
+  if (yy->__buf[yy->__pos] == c)
     {
-      ++yypos;
-      yyprintf((stderr, "  ok   yymatchChar(%c) @ %s\n", c, yybuf+yypos));
+      ++yy->__pos;
+      yyprintf((stderr, "  ok   yymatchChar(%c) @ %s\n", c, yy->__buf+yy->__pos));
       return 1;
     }
-  yyprintf((stderr, "  fail yymatchChar(%c) @ %s\n", c, yybuf+yypos));
+  yyprintf((stderr, "  fail yymatchChar(%c) @ %s\n", c, yy->__buf+yy->__pos));
   return 0;
 }
 
-YY_LOCAL(int) yymatchString(char *s)
+YY_LOCAL(int) yymatchString(yycontext *yy, char *s)
 {
-  int yysav= yypos;
+  int yysav= yy->__pos;
   while (*s)
     {
-      if (yypos >= yylimit && !yyrefill()) return 0;
-      if (yybuf[yypos] != *s)
+      if (yy->__pos >= yy->__limit && !yyrefill(yy)) return 0;
+      if (yy->__buf[yy->__pos] != *s)
         {
-          yypos= yysav;
+          yy->__pos= yysav;
           return 0;
         }
       ++s;
-      ++yypos;
+      ++yy->__pos;
     }
   return 1;
 }
 
-YY_LOCAL(int) yymatchClass(unsigned char *bits)
+YY_LOCAL(int) yymatchClass(yycontext *yy, unsigned char *bits)
 {
   int c;
-  if (yypos >= yylimit && !yyrefill()) return 0;
-  c= yybuf[yypos];
+  if (yy->__pos >= yy->__limit && !yyrefill(yy)) return 0;
+  c= yy->__buf[yy->__pos];
   if (bits[c >> 3] & (1 << (c & 7)))
     {
-      ++yypos;
-      yyprintf((stderr, "  ok   yymatchClass @ %s\n", yybuf+yypos));
+      ++yy->__pos;
+      yyprintf((stderr, "  ok   yymatchClass @ %s\n", yy->__buf+yy->__pos));
       return 1;
     }
-  yyprintf((stderr, "  fail yymatchClass @ %s\n", yybuf+yypos));
+  yyprintf((stderr, "  fail yymatchClass @ %s\n", yy->__buf+yy->__pos));
   return 0;
 }
 
-YY_LOCAL(void) yyDo(yyaction action, int begin, int end)
+YY_LOCAL(void) yyDo(yycontext *yy, yyaction action, int begin, int end)
 {
-  while (yythunkpos >= yythunkslen)
+  while (yy->__thunkpos >= yy->__thunkslen)
     {
-      yythunkslen *= 2;
-      yythunks= realloc(yythunks, sizeof(yythunk) * yythunkslen);
+      yy->__thunkslen *= 2;
+      yy->__thunks= realloc(yy->__thunks, sizeof(yythunk) * yy->__thunkslen);
     }
-  yythunks[yythunkpos].begin=  begin;
-  yythunks[yythunkpos].end=    end;
-  yythunks[yythunkpos].action= action;
-  ++yythunkpos;
+  yy->__thunks[yy->__thunkpos].begin=  begin;
+  yy->__thunks[yy->__thunkpos].end=    end;
+  yy->__thunks[yy->__thunkpos].action= action;
+  ++yy->__thunkpos;
 }
 
-YY_LOCAL(int) yyText(int begin, int end)
+YY_LOCAL(int) yyText(yycontext *yy, int begin, int end)
 {
-  int yyleng= end - begin;
+  int yyleng;
+#ifdef YY_MEMO
+  if (YY_OUTER == begin) begin= yy->__outerbegin, yy->__outer= 1;
+  if (YY_OUTER == end)   end=   yy->__outerend,   yy->__outer= 1;
+#endif
+  yy->__textpos= begin;
+  yyleng= end - begin;
   if (yyleng <= 0)
     yyleng= 0;
   else
     {
-      while (yytextlen < (yyleng - 1))
+      while (yy->__textlen < (yyleng - 1))
 	{
-	  yytextlen *= 2;
-	  yytext= realloc(yytext, yytextlen);
+	  yy->__textlen *= 2;
+	  yy->__text= realloc(yy->__text, yy->__textlen);
 	}
-      memcpy(yytext, yybuf + begin, yyleng);
+      memcpy(yy->__text, yy->__buf + begin, yyleng);
     }
-  yytext[yyleng]= '\0';
+  yy->__text[yyleng]= '\0';
   return yyleng;
 }
 
-YY_LOCAL(void) yyDone(void)
+YY_LOCAL(void) yyDone(yycontext *yy)
 {
   int pos;
-  for (pos= 0;  pos < yythunkpos;  ++pos)
+  for (pos= 0;  pos < yy->__thunkpos;  ++pos)
+    {
+      yythunk *thunk= &yy->__thunks[pos];
+      int yyleng= thunk->end ? yyText(yy, thunk->begin, thunk->end) : thunk->begin;
+      yyprintf((stderr, "DO [%d] %p %s\n", pos, thunk->action, yy->__text));
+      thunk->action(yy, yy->__text, yyleng);
+    }
+  yy->__thunkpos= 0;
+}
+
+#ifdef YY_MEMO
+
+YY_LOCAL(void) yyMemoClear(yycontext *yy)
+{
+  ++yy->__memogeneration;
+  yy->__memocount= yy->__memothunkpos= 0;
+}
+
+YY_LOCAL(yymemo *) yyMemoSlot(yycontext *yy, yymemo *memos, int len, int rule, int pos)
+{
+  unsigned int hash= ((unsigned int)pos * 2654435761u) ^ ((unsigned int)rule * 40503u);
+  yymemo *memo;
+  for (;;)
+    {
+      memo= &memos[hash & (len - 1)];
+      if (memo->generation != yy->__memogeneration || (memo->rule == rule && memo->pos == pos))
+	return memo;
+      ++hash;
+    }
+}
+
+YY_LOCAL(int) yyMemoLookup(yycontext *yy, int rule)
+{
+  yymemo *memo;
+  int i;
+  if (!yy->__memoslen) return -1;
+  memo= yyMemoSlot(yy, yy->__memos, yy->__memoslen, rule, yy->__pos);
+  if (memo->generation != yy->__memogeneration) return -1;
+  yyprintf((stderr, "  memo %d @ %d -> %d\n", rule, yy->__pos, memo->ok));
+  while (yy->__thunkpos + memo->thunkcount >= yy->__thunkslen)
+    {
+      yy->__thunkslen *= 2;
+      yy->__thunks= realloc(yy->__thunks, sizeof(yythunk) * yy->__thunkslen);
+    }
+  for (i= 0;  i < memo->thunkcount;  ++i)
+    {
+      yythunk *thunk= &yy->__thunks[yy->__thunkpos++];
+      *thunk= yy->__memothunks[memo->thunks + i];
+      if (YY_OUTER == thunk->begin) thunk->begin= yy->__begin;
+      if (YY_OUTER == thunk->end)   thunk->end=   yy->__end;
+    }
+  if (YY_OUTER != memo->begin) yy->__begin= memo->begin;
+  if (YY_OUTER != memo->end)   yy->__end=   memo->end;
+  if (memo->ok) yy->__pos= memo->endpos;
+  return memo->ok;
+}
+
+YY_LOCAL(void) yyMemoEnter(yycontext *yy, yymemoframe *frame)
+{
+  frame->pos= yy->__pos;
+  frame->thunkpos= yy->__thunkpos;
+  frame->begin= yy->__begin;
+  frame->end= yy->__end;
+  frame->outerbegin= yy->__outerbegin;
+  frame->outerend= yy->__outerend;
+  frame->outer= yy->__outer;
+  if (YY_OUTER != yy->__begin) yy->__outerbegin= yy->__begin;
+  if (YY_OUTER != yy->__end)   yy->__outerend=   yy->__end;
+  yy->__begin= yy->__end= YY_OUTER;
+  yy->__outer= 0;
+}
+
+YY_LOCAL(int) yyMemoLeave(yycontext *yy, yymemoframe *frame, int rule, int ok)
+{
+  yymemo *memo;
+  int i;
+  if (!yy->__outer)
+    {
+      if (2 * (yy->__memocount + 1) > yy->__memoslen)
+	{
+	  yymemo *memos= yy->__memos;
+	  int len= yy->__memoslen;
+	  yy->__memoslen= len ? 2 * len : 1024;
+	  yy->__memos= calloc(yy->__memoslen, sizeof(yymemo));
+	  for (i= 0;  i < len;  ++i)
+	    if (memos[i].generation == yy->__memogeneration)
+	      *yyMemoSlot(yy, yy->__memos, yy->__memoslen, memos[i].rule, memos[i].pos)= memos[i];
+	  free(memos);
+	}
+      memo= yyMemoSlot(yy, yy->__memos, yy->__memoslen, rule, frame->pos);
+      if (memo->generation != yy->__memogeneration) ++yy->__memocount;
+      memo->rule= rule;
+      memo->pos= frame->pos;
+      memo->generation= yy->__memogeneration;
+      memo->ok= ok;
+      memo->endpos= yy->__pos;
+      memo->begin= yy->__begin;
+      memo->end= yy->__end;
+      memo->thunks= yy->__memothunkpos;
+      memo->thunkcount= yy->__thunkpos - frame->thunkpos;
+      while (yy->__memothunkpos + memo->thunkcount >= yy->__memothunkslen)
+	{
+	  yy->__memothunkslen= yy->__memothunkslen ? 2 * yy->__memothunkslen : 1024;
+	  yy->__memothunks= realloc(yy->__memothunks, sizeof(yythunk) * yy->__memothunkslen);
+	}
+      memcpy(yy->__memothunks + yy->__memothunkpos, yy->__thunks + frame->thunkpos, sizeof(yythunk) * memo->thunkcount);
+      yy->__memothunkpos += memo->thunkcount;
+    }
+  for (i= frame->thunkpos;  i < yy->__thunkpos;  ++i)
     {
-      yythunk *thunk= &yythunks[pos];
-      int yyleng= thunk->end ? yyText(thunk->begin, thunk->end) : thunk->begin;
-      yyprintf((stderr, "DO [%d] %p %s\n", pos, thunk->action, yytext));
-      thunk->action(yytext, yyleng);
+      if (YY_OUTER == yy->__thunks[i].begin) yy->__thunks[i].begin= frame->begin;
+      if (YY_OUTER == yy->__thunks[i].end)   yy->__thunks[i].end=   frame->end;
     }
-  yythunkpos= 0;
+  if (YY_OUTER == yy->__begin) yy->__begin= frame->begin;
+  if (YY_OUTER == yy->__end)   yy->__end=   frame->end;
+  yy->__outer= frame->outer || (yy->__outer && (YY_OUTER == frame->begin || YY_OUTER == frame->end));
+  yy->__outerbegin= frame->outerbegin;
+  yy->__outerend= frame->outerend;
+  return ok;
 }
 
-YY_LOCAL(void) yyCommit()
+#endif
+
+YY_LOCAL(void) yyCommit(yycontext *yy)
 {
-  if ((yylimit -= yypos))
+#ifdef YY_MEMO
+  yyMemoClear(yy);
+#endif
+#ifdef YY_BUFFER
+  yy->__thunkpos= 0;
+#else
+  if ((yy->__limit -= yy->__pos))
     {
-      memmove(yybuf, yybuf + yypos, yylimit);
+      memmove(yy->__buf, yy->__buf + yy->__pos, yy->__limit);
     }
-  yybegin -= yypos;
-  yyend -= yypos;
-  yypos= yythunkpos= 0;
+  yy->__begin -= yy->__pos;
+  yy->__end -= yy->__pos;
+  yy->__pos= yy->__thunkpos= 0;
+#endif
 }
 
-YY_LOCAL(int) yyAccept(int tp0)
+YY_LOCAL(int) yyAccept(yycontext *yy, int tp0)
 {
   if (tp0)
     {
@@ -242,674 +404,921 @@ YY_LOCAL(int) yyAccept(int tp0)
     }
   else
     {
-      yyDone();
-      yyCommit();
+      yyDone(yy);
+      yyCommit(yy);
     }
   return 1;
 }
 
-YY_LOCAL(void) yyPush(char *text, int count)	{ yyval += count; }
-YY_LOCAL(void) yyPop(char *text, int count)	{ yyval -= count; }
-YY_LOCAL(void) yySet(char *text, int count)	{ yyval[count]= yy; }
+YY_LOCAL(void) yyPush(yycontext *yy, char *text, int count)
+{
+  yy->__val += count;
+  while (yy->__valslen <= yy->__val - yy->__vals)
+    {
+      long offset= yy->__val - yy->__vals;
+      yy->__valslen *= 2;
+      yy->__vals= realloc(yy->__vals, sizeof(YYSTYPE) * yy->__valslen);
+      yy->__val= yy->__vals + offset;
+    }
+}
+YY_LOCAL(void) yyPop(yycontext *yy, char *text, int count)	{ yy->__val -= count; }
+YY_LOCAL(void) yySet(yycontext *yy, char *text, int count)	{ yy->__val[count]= yy->__; }
 
 #endif /* YY_PART */
 
-#define	YYACCEPT	yyAccept(yythunkpos0)
-
-YY_RULE(int) yy_end_of_line(); /* 36 */
-YY_RULE(int) yy_comment(); /* 35 */
-YY_RULE(int) yy_space(); /* 34 */
-YY_RULE(int) yy_braces(); /* 33 */
-YY_RULE(int) yy_range(); /* 32 */
-YY_RULE(int) yy_char(); /* 31 */
-YY_RULE(int) yy_END(); /* 30 */
-YY_RULE(int) yy_BEGIN(); /* 29 */
-YY_RULE(int) yy_DOT(); /* 28 */
-YY_RULE(int) yy_class(); /* 27 */
-YY_RULE(int) yy_literal(); /* 26 */
-YY_RULE(int) yy_CLOSE(); /* 25 */
-YY_RULE(int) yy_OPEN(); /* 24 */
-YY_RULE(int) yy_COLON(); /* 23 */
-YY_RULE(int) yy_PLUS(); /* 22 */
-YY_RULE(int) yy_STAR(); /* 21 */
-YY_RULE(int) yy_QUESTION(); /* 20 */
-YY_RULE(int) yy_primary(); /* 19 */
-YY_RULE(int) yy_NOT(); /* 18 */
-YY_RULE(int) yy_suffix(); /* 17 */
-YY_RULE(int) yy_action(); /* 16 */
-YY_RULE(int) yy_AND(); /* 15 */
-YY_RULE(int) yy_prefix(); /* 14 */
-YY_RULE(int) yy_BAR(); /* 13 */
-YY_RULE(int) yy_sequence(); /* 12 */
-YY_RULE(int) yy_SEMICOLON(); /* 11 */
-YY_RULE(int) yy_expression(); /* 10 */
-YY_RULE(int) yy_EQUAL(); /* 9 */
-YY_RULE(int) yy_identifier(); /* 8 */
-YY_RULE(int) yy_RPERCENT(); /* 7 */
-YY_RULE(int) yy_end_of_file(); /* 6 */
-YY_RULE(int) yy_trailer(); /* 5 */
-YY_RULE(int) yy_definition(); /* 4 */
-YY_RULE(int) yy_declaration(); /* 3 */
-YY_RULE(int) yy__(); /* 2 */
-YY_RULE(int) yy_grammar(); /* 1 */
-
-YY_ACTION(void) yy_9_primary(char *yytext, int yyleng)
+#define	YYACCEPT	yyAccept(yy, yythunkpos0)
+
+YY_RULE(int) yy_end_of_line(yycontext *yy); /* 38 */
+YY_RULE(int) yy_comment(yycontext *yy); /* 37 */
+YY_RULE(int) yy_space(yycontext *yy); /* 36 */
+YY_RULE(int) yy_braces(yycontext *yy); /* 35 */
+YY_RULE(int) yy_range(yycontext *yy); /* 34 */
+YY_RULE(int) yy_char(yycontext *yy); /* 33 */
+YY_RULE(int) yy_END(yycontext *yy); /* 32 */
+YY_RULE(int) yy_BEGIN(yycontext *yy); /* 31 */
+YY_RULE(int) yy_DOT(yycontext *yy); /* 30 */
+YY_RULE(int) yy_class(yycontext *yy); /* 29 */
+YY_RULE(int) yy_literal(yycontext *yy); /* 28 */
+YY_RULE(int) yy_CLOSE(yycontext *yy); /* 27 */
+YY_RULE(int) yy_OPEN(yycontext *yy); /* 26 */
+YY_RULE(int) yy_COLON(yycontext *yy); /* 25 */
+YY_RULE(int) yy_PLUS(yycontext *yy); /* 24 */
+YY_RULE(int) yy_STAR(yycontext *yy); /* 23 */
+YY_RULE(int) yy_QUESTION(yycontext *yy); /* 22 */
+YY_RULE(int) yy_primary(yycontext *yy); /* 21 */
+YY_RULE(int) yy_NOT(yycontext *yy); /* 20 */
+YY_RULE(int) yy_suffix(yycontext *yy); /* 19 */
+YY_RULE(int) yy_action(yycontext *yy); /* 18 */
+YY_RULE(int) yy_AND(yycontext *yy); /* 17 */
+YY_RULE(int) yy_prefix(yycontext *yy); /* 16 */
+YY_RULE(int) yy_BAR(yycontext *yy); /* 15 */
+YY_RULE(int) yy_sequence(yycontext *yy); /* 14 */
+YY_RULE(int) yy_SEMICOLON(yycontext *yy); /* 13 */
+YY_RULE(int) yy_expression(yycontext *yy); /* 12 */
+YY_RULE(int) yy_EQUAL(yycontext *yy); /* 11 */
+YY_RULE(int) yy_identifier(yycontext *yy); /* 10 */
+YY_RULE(int) yy_MEMO(yycontext *yy); /* 9 */
+YY_RULE(int) yy_RPERCENT(yycontext *yy); /* 8 */
+YY_RULE(int) yy_end_of_file(yycontext *yy); /* 7 */
+YY_RULE(int) yy_trailer(yycontext *yy); /* 6 */
+YY_RULE(int) yy_definition(yycontext *yy); /* 5 */
+YY_RULE(int) yy_memo(yycontext *yy); /* 4 */
+YY_RULE(int) yy_declaration(yycontext *yy); /* 3 */
+YY_RULE(int) yy__(yycontext *yy); /* 2 */
+YY_RULE(int) yy_grammar(yycontext *yy); /* 1 */
+
+YY_ACTION(void) yy_9_primary(yycontext *yy, char *yytext, int yyleng)
 {
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
   yyprintf((stderr, "do yy_9_primary\n"));
    push(makePredicate("YY_END")); ;
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
 }
-YY_ACTION(void) yy_8_primary(char *yytext, int yyleng)
+YY_ACTION(void) yy_8_primary(yycontext *yy, char *yytext, int yyleng)
 {
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
   yyprintf((stderr, "do yy_8_primary\n"));
    push(makePredicate("YY_BEGIN")); ;
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
 }
-YY_ACTION(void) yy_7_primary(char *yytext, int yyleng)
+YY_ACTION(void) yy_7_primary(yycontext *yy, char *yytext, int yyleng)
 {
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
   yyprintf((stderr, "do yy_7_primary\n"));
    push(makeAction(yytext)); ;
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
 }
-YY_ACTION(void) yy_6_primary(char *yytext, int yyleng)
+YY_ACTION(void) yy_6_primary(yycontext *yy, char *yytext, int yyleng)
 {
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
   yyprintf((stderr, "do yy_6_primary\n"));
    push(makeDot()); ;
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
 }
-YY_ACTION(void) yy_5_primary(char *yytext, int yyleng)
+YY_ACTION(void) yy_5_primary(yycontext *yy, char *yytext, int yyleng)
 {
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
   yyprintf((stderr, "do yy_5_primary\n"));
    push(makeClass(yytext)); ;
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
 }
-YY_ACTION(void) yy_4_primary(char *yytext, int yyleng)
+YY_ACTION(void) yy_4_primary(yycontext *yy, char *yytext, int yyleng)
 {
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
   yyprintf((stderr, "do yy_4_primary\n"));
    push(makeString(yytext)); ;
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
 }
-YY_ACTION(void) yy_3_primary(char *yytext, int yyleng)
+YY_ACTION(void) yy_3_primary(yycontext *yy, char *yytext, int yyleng)
 {
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
   yyprintf((stderr, "do yy_3_primary\n"));
    push(makeName(findRule(yytext))); ;
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
 }
-YY_ACTION(void) yy_2_primary(char *yytext, int yyleng)
+YY_ACTION(void) yy_2_primary(yycontext *yy, char *yytext, int yyleng)
 {
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
   yyprintf((stderr, "do yy_2_primary\n"));
    Node *name= makeName(findRule(yytext));  name->name.variable= pop();  push(name); ;
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
 }
-YY_ACTION(void) yy_1_primary(char *yytext, int yyleng)
+YY_ACTION(void) yy_1_primary(yycontext *yy, char *yytext, int yyleng)
 {
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
   yyprintf((stderr, "do yy_1_primary\n"));
    push(makeVariable(yytext)); ;
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
 }
-YY_ACTION(void) yy_3_suffix(char *yytext, int yyleng)
+YY_ACTION(void) yy_3_suffix(yycontext *yy, char *yytext, int yyleng)
 {
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
   yyprintf((stderr, "do yy_3_suffix\n"));
    push(makePlus (pop())); ;
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
 }
-YY_ACTION(void) yy_2_suffix(char *yytext, int yyleng)
+YY_ACTION(void) yy_2_suffix(yycontext *yy, char *yytext, int yyleng)
 {
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
   yyprintf((stderr, "do yy_2_suffix\n"));
    push(makeStar (pop())); ;
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
 }
-YY_ACTION(void) yy_1_suffix(char *yytext, int yyleng)
+YY_ACTION(void) yy_1_suffix(yycontext *yy, char *yytext, int yyleng)
 {
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
   yyprintf((stderr, "do yy_1_suffix\n"));
    push(makeQuery(pop())); ;
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
 }
-YY_ACTION(void) yy_3_prefix(char *yytext, int yyleng)
+YY_ACTION(void) yy_3_prefix(yycontext *yy, char *yytext, int yyleng)
 {
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
   yyprintf((stderr, "do yy_3_prefix\n"));
    push(makePeekNot(pop())); ;
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
 }
-YY_ACTION(void) yy_2_prefix(char *yytext, int yyleng)
+YY_ACTION(void) yy_2_prefix(yycontext *yy, char *yytext, int yyleng)
 {
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
   yyprintf((stderr, "do yy_2_prefix\n"));
    push(makePeekFor(pop())); ;
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
 }
-YY_ACTION(void) yy_1_prefix(char *yytext, int yyleng)
+YY_ACTION(void) yy_1_prefix(yycontext *yy, char *yytext, int yyleng)
 {
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
   yyprintf((stderr, "do yy_1_prefix\n"));
    push(makePredicate(yytext)); ;
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
 }
-YY_ACTION(void) yy_1_sequence(char *yytext, int yyleng)
+YY_ACTION(void) yy_1_sequence(yycontext *yy, char *yytext, int yyleng)
 {
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
   yyprintf((stderr, "do yy_1_sequence\n"));
    Node *f= pop();  push(Sequence_append(pop(), f)); ;
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
 }
-YY_ACTION(void) yy_1_expression(char *yytext, int yyleng)
+YY_ACTION(void) yy_1_expression(yycontext *yy, char *yytext, int yyleng)
 {
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
   yyprintf((stderr, "do yy_1_expression\n"));
    Node *f= pop();  push(Alternate_append(pop(), f)); ;
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
 }
-YY_ACTION(void) yy_2_definition(char *yytext, int yyleng)
+YY_ACTION(void) yy_2_definition(yycontext *yy, char *yytext, int yyleng)
 {
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
   yyprintf((stderr, "do yy_2_definition\n"));
    Node *e= pop();  Rule_setExpression(pop(), e); ;
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
 }
-YY_ACTION(void) yy_1_definition(char *yytext, int yyleng)
+YY_ACTION(void) yy_1_definition(yycontext *yy, char *yytext, int yyleng)
 {
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
   yyprintf((stderr, "do yy_1_definition\n"));
    if (push(beginRule(findRule(yytext)))->rule.expression)
 							    fprintf(stderr, "rule '%s' redefined\n", yytext); ;
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
 }
-YY_ACTION(void) yy_1_trailer(char *yytext, int yyleng)
+YY_ACTION(void) yy_1_trailer(yycontext *yy, char *yytext, int yyleng)
 {
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
   yyprintf((stderr, "do yy_1_trailer\n"));
    makeTrailer(yytext); ;
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
 }
-YY_ACTION(void) yy_1_declaration(char *yytext, int yyleng)
+YY_ACTION(void) yy_1_memo(yycontext *yy, char *yytext, int yyleng)
 {
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
+  yyprintf((stderr, "do yy_1_memo\n"));
+   findRule(yytext)->rule.flags |= RuleMemo; ;
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
+}
+YY_ACTION(void) yy_1_declaration(yycontext *yy, char *yytext, int yyleng)
+{
+#define __ yy->__
+#define yypos yy->__pos
+#define yytextpos yy->__textpos
+#define yythunkpos yy->__thunkpos
   yyprintf((stderr, "do yy_1_declaration\n"));
    makeHeader(yytext); ;
+#undef yythunkpos
+#undef yytextpos
+#undef yypos
+#undef __
 }
 
-YY_RULE(int) yy_end_of_line()
-{  int yypos0= yypos, yythunkpos0= yythunkpos;
+YY_RULE(int) yy_end_of_line(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
   yyprintf((stderr, "%s\n", "end_of_line"));
-  {  int yypos2= yypos, yythunkpos2= yythunkpos;  if (!yymatchString("\r\n")) goto l3;  goto l2;
-  l3:;	  yypos= yypos2; yythunkpos= yythunkpos2;  if (!yymatchChar('\n')) goto l4;  goto l2;
-  l4:;	  yypos= yypos2; yythunkpos= yythunkpos2;  if (!yymatchChar('\r')) goto l1;
+  {  int yypos2= yy->__pos, yythunkpos2= yy->__thunkpos;  if (!yymatchString(yy, "\r\n")) goto l3;  goto l2;
+  l3:;	  yy->__pos= yypos2; yy->__thunkpos= yythunkpos2;  if (!yymatchChar(yy, '\n')) goto l4;  goto l2;
+  l4:;	  yy->__pos= yypos2; yy->__thunkpos= yythunkpos2;  if (!yymatchChar(yy, '\r')) goto l1;
   }
   l2:;	
-  yyprintf((stderr, "  ok   %s @ %s\n", "end_of_line", yybuf+yypos));
+  yyprintf((stderr, "  ok   %s @ %s\n", "end_of_line", yy->__buf+yy->__pos));
   return 1;
-  l1:;	  yypos= yypos0; yythunkpos= yythunkpos0;
-  yyprintf((stderr, "  fail %s @ %s\n", "end_of_line", yybuf+yypos));
+  l1:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "end_of_line", yy->__buf+yy->__pos));
   return 0;
 }
-YY_RULE(int) yy_comment()
-{  int yypos0= yypos, yythunkpos0= yythunkpos;
-  yyprintf((stderr, "%s\n", "comment"));  if (!yymatchChar('#')) goto l5;
+YY_RULE(int) yy_comment(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "comment"));  if (!yymatchChar(yy, '#')) goto l5;
   l6:;	
-  {  int yypos7= yypos, yythunkpos7= yythunkpos;
-  {  int yypos8= yypos, yythunkpos8= yythunkpos;  if (!yy_end_of_line()) goto l8;  goto l7;
-  l8:;	  yypos= yypos8; yythunkpos= yythunkpos8;
-  }  if (!yymatchDot()) goto l7;  goto l6;
-  l7:;	  yypos= yypos7; yythunkpos= yythunkpos7;
-  }  if (!yy_end_of_line()) goto l5;
-  yyprintf((stderr, "  ok   %s @ %s\n", "comment", yybuf+yypos));
+  {  int yypos7= yy->__pos, yythunkpos7= yy->__thunkpos;
+  {  int yypos8= yy->__pos, yythunkpos8= yy->__thunkpos;  if (!yy_end_of_line(yy)) goto l8;  goto l7;
+  l8:;	  yy->__pos= yypos8; yy->__thunkpos= yythunkpos8;
+  }  if (!yymatchDot(yy)) goto l7;  goto l6;
+  l7:;	  yy->__pos= yypos7; yy->__thunkpos= yythunkpos7;
+  }  if (!yy_end_of_line(yy)) goto l5;
+  yyprintf((stderr, "  ok   %s @ %s\n", "comment", yy->__buf+yy->__pos));
   return 1;
-  l5:;	  yypos= yypos0; yythunkpos= yythunkpos0;
-  yyprintf((stderr, "  fail %s @ %s\n", "comment", yybuf+yypos));
+  l5:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "comment", yy->__buf+yy->__pos));
   return 0;
 }
-YY_RULE(int) yy_space()
-{  int yypos0= yypos, yythunkpos0= yythunkpos;
+YY_RULE(int) yy_space(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
   yyprintf((stderr, "%s\n", "space"));
-  {  int yypos10= yypos, yythunkpos10= yythunkpos;  if (!yymatchChar(' ')) goto l11;  goto l10;
-  l11:;	  yypos= yypos10; yythunkpos= yythunkpos10;  if (!yymatchChar('\t')) goto l12;  goto l10;
-  l12:;	  yypos= yypos10; yythunkpos= yythunkpos10;  if (!yy_end_of_line()) goto l9;
+  {  int yypos10= yy->__pos, yythunkpos10= yy->__thunkpos;  if (!yymatchChar(yy, ' ')) goto l11;  goto l10;
+  l11:;	  yy->__pos= yypos10; yy->__thunkpos= yythunkpos10;  if (!yymatchChar(yy, '\t')) goto l12;  goto l10;
+  l12:;	  yy->__pos= yypos10; yy->__thunkpos= yythunkpos10;  if (!yy_end_of_line(yy)) goto l9;
   }
   l10:;	
-  yyprintf((stderr, "  ok   %s @ %s\n", "space", yybuf+yypos));
+  yyprintf((stderr, "  ok   %s @ %s\n", "space", yy->__buf+yy->__pos));
   return 1;
-  l9:;	  yypos= yypos0; yythunkpos= yythunkpos0;
-  yyprintf((stderr, "  fail %s @ %s\n", "space", yybuf+yypos));
+  l9:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "space", yy->__buf+yy->__pos));
   return 0;
 }
-YY_RULE(int) yy_braces()
-{  int yypos0= yypos, yythunkpos0= yythunkpos;
+YY_RULE(int) yy_braces(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
   yyprintf((stderr, "%s\n", "braces"));
-  {  int yypos14= yypos, yythunkpos14= yythunkpos;  if (!yymatchChar('{')) goto l15;
+  {  int yypos14= yy->__pos, yythunkpos14= yy->__thunkpos;  if (!yymatchChar(yy, '{')) goto l15;
   l16:;	
-  {  int yypos17= yypos, yythunkpos17= yythunkpos;
-  {  int yypos18= yypos, yythunkpos18= yythunkpos;  if (!yymatchChar('}')) goto l18;  goto l17;
-  l18:;	  yypos= yypos18; yythunkpos= yythunkpos18;
-  }  if (!yymatchDot()) goto l17;  goto l16;
-  l17:;	  yypos= yypos17; yythunkpos= yythunkpos17;
-  }  if (!yymatchChar('}')) goto l15;  goto l14;
-  l15:;	  yypos= yypos14; yythunkpos= yythunkpos14;
-  {  int yypos19= yypos, yythunkpos19= yythunkpos;  if (!yymatchChar('}')) goto l19;  goto l13;
-  l19:;	  yypos= yypos19; yythunkpos= yythunkpos19;
-  }  if (!yymatchDot()) goto l13;
+  {  int yypos17= yy->__pos, yythunkpos17= yy->__thunkpos;
+  {  int yypos18= yy->__pos, yythunkpos18= yy->__thunkpos;  if (!yymatchChar(yy, '}')) goto l18;  goto l17;
+  l18:;	  yy->__pos= yypos18; yy->__thunkpos= yythunkpos18;
+  }  if (!yymatchDot(yy)) goto l17;  goto l16;
+  l17:;	  yy->__pos= yypos17; yy->__thunkpos= yythunkpos17;
+  }  if (!yymatchChar(yy, '}')) goto l15;  goto l14;
+  l15:;	  yy->__pos= yypos14; yy->__thunkpos= yythunkpos14;
+  {  int yypos19= yy->__pos, yythunkpos19= yy->__thunkpos;  if (!yymatchChar(yy, '}')) goto l19;  goto l13;
+  l19:;	  yy->__pos= yypos19; yy->__thunkpos= yythunkpos19;
+  }  if (!yymatchDot(yy)) goto l13;
   }
   l14:;	
-  yyprintf((stderr, "  ok   %s @ %s\n", "braces", yybuf+yypos));
+  yyprintf((stderr, "  ok   %s @ %s\n", "braces", yy->__buf+yy->__pos));
   return 1;
-  l13:;	  yypos= yypos0; yythunkpos= yythunkpos0;
-  yyprintf((stderr, "  fail %s @ %s\n", "braces", yybuf+yypos));
+  l13:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "braces", yy->__buf+yy->__pos));
   return 0;
 }
-YY_RULE(int) yy_range()
-{  int yypos0= yypos, yythunkpos0= yythunkpos;
+YY_RULE(int) yy_range(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
   yyprintf((stderr, "%s\n", "range"));
-  {  int yypos21= yypos, yythunkpos21= yythunkpos;  if (!yy_char()) goto l22;  if (!yymatchChar('-')) goto l22;  if (!yy_char()) goto l22;  goto l21;
-  l22:;	  yypos= yypos21; yythunkpos= yythunkpos21;  if (!yy_char()) goto l20;
+  {  int yypos21= yy->__pos, yythunkpos21= yy->__thunkpos;  if (!yy_char(yy)) goto l22;  if (!yymatchChar(yy, '-')) goto l22;  if (!yy_char(yy)) goto l22;  goto l21;
+  l22:;	  yy->__pos= yypos21; yy->__thunkpos= yythunkpos21;  if (!yy_char(yy)) goto l20;
   }
   l21:;	
-  yyprintf((stderr, "  ok   %s @ %s\n", "range", yybuf+yypos));
+  yyprintf((stderr, "  ok   %s @ %s\n", "range", yy->__buf+yy->__pos));
   return 1;
-  l20:;	  yypos= yypos0; yythunkpos= yythunkpos0;
-  yyprintf((stderr, "  fail %s @ %s\n", "range", yybuf+yypos));
+  l20:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "range", yy->__buf+yy->__pos));
   return 0;
 }
-YY_RULE(int) yy_char()
-{  int yypos0= yypos, yythunkpos0= yythunkpos;
+YY_RULE(int) yy_char(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
   yyprintf((stderr, "%s\n", "char"));
-  {  int yypos24= yypos, yythunkpos24= yythunkpos;  if (!yymatchChar('\\')) goto l25;  if (!yymatchClass((unsigned char *)"\000\000\000\000\204\000\000\000\000\000\000\070\146\100\124\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l25;  goto l24;
-  l25:;	  yypos= yypos24; yythunkpos= yythunkpos24;  if (!yymatchChar('\\')) goto l26;  if (!yymatchClass((unsigned char *)"\000\000\000\000\000\000\017\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l26;  if (!yymatchClass((unsigned char *)"\000\000\000\000\000\000\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l26;  if (!yymatchClass((unsigned char *)"\000\000\000\000\000\000\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l26;  goto l24;
-  l26:;	  yypos= yypos24; yythunkpos= yythunkpos24;  if (!yymatchChar('\\')) goto l27;  if (!yymatchClass((unsigned char *)"\000\000\000\000\000\000\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l27;
-  {  int yypos28= yypos, yythunkpos28= yythunkpos;  if (!yymatchClass((unsigned char *)"\000\000\000\000\000\000\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l28;  goto l29;
-  l28:;	  yypos= yypos28; yythunkpos= yythunkpos28;
+  {  int yypos24= yy->__pos, yythunkpos24= yy->__thunkpos;  if (!yymatchChar(yy, '\\')) goto l25;  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\204\000\000\000\000\000\000\070\146\100\124\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l25;  goto l24;
+  l25:;	  yy->__pos= yypos24; yy->__thunkpos= yythunkpos24;  if (!yymatchChar(yy, '\\')) goto l26;  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\000\000\017\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l26;  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\000\000\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l26;  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\000\000\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l26;  goto l24;
+  l26:;	  yy->__pos= yypos24; yy->__thunkpos= yythunkpos24;  if (!yymatchChar(yy, '\\')) goto l27;  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\000\000\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l27;
+  {  int yypos28= yy->__pos, yythunkpos28= yy->__thunkpos;  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\000\000\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l28;  goto l29;
+  l28:;	  yy->__pos= yypos28; yy->__thunkpos= yythunkpos28;
   }
   l29:;	  goto l24;
-  l27:;	  yypos= yypos24; yythunkpos= yythunkpos24;
-  {  int yypos30= yypos, yythunkpos30= yythunkpos;  if (!yymatchChar('\\')) goto l30;  goto l23;
-  l30:;	  yypos= yypos30; yythunkpos= yythunkpos30;
-  }  if (!yymatchDot()) goto l23;
+  l27:;	  yy->__pos= yypos24; yy->__thunkpos= yythunkpos24;
+  {  int yypos30= yy->__pos, yythunkpos30= yy->__thunkpos;  if (!yymatchChar(yy, '\\')) goto l30;  goto l23;
+  l30:;	  yy->__pos= yypos30; yy->__thunkpos= yythunkpos30;
+  }  if (!yymatchDot(yy)) goto l23;
   }
   l24:;	
-  yyprintf((stderr, "  ok   %s @ %s\n", "char", yybuf+yypos));
+  yyprintf((stderr, "  ok   %s @ %s\n", "char", yy->__buf+yy->__pos));
   return 1;
-  l23:;	  yypos= yypos0; yythunkpos= yythunkpos0;
-  yyprintf((stderr, "  fail %s @ %s\n", "char", yybuf+yypos));
+  l23:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "char", yy->__buf+yy->__pos));
   return 0;
 }
-YY_RULE(int) yy_END()
-{  int yypos0= yypos, yythunkpos0= yythunkpos;
-  yyprintf((stderr, "%s\n", "END"));  if (!yymatchChar('>')) goto l31;  if (!yy__()) goto l31;
-  yyprintf((stderr, "  ok   %s @ %s\n", "END", yybuf+yypos));
+YY_RULE(int) yy_END(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "END"));  if (!yymatchChar(yy, '>')) goto l31;  if (!yy__(yy)) goto l31;
+  yyprintf((stderr, "  ok   %s @ %s\n", "END", yy->__buf+yy->__pos));
   return 1;
-  l31:;	  yypos= yypos0; yythunkpos= yythunkpos0;
-  yyprintf((stderr, "  fail %s @ %s\n", "END", yybuf+yypos));
+  l31:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "END", yy->__buf+yy->__pos));
   return 0;
 }
-YY_RULE(int) yy_BEGIN()
-{  int yypos0= yypos, yythunkpos0= yythunkpos;
-  yyprintf((stderr, "%s\n", "BEGIN"));  if (!yymatchChar('<')) goto l32;  if (!yy__()) goto l32;
-  yyprintf((stderr, "  ok   %s @ %s\n", "BEGIN", yybuf+yypos));
+YY_RULE(int) yy_BEGIN(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "BEGIN"));  if (!yymatchChar(yy, '<')) goto l32;  if (!yy__(yy)) goto l32;
+  yyprintf((stderr, "  ok   %s @ %s\n", "BEGIN", yy->__buf+yy->__pos));
   return 1;
-  l32:;	  yypos= yypos0; yythunkpos= yythunkpos0;
-  yyprintf((stderr, "  fail %s @ %s\n", "BEGIN", yybuf+yypos));
+  l32:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "BEGIN", yy->__buf+yy->__pos));
   return 0;
 }
-YY_RULE(int) yy_DOT()
-{  int yypos0= yypos, yythunkpos0= yythunkpos;
-  yyprintf((stderr, "%s\n", "DOT"));  if (!yymatchChar('.')) goto l33;  if (!yy__()) goto l33;
-  yyprintf((stderr, "  ok   %s @ %s\n", "DOT", yybuf+yypos));
+YY_RULE(int) yy_DOT(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "DOT"));  if (!yymatchChar(yy, '.')) goto l33;  if (!yy__(yy)) goto l33;
+  yyprintf((stderr, "  ok   %s @ %s\n", "DOT", yy->__buf+yy->__pos));
   return 1;
-  l33:;	  yypos= yypos0; yythunkpos= yythunkpos0;
-  yyprintf((stderr, "  fail %s @ %s\n", "DOT", yybuf+yypos));
+  l33:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "DOT", yy->__buf+yy->__pos));
   return 0;
 }
-YY_RULE(int) yy_class()
-{  int yypos0= yypos, yythunkpos0= yythunkpos;
-  yyprintf((stderr, "%s\n", "class"));  if (!yymatchChar('[')) goto l34;  yyText(yybegin, yyend);  if (!(YY_BEGIN)) goto l34;
+YY_RULE(int) yy_class(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "class"));  if (!yymatchChar(yy, '[')) goto l34;  if (!(YY_BEGIN)) goto l34;
   l35:;	
-  {  int yypos36= yypos, yythunkpos36= yythunkpos;
-  {  int yypos37= yypos, yythunkpos37= yythunkpos;  if (!yymatchChar(']')) goto l37;  goto l36;
-  l37:;	  yypos= yypos37; yythunkpos= yythunkpos37;
-  }  if (!yy_range()) goto l36;  goto l35;
-  l36:;	  yypos= yypos36; yythunkpos= yythunkpos36;
-  }  yyText(yybegin, yyend);  if (!(YY_END)) goto l34;  if (!yymatchChar(']')) goto l34;  if (!yy__()) goto l34;
-  yyprintf((stderr, "  ok   %s @ %s\n", "class", yybuf+yypos));
+  {  int yypos36= yy->__pos, yythunkpos36= yy->__thunkpos;
+  {  int yypos37= yy->__pos, yythunkpos37= yy->__thunkpos;  if (!yymatchChar(yy, ']')) goto l37;  goto l36;
+  l37:;	  yy->__pos= yypos37; yy->__thunkpos= yythunkpos37;
+  }  if (!yy_range(yy)) goto l36;  goto l35;
+  l36:;	  yy->__pos= yypos36; yy->__thunkpos= yythunkpos36;
+  }  if (!(YY_END)) goto l34;  if (!yymatchChar(yy, ']')) goto l34;  if (!yy__(yy)) goto l34;
+  yyprintf((stderr, "  ok   %s @ %s\n", "class", yy->__buf+yy->__pos));
   return 1;
-  l34:;	  yypos= yypos0; yythunkpos= yythunkpos0;
-  yyprintf((stderr, "  fail %s @ %s\n", "class", yybuf+yypos));
+  l34:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "class", yy->__buf+yy->__pos));
   return 0;
 }
-YY_RULE(int) yy_literal()
-{  int yypos0= yypos, yythunkpos0= yythunkpos;
+YY_RULE(int) yy_literal(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
   yyprintf((stderr, "%s\n", "literal"));
-  {  int yypos39= yypos, yythunkpos39= yythunkpos;  if (!yymatchClass((unsigned char *)"\000\000\000\000\200\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l40;  yyText(yybegin, yyend);  if (!(YY_BEGIN)) goto l40;
+  {  int yypos39= yy->__pos, yythunkpos39= yy->__thunkpos;  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\200\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l40;  if (!(YY_BEGIN)) goto l40;
   l41:;	
-  {  int yypos42= yypos, yythunkpos42= yythunkpos;
-  {  int yypos43= yypos, yythunkpos43= yythunkpos;  if (!yymatchClass((unsigned char *)"\000\000\000\000\200\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l43;  goto l42;
-  l43:;	  yypos= yypos43; yythunkpos= yythunkpos43;
-  }  if (!yy_char()) goto l42;  goto l41;
-  l42:;	  yypos= yypos42; yythunkpos= yythunkpos42;
-  }  yyText(yybegin, yyend);  if (!(YY_END)) goto l40;  if (!yymatchClass((unsigned char *)"\000\000\000\000\200\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l40;  if (!yy__()) goto l40;  goto l39;
-  l40:;	  yypos= yypos39; yythunkpos= yythunkpos39;  if (!yymatchClass((unsigned char *)"\000\000\000\000\004\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l38;  yyText(yybegin, yyend);  if (!(YY_BEGIN)) goto l38;
+  {  int yypos42= yy->__pos, yythunkpos42= yy->__thunkpos;
+  {  int yypos43= yy->__pos, yythunkpos43= yy->__thunkpos;  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\200\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l43;  goto l42;
+  l43:;	  yy->__pos= yypos43; yy->__thunkpos= yythunkpos43;
+  }  if (!yy_char(yy)) goto l42;  goto l41;
+  l42:;	  yy->__pos= yypos42; yy->__thunkpos= yythunkpos42;
+  }  if (!(YY_END)) goto l40;  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\200\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l40;  if (!yy__(yy)) goto l40;  goto l39;
+  l40:;	  yy->__pos= yypos39; yy->__thunkpos= yythunkpos39;  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\004\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l38;  if (!(YY_BEGIN)) goto l38;
   l44:;	
-  {  int yypos45= yypos, yythunkpos45= yythunkpos;
-  {  int yypos46= yypos, yythunkpos46= yythunkpos;  if (!yymatchClass((unsigned char *)"\000\000\000\000\004\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l46;  goto l45;
-  l46:;	  yypos= yypos46; yythunkpos= yythunkpos46;
-  }  if (!yy_char()) goto l45;  goto l44;
-  l45:;	  yypos= yypos45; yythunkpos= yythunkpos45;
-  }  yyText(yybegin, yyend);  if (!(YY_END)) goto l38;  if (!yymatchClass((unsigned char *)"\000\000\000\000\004\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l38;  if (!yy__()) goto l38;
+  {  int yypos45= yy->__pos, yythunkpos45= yy->__thunkpos;
+  {  int yypos46= yy->__pos, yythunkpos46= yy->__thunkpos;  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\004\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l46;  goto l45;
+  l46:;	  yy->__pos= yypos46; yy->__thunkpos= yythunkpos46;
+  }  if (!yy_char(yy)) goto l45;  goto l44;
+  l45:;	  yy->__pos= yypos45; yy->__thunkpos= yythunkpos45;
+  }  if (!(YY_END)) goto l38;  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\004\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l38;  if (!yy__(yy)) goto l38;
   }
   l39:;	
-  yyprintf((stderr, "  ok   %s @ %s\n", "literal", yybuf+yypos));
+  yyprintf((stderr, "  ok   %s @ %s\n", "literal", yy->__buf+yy->__pos));
   return 1;
-  l38:;	  yypos= yypos0; yythunkpos= yythunkpos0;
-  yyprintf((stderr, "  fail %s @ %s\n", "literal", yybuf+yypos));
+  l38:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "literal", yy->__buf+yy->__pos));
   return 0;
 }
-YY_RULE(int) yy_CLOSE()
-{  int yypos0= yypos, yythunkpos0= yythunkpos;
-  yyprintf((stderr, "%s\n", "CLOSE"));  if (!yymatchChar(')')) goto l47;  if (!yy__()) goto l47;
-  yyprintf((stderr, "  ok   %s @ %s\n", "CLOSE", yybuf+yypos));
+YY_RULE(int) yy_CLOSE(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "CLOSE"));  if (!yymatchChar(yy, ')')) goto l47;  if (!yy__(yy)) goto l47;
+  yyprintf((stderr, "  ok   %s @ %s\n", "CLOSE", yy->__buf+yy->__pos));
   return 1;
-  l47:;	  yypos= yypos0; yythunkpos= yythunkpos0;
-  yyprintf((stderr, "  fail %s @ %s\n", "CLOSE", yybuf+yypos));
+  l47:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "CLOSE", yy->__buf+yy->__pos));
   return 0;
 }
-YY_RULE(int) yy_OPEN()
-{  int yypos0= yypos, yythunkpos0= yythunkpos;
-  yyprintf((stderr, "%s\n", "OPEN"));  if (!yymatchChar('(')) goto l48;  if (!yy__()) goto l48;
-  yyprintf((stderr, "  ok   %s @ %s\n", "OPEN", yybuf+yypos));
+YY_RULE(int) yy_OPEN(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "OPEN"));  if (!yymatchChar(yy, '(')) goto l48;  if (!yy__(yy)) goto l48;
+  yyprintf((stderr, "  ok   %s @ %s\n", "OPEN", yy->__buf+yy->__pos));
   return 1;
-  l48:;	  yypos= yypos0; yythunkpos= yythunkpos0;
-  yyprintf((stderr, "  fail %s @ %s\n", "OPEN", yybuf+yypos));
+  l48:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "OPEN", yy->__buf+yy->__pos));
   return 0;
 }
-YY_RULE(int) yy_COLON()
-{  int yypos0= yypos, yythunkpos0= yythunkpos;
-  yyprintf((stderr, "%s\n", "COLON"));  if (!yymatchChar(':')) goto l49;  if (!yy__()) goto l49;
-  yyprintf((stderr, "  ok   %s @ %s\n", "COLON", yybuf+yypos));
+YY_RULE(int) yy_COLON(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "COLON"));  if (!yymatchChar(yy, ':')) goto l49;  if (!yy__(yy)) goto l49;
+  yyprintf((stderr, "  ok   %s @ %s\n", "COLON", yy->__buf+yy->__pos));
   return 1;
-  l49:;	  yypos= yypos0; yythunkpos= yythunkpos0;
-  yyprintf((stderr, "  fail %s @ %s\n", "COLON", yybuf+yypos));
+  l49:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "COLON", yy->__buf+yy->__pos));
   return 0;
 }
-YY_RULE(int) yy_PLUS()
-{  int yypos0= yypos, yythunkpos0= yythunkpos;
-  yyprintf((stderr, "%s\n", "PLUS"));  if (!yymatchChar('+')) goto l50;  if (!yy__()) goto l50;
-  yyprintf((stderr, "  ok   %s @ %s\n", "PLUS", yybuf+yypos));
+YY_RULE(int) yy_PLUS(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "PLUS"));  if (!yymatchChar(yy, '+')) goto l50;  if (!yy__(yy)) goto l50;
+  yyprintf((stderr, "  ok   %s @ %s\n", "PLUS", yy->__buf+yy->__pos));
   return 1;
-  l50:;	  yypos= yypos0; yythunkpos= yythunkpos0;
-  yyprintf((stderr, "  fail %s @ %s\n", "PLUS", yybuf+yypos));
+  l50:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "PLUS", yy->__buf+yy->__pos));
   return 0;
 }
-YY_RULE(int) yy_STAR()
-{  int yypos0= yypos, yythunkpos0= yythunkpos;
-  yyprintf((stderr, "%s\n", "STAR"));  if (!yymatchChar('*')) goto l51;  if (!yy__()) goto l51;
-  yyprintf((stderr, "  ok   %s @ %s\n", "STAR", yybuf+yypos));
+YY_RULE(int) yy_STAR(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "STAR"));  if (!yymatchChar(yy, '*')) goto l51;  if (!yy__(yy)) goto l51;
+  yyprintf((stderr, "  ok   %s @ %s\n", "STAR", yy->__buf+yy->__pos));
   return 1;
-  l51:;	  yypos= yypos0; yythunkpos= yythunkpos0;
-  yyprintf((stderr, "  fail %s @ %s\n", "STAR", yybuf+yypos));
+  l51:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "STAR", yy->__buf+yy->__pos));
   return 0;
 }
-YY_RULE(int) yy_QUESTION()
-{  int yypos0= yypos, yythunkpos0= yythunkpos;
-  yyprintf((stderr, "%s\n", "QUESTION"));  if (!yymatchChar('?')) goto l52;  if (!yy__()) goto l52;
-  yyprintf((stderr, "  ok   %s @ %s\n", "QUESTION", yybuf+yypos));
+YY_RULE(int) yy_QUESTION(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "QUESTION"));  if (!yymatchChar(yy, '?')) goto l52;  if (!yy__(yy)) goto l52;
+  yyprintf((stderr, "  ok   %s @ %s\n", "QUESTION", yy->__buf+yy->__pos));
   return 1;
-  l52:;	  yypos= yypos0; yythunkpos= yythunkpos0;
-  yyprintf((stderr, "  fail %s @ %s\n", "QUESTION", yybuf+yypos));
+  l52:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "QUESTION", yy->__buf+yy->__pos));
   return 0;
 }
-YY_RULE(int) yy_primary()
-{  int yypos0= yypos, yythunkpos0= yythunkpos;
+YY_RULE(int) yy_primary(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
   yyprintf((stderr, "%s\n", "primary"));
-  {  int yypos54= yypos, yythunkpos54= yythunkpos;  if (!yy_identifier()) goto l55;  yyDo(yy_1_primary, yybegin, yyend);  if (!yy_COLON()) goto l55;  if (!yy_identifier()) goto l55;
-  {  int yypos56= yypos, yythunkpos56= yythunkpos;  if (!yy_EQUAL()) goto l56;  goto l55;
-  l56:;	  yypos= yypos56; yythunkpos= yythunkpos56;
-  }  yyDo(yy_2_primary, yybegin, yyend);  goto l54;
-  l55:;	  yypos= yypos54; yythunkpos= yythunkpos54;  if (!yy_identifier()) goto l57;
-  {  int yypos58= yypos, yythunkpos58= yythunkpos;  if (!yy_EQUAL()) goto l58;  goto l57;
-  l58:;	  yypos= yypos58; yythunkpos= yythunkpos58;
-  }  yyDo(yy_3_primary, yybegin, yyend);  goto l54;
-  l57:;	  yypos= yypos54; yythunkpos= yythunkpos54;  if (!yy_OPEN()) goto l59;  if (!yy_expression()) goto l59;  if (!yy_CLOSE()) goto l59;  goto l54;
-  l59:;	  yypos= yypos54; yythunkpos= yythunkpos54;  if (!yy_literal()) goto l60;  yyDo(yy_4_primary, yybegin, yyend);  goto l54;
-  l60:;	  yypos= yypos54; yythunkpos= yythunkpos54;  if (!yy_class()) goto l61;  yyDo(yy_5_primary, yybegin, yyend);  goto l54;
-  l61:;	  yypos= yypos54; yythunkpos= yythunkpos54;  if (!yy_DOT()) goto l62;  yyDo(yy_6_primary, yybegin, yyend);  goto l54;
-  l62:;	  yypos= yypos54; yythunkpos= yythunkpos54;  if (!yy_action()) goto l63;  yyDo(yy_7_primary, yybegin, yyend);  goto l54;
-  l63:;	  yypos= yypos54; yythunkpos= yythunkpos54;  if (!yy_BEGIN()) goto l64;  yyDo(yy_8_primary, yybegin, yyend);  goto l54;
-  l64:;	  yypos= yypos54; yythunkpos= yythunkpos54;  if (!yy_END()) goto l53;  yyDo(yy_9_primary, yybegin, yyend);
+  {  int yypos54= yy->__pos, yythunkpos54= yy->__thunkpos;  if (!yy_identifier(yy)) goto l55;  yyDo(yy, yy_1_primary, yy->__begin, yy->__end);  if (!yy_COLON(yy)) goto l55;  if (!yy_identifier(yy)) goto l55;
+  {  int yypos56= yy->__pos, yythunkpos56= yy->__thunkpos;  if (!yy_EQUAL(yy)) goto l56;  goto l55;
+  l56:;	  yy->__pos= yypos56; yy->__thunkpos= yythunkpos56;
+  }  yyDo(yy, yy_2_primary, yy->__begin, yy->__end);  goto l54;
+  l55:;	  yy->__pos= yypos54; yy->__thunkpos= yythunkpos54;  if (!yy_identifier(yy)) goto l57;
+  {  int yypos58= yy->__pos, yythunkpos58= yy->__thunkpos;  if (!yy_EQUAL(yy)) goto l58;  goto l57;
+  l58:;	  yy->__pos= yypos58; yy->__thunkpos= yythunkpos58;
+  }  yyDo(yy, yy_3_primary, yy->__begin, yy->__end);  goto l54;
+  l57:;	  yy->__pos= yypos54; yy->__thunkpos= yythunkpos54;  if (!yy_OPEN(yy)) goto l59;  if (!yy_expression(yy)) goto l59;  if (!yy_CLOSE(yy)) goto l59;  goto l54;
+  l59:;	  yy->__pos= yypos54; yy->__thunkpos= yythunkpos54;  if (!yy_literal(yy)) goto l60;  yyDo(yy, yy_4_primary, yy->__begin, yy->__end);  goto l54;
+  l60:;	  yy->__pos= yypos54; yy->__thunkpos= yythunkpos54;  if (!yy_class(yy)) goto l61;  yyDo(yy, yy_5_primary, yy->__begin, yy->__end);  goto l54;
+  l61:;	  yy->__pos= yypos54; yy->__thunkpos= yythunkpos54;  if (!yy_DOT(yy)) goto l62;  yyDo(yy, yy_6_primary, yy->__begin, yy->__end);  goto l54;
+  l62:;	  yy->__pos= yypos54; yy->__thunkpos= yythunkpos54;  if (!yy_action(yy)) goto l63;  yyDo(yy, yy_7_primary, yy->__begin, yy->__end);  goto l54;
+  l63:;	  yy->__pos= yypos54; yy->__thunkpos= yythunkpos54;  if (!yy_BEGIN(yy)) goto l64;  yyDo(yy, yy_8_primary, yy->__begin, yy->__end);  goto l54;
+  l64:;	  yy->__pos= yypos54; yy->__thunkpos= yythunkpos54;  if (!yy_END(yy)) goto l53;  yyDo(yy, yy_9_primary, yy->__begin, yy->__end);
   }
   l54:;	
-  yyprintf((stderr, "  ok   %s @ %s\n", "primary", yybuf+yypos));
+  yyprintf((stderr, "  ok   %s @ %s\n", "primary", yy->__buf+yy->__pos));
   return 1;
-  l53:;	  yypos= yypos0; yythunkpos= yythunkpos0;
-  yyprintf((stderr, "  fail %s @ %s\n", "primary", yybuf+yypos));
+  l53:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "primary", yy->__buf+yy->__pos));
   return 0;
 }
-YY_RULE(int) yy_NOT()
-{  int yypos0= yypos, yythunkpos0= yythunkpos;
-  yyprintf((stderr, "%s\n", "NOT"));  if (!yymatchChar('!')) goto l65;  if (!yy__()) goto l65;
-  yyprintf((stderr, "  ok   %s @ %s\n", "NOT", yybuf+yypos));
+YY_RULE(int) yy_NOT(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "NOT"));  if (!yymatchChar(yy, '!')) goto l65;  if (!yy__(yy)) goto l65;
+  yyprintf((stderr, "  ok   %s @ %s\n", "NOT", yy->__buf+yy->__pos));
   return 1;
-  l65:;	  yypos= yypos0; yythunkpos= yythunkpos0;
-  yyprintf((stderr, "  fail %s @ %s\n", "NOT", yybuf+yypos));
+  l65:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "NOT", yy->__buf+yy->__pos));
   return 0;
 }
-YY_RULE(int) yy_suffix()
-{  int yypos0= yypos, yythunkpos0= yythunkpos;
-  yyprintf((stderr, "%s\n", "suffix"));  if (!yy_primary()) goto l66;
-  {  int yypos67= yypos, yythunkpos67= yythunkpos;
-  {  int yypos69= yypos, yythunkpos69= yythunkpos;  if (!yy_QUESTION()) goto l70;  yyDo(yy_1_suffix, yybegin, yyend);  goto l69;
-  l70:;	  yypos= yypos69; yythunkpos= yythunkpos69;  if (!yy_STAR()) goto l71;  yyDo(yy_2_suffix, yybegin, yyend);  goto l69;
-  l71:;	  yypos= yypos69; yythunkpos= yythunkpos69;  if (!yy_PLUS()) goto l67;  yyDo(yy_3_suffix, yybegin, yyend);
+YY_RULE(int) yy_suffix(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "suffix"));  if (!yy_primary(yy)) goto l66;
+  {  int yypos67= yy->__pos, yythunkpos67= yy->__thunkpos;
+  {  int yypos69= yy->__pos, yythunkpos69= yy->__thunkpos;  if (!yy_QUESTION(yy)) goto l70;  yyDo(yy, yy_1_suffix, yy->__begin, yy->__end);  goto l69;
+  l70:;	  yy->__pos= yypos69; yy->__thunkpos= yythunkpos69;  if (!yy_STAR(yy)) goto l71;  yyDo(yy, yy_2_suffix, yy->__begin, yy->__end);  goto l69;
+  l71:;	  yy->__pos= yypos69; yy->__thunkpos= yythunkpos69;  if (!yy_PLUS(yy)) goto l67;  yyDo(yy, yy_3_suffix, yy->__begin, yy->__end);
   }
   l69:;	  goto l68;
-  l67:;	  yypos= yypos67; yythunkpos= yythunkpos67;
+  l67:;	  yy->__pos= yypos67; yy->__thunkpos= yythunkpos67;
   }
   l68:;	
-  yyprintf((stderr, "  ok   %s @ %s\n", "suffix", yybuf+yypos));
+  yyprintf((stderr, "  ok   %s @ %s\n", "suffix", yy->__buf+yy->__pos));
   return 1;
-  l66:;	  yypos= yypos0; yythunkpos= yythunkpos0;
-  yyprintf((stderr, "  fail %s @ %s\n", "suffix", yybuf+yypos));
+  l66:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "suffix", yy->__buf+yy->__pos));
   return 0;
 }
-YY_RULE(int) yy_action()
-{  int yypos0= yypos, yythunkpos0= yythunkpos;
-  yyprintf((stderr, "%s\n", "action"));  if (!yymatchChar('{')) goto l72;  yyText(yybegin, yyend);  if (!(YY_BEGIN)) goto l72;
+YY_RULE(int) yy_action(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "action"));  if (!yymatchChar(yy, '{')) goto l72;  if (!(YY_BEGIN)) goto l72;
   l73:;	
-  {  int yypos74= yypos, yythunkpos74= yythunkpos;  if (!yy_braces()) goto l74;  goto l73;
-  l74:;	  yypos= yypos74; yythunkpos= yythunkpos74;
-  }  yyText(yybegin, yyend);  if (!(YY_END)) goto l72;  if (!yymatchChar('}')) goto l72;  if (!yy__()) goto l72;
-  yyprintf((stderr, "  ok   %s @ %s\n", "action", yybuf+yypos));
+  {  int yypos74= yy->__pos, yythunkpos74= yy->__thunkpos;  if (!yy_braces(yy)) goto l74;  goto l73;
+  l74:;	  yy->__pos= yypos74; yy->__thunkpos= yythunkpos74;
+  }  if (!(YY_END)) goto l72;  if (!yymatchChar(yy, '}')) goto l72;  if (!yy__(yy)) goto l72;
+  yyprintf((stderr, "  ok   %s @ %s\n", "action", yy->__buf+yy->__pos));
   return 1;
-  l72:;	  yypos= yypos0; yythunkpos= yythunkpos0;
-  yyprintf((stderr, "  fail %s @ %s\n", "action", yybuf+yypos));
+  l72:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "action", yy->__buf+yy->__pos));
   return 0;
 }
-YY_RULE(int) yy_AND()
-{  int yypos0= yypos, yythunkpos0= yythunkpos;
-  yyprintf((stderr, "%s\n", "AND"));  if (!yymatchChar('&')) goto l75;  if (!yy__()) goto l75;
-  yyprintf((stderr, "  ok   %s @ %s\n", "AND", yybuf+yypos));
+YY_RULE(int) yy_AND(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "AND"));  if (!yymatchChar(yy, '&')) goto l75;  if (!yy__(yy)) goto l75;
+  yyprintf((stderr, "  ok   %s @ %s\n", "AND", yy->__buf+yy->__pos));
   return 1;
-  l75:;	  yypos= yypos0; yythunkpos= yythunkpos0;
-  yyprintf((stderr, "  fail %s @ %s\n", "AND", yybuf+yypos));
+  l75:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "AND", yy->__buf+yy->__pos));
   return 0;
 }
-YY_RULE(int) yy_prefix()
-{  int yypos0= yypos, yythunkpos0= yythunkpos;
+YY_RULE(int) yy_prefix(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
   yyprintf((stderr, "%s\n", "prefix"));
-  {  int yypos77= yypos, yythunkpos77= yythunkpos;  if (!yy_AND()) goto l78;  if (!yy_action()) goto l78;  yyDo(yy_1_prefix, yybegin, yyend);  goto l77;
-  l78:;	  yypos= yypos77; yythunkpos= yythunkpos77;  if (!yy_AND()) goto l79;  if (!yy_suffix()) goto l79;  yyDo(yy_2_prefix, yybegin, yyend);  goto l77;
-  l79:;	  yypos= yypos77; yythunkpos= yythunkpos77;  if (!yy_NOT()) goto l80;  if (!yy_suffix()) goto l80;  yyDo(yy_3_prefix, yybegin, yyend);  goto l77;
-  l80:;	  yypos= yypos77; yythunkpos= yythunkpos77;  if (!yy_suffix()) goto l76;
+  {  int yypos77= yy->__pos, yythunkpos77= yy->__thunkpos;  if (!yy_AND(yy)) goto l78;  if (!yy_action(yy)) goto l78;  yyDo(yy, yy_1_prefix, yy->__begin, yy->__end);  goto l77;
+  l78:;	  yy->__pos= yypos77; yy->__thunkpos= yythunkpos77;  if (!yy_AND(yy)) goto l79;  if (!yy_suffix(yy)) goto l79;  yyDo(yy, yy_2_prefix, yy->__begin, yy->__end);  goto l77;
+  l79:;	  yy->__pos= yypos77; yy->__thunkpos= yythunkpos77;  if (!yy_NOT(yy)) goto l80;  if (!yy_suffix(yy)) goto l80;  yyDo(yy, yy_3_prefix, yy->__begin, yy->__end);  goto l77;
+  l80:;	  yy->__pos= yypos77; yy->__thunkpos= yythunkpos77;  if (!yy_suffix(yy)) goto l76;
   }
   l77:;	
-  yyprintf((stderr, "  ok   %s @ %s\n", "prefix", yybuf+yypos));
+  yyprintf((stderr, "  ok   %s @ %s\n", "prefix", yy->__buf+yy->__pos));
   return 1;
-  l76:;	  yypos= yypos0; yythunkpos= yythunkpos0;
-  yyprintf((stderr, "  fail %s @ %s\n", "prefix", yybuf+yypos));
+  l76:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "prefix", yy->__buf+yy->__pos));
   return 0;
 }
-YY_RULE(int) yy_BAR()
-{  int yypos0= yypos, yythunkpos0= yythunkpos;
-  yyprintf((stderr, "%s\n", "BAR"));  if (!yymatchChar('|')) goto l81;  if (!yy__()) goto l81;
-  yyprintf((stderr, "  ok   %s @ %s\n", "BAR", yybuf+yypos));
+YY_RULE(int) yy_BAR(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "BAR"));  if (!yymatchChar(yy, '|')) goto l81;  if (!yy__(yy)) goto l81;
+  yyprintf((stderr, "  ok   %s @ %s\n", "BAR", yy->__buf+yy->__pos));
   return 1;
-  l81:;	  yypos= yypos0; yythunkpos= yythunkpos0;
-  yyprintf((stderr, "  fail %s @ %s\n", "BAR", yybuf+yypos));
+  l81:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "BAR", yy->__buf+yy->__pos));
   return 0;
 }
-YY_RULE(int) yy_sequence()
-{  int yypos0= yypos, yythunkpos0= yythunkpos;
-  yyprintf((stderr, "%s\n", "sequence"));  if (!yy_prefix()) goto l82;
+YY_RULE(int) yy_sequence(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "sequence"));  if (!yy_prefix(yy)) goto l82;
   l83:;	
-  {  int yypos84= yypos, yythunkpos84= yythunkpos;  if (!yy_prefix()) goto l84;  yyDo(yy_1_sequence, yybegin, yyend);  goto l83;
-  l84:;	  yypos= yypos84; yythunkpos= yythunkpos84;
+  {  int yypos84= yy->__pos, yythunkpos84= yy->__thunkpos;  if (!yy_prefix(yy)) goto l84;  yyDo(yy, yy_1_sequence, yy->__begin, yy->__end);  goto l83;
+  l84:;	  yy->__pos= yypos84; yy->__thunkpos= yythunkpos84;
   }
-  yyprintf((stderr, "  ok   %s @ %s\n", "sequence", yybuf+yypos));
+  yyprintf((stderr, "  ok   %s @ %s\n", "sequence", yy->__buf+yy->__pos));
   return 1;
-  l82:;	  yypos= yypos0; yythunkpos= yythunkpos0;
-  yyprintf((stderr, "  fail %s @ %s\n", "sequence", yybuf+yypos));
+  l82:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "sequence", yy->__buf+yy->__pos));
   return 0;
 }
-YY_RULE(int) yy_SEMICOLON()
-{  int yypos0= yypos, yythunkpos0= yythunkpos;
-  yyprintf((stderr, "%s\n", "SEMICOLON"));  if (!yymatchChar(';')) goto l85;  if (!yy__()) goto l85;
-  yyprintf((stderr, "  ok   %s @ %s\n", "SEMICOLON", yybuf+yypos));
+YY_RULE(int) yy_SEMICOLON(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "SEMICOLON"));  if (!yymatchChar(yy, ';')) goto l85;  if (!yy__(yy)) goto l85;
+  yyprintf((stderr, "  ok   %s @ %s\n", "SEMICOLON", yy->__buf+yy->__pos));
   return 1;
-  l85:;	  yypos= yypos0; yythunkpos= yythunkpos0;
-  yyprintf((stderr, "  fail %s @ %s\n", "SEMICOLON", yybuf+yypos));
+  l85:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "SEMICOLON", yy->__buf+yy->__pos));
   return 0;
 }
-YY_RULE(int) yy_expression()
-{  int yypos0= yypos, yythunkpos0= yythunkpos;
-  yyprintf((stderr, "%s\n", "expression"));  if (!yy_sequence()) goto l86;
+YY_RULE(int) yy_expression(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "expression"));  if (!yy_sequence(yy)) goto l86;
   l87:;	
-  {  int yypos88= yypos, yythunkpos88= yythunkpos;  if (!yy_BAR()) goto l88;  if (!yy_sequence()) goto l88;  yyDo(yy_1_expression, yybegin, yyend);  goto l87;
-  l88:;	  yypos= yypos88; yythunkpos= yythunkpos88;
+  {  int yypos88= yy->__pos, yythunkpos88= yy->__thunkpos;  if (!yy_BAR(yy)) goto l88;  if (!yy_sequence(yy)) goto l88;  yyDo(yy, yy_1_expression, yy->__begin, yy->__end);  goto l87;
+  l88:;	  yy->__pos= yypos88; yy->__thunkpos= yythunkpos88;
   }
-  yyprintf((stderr, "  ok   %s @ %s\n", "expression", yybuf+yypos));
+  yyprintf((stderr, "  ok   %s @ %s\n", "expression", yy->__buf+yy->__pos));
   return 1;
-  l86:;	  yypos= yypos0; yythunkpos= yythunkpos0;
-  yyprintf((stderr, "  fail %s @ %s\n", "expression", yybuf+yypos));
+  l86:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "expression", yy->__buf+yy->__pos));
   return 0;
 }
-YY_RULE(int) yy_EQUAL()
-{  int yypos0= yypos, yythunkpos0= yythunkpos;
-  yyprintf((stderr, "%s\n", "EQUAL"));  if (!yymatchChar('=')) goto l89;  if (!yy__()) goto l89;
-  yyprintf((stderr, "  ok   %s @ %s\n", "EQUAL", yybuf+yypos));
+YY_RULE(int) yy_EQUAL(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "EQUAL"));  if (!yymatchChar(yy, '=')) goto l89;  if (!yy__(yy)) goto l89;
+  yyprintf((stderr, "  ok   %s @ %s\n", "EQUAL", yy->__buf+yy->__pos));
   return 1;
-  l89:;	  yypos= yypos0; yythunkpos= yythunkpos0;
-  yyprintf((stderr, "  fail %s @ %s\n", "EQUAL", yybuf+yypos));
+  l89:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "EQUAL", yy->__buf+yy->__pos));
   return 0;
 }
-YY_RULE(int) yy_identifier()
-{  int yypos0= yypos, yythunkpos0= yythunkpos;
-  yyprintf((stderr, "%s\n", "identifier"));  yyText(yybegin, yyend);  if (!(YY_BEGIN)) goto l90;  if (!yymatchClass((unsigned char *)"\000\000\000\000\000\040\000\000\376\377\377\207\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l90;
+YY_RULE(int) yy_identifier(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "identifier"));  if (!(YY_BEGIN)) goto l90;  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\000\040\000\000\376\377\377\207\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l90;
   l91:;	
-  {  int yypos92= yypos, yythunkpos92= yythunkpos;  if (!yymatchClass((unsigned char *)"\000\000\000\000\000\040\377\003\376\377\377\207\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l92;  goto l91;
-  l92:;	  yypos= yypos92; yythunkpos= yythunkpos92;
-  }  yyText(yybegin, yyend);  if (!(YY_END)) goto l90;  if (!yy__()) goto l90;
-  yyprintf((stderr, "  ok   %s @ %s\n", "identifier", yybuf+yypos));
+  {  int yypos92= yy->__pos, yythunkpos92= yy->__thunkpos;  if (!yymatchClass(yy, (unsigned char *)"\000\000\000\000\000\040\377\003\376\377\377\207\376\377\377\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000")) goto l92;  goto l91;
+  l92:;	  yy->__pos= yypos92; yy->__thunkpos= yythunkpos92;
+  }  if (!(YY_END)) goto l90;  if (!yy__(yy)) goto l90;
+  yyprintf((stderr, "  ok   %s @ %s\n", "identifier", yy->__buf+yy->__pos));
+  return 1;
+  l90:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "identifier", yy->__buf+yy->__pos));
+  return 0;
+}
+YY_RULE(int) yy_MEMO(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "MEMO"));  if (!yymatchString(yy, "%memo")) goto l93;  if (!yy__(yy)) goto l93;
+  yyprintf((stderr, "  ok   %s @ %s\n", "MEMO", yy->__buf+yy->__pos));
   return 1;
-  l90:;	  yypos= yypos0; yythunkpos= yythunkpos0;
-  yyprintf((stderr, "  fail %s @ %s\n", "identifier", yybuf+yypos));
+  l93:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "MEMO", yy->__buf+yy->__pos));
   return 0;
 }
-YY_RULE(int) yy_RPERCENT()
-{  int yypos0= yypos, yythunkpos0= yythunkpos;
-  yyprintf((stderr, "%s\n", "RPERCENT"));  if (!yymatchString("%}")) goto l93;  if (!yy__()) goto l93;
-  yyprintf((stderr, "  ok   %s @ %s\n", "RPERCENT", yybuf+yypos));
+YY_RULE(int) yy_RPERCENT(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "RPERCENT"));  if (!yymatchString(yy, "%}")) goto l94;  if (!yy__(yy)) goto l94;
+  yyprintf((stderr, "  ok   %s @ %s\n", "RPERCENT", yy->__buf+yy->__pos));
   return 1;
-  l93:;	  yypos= yypos0; yythunkpos= yythunkpos0;
-  yyprintf((stderr, "  fail %s @ %s\n", "RPERCENT", yybuf+yypos));
+  l94:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "RPERCENT", yy->__buf+yy->__pos));
   return 0;
 }
-YY_RULE(int) yy_end_of_file()
-{  int yypos0= yypos, yythunkpos0= yythunkpos;
+YY_RULE(int) yy_end_of_file(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
   yyprintf((stderr, "%s\n", "end_of_file"));
-  {  int yypos95= yypos, yythunkpos95= yythunkpos;  if (!yymatchDot()) goto l95;  goto l94;
-  l95:;	  yypos= yypos95; yythunkpos= yythunkpos95;
+  {  int yypos96= yy->__pos, yythunkpos96= yy->__thunkpos;  if (!yymatchDot(yy)) goto l96;  goto l95;
+  l96:;	  yy->__pos= yypos96; yy->__thunkpos= yythunkpos96;
   }
-  yyprintf((stderr, "  ok   %s @ %s\n", "end_of_file", yybuf+yypos));
+  yyprintf((stderr, "  ok   %s @ %s\n", "end_of_file", yy->__buf+yy->__pos));
+  return 1;
+  l95:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "end_of_file", yy->__buf+yy->__pos));
+  return 0;
+}
+YY_RULE(int) yy_trailer(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "trailer"));  if (!yymatchString(yy, "%%")) goto l97;  if (!(YY_BEGIN)) goto l97;
+  l98:;	
+  {  int yypos99= yy->__pos, yythunkpos99= yy->__thunkpos;  if (!yymatchDot(yy)) goto l99;  goto l98;
+  l99:;	  yy->__pos= yypos99; yy->__thunkpos= yythunkpos99;
+  }  if (!(YY_END)) goto l97;  yyDo(yy, yy_1_trailer, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "trailer", yy->__buf+yy->__pos));
   return 1;
-  l94:;	  yypos= yypos0; yythunkpos= yythunkpos0;
-  yyprintf((stderr, "  fail %s @ %s\n", "end_of_file", yybuf+yypos));
+  l97:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "trailer", yy->__buf+yy->__pos));
   return 0;
 }
-YY_RULE(int) yy_trailer()
-{  int yypos0= yypos, yythunkpos0= yythunkpos;
-  yyprintf((stderr, "%s\n", "trailer"));  if (!yymatchString("%%")) goto l96;  yyText(yybegin, yyend);  if (!(YY_BEGIN)) goto l96;
-  l97:;	
-  {  int yypos98= yypos, yythunkpos98= yythunkpos;  if (!yymatchDot()) goto l98;  goto l97;
-  l98:;	  yypos= yypos98; yythunkpos= yythunkpos98;
-  }  yyText(yybegin, yyend);  if (!(YY_END)) goto l96;  yyDo(yy_1_trailer, yybegin, yyend);
-  yyprintf((stderr, "  ok   %s @ %s\n", "trailer", yybuf+yypos));
+YY_RULE(int) yy_definition(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "definition"));  if (!yy_identifier(yy)) goto l100;  yyDo(yy, yy_1_definition, yy->__begin, yy->__end);  if (!yy_EQUAL(yy)) goto l100;  if (!yy_expression(yy)) goto l100;  yyDo(yy, yy_2_definition, yy->__begin, yy->__end);
+  {  int yypos101= yy->__pos, yythunkpos101= yy->__thunkpos;  if (!yy_SEMICOLON(yy)) goto l101;  goto l102;
+  l101:;	  yy->__pos= yypos101; yy->__thunkpos= yythunkpos101;
+  }
+  l102:;	
+  yyprintf((stderr, "  ok   %s @ %s\n", "definition", yy->__buf+yy->__pos));
   return 1;
-  l96:;	  yypos= yypos0; yythunkpos= yythunkpos0;
-  yyprintf((stderr, "  fail %s @ %s\n", "trailer", yybuf+yypos));
+  l100:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "definition", yy->__buf+yy->__pos));
   return 0;
 }
-YY_RULE(int) yy_definition()
-{  int yypos0= yypos, yythunkpos0= yythunkpos;
-  yyprintf((stderr, "%s\n", "definition"));  if (!yy_identifier()) goto l99;  yyDo(yy_1_definition, yybegin, yyend);  if (!yy_EQUAL()) goto l99;  if (!yy_expression()) goto l99;  yyDo(yy_2_definition, yybegin, yyend);
-  {  int yypos100= yypos, yythunkpos100= yythunkpos;  if (!yy_SEMICOLON()) goto l100;  goto l101;
-  l100:;	  yypos= yypos100; yythunkpos= yythunkpos100;
+YY_RULE(int) yy_memo(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "memo"));  if (!yy_MEMO(yy)) goto l103;  if (!yy_identifier(yy)) goto l103;
+  {  int yypos106= yy->__pos, yythunkpos106= yy->__thunkpos;  if (!yy_EQUAL(yy)) goto l106;  goto l103;
+  l106:;	  yy->__pos= yypos106; yy->__thunkpos= yythunkpos106;
+  }  yyDo(yy, yy_1_memo, yy->__begin, yy->__end);
+  l104:;	
+  {  int yypos105= yy->__pos, yythunkpos105= yy->__thunkpos;  if (!yy_identifier(yy)) goto l105;
+  {  int yypos107= yy->__pos, yythunkpos107= yy->__thunkpos;  if (!yy_EQUAL(yy)) goto l107;  goto l105;
+  l107:;	  yy->__pos= yypos107; yy->__thunkpos= yythunkpos107;
+  }  yyDo(yy, yy_1_memo, yy->__begin, yy->__end);  goto l104;
+  l105:;	  yy->__pos= yypos105; yy->__thunkpos= yythunkpos105;
   }
-  l101:;	
-  yyprintf((stderr, "  ok   %s @ %s\n", "definition", yybuf+yypos));
+  yyprintf((stderr, "  ok   %s @ %s\n", "memo", yy->__buf+yy->__pos));
   return 1;
-  l99:;	  yypos= yypos0; yythunkpos= yythunkpos0;
-  yyprintf((stderr, "  fail %s @ %s\n", "definition", yybuf+yypos));
+  l103:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "memo", yy->__buf+yy->__pos));
   return 0;
 }
-YY_RULE(int) yy_declaration()
-{  int yypos0= yypos, yythunkpos0= yythunkpos;
-  yyprintf((stderr, "%s\n", "declaration"));  if (!yymatchString("%{")) goto l102;  yyText(yybegin, yyend);  if (!(YY_BEGIN)) goto l102;
-  l103:;	
-  {  int yypos104= yypos, yythunkpos104= yythunkpos;
-  {  int yypos105= yypos, yythunkpos105= yythunkpos;  if (!yymatchString("%}")) goto l105;  goto l104;
-  l105:;	  yypos= yypos105; yythunkpos= yythunkpos105;
-  }  if (!yymatchDot()) goto l104;  goto l103;
-  l104:;	  yypos= yypos104; yythunkpos= yythunkpos104;
-  }  yyText(yybegin, yyend);  if (!(YY_END)) goto l102;  if (!yy_RPERCENT()) goto l102;  yyDo(yy_1_declaration, yybegin, yyend);
-  yyprintf((stderr, "  ok   %s @ %s\n", "declaration", yybuf+yypos));
+YY_RULE(int) yy_declaration(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "declaration"));  if (!yymatchString(yy, "%{")) goto l108;  if (!(YY_BEGIN)) goto l108;
+  l109:;	
+  {  int yypos110= yy->__pos, yythunkpos110= yy->__thunkpos;
+  {  int yypos111= yy->__pos, yythunkpos111= yy->__thunkpos;  if (!yymatchString(yy, "%}")) goto l111;  goto l110;
+  l111:;	  yy->__pos= yypos111; yy->__thunkpos= yythunkpos111;
+  }  if (!yymatchDot(yy)) goto l110;  goto l109;
+  l110:;	  yy->__pos= yypos110; yy->__thunkpos= yythunkpos110;
+  }  if (!(YY_END)) goto l108;  if (!yy_RPERCENT(yy)) goto l108;  yyDo(yy, yy_1_declaration, yy->__begin, yy->__end);
+  yyprintf((stderr, "  ok   %s @ %s\n", "declaration", yy->__buf+yy->__pos));
   return 1;
-  l102:;	  yypos= yypos0; yythunkpos= yythunkpos0;
-  yyprintf((stderr, "  fail %s @ %s\n", "declaration", yybuf+yypos));
+  l108:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "declaration", yy->__buf+yy->__pos));
   return 0;
 }
-YY_RULE(int) yy__()
+YY_RULE(int) yy__(yycontext *yy)
 {
   yyprintf((stderr, "%s\n", "_"));
-  l107:;	
-  {  int yypos108= yypos, yythunkpos108= yythunkpos;
-  {  int yypos109= yypos, yythunkpos109= yythunkpos;  if (!yy_space()) goto l110;  goto l109;
-  l110:;	  yypos= yypos109; yythunkpos= yythunkpos109;  if (!yy_comment()) goto l108;
+  l113:;	
+  {  int yypos114= yy->__pos, yythunkpos114= yy->__thunkpos;
+  {  int yypos115= yy->__pos, yythunkpos115= yy->__thunkpos;  if (!yy_space(yy)) goto l116;  goto l115;
+  l116:;	  yy->__pos= yypos115; yy->__thunkpos= yythunkpos115;  if (!yy_comment(yy)) goto l114;
   }
-  l109:;	  goto l107;
-  l108:;	  yypos= yypos108; yythunkpos= yythunkpos108;
+  l115:;	  goto l113;
+  l114:;	  yy->__pos= yypos114; yy->__thunkpos= yythunkpos114;
   }
-  yyprintf((stderr, "  ok   %s @ %s\n", "_", yybuf+yypos));
+  yyprintf((stderr, "  ok   %s @ %s\n", "_", yy->__buf+yy->__pos));
   return 1;
 }
-YY_RULE(int) yy_grammar()
-{  int yypos0= yypos, yythunkpos0= yythunkpos;
-  yyprintf((stderr, "%s\n", "grammar"));  if (!yy__()) goto l111;
-  {  int yypos114= yypos, yythunkpos114= yythunkpos;  if (!yy_declaration()) goto l115;  goto l114;
-  l115:;	  yypos= yypos114; yythunkpos= yythunkpos114;  if (!yy_definition()) goto l111;
+YY_RULE(int) yy_grammar(yycontext *yy)
+{  int yypos0= yy->__pos, yythunkpos0= yy->__thunkpos;
+  yyprintf((stderr, "%s\n", "grammar"));  if (!yy__(yy)) goto l117;
+  {  int yypos120= yy->__pos, yythunkpos120= yy->__thunkpos;  if (!yy_declaration(yy)) goto l121;  goto l120;
+  l121:;	  yy->__pos= yypos120; yy->__thunkpos= yythunkpos120;  if (!yy_memo(yy)) goto l122;  goto l120;
+  l122:;	  yy->__pos= yypos120; yy->__thunkpos= yythunkpos120;  if (!yy_definition(yy)) goto l117;
   }
-  l114:;	
-  l112:;	
-  {  int yypos113= yypos, yythunkpos113= yythunkpos;
-  {  int yypos116= yypos, yythunkpos116= yythunkpos;  if (!yy_declaration()) goto l117;  goto l116;
-  l117:;	  yypos= yypos116; yythunkpos= yythunkpos116;  if (!yy_definition()) goto l113;
+  l120:;	
+  l118:;	
+  {  int yypos119= yy->__pos, yythunkpos119= yy->__thunkpos;
+  {  int yypos123= yy->__pos, yythunkpos123= yy->__thunkpos;  if (!yy_declaration(yy)) goto l124;  goto l123;
+  l124:;	  yy->__pos= yypos123; yy->__thunkpos= yythunkpos123;  if (!yy_memo(yy)) goto l125;  goto l123;
+  l125:;	  yy->__pos= yypos123; yy->__thunkpos= yythunkpos123;  if (!yy_definition(yy)) goto l119;
   }
-  l116:;	  goto l112;
-  l113:;	  yypos= yypos113; yythunkpos= yythunkpos113;
+  l123:;	  goto l118;
+  l119:;	  yy->__pos= yypos119; yy->__thunkpos= yythunkpos119;
   }
-  {  int yypos118= yypos, yythunkpos118= yythunkpos;  if (!yy_trailer()) goto l118;  goto l119;
-  l118:;	  yypos= yypos118; yythunkpos= yythunkpos118;
+  {  int yypos126= yy->__pos, yythunkpos126= yy->__thunkpos;  if (!yy_trailer(yy)) goto l126;  goto l127;
+  l126:;	  yy->__pos= yypos126; yy->__thunkpos= yythunkpos126;
   }
-  l119:;	  if (!yy_end_of_file()) goto l111;
-  yyprintf((stderr, "  ok   %s @ %s\n", "grammar", yybuf+yypos));
+  l127:;	  if (!yy_end_of_file(yy)) goto l117;
+  yyprintf((stderr, "  ok   %s @ %s\n", "grammar", yy->__buf+yy->__pos));
   return 1;
-  l111:;	  yypos= yypos0; yythunkpos= yythunkpos0;
-  yyprintf((stderr, "  fail %s @ %s\n", "grammar", yybuf+yypos));
+  l117:;	  yy->__pos= yypos0; yy->__thunkpos= yythunkpos0;
+  yyprintf((stderr, "  fail %s @ %s\n", "grammar", yy->__buf+yy->__pos));
   return 0;
 }
 
 #ifndef YY_PART
 
-typedef int (*yyrule)();
+typedef int (*yyrule)(yycontext *yy);
 
-YY_PARSE(int) YYPARSEFROM(yyrule yystart)
+#ifdef YY_CTX_LOCAL
+#define YY_CTX_PARAM_	yycontext *yyctx,
+#define YY_CTX_PARAM	yycontext *yyctx
+#define YY_CTX_ARG_	yyctx,
+#define YY_CTX_ARG	yyctx
+#else
+#define YY_CTX_PARAM_
+#define YY_CTX_PARAM	void
+#define YY_CTX_ARG_
+#define YY_CTX_ARG
+static yycontext  yyctx0;
+static yycontext *yyctx= &yyctx0;
+#endif
+
+YY_PARSE(int) YYPARSEFROM(YY_CTX_PARAM_ yyrule yystart)
 {
   int yyok;
-  if (!yybuflen)
+  if (!yyctx->__textlen)
     {
-      yybuflen= 1024;
-      yybuf= malloc(yybuflen);
-      yytextlen= 1024;
-      yytext= malloc(yytextlen);
-      yythunkslen= 32;
-      yythunks= malloc(sizeof(yythunk) * yythunkslen);
-      yyvalslen= 32;
-      yyvals= malloc(sizeof(YYSTYPE) * yyvalslen);
-      yybegin= yyend= yypos= yylimit= yythunkpos= 0;
+#ifndef YY_BUFFER
+      yyctx->__buflen= 1024;
+      yyctx->__buf= malloc(yyctx->__buflen);
+#endif
+      yyctx->__textlen= 1024;
+      yyctx->__text= malloc(yyctx->__textlen);
+      yyctx->__thunkslen= 32;
+      yyctx->__thunks= malloc(sizeof(yythunk) * yyctx->__thunkslen);
+      yyctx->__valslen= 32;
+      yyctx->__vals= malloc(sizeof(YYSTYPE) * yyctx->__valslen);
+      yyctx->__begin= yyctx->__end= yyctx->__pos= yyctx->__limit= yyctx->__thunkpos= 0;
     }
-  yybegin= yyend= yypos;
-  yythunkpos= 0;
-  yyval= yyvals;
-  yyok= yystart();
-  if (yyok) yyDone();
-  yyCommit();
+#ifdef YY_BUFFER
+  yyctx->__buf= YY_BUFFER;
+  yyctx->__limit= strlen(yyctx->__buf);
+  yyctx->__pos= 0;
+#endif
+  yyctx->__begin= yyctx->__end= yyctx->__pos;
+  yyctx->__thunkpos= 0;
+#ifdef YY_MEMO
+  yyMemoClear(yyctx);
+#endif
+  yyctx->__val= yyctx->__vals;
+  yyok= yystart(yyctx);
+  if (yyok) yyDone(yyctx);
+  yyCommit(yyctx);
   return yyok;
   (void)yyrefill;
   (void)yymatchDot;
@@ -924,31 +1333,49 @@ YY_PARSE(int) YYPARSEFROM(yyrule yystart)
   (void)yyPush;
   (void)yyPop;
   (void)yySet;
-  (void)yytextmax;
 }
 
-YY_PARSE(int) YYPARSE(void)
+YY_PARSE(int) YYPARSE(YY_CTX_PARAM)
+{
+  return YYPARSEFROM(YY_CTX_ARG_ yy_grammar);
+}
+
+#ifdef YY_CTX_LOCAL
+
+YY_PARSE(void) YYRELEASE(yycontext *yyctx)
 {
-  return YYPARSEFROM(yy_grammar);
+#ifndef YY_BUFFER
+  free(yyctx->__buf);
+#endif
+  free(yyctx->__text);
+  free(yyctx->__thunks);
+  free(yyctx->__vals);
+#ifdef YY_MEMO
+  free(yyctx->__memos);
+  free(yyctx->__memothunks);
+#endif
+  memset(yyctx, 0, sizeof(yycontext));
 }
 
 #endif
 
+#endif
+
 
 void yyerror(char *message)
 {
   fprintf(stderr, "%s:%d: %s", fileName, lineNumber, message);
-  if (yytext[0]) fprintf(stderr, " near token '%s'", yytext);
-  if (yypos < yylimit || !feof(input))
+  if (yyctx->__text[0]) fprintf(stderr, " near token '%s'", yyctx->__text);
+  if (yyctx->__pos < yyctx->__limit || !feof(input))
     {
-      yybuf[yylimit]= '\0';
+      yyctx->__buf[yyctx->__limit]= '\0';
       fprintf(stderr, " before text \"");
-      while (yypos < yylimit)
+      while (yyctx->__pos < yyctx->__limit)
 	{
-	  if ('\n' == yybuf[yypos] || '\r' == yybuf[yypos]) break;
-	  fputc(yybuf[yypos++], stderr);
+	  if ('\n' == yyctx->__buf[yyctx->__pos] || '\r' == yyctx->__buf[yyctx->__pos]) break;
+	  fputc(yyctx->__buf[yyctx->__pos++], stderr);
 	}
-      if (yypos == yylimit)
+      if (yyctx->__pos == yyctx->__limit)
 	{
 	  int c;
 	  while (EOF != (c= fgetc(input)) && '\n' != c && '\r' != c)
@@ -150,7 +150,7 @@ Node *makeAction(char *text)
     char *ptr;
     for (ptr= node->action.text;  *ptr;  ++ptr)
       if ('$' == ptr[0] && '$' == ptr[1])
-	ptr[1]= ptr[0]= 'y';
+	ptr[1]= ptr[0]= '_';
   }
   return node;
 }
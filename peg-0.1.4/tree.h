@@ -23,6 +23,7 @@ enum { Unknown= 0, Rule, Variable, Name, Dot, Character, String, Class, Action,
 enum {
   RuleUsed	= 1<<0,
   RuleReached	= 1<<1,
+  RuleMemo	= 1<<2,
 };
 
 typedef union Node Node;
@@ -0,0 +1,368 @@
+/* tree_file.c - Compact binary files of parsed documents, so that a
+ * document parsed by one process can be printed by another without being
+ * parsed again.
+ *
+ * A file holds a header, then every element of the tree as a record in a
+ * flat array, then the link records, then a pool of NUL-terminated
+ * strings.  Records refer to each other by index, and to strings by
+ * offset in the pool, with TREE_NONE standing for NULL.  Elements that are
+ * shared in the tree (such as a note and the citations of it) are stored
+ * once.  Every element comes before all the elements it refers to, so
+ * that a file whose references do not all point forward, which might
+ * hold a cycle, can be rejected on load.  A loaded file is used in place:
+ * the strings are read straight from the mapped file, and only the
+ * element and link structs the writers expect are built over it, in one
+ * allocation.
+ *
+ * Records are stored in the byte order of the machine that wrote them;
+ * a file from a machine of the other byte order is rejected. */
+
+#include <stdint.h>
+
+#define TREE_MAGIC "MMDTREE"            /* With its NUL, 8 bytes. */
+#define TREE_VERSION 3
+#define TREE_BYTE_ORDER 0x01020304
+#define TREE_NONE (-1)
+
+typedef struct {
+    char magic[8];
+    uint32_t byte_order;
+    uint32_t version;
+    uint32_t key_count;         /* Number of element keys the writer knew. */
+    int32_t extensions;         /* Extensions the document was parsed with. */
+    uint32_t node_count;
+    uint32_t link_count;
+    uint32_t pool_size;
+    int32_t root;               /* First element of the document. */
+    int32_t text;               /* Preformatted text, for reparsing as OPML. */
+} tree_header;
+
+typedef struct {
+    int32_t key;
+    int32_t len;
+    int32_t contents;           /* Link index for links, else string offset. */
+    int32_t children;
+    int32_t next;
+} tree_node;
+
+typedef struct {
+    int32_t label;
+    int32_t url;
+    int32_t title;
+    int32_t attr;
+    int32_t identifier;
+} tree_link;
+
+/* tree_writer - what saving a tree has gathered so far */
+typedef struct {
+    element **nodes;            /* Elements in reverse index order. */
+    int node_count;
+    int node_size;
+    element **slots;            /* Open-addressed index of every element
+                                   seen, numbered or not. */
+    int *slot_index;            /* Position in 'nodes', or -1. */
+    int slot_size;
+    int slot_count;
+    element **pending;          /* Elements seen but not yet numbered. */
+    int pending_count;
+    int pending_size;
+    int link_count;
+    GString *pool;
+} tree_writer;
+
+/* has_link - true if elements with 'key' hold a link rather than a string */
+static bool has_link(int key) {
+    return key == LINK || key == IMAGE || key == IMAGEBLOCK || key == REFERENCE;
+}
+
+/* pointer_slot - first slot to try for 'ptr' in a table of 'size' slots.
+ * Elements come from an arena, so their addresses are mostly consecutive;
+ * they are scattered so that they do not fill runs of adjacent slots. */
+static size_t pointer_slot(void *ptr, int size) {
+    return (size_t)(((uint64_t)(size_t)ptr * 0x9E3779B97F4A7C15ULL) >> 32) & (size - 1);
+}
+
+/* node_slot - slot of 'elt' in the index, or -1 if it has not been seen */
+static long node_slot(tree_writer *w, element *elt) {
+    size_t slot;
+
+    if (w->slot_size == 0)
+        return -1;
+    slot = pointer_slot(elt, w->slot_size);
+    while (w->slots[slot] != NULL) {
+        if (w->slots[slot] == elt)
+            return (long)slot;
+        slot = (slot + 1) & (w->slot_size - 1);
+    }
+    return -1;
+}
+
+/* add_node - record that 'elt' has been seen, without numbering it */
+static void add_node(tree_writer *w, element *elt) {
+    element **old_slots;
+    int *old_index;
+    int old_size;
+    size_t slot;
+    int i;
+
+    if (2 * (w->slot_count + 1) > w->slot_size) {
+        old_slots = w->slots;
+        old_index = w->slot_index;
+        old_size = w->slot_size;
+        w->slot_size = old_size ? 2 * old_size : 1024;
+        w->slots = calloc(w->slot_size, sizeof(element *));
+        w->slot_index = malloc(w->slot_size * sizeof(int));
+        for (i = 0; i < old_size; i++) {
+            if (old_slots[i] == NULL)
+                continue;
+            slot = pointer_slot(old_slots[i], w->slot_size);
+            while (w->slots[slot] != NULL)
+                slot = (slot + 1) & (w->slot_size - 1);
+            w->slots[slot] = old_slots[i];
+            w->slot_index[slot] = old_index[i];
+        }
+        free(old_slots);
+        free(old_index);
+    }
+    slot = pointer_slot(elt, w->slot_size);
+    while (w->slots[slot] != NULL)
+        slot = (slot + 1) & (w->slot_size - 1);
+    w->slots[slot] = elt;
+    w->slot_index[slot] = -1;
+    w->slot_count++;
+}
+
+/* number_node - give 'elt', which has been seen, the next position */
+static void number_node(tree_writer *w, element *elt) {
+    if (w->node_count == w->node_size) {
+        w->node_size = w->node_size ? 2 * w->node_size : 1024;
+        w->nodes = realloc(w->nodes, w->node_size * sizeof(element *));
+    }
+    w->slot_index[node_slot(w, elt)] = w->node_count;
+    w->nodes[w->node_count++] = elt;
+}
+
+/* number_elements - give every element reachable from 'list' a position
+ * in 'nodes' after all the elements it refers to.  The elements of 'list'
+ * itself are set aside and numbered from its end, so that long lists do
+ * not recurse. */
+static void number_elements(tree_writer *w, element *list) {
+    int base = w->pending_count;
+    element *elt;
+
+    for (; list != NULL && node_slot(w, list) < 0; list = list->next) {
+        add_node(w, list);
+        if (w->pending_count == w->pending_size) {
+            w->pending_size = w->pending_size ? 2 * w->pending_size : 1024;
+            w->pending = realloc(w->pending, w->pending_size * sizeof(element *));
+        }
+        w->pending[w->pending_count++] = list;
+    }
+    while (w->pending_count > base) {
+        elt = w->pending[w->pending_count - 1];
+        if (has_link(elt->key)) {
+            w->link_count++;
+            number_elements(w, elt->contents.link->label);
+            number_elements(w, elt->contents.link->attr);
+        }
+        number_elements(w, elt->children);
+        number_node(w, elt);
+        w->pending_count--;
+    }
+}
+
+/* node_index - index of 'elt' in the file, once every element has been
+ * numbered.  Positions are reversed, so that elements come before the
+ * elements they refer to. */
+static int node_index(tree_writer *w, element *elt) {
+    return w->node_count - 1 - w->slot_index[node_slot(w, elt)];
+}
+
+/* pool_string - add 'len' characters of 'str' to the pool, returning
+ * their offset */
+static int32_t pool_string(tree_writer *w, char *str, size_t len) {
+    int32_t offset;
+
+    if (str == NULL)
+        return TREE_NONE;
+    offset = w->pool->currentStringLength;
+    g_string_append_len(w->pool, str, len);
+    g_string_append_c(w->pool, '\0');
+    return offset;
+}
+
+static int32_t reference(tree_writer *w, element *elt) {
+    return (elt == NULL) ? TREE_NONE : node_index(w, elt);
+}
+
+/* forward - true if 'index', referred to by the element at 'from', is
+ * TREE_NONE or comes after it */
+static bool forward(int32_t index, uint32_t from) {
+    return index == TREE_NONE || (index >= 0 && (uint32_t)index > from);
+}
+
+/* tree_save - write the document 'root', parsed with 'extensions' from the
+ * preformatted 'text', to 'out'.  Returns false, with errno set to EINVAL
+ * if the tree has a cycle, if it could not be written. */
+static bool tree_save(FILE *out, element *root, char *text, int extensions) {
+    tree_writer w;
+    tree_header header;
+    tree_node *nodes;
+    tree_link *links;
+    element *elt;
+    link *l;
+    int link_count = 0;
+    bool acyclic = true;
+    bool ok;
+    int i;
+
+    memset(&w, 0, sizeof(tree_writer));
+    w.pool = g_string_sized_new(65536);
+    number_elements(&w, root);
+
+    nodes = malloc((w.node_count ? w.node_count : 1) * sizeof(tree_node));
+    links = malloc((w.link_count ? w.link_count : 1) * sizeof(tree_link));
+    for (i = 0; i < w.node_count; i++) {
+        elt = w.nodes[w.node_count - 1 - i];
+        nodes[i].key = elt->key;
+        nodes[i].len = elt->len;
+        nodes[i].children = reference(&w, elt->children);
+        nodes[i].next = reference(&w, elt->next);
+        acyclic = acyclic && forward(nodes[i].children, i) && forward(nodes[i].next, i);
+        if (has_link(elt->key)) {
+            l = elt->contents.link;
+            links[link_count].label = reference(&w, l->label);
+            links[link_count].url = pool_string(&w, l->url, l->url ? strlen(l->url) : 0);
+            links[link_count].title = pool_string(&w, l->title, l->title ? strlen(l->title) : 0);
+            links[link_count].attr = reference(&w, l->attr);
+            links[link_count].identifier = pool_string(&w, l->identifier,
+                l->identifier ? strlen(l->identifier) : 0);
+            acyclic = acyclic && forward(links[link_count].label, i) && forward(links[link_count].attr, i);
+            nodes[i].contents = link_count++;
+        } else if (elt->key == SLICE) {
+            nodes[i].contents = pool_string(&w, elt->contents.str, elt->len);
+        } else {
+            nodes[i].contents = pool_string(&w, elt->contents.str,
+                elt->contents.str ? strlen(elt->contents.str) : 0);
+        }
+    }
+
+    memset(&header, 0, sizeof(tree_header));
+    memcpy(header.magic, TREE_MAGIC, sizeof(header.magic));
+    header.byte_order = TREE_BYTE_ORDER;
+    header.version = TREE_VERSION;
+    header.key_count = SLICE + 1;
+    header.extensions = extensions;
+    header.node_count = w.node_count;
+    header.link_count = w.link_count;
+    header.root = reference(&w, root);
+    header.text = pool_string(&w, text, strlen(text));
+    header.pool_size = w.pool->currentStringLength;
+
+    if (!acyclic)
+        errno = EINVAL;
+    ok = acyclic && fwrite(&header, sizeof(tree_header), 1, out) == 1
+        && fwrite(nodes, sizeof(tree_node), w.node_count, out) == (size_t)w.node_count
+        && fwrite(links, sizeof(tree_link), w.link_count, out) == (size_t)w.link_count
+        && fwrite(w.pool->str, 1, header.pool_size, out) == header.pool_size;
+
+    free(nodes);
+    free(links);
+    free(w.nodes);
+    free(w.slots);
+    free(w.slot_index);
+    free(w.pending);
+    g_string_free(w.pool, true);
+    return ok;
+}
+
+/* tree_contents - a tree file, as loaded */
+typedef struct {
+    element *nodes;
+    link *links;
+    element *root;
+    char *text;
+    int extensions;
+} tree_contents;
+
+/* valid_string - true if 'offset' is TREE_NONE or starts a string of the
+ * pool.  The pool is known to end with a NUL. */
+static bool valid_string(int32_t offset, uint32_t pool_size) {
+    return offset == TREE_NONE || (offset >= 0 && (uint32_t)offset < pool_size);
+}
+
+static bool valid_node(int32_t index, uint32_t node_count) {
+    return index == TREE_NONE || (index >= 0 && (uint32_t)index < node_count);
+}
+
+/* tree_load - set up 'tree' over the 'size' bytes of a tree file at
+ * 'data', which must stay in place for as long as the tree is used.
+ * Returns false if the data is not a tree file this program can read,
+ * including one whose references do not all point forward, since the
+ * writers would loop forever on a cycle. */
+static bool tree_load(char *data, size_t size, tree_contents *tree) {
+    tree_header *header = (tree_header *)data;
+    tree_node *nodes;
+    tree_link *links;
+    char *pool;
+    link *l;
+    uint32_t i;
+
+    if (size < sizeof(tree_header) || memcmp(header->magic, TREE_MAGIC, sizeof(header->magic)) != 0
+        || header->byte_order != TREE_BYTE_ORDER || header->version != TREE_VERSION
+        || header->key_count != SLICE + 1)
+        return false;
+    if (size - sizeof(tree_header) < (size_t)header->node_count * sizeof(tree_node)
+            + (size_t)header->link_count * sizeof(tree_link) + header->pool_size
+        || header->pool_size == 0)
+        return false;
+    nodes = (tree_node *)(header + 1);
+    links = (tree_link *)(nodes + header->node_count);
+    pool = (char *)(links + header->link_count);
+    if (pool[header->pool_size - 1] != '\0' || header->text < 0
+        || !valid_string(header->text, header->pool_size)
+        || !valid_node(header->root, header->node_count))
+        return false;
+
+    for (i = 0; i < header->link_count; i++)
+        if (!valid_node(links[i].label, header->node_count) || !valid_node(links[i].attr, header->node_count)
+            || !valid_string(links[i].url, header->pool_size) || !valid_string(links[i].title, header->pool_size)
+            || !valid_string(links[i].identifier, header->pool_size))
+            return false;
+    for (i = 0; i < header->node_count; i++) {
+        if (nodes[i].key < 0 || nodes[i].key > SLICE
+            || !valid_node(nodes[i].children, header->node_count) || !forward(nodes[i].children, i)
+            || !valid_node(nodes[i].next, header->node_count) || !forward(nodes[i].next, i))
+            return false;
+        if (has_link(nodes[i].key) ? (nodes[i].contents < 0 || (uint32_t)nodes[i].contents >= header->link_count
+                    || !forward(links[nodes[i].contents].label, i) || !forward(links[nodes[i].contents].attr, i))
+                : !valid_string(nodes[i].contents, header->pool_size))
+            return false;
+    }
+
+    tree->nodes = malloc((header->node_count ? header->node_count : 1) * sizeof(element));
+    tree->links = malloc((header->link_count ? header->link_count : 1) * sizeof(link));
+    for (i = 0; i < header->link_count; i++) {
+        l = &tree->links[i];
+        l->label = (links[i].label == TREE_NONE) ? NULL : &tree->nodes[links[i].label];
+        l->url = (links[i].url == TREE_NONE) ? NULL : pool + links[i].url;
+        l->title = (links[i].title == TREE_NONE) ? NULL : pool + links[i].title;
+        l->attr = (links[i].attr == TREE_NONE) ? NULL : &tree->nodes[links[i].attr];
+        l->identifier = (links[i].identifier == TREE_NONE) ? NULL : pool + links[i].identifier;
+    }
+    for (i = 0; i < header->node_count; i++) {
+        tree->nodes[i].key = nodes[i].key;
+        tree->nodes[i].len = nodes[i].len;
+        tree->nodes[i].children = (nodes[i].children == TREE_NONE) ? NULL : &tree->nodes[nodes[i].children];
+        tree->nodes[i].next = (nodes[i].next == TREE_NONE) ? NULL : &tree->nodes[nodes[i].next];
+        if (has_link(nodes[i].key))
+            tree->nodes[i].contents.link = &tree->links[nodes[i].contents];
+        else
+            tree->nodes[i].contents.str = (nodes[i].contents == TREE_NONE) ? NULL : pool + nodes[i].contents;
+    }
+
+    tree->root = (header->root == TREE_NONE) ? NULL : &tree->nodes[header->root];
+    tree->text = pool + header->text;
+    tree->extensions = header->extensions;
+    return true;
+}
@@ -46,36 +46,105 @@ static void append_list(element *new, element *list) {
     step->next = new;
 }
 
-/* concat_string_list - concatenates string contents of list of STR elements.
- * Frees STR elements as they are added to the concatenation. */
-static GString *concat_string_list(element *list) {
-    GString *result;
-    element *next;
-    result = g_string_new("");
-    while (list != NULL) {
-        assert(list->key == STR);
-        assert(list->contents.str != NULL);
-        g_string_append(result, list->contents.str);
-        next = list->next;
-        free_element(list);
-        list = next;
+/**********************************************************************
+
+  Memory arena.  Elements, links and their strings are carved out of
+  large blocks owned by the parser instead of being malloc'd one by
+  one, and a whole document is freed at once by releasing the arena.
+
+ ***********************************************************************/
+
+#define ARENA_BLOCK_SIZE  65536     /* Usable bytes in an ordinary block. */
+
+/* ARENA_ALIGN - alignment of every allocation; enough for any member of
+ * an element (pointers, ints) and for doubles. */
+#define ARENA_ALIGN  sizeof(union { void *p; long l; double d; })
+#define ARENA_ROUND(n)  (((n) + ARENA_ALIGN - 1) & ~(ARENA_ALIGN - 1))
+
+typedef struct ArenaBlock {
+    struct ArenaBlock *next;
+    size_t size;                /* Usable bytes following the header. */
+    size_t used;                /* Bytes handed out so far. */
+} arena_block;
+
+typedef struct {
+    arena_block *blocks;        /* Most recently opened block first. */
+} arena;
+
+/* arena_alloc - return 'size' bytes of uninitialized memory that live
+ * until the arena is released */
+static void *arena_alloc(arena *a, size_t size) {
+    arena_block *block = a->blocks;
+    size_t header = ARENA_ROUND(sizeof(arena_block));
+    void *result;
+
+    size = ARENA_ROUND(size);
+    if (block == NULL || block->size - block->used < size) {
+        if (size > ARENA_BLOCK_SIZE / 4) {
+            /* Large requests get a block of their own, kept behind the
+             * current block so that its free space is not wasted. */
+            block = malloc(header + size);
+            assert(block != NULL);
+            block->size = size;
+            block->used = 0;
+            if (a->blocks == NULL) {
+                block->next = NULL;
+                a->blocks = block;
+            } else {
+                block->next = a->blocks->next;
+                a->blocks->next = block;
+            }
+        } else {
+            block = malloc(header + ARENA_BLOCK_SIZE);
+            assert(block != NULL);
+            block->size = ARENA_BLOCK_SIZE;
+            block->used = 0;
+            block->next = a->blocks;
+            a->blocks = block;
+        }
     }
+    result = (char *) block + header + block->used;
+    block->used += size;
     return result;
 }
 
+/* arena_strdup - copy a NUL-terminated string into the arena */
+static char *arena_strdup(arena *a, const char *str) {
+    size_t len = strlen(str) + 1;
+    return memcpy(arena_alloc(a, len), str, len);
+}
+
 /**********************************************************************
 
-  Global variables used in parsing
+  Parser state.  Everything a parse reads or writes lives here, so
+  that independent parsers can run at the same time (e.g. on
+  different threads).  The leg context for the parser hangs off 'yy',
+  and the context points back here through its 'parser' member.
 
  ***********************************************************************/
 
-static char *charbuf = "";     /* Buffer of characters to be parsed. */
-static element *references = NULL;    /* List of link references found. */
-static element *notes = NULL;         /* List of footnotes found. */
-static element *parse_result;  /* Results of parse. */
-int syntax_extensions;  /* Syntax extensions selected. */
-
-static element *labels = NULL;      /* List of labels found in document. */
+struct mmd_parser {
+    char *charbuf;              /* Buffer of characters to be parsed. */
+    element *references;        /* List of link references found. */
+    element *notes;             /* List of footnotes found. */
+    element *labels;            /* List of labels found in document. */
+    element *parse_result;      /* Results of parse. */
+    int syntax_extensions;      /* Syntax extensions selected. */
+    int section_end;            /* Offset in charbuf from which no further
+                                   top-level block is started. */
+    int jobs;                   /* Threads to parse a document with. */
+    lookup_table reference_table;   /* Index of 'references' by label. */
+    lookup_table note_table;        /* Index of 'notes' by label. */
+    lookup_table label_table;       /* Index of 'labels'. */
+    arena elements;             /* Storage for every element parsed. */
+    struct _yycontext *yy;      /* leg parser context. */
+};
+
+/* parser_strdup - copy a string into storage that lives as long as the
+ * parser's elements */
+static char *parser_strdup(mmd_parser_t *parser, const char *str) {
+    return arena_strdup(&parser->elements, str);
+}
 
 /**********************************************************************
 
@@ -86,9 +155,10 @@ static element *labels = NULL;      /* List of labels found in document. */
  ***********************************************************************/
 
 /* mk_element - generic constructor for element */
-static element * mk_element(int key) {
-    element *result = malloc(sizeof(element));
+static element * mk_element(mmd_parser_t *parser, int key) {
+    element *result = arena_alloc(&parser->elements, sizeof(element));
     result->key = key;
+    result->len = 0;
     result->children = NULL;
     result->next = NULL;
     result->contents.str = NULL;
@@ -96,138 +166,251 @@ static element * mk_element(int key) {
 }
 
 /* mk_str - constructor for STR element */
-static element * mk_str(char *string) {
+static element * mk_str(mmd_parser_t *parser, char *string) {
     element *result;
     assert(string != NULL);
-    result = mk_element(STR);
-    result->contents.str = strdup(string);
+    result = mk_element(parser, STR);
+    result->contents.str = parser_strdup(parser, string);
     return result;
 }
 
+/* fragment_length - length of the text of a STR or SLICE fragment */
+static size_t fragment_length(element *elt) {
+    assert(elt->key == STR || elt->key == SLICE);
+    assert(elt->contents.str != NULL);
+    return elt->key == SLICE ? (size_t) elt->len : strlen(elt->contents.str);
+}
+
 /* mk_str_from_list - makes STR element by concatenating a
- * reversed list of strings, adding optional extra newline */
-static element * mk_str_from_list(element *list, bool extra_newline) {
+ * reversed list of STR and SLICE fragments, adding optional extra
+ * newline.  The text is copied once, straight into its final place. */
+static element * mk_str_from_list(mmd_parser_t *parser, element *list, bool extra_newline) {
     element *result;
-    GString *c = concat_string_list(reverse(list));
+    element *step;
+    size_t len = extra_newline ? 1 : 0;
+    size_t n;
+    char *str;
+
+    list = reverse(list);
+    for (step = list; step != NULL; step = step->next)
+        len += fragment_length(step);
+    str = arena_alloc(&parser->elements, len + 1);
+    result = mk_element(parser, STR);
+    result->contents.str = str;
+    for (step = list; step != NULL; step = step->next) {
+        n = fragment_length(step);
+        memcpy(str, step->contents.str, n);
+        str += n;
+    }
     if (extra_newline)
-        g_string_append(c, "\n");
-    result = mk_element(STR);
-    result->contents.str = c->str;
-    g_string_free(c, false);
+        *str++ = '\n';
+    *str = '\0';
     return result;
 }
 
 /* mk_list - makes new list with key 'key' and children the reverse of 'lst'.
  * This is designed to be used with cons to build lists in a parser action.
  * The reversing is necessary because cons adds to the head of a list. */
-static element * mk_list(int key, element *lst) {
+static element * mk_list(mmd_parser_t *parser, int key, element *lst) {
     element *result;
-    result = mk_element(key);
+    result = mk_element(parser, key);
     result->children = reverse(lst);
     return result;
 }
 
 /* mk_link - constructor for LINK element */
-static element * mk_link(element *label, char *url, char *title, element *attr, char *id) {
+static element * mk_link(mmd_parser_t *parser, element *label, char *url, char *title, element *attr, char *id) {
     element *result;
-    result = mk_element(LINK);
-    result->contents.link = malloc(sizeof(link));
+    result = mk_element(parser, LINK);
+    result->contents.link = arena_alloc(&parser->elements, sizeof(link));
     result->contents.link->label = label;
-    result->contents.link->url = strdup(url);
-    result->contents.link->title = strdup(title);
+    result->contents.link->url = parser_strdup(parser, url);
+    result->contents.link->title = parser_strdup(parser, title);
     result->contents.link->attr = attr;
-    result->contents.link->identifier = strdup(id);
+    result->contents.link->identifier = parser_strdup(parser, id);
     return result;
 }
 
-/* extension = returns true if extension is selected */
-static bool extension(int ext) {
-    return (syntax_extensions & ext);
+/* hash_string - FNV-1a hash of a NUL-terminated string */
+static unsigned int hash_string(const char *str) {
+    unsigned int h = 2166136261u;
+    while (*str != '\0') {
+        h ^= (unsigned char) *str++;
+        h *= 16777619u;
+    }
+    return h;
+}
+
+/* lookup_table_free - free a table's slots and keys, leaving it empty */
+static void lookup_table_free(lookup_table *table) {
+    int i;
+    for (i = 0; i < table->size; i++)
+        free(table->keys[i]);
+    free(table->keys);
+    free(table->values);
+    memset(table, 0, sizeof(lookup_table));
 }
 
-/* match_inlines - returns true if inline lists match (case-insensitive...) */
-static bool match_inlines(element *l1, element *l2) {
-    while (l1 != NULL && l2 != NULL) {
-        if (l1->key != l2->key)
-            return false;
-        switch (l1->key) {
+/* lookup_table_build - index every element of 'list' under the key made by
+ * 'key_for' (a malloc'd string, or NULL if the element cannot be looked
+ * up).  Where keys collide the earliest element in the list wins, as it
+ * would in a linear search. */
+static void lookup_table_build(lookup_table *table, element *list, char *(*key_for)(element *)) {
+    element *cur;
+    char *key;
+    int count = 0;
+    unsigned int slot;
+
+    lookup_table_free(table);
+    table->source = list;
+    for (cur = list; cur != NULL; cur = cur->next)
+        count++;
+    if (count == 0)
+        return;
+    table->size = 8;
+    while (table->size < 2 * count)
+        table->size *= 2;
+    table->keys = calloc(table->size, sizeof(char *));
+    table->values = calloc(table->size, sizeof(element *));
+
+    for (cur = list; cur != NULL; cur = cur->next) {
+        key = key_for(cur);
+        if (key == NULL)
+            continue;
+        slot = hash_string(key) & (table->size - 1);
+        while (table->keys[slot] != NULL && strcmp(table->keys[slot], key) != 0)
+            slot = (slot + 1) & (table->size - 1);
+        if (table->keys[slot] == NULL) {
+            table->keys[slot] = key;
+            table->values[slot] = cur;
+            table->count++;
+        } else {
+            free(key);
+        }
+    }
+}
+
+/* lookup_table_find - return the element indexed under 'key', or NULL */
+static element *lookup_table_find(const lookup_table *table, const char *key) {
+    unsigned int slot;
+    if (table->size == 0)
+        return NULL;
+    slot = hash_string(key) & (table->size - 1);
+    while (table->keys[slot] != NULL) {
+        if (strcmp(table->keys[slot], key) == 0)
+            return table->values[slot];
+        slot = (slot + 1) & (table->size - 1);
+    }
+    return NULL;
+}
+
+/* inline_key - append to 'out' a key for an inline list, such that two
+ * lists get the same key exactly when they match as link labels: the
+ * same sequence of elements, with strings compared case-insensitively and
+ * spaces, dashes and the like compared by kind only.  Returns false if
+ * the list cannot match any label (it contains a link or image, or an
+ * element that has no business in a label). */
+static bool inline_key(GString *out, element *list) {
+    char *str;
+    while (list != NULL) {
+        switch (list->key) {
         case SPACE:
         case LINEBREAK:
         case ELLIPSIS:
         case EMDASH:
         case ENDASH:
         case APOSTROPHE:
+            g_string_append_int(out, list->key);
+            g_string_append_c(out, ';');
             break;
         case CODE:
         case STR:
         case HTML:
-            if (strcasecmp(l1->contents.str, l2->contents.str) == 0)
-                break;
-            else
-                return false;
+            g_string_append_int(out, list->key);
+            g_string_append_c(out, ':');
+            g_string_append_int(out, (int) strlen(list->contents.str));
+            g_string_append_c(out, ':');
+            for (str = list->contents.str; *str != '\0'; str++)
+                g_string_append_c(out, tolower(*str));
+            break;
         case EMPH:
         case STRONG:
         case LIST:
         case SINGLEQUOTED:
         case DOUBLEQUOTED:
-            if (match_inlines(l1->children, l2->children))
-                break;
-            else
+            g_string_append_int(out, list->key);
+            g_string_append_c(out, '(');
+            if (!inline_key(out, list->children))
                 return false;
-        case LINK:
-        case IMAGE:
-            return false;  /* No links or images within links */
-        default:
-            fprintf(stderr, "match_inlines encountered unknown key = %d\n", l1->key);
-            exit(EXIT_FAILURE);
+            g_string_append_c(out, ')');
             break;
+        default:
+            return false;  /* No links or images within links */
         }
-        l1 = l1->next;
-        l2 = l2->next;
+        list = list->next;
     }
-    return (l1 == NULL && l2 == NULL);  /* return true if both lists exhausted */
+    return true;
+}
+
+/* reference_key - lookup key for a REFERENCE element */
+static char *reference_key(element *ref) {
+    GString *key = g_string_new("");
+    if (!inline_key(key, ref->contents.link->label)) {
+        g_string_free(key, true);
+        return NULL;
+    }
+    return g_string_free(key, false);
+}
+
+/* string_key - lookup key for an element named by its string contents
+ * (notes, glossary entries and labels) */
+static char *string_key(element *elt) {
+    return strdup(elt->contents.str);
 }
 
 /* find_reference - return true if link found in references matching label.
  * 'link' is modified with the matching url and title. */
-static bool find_reference(link *result, element *label) {
-    element *cur = references;  /* pointer to walk up list of references */
-    link *curitem;
-    while (cur != NULL) {
-        curitem = cur->contents.link;
-        if (match_inlines(label, curitem->label)) {
-            *result = *curitem;
-            return true;
-        }
-        else
-            cur = cur->next;
+static bool find_reference(mmd_parser_t *parser, link *result, element *label) {
+    element *match;
+    GString *key = g_string_new("");
+
+    if (parser->reference_table.source != parser->references)
+        lookup_table_build(&parser->reference_table, parser->references, reference_key);
+    if (!inline_key(key, label)) {
+        g_string_free(key, true);
+        return false;
     }
-    return false;
+    match = lookup_table_find(&parser->reference_table, key->str);
+    g_string_free(key, true);
+    if (match == NULL)
+        return false;
+    *result = *match->contents.link;
+    return true;
 }
 
 /* find_note - return true if note found in notes matching label.
 if found, 'result' is set to point to matched note. */
 
-static bool find_note(element **result, char *label) {
-   element *cur = notes;  /* pointer to walk up list of notes */
-   while (cur != NULL) {
-       if (strcmp(label, cur->contents.str) == 0) {
-           *result = cur;
-           return true;
-       }
-       else
-           cur = cur->next;
-   }
-   return false;
-}
-
+static bool find_note(mmd_parser_t *parser, element **result, char *label) {
+    element *match;
 
+    if (parser->note_table.source != parser->notes)
+        lookup_table_build(&parser->note_table, parser->notes, string_key);
+    match = lookup_table_find(&parser->note_table, label);
+    if (match == NULL)
+        return false;
+    *result = match;
+    return true;
+}
 
 /**********************************************************************
 
   Definitions for leg parser generator.
-  YY_INPUT is the function the parser calls to get new input.
-  We take all new input from (static) charbuf.
+  Each parser owns its own leg context (YY_CTX_LOCAL), which carries
+  a pointer back to the mmd_parser; rules and actions reach it as
+  yy->parser.  The parser matches directly against the parser's
+  charbuf, which must be NUL-terminated and is never copied or
+  modified; positions are offsets from its start.
 
  ***********************************************************************/
 
@@ -236,16 +419,13 @@ static bool find_note(element **result, char *label) {
 # define YY_DEBUG 1
 #endif
 
-#define YY_INPUT(buf, result, max_size)              \
-{                                                    \
-    int yyc;                                         \
-    if (charbuf && *charbuf != '\0') {               \
-        yyc= *charbuf++;                             \
-    } else {                                         \
-        yyc= EOF;                                    \
-    }                                                \
-    result= (EOF == yyc) ? 0 : (*(buf)= yyc, 1);     \
-}
+#define YY_CTX_LOCAL
+#define YY_CTX_MEMBERS  mmd_parser_t *parser;
+#define YY_BUFFER yyctx->parser->charbuf
+
+/* mk_match - SLICE of the text matched by the current action (yytext),
+ * taken from the input buffer in place of a copy */
+#define mk_match()  mk_slice(yy->parser, yy->parser->charbuf + yytextpos, yyleng)
 
 
 /* peg-multimarkdown additions */
@@ -256,7 +436,7 @@ static void print_raw_element(GString *out, element *elt) {
         print_raw_element_list(out,elt->contents.link->label);
     } else {
         if (elt->contents.str != NULL) {
-            g_string_append_printf(out, "%s", elt->contents.str);
+            g_string_append(out, elt->contents.str);
         } else {
             print_raw_element_list(out, elt->children);
         }
@@ -321,207 +501,93 @@ static char *label_from_string(char *str, bool obfuscate) {
 
 /* find_label - return true if header, table, etc is found matching label.
  * 'link' is modified with the matching url and title. */
-static bool find_label(link *result, element *label) {
+static bool find_label(mmd_parser_t *parser, link *result, element *label) {
     char *lab;
-    element *cur = labels;  /* pointer to walk up list of references */
+    element *match;
     GString *text = g_string_new("");
+
+    if (parser->label_table.source != parser->labels)
+        lookup_table_build(&parser->label_table, parser->labels, string_key);
     print_raw_element_list(text, label);
     lab = label_from_string(text->str,0);
-    GString *query = g_string_new(lab);
+    match = lookup_table_find(&parser->label_table, lab);
     free(lab);
     g_string_free(text, true);
-
-    while (cur != NULL) {
-        if (strcmp(query->str,cur->contents.str) == 0) {
-            g_string_free(query, true);
-            return true;
-        }
-        else
-           cur = cur->next;
-    }
-    g_string_free(query, true);
-    return false;
+    return (match != NULL);
 }
 
 
-/* localize_typography - return the proper string, based on language chosen */
-/* Default action is English */
+/* typography - what each smart typography element prints as, by output
+ * format, language and element.  The order follows enum smartoutput,
+ * enum language and enum smartelements. */
+#define T(s) { s, sizeof(s) - 1 }
+static const struct {
+    char *str;
+    size_t len;
+} typography[4][6][8] = {
+    {   /* HTMLOUT */
+        { T("&#8216;"), T("&#8217;"), T("&#8222;"), T("&#8221;"),   /* DUTCH */
+          T("&#8211;"), T("&#8212;"), T("&#8230;"), T("&#8217;") },
+        { T("&#8216;"), T("&#8217;"), T("&#8220;"), T("&#8221;"),   /* ENGLISH */
+          T("&#8211;"), T("&#8212;"), T("&#8230;"), T("&#8217;") },
+        { T("&#39;"), T("&#8217;"), T("&#171;"), T("&#187;"),   /* FRENCH */
+          T("&#8211;"), T("&#8212;"), T("&#8230;"), T("&#8217;") },
+        { T("&#8218;"), T("&#8216;"), T("&#8222;"), T("&#8220;"),   /* GERMAN */
+          T("&#8211;"), T("&#8212;"), T("&#8230;"), T("&#8217;") },
+        { T("&#8217;"), T("&#8217;"), T("&#8221;"), T("&#8221;"),   /* SWEDISH */
+          T("&#8211;"), T("&#8212;"), T("&#8230;"), T("&#8217;") },
+        { T("&#8250;"), T("&#8249;"), T("&#187;"), T("&#171;"),   /* GERMANGUILL */
+          T("&#8211;"), T("&#8212;"), T("&#8230;"), T("&#8217;") }
+    },
+    {   /* LATEXOUT */
+        { T("`"), T("'"), T("„"), T("''"),   /* DUTCH */
+          T("--"), T("---"), T("{\\ldots}"), T("'") },
+        { T("`"), T("'"), T("``"), T("''"),   /* ENGLISH */
+          T("--"), T("---"), T("{\\ldots}"), T("'") },
+        { T("'"), T("'"), T("«"), T("»"),   /* FRENCH */
+          T("--"), T("---"), T("{\\ldots}"), T("'") },
+        { T("‚"), T("`"), T("„"), T("``"),   /* GERMAN */
+          T("--"), T("---"), T("{\\ldots}"), T("'") },
+        { T("'"), T("'"), T("''"), T("''"),   /* SWEDISH */
+          T("--"), T("---"), T("{\\ldots}"), T("'") },
+        { T("›"), T("‹"), T("»"), T("«"),   /* GERMANGUILL */
+          T("--"), T("---"), T("{\\ldots}"), T("'") }
+    },
+    {   /* ODFOUT */
+        { T("&#8216;"), T("&#8217;"), T("&#8222;"), T("&#8221;"),   /* DUTCH */
+          T("&#8211;"), T("&#8212;"), T("&#8230;"), T("&#8217;") },
+        { T("&#8216;"), T("&#8217;"), T("&#8220;"), T("&#8221;"),   /* ENGLISH */
+          T("&#8211;"), T("&#8212;"), T("&#8230;"), T("&#8217;") },
+        { T("&#39;"), T("&#8217;"), T("&#171;"), T("&#187;"),   /* FRENCH */
+          T("&#8211;"), T("&#8212;"), T("&#8230;"), T("&#8217;") },
+        { T("&#8218;"), T("&#8216;"), T("&#8222;"), T("&#8220;"),   /* GERMAN */
+          T("&#8211;"), T("&#8212;"), T("&#8230;"), T("&#8217;") },
+        { T("&#8217;"), T("&#8217;"), T("&#8221;"), T("&#8221;"),   /* SWEDISH */
+          T("&#8211;"), T("&#8212;"), T("&#8230;"), T("&#8217;") },
+        { T("&#8250;"), T("&#8249;"), T("&#187;"), T("&#171;"),   /* GERMANGUILL */
+          T("&#8211;"), T("&#8212;"), T("&#8230;"), T("&#8217;") }
+    },
+    {   /* GROFFOUT */
+        { T("`"), T("'"), T("\\[lq]"), T("\\[rq]"),   /* DUTCH */
+          T("\\[en]"), T("\\[em]"), T("..."), T("'") },
+        { T("`"), T("'"), T("\\[lq]"), T("\\[rq]"),   /* ENGLISH */
+          T("\\[en]"), T("\\[em]"), T("..."), T("'") },
+        { T("`"), T("'"), T("\\[lq]"), T("\\[rq]"),   /* FRENCH */
+          T("\\[en]"), T("\\[em]"), T("..."), T("'") },
+        { T("`"), T("'"), T("\\[lq]"), T("\\[rq]"),   /* GERMAN */
+          T("\\[en]"), T("\\[em]"), T("..."), T("'") },
+        { T("`"), T("'"), T("\\[lq]"), T("\\[rq]"),   /* SWEDISH */
+          T("\\[en]"), T("\\[em]"), T("..."), T("'") },
+        { T("`"), T("'"), T("\\[lq]"), T("\\[rq]"),   /* GERMANGUILL */
+          T("\\[en]"), T("\\[em]"), T("..."), T("'") }
+    }
+};
+#undef T
 
+/* localize_typography - print the proper string, based on language chosen */
 static void localize_typography(GString *out, int character, int lang, int output) {
-
-    switch (output) {
-        case HTMLOUT:
-            switch (character) {
-                case LSQUOTE:
-                    switch (lang) {
-                        case SWEDISH:
-                            g_string_append_printf(out, "&#8217;");
-                            break;
-                        case FRENCH:
-                            g_string_append_printf(out,"&#39;");
-                            break;
-                        case GERMAN:
-                            g_string_append_printf(out,"&#8218;");
-                            break;
-                        case GERMANGUILL:
-                            g_string_append_printf(out,"&#8250;");
-                            break;
-                        default:
-                            g_string_append_printf(out,"&#8216;");
-                        }
-                    break;
-                case RSQUOTE:
-                    switch (lang) {
-                        case GERMAN:
-                            g_string_append_printf(out,"&#8216;");
-                            break;
-                        case GERMANGUILL:
-                            g_string_append_printf(out,"&#8249;");
-                            break;
-                        default:
-                            g_string_append_printf(out,"&#8217;");
-                        }
-                    break;
-                case APOS:
-                    g_string_append_printf(out,"&#8217;");
-                    break;
-                case LDQUOTE:
-                    switch (lang) {
-                        case DUTCH:
-                        case GERMAN:
-                            g_string_append_printf(out,"&#8222;");
-                            break;
-                        case GERMANGUILL:
-                            g_string_append_printf(out,"&#187;");
-                            break;
-                        case FRENCH:
-                            g_string_append_printf(out,"&#171;");
-                            break;
-                        case SWEDISH:
-                            g_string_append_printf(out, "&#8221;");
-                            break;
-                        default:
-                            g_string_append_printf(out,"&#8220;");
-                        }
-                    break;
-                case RDQUOTE:
-                    switch (lang) {
-                        case SWEDISH:
-                        case DUTCH:
-                            g_string_append_printf(out,"&#8221;");
-                            break;
-                        case GERMAN:
-                            g_string_append_printf(out,"&#8220;");
-                            break;
-                        case GERMANGUILL:
-                            g_string_append_printf(out,"&#171;");
-                            break;
-                        case FRENCH:
-                            g_string_append_printf(out,"&#187;");
-                            break;
-                        default:
-                            g_string_append_printf(out,"&#8221;");
-                        }
-                    break;
-                case NDASH:
-                    g_string_append_printf(out,"&#8211;");
-                    break;
-                case MDASH:
-                    g_string_append_printf(out,"&#8212;");
-                    break;
-                case ELLIP:
-                    g_string_append_printf(out,"&#8230;");
-                    break;
-                    default:;
-            }
-            break;
-        case LATEXOUT:
-            switch (character) {
-                case LSQUOTE:
-                    switch (lang) {
-                        case SWEDISH:
-                            g_string_append_printf(out,"'");
-                            break;
-                        case FRENCH:
-                            g_string_append_printf(out,"'");
-                            break;
-                        case GERMAN:
-                            g_string_append_printf(out,"‚");
-                            break;
-                        case GERMANGUILL:
-                            g_string_append_printf(out,"›");
-                            break;
-                        default:
-                            g_string_append_printf(out,"`");
-                    }
-                    break;
-                case RSQUOTE:
-                    switch (lang) {
-                        case GERMAN:
-                            g_string_append_printf(out,"`");
-                            break;
-                        case GERMANGUILL:
-                            g_string_append_printf(out,"‹");
-                            break;
-                        default:
-                            g_string_append_printf(out,"'");
-                    }
-                    break;
-                case APOS:
-                    g_string_append_printf(out,"'");
-                    break;
-                case LDQUOTE:
-                    switch (lang) {
-                        case DUTCH:
-                        case GERMAN:
-                            g_string_append_printf(out,"„");
-                            break;
-                        case GERMANGUILL:
-                            g_string_append_printf(out,"»");
-                            break;
-                        case FRENCH:
-                            g_string_append_printf(out,"«");
-                            break;
-                        case SWEDISH:
-                            g_string_append_printf(out,"''");
-                            break;
-                        default:
-                            g_string_append_printf(out,"``");
-                        }
-                    break;
-                case RDQUOTE:
-                    switch (lang) {
-                        case SWEDISH:
-                        case DUTCH:
-                            g_string_append_printf(out,"''");
-                            break;
-                        case GERMAN:
-                            g_string_append_printf(out,"``");
-                            break;
-                        case GERMANGUILL:
-                            g_string_append_printf(out,"«");
-                            break;
-                        case FRENCH:
-                            g_string_append_printf(out,"»");
-                            break;
-                        default:
-                            g_string_append_printf(out,"''");
-                        }
-                    break;
-                case NDASH:
-                    g_string_append_printf(out,"--");
-                    break;
-                case MDASH:
-                    g_string_append_printf(out,"---");
-                    break;
-                case ELLIP:
-                    g_string_append_printf(out,"{\\ldots}");
-                    break;
-                    default:;
-            }
-            break;
-        default:;
-    }
+    g_string_append_len(out, typography[output][lang][character].str,
+        typography[output][lang][character].len);
 }
 
 /* Trim spaces at end of string */